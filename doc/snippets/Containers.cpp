@@ -32,23 +32,34 @@
 #endif
 
 #include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/ArrayArena.h"
 #include "Corrade/Containers/ArrayTuple.h"
 #include "Corrade/Containers/BigEnumSet.hpp"
+#include "Corrade/Containers/BitArray.h"
 #include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/Containers/HashMap.h"
 #include "Corrade/Containers/EnumSet.hpp"
+#include "Corrade/Containers/FreeList.h"
 #include "Corrade/Containers/LinkedList.h"
+#include "Corrade/Containers/MpmcQueue.h"
+#include "Corrade/Containers/ObjectPool.h"
 #include "Corrade/Containers/Optional.h"
 #include "Corrade/Containers/Pair.h"
 #include "Corrade/Containers/Pointer.h"
 #include "Corrade/Containers/Reference.h"
 #include "Corrade/Containers/ScopeGuard.h"
+#include "Corrade/Containers/SmallArray.h"
+#include "Corrade/Containers/SpscQueue.h"
 #include "Corrade/Containers/StaticArray.h"
 #include "Corrade/Containers/StridedArrayView.h"
+#include "Corrade/Containers/StridedBitArrayView.h"
 #include "Corrade/Containers/String.h"
 #include "Corrade/Containers/StringView.h"
 #include "Corrade/Containers/Triple.h"
 #include "Corrade/Utility/Debug.h"
 #include "Corrade/Utility/Directory.h"
+#include "Corrade/Utility/Format.h"
+#include "Corrade/Utility/FormatGrowable.h"
 
 using namespace Corrade;
 
@@ -551,6 +562,37 @@ for(std::size_t i = 0; i != strings.size(); ++i)
 /* [ArrayTuple-usage-nontrivial] */
 }
 
+{
+/* [ArrayTuple-usage-alignment] */
+Containers::ArrayView<std::uint32_t> counters;
+Containers::ArrayView<float> pixels;
+Containers::ArrayTuple data{
+    {4, counters, 64},          /* each counter updated from a different thread */
+    {NoInit, 1024*1024, pixels, 4096}
+};
+/* [ArrayTuple-usage-alignment] */
+}
+
+{
+std::size_t vertexCount{}, indexCount{};
+/* [ArrayTuple-usage-recreate] */
+Containers::ArrayView<float> positions;
+Containers::ArrayView<std::uint32_t> indices;
+Containers::ArrayTuple data{
+    {NoInit, vertexCount*3, positions},
+    {NoInit, indexCount, indices}
+};
+
+// Remove some vertices and indices...
+
+/* Reuses the existing allocation because the new layout is smaller */
+data.recreate({
+    {NoInit, vertexCount*3 - 30, positions},
+    {NoInit, indexCount - 36, indices}
+});
+/* [ArrayTuple-usage-recreate] */
+}
+
 #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
 {
 /* [ArrayTuple-usage-mmap] */
@@ -663,6 +705,21 @@ Utility::Debug{} << Features{};
 /* [bigEnumSetDebugOutput-usage] */
 }
 
+{
+typedef Big3::Feature Feature;
+typedef Big3::Features Features;
+void render(Feature);
+/* [BigEnumSet-iteration] */
+Features features = Feature::Fast|Feature::Popular;
+
+/* Calls render(Feature::Fast) and then render(Feature::Popular) */
+for(Feature feature: features)
+    render(feature);
+
+Utility::Debug{} << features.count() << "features enabled"; // prints 2
+/* [BigEnumSet-iteration] */
+}
+
 {
 /* [LinkedList-usage] */
 class Object: public Containers::LinkedListItem<Object> {
@@ -1138,6 +1195,18 @@ Containers::String a = ", "_s.join({"hello", "world"});
 /* [StringView-join] */
 }
 
+{
+Containers::StringView data;
+/* [StringView-splitter] */
+for(Containers::StringView line: data.splitter('\n')) {
+    for(Containers::StringView word: line.splitterOnWhitespaceWithoutEmptyParts()) {
+        // ...
+        static_cast<void>(word);
+    }
+}
+/* [StringView-splitter] */
+}
+
 {
 using namespace Containers::Literals;
 /* [String-usage-literal-null] */
@@ -1148,4 +1217,201 @@ static_cast<void>(a);
 static_cast<void>(b);
 }
 
+{
+Containers::ArrayView<const Containers::StringView> names;
+/* [String-usage-building] */
+Containers::Array<char> out;
+for(Containers::StringView name: names)
+    Utility::formatInto(out, out.size(), "{}{}", out.empty() ? "" : ", ", name);
+
+arrayAppend(out, '\0');
+Containers::String string{std::move(out)}; // out is empty now, no copy made
+/* [String-usage-building] */
+static_cast<void>(string);
+}
+
+{
+bool running = false;
+struct Object { int id; bool visible; };
+Containers::ArrayView<const Object> objects;
+auto draw = [](Containers::ArrayView<const int>) {};
+/* [ArrayArena-usage] */
+Containers::Array<char> scratch{NoInit, 1024*1024};
+while(running) {
+    Containers::ArrayArena arena{scratch};
+
+    Containers::Array<int> visible;
+    for(const Object& object: objects)
+        if(object.visible)
+            Containers::arrayAppend<Containers::ArrayArenaAllocator>(visible, object.id);
+
+    draw(visible);
+
+    // arena memory gets reused in the next iteration
+}
+/* [ArrayArena-usage] */
+}
+
+{
+struct Job { int id; };
+auto process = [](const Job&) {};
+/* [SpscQueue-usage] */
+Containers::SpscQueue<Job> queue{256};
+
+/* Producer thread */
+if(!queue.push(Job{42})) {
+    // queue is full, retry later
+}
+
+/* Consumer thread */
+Job job;
+while(queue.pop(job))
+    process(job);
+/* [SpscQueue-usage] */
+}
+
+{
+struct Job { int id; };
+auto process = [](const Job&) {};
+/* [MpmcQueue-usage] */
+Containers::MpmcQueue<Job> queue{256};
+
+/* Any number of producer threads */
+queue.push(Corrade::InPlaceInit, 42);
+
+/* Any number of consumer threads */
+Job job;
+while(queue.pop(job))
+    process(job);
+/* [MpmcQueue-usage] */
+}
+
+{
+/* [FreeList-usage] */
+struct Buffer: Containers::FreeListItem<Buffer> {
+    char data[65536];
+};
+
+/* A fixed set of buffers, all of them available initially */
+Containers::Array<Buffer> buffers{16};
+Containers::FreeList<Buffer> available{buffers};
+
+/* Any worker thread */
+if(Containers::FreeListPointer<Buffer> buffer = available.acquire()) {
+    // fill buffer->data, the buffer gets returned at the end of the scope
+}
+/* [FreeList-usage] */
+}
+
+{
+struct Transformation {
+    explicit Transformation(float, float) {}
+};
+/* [ObjectPool-usage] */
+Containers::ObjectPool<Transformation> pool;
+
+/* Any thread */
+Containers::PoolPointer<Transformation> a = pool.pointer(1.0f, 0.5f);
+
+/* Any thread again, the memory is reused by the next allocation */
+a = nullptr;
+/* [ObjectPool-usage] */
+}
+
+{
+struct Mesh {};
+auto loadMesh = [](int) { return Mesh{}; };
+/* [HashMap-usage] */
+Containers::HashMap<int, Mesh> meshes;
+meshes.insert(42, loadMesh(42));
+
+if(Mesh* mesh = meshes.find(42)) {
+    // use the mesh
+    static_cast<void>(mesh);
+}
+
+meshes.remove(42);
+/* [HashMap-usage] */
+}
+
+{
+Containers::StringView line;
+/* [HashMap-usage-strings] */
+Containers::HashMap<Containers::String, int> counts;
+for(Containers::StringView word: line.splitOnWhitespaceWithoutEmptyParts())
+    ++counts[word]; // a String gets allocated only for new words
+
+const int* theCount = counts.find("the"); // no allocation here
+/* [HashMap-usage-strings] */
+static_cast<void>(theCount);
+}
+
+{
+Containers::HashMap<Containers::String, int> counts;
+/* [HashMap-iteration] */
+for(auto&& item: counts) {
+    Utility::Debug{} << item.key() << item.value();
+    item.value() = 0; // the value can be modified, the key not
+}
+/* [HashMap-iteration] */
+}
+
+{
+/* [SmallArray-usage] */
+Containers::SmallArray<8, int> indices;
+arrayAppend(indices, {1, 2, 3}); // stays inline, no allocation
+
+for(int i = 4; i != 16; ++i)
+    arrayAppend(indices, i); // spills to the heap past 8 items
+
+Containers::ArrayView<int> view = indices;
+/* [SmallArray-usage] */
+static_cast<void>(view);
+}
+
+{
+struct Sphere {
+    bool isVisibleFrom(int) const { return true; }
+};
+Containers::ArrayView<Sphere> spheres;
+int camera{};
+/* [BitArray-usage] */
+/* One bit per object instead of a byte in an Array<bool> */
+Containers::BitArray visible{Corrade::ValueInit, spheres.size()};
+for(std::size_t i = 0; i != spheres.size(); ++i)
+    if(spheres[i].isVisibleFrom(camera)) visible.set(i);
+
+Containers::BitArray selected{Corrade::DirectInit, spheres.size(), true};
+selected.andWith(visible);
+Utility::Debug{} << selected.count() << "objects selected and visible";
+/* [BitArray-usage] */
+}
+
+{
+char data[4]{};
+/* [BitArrayView-usage] */
+/* 20 bits starting at bit 3 of the first byte */
+Containers::MutableBitArrayView view{data, 3, 20};
+view.slice(5, 12).setAll();
+
+if(Containers::Optional<std::size_t> first = view.findFirstSet())
+    Utility::Debug{} << "First set bit at" << *first; // prints 5
+/* [BitArrayView-usage] */
+}
+
+{
+struct Flags {
+    std::uint32_t id;
+    std::uint8_t flags;
+};
+Flags items[16]{};
+/* [StridedBitArrayView-usage] */
+/* Bit 2 of the flags byte in every item */
+Containers::MutableStridedBitArrayView hidden{&items[0].flags, 2,
+    Containers::arraySize(items), sizeof(Flags)*8};
+hidden.set(3);
+Utility::Debug{} << hidden.count() << "hidden items";
+/* [StridedBitArrayView-usage] */
+}
+
 }
@@ -36,6 +36,9 @@
 #include "Corrade/Containers/StridedArrayView.h"
 #include "Corrade/Utility/Algorithms.h"
 #include "Corrade/Utility/Arguments.h"
+#if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+#include "Corrade/Utility/ArrayVirtualAllocator.h"
+#endif
 #include "Corrade/Utility/Assert.h"
 #include "Corrade/Utility/Configuration.h"
 #include "Corrade/Utility/DebugStl.h"
@@ -45,11 +48,14 @@
 #include "Corrade/Utility/FileWatcher.h"
 #endif
 #include "Corrade/Utility/Format.h"
+#include "Corrade/Utility/FormatGrowable.h"
 #include "Corrade/Utility/FormatStl.h"
 #include "Corrade/Utility/Macros.h"
 #include "Corrade/Utility/Memory.h"
+#include "Corrade/Utility/MurmurHash2.h"
 #include "Corrade/Utility/Sha1.h"
 #include "Corrade/Utility/StlMath.h"
+#include "Corrade/Utility/XxHash3.h"
 
 /* [Tweakable-disable-header] */
 #define CORRADE_TWEAKABLE
@@ -403,6 +409,62 @@ for(Foo& f: data) new(&f) Foo{index++};
 /* [allocateAligned-NoInit] */
 }
 
+#if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+{
+struct Event { int a; };
+Event event{};
+/* [ArrayVirtualAllocator] */
+Containers::Array<Event> log;
+
+/* Reserves 1 GB of address space on the first append, the data never move
+   until that's exhausted */
+Containers::arrayAppend<Utility::ArrayVirtualAllocator>(log, event);
+const Event& first = log.front();
+
+for(std::size_t i = 0; i != 1000000; ++i)
+    Containers::arrayAppend<Utility::ArrayVirtualAllocator>(log, event);
+
+CORRADE_INTERNAL_ASSERT(&first == &log.front()); /* still valid */
+/* [ArrayVirtualAllocator] */
+}
+
+{
+struct Event { int a; };
+Event event{};
+/* [reserveVirtual] */
+/* Reserve address space for 256 million events, only the first page is
+   committed at this point */
+Containers::Array<Event> log = Utility::reserveVirtual<Event>(256*1024*1024);
+
+Containers::arrayAppend<Utility::ArrayVirtualAllocator>(log, event);
+/* [reserveVirtual] */
+}
+
+{
+struct Socket {
+    std::size_t receive(Containers::ArrayView<char>) { return {}; }
+} socket;
+auto parse = [](Containers::ArrayView<const char>) -> std::size_t { return {}; };
+/* [MagicRingBuffer-usage] */
+Utility::MagicRingBuffer buffer{64*1024};
+
+/* Producer, fills as much as there's space for */
+buffer.produce(socket.receive(buffer.writeView()));
+
+/* Consumer, always sees the data contiguous, even across the wrap point */
+buffer.consume(parse(buffer.readView()));
+/* [MagicRingBuffer-usage] */
+}
+
+{
+Utility::MagicRingBuffer buffer{64*1024};
+/* [MagicRingBuffer-file] */
+Utility::Directory::append("log.txt", buffer.readView());
+buffer.consume(buffer.size());
+/* [MagicRingBuffer-file] */
+}
+#endif
+
 {
 /* [Configuration-usage] */
 Utility::Configuration conf{"my.conf"};
@@ -708,6 +770,14 @@ for(std::size_t i = 0; i < positions.size(); i += 3)
 /* [formatInto-string] */
 }
 
+{
+/* [formatInto-growable] */
+Containers::Array<char> out;
+for(std::size_t i = 0; i != 1000; ++i)
+    Utility::formatInto(out, out.size(), "{}{:.4}", i ? ", " : "", i*0.125f);
+/* [formatInto-growable] */
+}
+
 {
 /* [formatInto-stdout] */
 Utility::formatInto(stdout, "Hello, {}!", "world");
@@ -857,6 +927,32 @@ struct {
 };
 }
 
+{
+/* [MurmurHash2A-incremental] */
+Utility::MurmurHash2A hasher;
+hasher << std::string{"corrade"};
+
+const char data[4] = { '\x35', '\xf6', '\x00', '\xab' };
+hasher << Containers::arrayView(data);
+
+Utility::Debug{} << hasher.digest().hexString();
+/* [MurmurHash2A-incremental] */
+}
+
+{
+std::string key;
+/* [MurmurHash2-constexpr] */
+switch(Utility::MurmurHash2{}.hash(key.data(), key.size())) {
+    case Utility::MurmurHash2{}.hash("width"):
+        // ...
+        break;
+    case Utility::MurmurHash2{}.hash("height"):
+        // ...
+        break;
+}
+/* [MurmurHash2-constexpr] */
+}
+
 {
 /* [Sha1-usage] */
 Utility::Sha1 sha1;
@@ -875,6 +971,38 @@ Utility::Debug{} << sha1.digest().hexString();
 Utility::Debug{} << Utility::Sha1::digest("corrade");
 /* [Sha1-usage] */
 }
+
+{
+Containers::ArrayView<const Containers::Array<char>> blobs;
+/* [Sha1-usage-batch] */
+/* Views on the data to hash, such as file contents */
+Containers::Array<Containers::ArrayView<const char>> data{blobs.size()};
+for(std::size_t i = 0; i != blobs.size(); ++i)
+    data[i] = blobs[i];
+
+/* All digests calculated in a single call */
+Containers::Array<Utility::Sha1::Digest> digests = Utility::Sha1::digest(data);
+/* [Sha1-usage-batch] */
+}
+
+{
+/* [XxHash3-usage] */
+Utility::XxHash3 hasher;
+
+/* Add 7 bytes of string data */
+hasher << std::string{"corrade"};
+
+/* Add four bytes of binary data */
+const char data[4] = { '\x35', '\xf6', '\x00', '\xab' };
+hasher << Containers::arrayView(data);
+
+/* Print the digest as a hex string */
+Utility::Debug{} << hasher.digest().hexString();
+
+/* Shorthand variant, treating the argument as a string */
+Utility::Debug{} << Utility::XxHash3::digest("corrade");
+/* [XxHash3-usage] */
+}
 }
 
 typedef std::pair<int, int> T;
@@ -104,6 +104,8 @@
 #   XCTest
 #  CORRADE_UTILITY_USE_ANSI_COLORS - Defined if ANSI escape sequences are used
 #   for colored output with Utility::Debug on Windows
+#  CORRADE_UTILITY_USE_THREADS  - Defined if parallel Utility algorithms use
+#   multiple threads
 #
 # Additionally these variables are defined for internal usage:
 #
@@ -331,7 +333,8 @@ set(_corradeFlags
     # as the compiler can be different when compiling the lib & when using it.
     PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
     TESTSUITE_TARGET_XCTEST
-    UTILITY_USE_ANSI_COLORS)
+    UTILITY_USE_ANSI_COLORS
+    UTILITY_USE_THREADS)
 foreach(_corradeFlag ${_corradeFlags})
     list(FIND _corradeConfigure "#define CORRADE_${_corradeFlag}" _corrade_${_corradeFlag})
     if(NOT _corrade_${_corradeFlag} EQUAL -1)
@@ -539,6 +542,13 @@ foreach(_component ${Corrade_FIND_COMPONENTS})
                 set_property(TARGET Corrade::${_component} APPEND PROPERTY
                     INTERFACE_LINK_LIBRARIES "log")
             endif()
+            # copyParallel(), flipInPlaceParallel() and
+            # Directory::hashFileChunked() need this
+            if(CORRADE_UTILITY_USE_THREADS)
+                find_package(Threads REQUIRED)
+                set_property(TARGET Corrade::${_component} APPEND PROPERTY
+                    INTERFACE_LINK_LIBRARIES Threads::Threads)
+            endif()
         endif()
 
         # Find library includes
@@ -10,6 +10,7 @@ cmake .. \
     -DBUILD_TESTS=ON \
     -DBUILD_DEPRECATED=$BUILD_DEPRECATED \
     -DBUILD_STATIC=$BUILD_STATIC \
+    -DUTILITY_USE_THREADS=$UTILITY_USE_THREADS \
     -DCMAKE_BUILD_TYPE=$CONFIGURATION \
     -G Ninja
 ninja
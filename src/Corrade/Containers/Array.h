@@ -215,6 +215,12 @@ memory copies when growing the array. The typeless nature of
 instance with @ref arrayAllocatorCast(), an operation not easily doable using
 typed allocators.
 
+For short-lived scratch arrays, the @ref ArrayArenaAllocator allocates from a
+user-provided @ref ArrayArena, growing arrays in-place where possible and
+freeing everything at once at the end. For huge append-only arrays, the
+@ref Utility::ArrayVirtualAllocator reserves virtual memory upfront and grows
+in-place without ever copying the contents.
+
 @subsection Containers-Array-growable-sanitizer AddressSanitizer container annotations
 
 Because the alloacted growable arrays have an area between @ref size() and
@@ -0,0 +1,95 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ArrayArena.h"
+
+#include "Corrade/Utility/Assert.h"
+#include "Corrade/Utility/Debug.h"
+#include "Corrade/Utility/Macros.h"
+
+namespace Corrade { namespace Containers {
+
+namespace {
+
+/* Allocations remember the arena they came from, so the current arena is
+   needed only for the initial allocation of each array */
+#ifdef CORRADE_BUILD_MULTITHREADED
+CORRADE_THREAD_LOCAL
+#endif
+ArrayArena* currentArena = nullptr;
+
+}
+
+ArrayArena* ArrayArena::current() { return currentArena; }
+
+ArrayArena::ArrayArena(const ArrayView<char> memory) noexcept: _previous{currentArena}, _data{memory.data()}, _capacity{memory.size()}, _size{}, _last{~std::size_t{}} {
+    currentArena = this;
+}
+
+ArrayArena::~ArrayArena() {
+    CORRADE_ASSERT(currentArena == this,
+        "Containers::ArrayArena: instances have to be destroyed in reverse order of their creation", );
+    currentArena = _previous;
+}
+
+void* ArrayArena::allocate(const std::size_t size, const std::size_t alignment) {
+    CORRADE_ASSERT(alignment && !(alignment & (alignment - 1)),
+        "Containers::ArrayArena::allocate(): alignment expected to be a power of two, got" << alignment, {});
+
+    /* Align the absolute address, not the offset, as the memory itself can
+       have an arbitrary alignment */
+    const std::size_t address = reinterpret_cast<std::size_t>(_data) + _size;
+    const std::size_t offset = _size + ((alignment - (address & (alignment - 1))) & (alignment - 1));
+    if(offset > _capacity || size > _capacity - offset) return nullptr;
+
+    _last = offset;
+    _size = offset + size;
+    return _data + offset;
+}
+
+bool ArrayArena::reallocate(void* const allocation, const std::size_t size) {
+    if(_last == ~std::size_t{} || allocation != _data + _last || size > _capacity - _last)
+        return false;
+
+    _size = _last + size;
+    return true;
+}
+
+void ArrayArena::deallocate(void* const allocation) {
+    if(_last == ~std::size_t{} || allocation != _data + _last) return;
+
+    /* The previous allocation isn't known, so it's not possible to grow it
+       in-place anymore */
+    _size = _last;
+    _last = ~std::size_t{};
+}
+
+void ArrayArena::reset() {
+    _size = 0;
+    _last = ~std::size_t{};
+}
+
+}}
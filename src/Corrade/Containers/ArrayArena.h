@@ -0,0 +1,372 @@
+#ifndef Corrade_Containers_ArrayArena_h
+#define Corrade_Containers_ArrayArena_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::ArrayArena, @ref Corrade::Containers::ArrayArenaAllocator
+ * @m_since_latest
+ */
+
+#include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/Utility/visibility.h"
+
+namespace Corrade { namespace Containers {
+
+/**
+@brief Memory arena for growable arrays
+@m_since_latest
+
+A monotonic (bump) allocator operating on a user-provided piece of memory,
+used by growable arrays through @ref ArrayArenaAllocator. Allocations are
+done by simply advancing an offset, individual deallocations don't free
+anything except when deallocating the most recent allocation, and the whole
+arena is freed at once with an @f$ \mathcal{O}(1) @f$ @ref reset(). This makes
+it suitable for short-lived scratch data, such as temporary arrays that get
+repeatedly built and thrown away every frame:
+
+@snippet Containers.cpp ArrayArena-usage
+
+@section Containers-ArrayArena-current Current arena
+
+Because growable array allocators are stateless, the arena is communicated to
+@ref ArrayArenaAllocator implicitly --- for the whole lifetime of an
+@ref ArrayArena instance, it becomes the current arena for the calling thread,
+returned by @ref current(). Similarly to @ref Utility::Debug output
+redirection, creating another instance makes it current until it's destroyed,
+after which the previous one becomes current again. The instances are thus
+expected to be destroyed in reverse order of their creation.
+
+Only the initial allocation of an array is taken from the current arena. Each
+allocation remembers the arena it was taken from and all subsequent growth of
+the array happens within the same arena, regardless of which arena is current
+at that point.
+
+@section Containers-ArrayArena-growth In-place growth and fallback allocations
+
+If an array being grown is the most recent allocation in the arena and there's
+enough space left, it's extended in-place without any copying. Otherwise a new
+allocation is made at the end of the arena and the contents are moved there,
+leaving the original memory unused until the next @ref reset().
+
+If the arena doesn't have enough space left, or there's no current arena, the
+allocation falls back to @ref std::malloc(). Such allocations are not
+affected by @ref reset() and are freed when the array is destroyed, same as
+with the @ref ArrayMallocAllocator. Use @ref ArrayArenaAllocator::arena() to
+check where a particular array got allocated.
+
+@section Containers-ArrayArena-lifetime Lifetime and thread safety
+
+The arena doesn't own the memory it operates on and it doesn't track live
+allocations. Arrays allocated from it reference the arena in their deleter, so
+it's the user responsibility to destroy them before calling @ref reset() or
+destroying the arena. The arena itself is not thread-safe, but if
+@ref CORRADE_BUILD_MULTITHREADED is enabled, each thread has its own current
+arena.
+
+@experimental
+*/
+class CORRADE_UTILITY_EXPORT ArrayArena {
+    public:
+        /**
+         * @brief Current arena
+         *
+         * Returns the most recently created arena in the calling thread that
+         * wasn't destroyed yet, or @cpp nullptr @ce if there's none.
+         */
+        static ArrayArena* current();
+
+        /**
+         * @brief Constructor
+         * @param memory    Memory to allocate from
+         *
+         * The memory is not owned by the arena and has to stay in scope for
+         * the whole arena lifetime. Makes the instance the @ref current()
+         * arena.
+         */
+        explicit ArrayArena(ArrayView<char> memory) noexcept;
+
+        /** @brief Copying is not allowed */
+        ArrayArena(const ArrayArena&) = delete;
+
+        /**
+         * @brief Moving is not allowed
+         *
+         * Allocations reference the arena they came from, so it has to stay
+         * at a fixed address.
+         */
+        ArrayArena(ArrayArena&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Makes the previous arena current again. Expects that the instance
+         * is the @ref current() arena.
+         */
+        ~ArrayArena();
+
+        /** @brief Copying is not allowed */
+        ArrayArena& operator=(const ArrayArena&) = delete;
+
+        /** @brief Moving is not allowed */
+        ArrayArena& operator=(ArrayArena&&) = delete;
+
+        /** @brief Memory the arena allocates from */
+        char* data() const { return _data; }
+
+        /** @brief Total arena capacity in bytes */
+        std::size_t capacity() const { return _capacity; }
+
+        /**
+         * @brief Used size in bytes
+         *
+         * Includes alignment padding and memory left unused after moving an
+         * array to a different location.
+         */
+        std::size_t size() const { return _size; }
+
+        /**
+         * @brief Allocate memory
+         * @param size      Allocation size in bytes
+         * @param alignment Allocation alignment. Expected to be a power of
+         *      two.
+         *
+         * Returns a pointer to the allocated memory, or @cpp nullptr @ce if
+         * there's not enough space left.
+         */
+        void* allocate(std::size_t size, std::size_t alignment);
+
+        /**
+         * @brief Resize an allocation in-place
+         *
+         * If @p allocation is the most recent allocation made from the arena
+         * and there's enough space left, changes its size to @p size and
+         * returns @cpp true @ce, otherwise does nothing and returns
+         * @cpp false @ce.
+         */
+        bool reallocate(void* allocation, std::size_t size);
+
+        /**
+         * @brief Deallocate memory
+         *
+         * If @p allocation is the most recent allocation made from the
+         * arena, the space is reclaimed, otherwise it's left unused until
+         * the next @ref reset().
+         */
+        void deallocate(void* allocation);
+
+        /**
+         * @brief Reset the arena
+         *
+         * Makes the whole memory available again. All memory previously
+         * allocated from the arena becomes invalid, arrays allocated from it
+         * are expected to be destroyed before calling this function.
+         */
+        void reset();
+
+    private:
+        ArrayArena* _previous;
+        char* _data;
+        std::size_t _capacity;
+        std::size_t _size;
+        /* Offset of the most recent allocation or ~std::size_t{} if there's
+           none that could be grown in-place */
+        std::size_t _last;
+};
+
+namespace Implementation {
+
+template<class T> struct ArrayArenaTraits {
+    enum: std::size_t {
+        Alignment = alignof(T) < alignof(std::size_t) ? alignof(std::size_t) :
+            (alignof(T) < DefaultAllocationAlignment ?
+                alignof(T) : DefaultAllocationAlignment),
+        /* Space for the arena pointer and the capacity, padded to the type
+           alignment */
+        Offset = Alignment < 2*sizeof(std::size_t) ?
+            2*sizeof(std::size_t) : Alignment
+    };
+};
+
+}
+
+/**
+@brief Arena allocator for growable arrays
+@m_since_latest
+
+An @ref ArrayAllocator that allocates from the @ref ArrayArena::current() arena
+and falls back to @ref std::malloc() if there's none or it's full. See the
+@ref ArrayArena class documentation for details and usage example. Similarly to
+@ref ArrayNewAllocator it's reserving an extra space *before* the front, storing
+the originating arena and array capacity. Expects that @p T is nothrow
+move-constructible.
+@see @ref Containers-Array-growable
+@experimental
+*/
+template<class T> struct ArrayArenaAllocator {
+    typedef T Type; /**< Pointer type */
+
+    enum: std::size_t {
+        /**
+         * Offset at the beginning of the allocation to store the originating
+         * arena and allocation capacity. At least as large as two
+         * @ref std::size_t. If the type alignment is larger than that, then
+         * it's equal to type alignment, but only at most as large as the
+         * default allocation alignment.
+         */
+        AllocationOffset = Implementation::ArrayArenaTraits<T>::Offset
+    };
+
+    /**
+     * @brief Allocate (but not construct) an array of given capacity
+     *
+     * Allocates from @ref ArrayArena::current(), or falls back to
+     * @ref std::malloc() if there's no current arena or it doesn't have
+     * enough space left.
+     */
+    static T* allocate(std::size_t capacity) {
+        return allocate(ArrayArena::current(), capacity);
+    }
+
+    /**
+     * @brief Allocate (but not construct) an array of given capacity in given arena
+     *
+     * Like @ref allocate(std::size_t), but using @p arena instead of the
+     * current one. Passing @cpp nullptr @ce always allocates using
+     * @ref std::malloc().
+     */
+    static T* allocate(ArrayArena* arena, std::size_t capacity);
+
+    /**
+     * @brief Reallocate an array to given capacity
+     *
+     * If @p array is the most recent allocation in its arena and the arena
+     * has enough space left, it's grown in-place. Otherwise allocates a new
+     * array in the same arena (or falls back to @ref std::malloc()),
+     * move-constructs @p prevSize elements from @p array into it, calls
+     * destructors on the original elements, calls @ref deallocate() and
+     * updates the @p array reference to point to the new array.
+     */
+    static void reallocate(T*& array, std::size_t prevSize, std::size_t newCapacity);
+
+    /**
+     * @brief Deallocate an array
+     *
+     * If the array was allocated from an arena, delegates to
+     * @ref ArrayArena::deallocate(), otherwise calls @ref std::free().
+     */
+    static void deallocate(T* data);
+
+    /**
+     * @brief Grow the array
+     *
+     * Behaves the same as @ref ArrayNewAllocator::grow().
+     */
+    static std::size_t grow(T* array, std::size_t desired);
+
+    /**
+     * @brief Array capacity
+     *
+     * Retrieves the capacity that's stored *before* the front of the
+     * @p array.
+     */
+    static std::size_t capacity(T* array) {
+        return reinterpret_cast<std::size_t*>(base(array))[1];
+    }
+
+    /**
+     * @brief Arena the array was allocated from
+     *
+     * Retrieves the arena pointer that's stored *before* the front of the
+     * @p array. Returns @cpp nullptr @ce if the array was allocated with
+     * @ref std::malloc().
+     */
+    static ArrayArena* arena(T* array) {
+        return *reinterpret_cast<ArrayArena**>(base(array));
+    }
+
+    /**
+     * @brief Array base address
+     *
+     * Returns the address with @ref AllocationOffset subtracted.
+     */
+    static void* base(T* array) {
+        return reinterpret_cast<char*>(array) - AllocationOffset;
+    }
+
+    /**
+     * @brief Array deleter
+     *
+     * Calls a destructor on @p size elements and then delegates into
+     * @ref deallocate().
+     */
+    static void deleter(T* data, std::size_t size) {
+        Implementation::arrayDestruct<T>(data, data + size);
+        deallocate(data);
+    }
+};
+
+template<class T> T* ArrayArenaAllocator<T>::allocate(ArrayArena* arena, const std::size_t capacity) {
+    const std::size_t size = capacity*sizeof(T) + AllocationOffset;
+    void* memory = arena ? arena->allocate(size, Implementation::ArrayArenaTraits<T>::Alignment) : nullptr;
+    if(!memory) {
+        arena = nullptr;
+        memory = std::malloc(size);
+    }
+
+    *reinterpret_cast<ArrayArena**>(memory) = arena;
+    reinterpret_cast<std::size_t*>(memory)[1] = capacity;
+    return reinterpret_cast<T*>(static_cast<char*>(memory) + AllocationOffset);
+}
+
+template<class T> void ArrayArenaAllocator<T>::reallocate(T*& array, const std::size_t prevSize, const std::size_t newCapacity) {
+    ArrayArena* const arena = ArrayArenaAllocator<T>::arena(array);
+    if(arena && arena->reallocate(base(array), newCapacity*sizeof(T) + AllocationOffset)) {
+        reinterpret_cast<std::size_t*>(base(array))[1] = newCapacity;
+        return;
+    }
+
+    T* const newArray = allocate(arena, newCapacity);
+    Implementation::arrayMoveConstruct<T>(array, newArray, prevSize);
+    Implementation::arrayDestruct<T>(array, array + prevSize);
+    deallocate(array);
+    array = newArray;
+}
+
+template<class T> void ArrayArenaAllocator<T>::deallocate(T* const data) {
+    if(!data) return;
+    if(ArrayArena* const arena = ArrayArenaAllocator<T>::arena(data))
+        arena->deallocate(base(data));
+    else std::free(base(data));
+}
+
+template<class T> std::size_t ArrayArenaAllocator<T>::grow(T* const array, const std::size_t desiredCapacity) {
+    return Implementation::arrayGrowth<T>(array ? capacity(array) : 0, desiredCapacity);
+}
+
+}}
+
+#endif
@@ -26,7 +26,10 @@
 
 #include "ArrayTuple.h"
 
+#include <cstring>
+
 #include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/ArrayArena.h"
 #include "Corrade/Containers/StridedArrayView.h"
 
 namespace Corrade { namespace Containers {
@@ -152,17 +155,121 @@ need to store the wrapper lambda from case (2) in the ArrayTuple, Instead, the
 ArrayTuple deleter pointer is `nullptr`, which makes the class simply do
 `delete[] data` on destruction, consistently with what Array does.
 
+### Recreating in-place
+
+On recreate(), the memory deleter is extracted from the existing state first
+--- either it's directly the ArrayTuple deleter pointer, or it's the last
+DestructibleItem record. In the latter case, if the record data pointer
+doesn't point to the beginning of the allocation, it's a stateful deleter and
+its state is at the end of the allocation. The new arrays then have to fit
+before the state, which stays where it is. After that, destructors are called
+on all remaining DestructibleItem records and the new layout is written over
+the old one, with the memory deleter stored either directly in the
+ArrayTuple again or as the last DestructibleItem record, depending on whether
+there are any destructible items. The allocation size doesn't change, so
+the stateful deleter wrapper still calculates the correct beginning of the
+allocation.
+
 */
 
-ArrayTuple::ArrayTuple(const ArrayView<const Item>& items): ArrayTuple{items, [](std::size_t size, std::size_t) -> std::pair<char*, std::nullptr_t> {
-    /** @todo use the alignment param once we implement aligned alloc */
-    return {size ? new char[size] : nullptr, nullptr};
-}} {}
+namespace {
+
+/* Used for allocations with alignment larger than what new[] guarantees. The
+   allocation is made larger by the alignment and the size of the offset that
+   gets stored right before the returned pointer, which means the deleter can
+   be stateless. */
+char* alignedAllocate(const std::size_t size, const std::size_t alignment) {
+    if(!size) return nullptr;
+
+    char* const allocation = new char[size + alignment - 1 + sizeof(std::size_t)];
+    const std::size_t address = reinterpret_cast<std::size_t>(allocation) + sizeof(std::size_t);
+    const std::size_t offset = sizeof(std::size_t) + ((alignment - (address & (alignment - 1))) & (alignment - 1));
+    std::memcpy(allocation + offset - sizeof(std::size_t), &offset, sizeof(std::size_t));
+    return allocation + offset;
+}
+
+void alignedDeleter(char* const data, std::size_t) {
+    if(!data) return;
+
+    std::size_t offset;
+    std::memcpy(&offset, data - sizeof(std::size_t), sizeof(std::size_t));
+    delete[] (data - offset);
+}
+
+/* Used for recreate() in case the original tuple had a default deleter but
+   the new one needs to store it in a DestructibleItem record */
+void defaultDeleter(char* const data, std::size_t) {
+    delete[] data;
+}
+
+/* Used for tuples constructed in a caller-supplied memory */
+void noopDeleter(char*, std::size_t) {}
+
+/* Used for tuples constructed in an arena. If the arena is full, the memory is
+   allocated on the heap instead and the arena pointer is null. */
+struct ArenaDeleter {
+    void operator()(char* const data, const std::size_t size) {
+        if(arena) arena->deallocate(data);
+        else alignedDeleter(data, size);
+    }
+
+    ArrayArena* arena;
+};
+
+}
+
+ArrayTuple::ArrayTuple(const ArrayView<const Item>& items): ArrayTuple{} {
+    std::size_t maxAlignment = 1;
+    for(const Item& item: items)
+        if(item._elementAlignment > maxAlignment)
+            maxAlignment = item._elementAlignment;
+
+    if(maxAlignment <= Implementation::DefaultAllocationAlignment) {
+        *this = ArrayTuple{items, [](std::size_t size, std::size_t) -> std::pair<char*, std::nullptr_t> {
+            return {size ? new char[size] : nullptr, nullptr};
+        }};
+    } else {
+        *this = ArrayTuple{items, [](std::size_t size, std::size_t alignment) -> std::pair<char*, void(*)(char*, std::size_t)> {
+            return {alignedAllocate(size, alignment), alignedDeleter};
+        }};
+    }
+}
 
 ArrayTuple::ArrayTuple(): _data{}, _size{}, _deleter{} {}
 
 ArrayTuple::ArrayTuple(std::initializer_list<Item> items): ArrayTuple{arrayView(items)} {}
 
+ArrayTuple::ArrayTuple(const ArrayView<char> memory, const ArrayView<const Item>& items): ArrayTuple{} {
+    void(**deleterDestination)(char*, std::size_t) = nullptr;
+    Item arrayDeleterItem{nullptr, deleterDestination};
+
+    std::size_t destructibleItemCount;
+    bool arrayDeleterItemNeeded;
+    const std::pair<std::size_t, std::size_t> sizeAlignment = sizeAlignmentFor(items, arrayDeleterItem, destructibleItemCount, arrayDeleterItemNeeded);
+
+    /* Align the absolute address, as the memory itself can have an arbitrary
+       alignment */
+    const std::size_t address = reinterpret_cast<std::size_t>(memory.data());
+    const std::size_t padding = (sizeAlignment.second - (address & (sizeAlignment.second - 1))) & (sizeAlignment.second - 1);
+    CORRADE_ASSERT(padding + sizeAlignment.first <= memory.size(),
+        "Containers::ArrayTuple: expected at least" << padding + sizeAlignment.first << "bytes of memory for" << sizeAlignment.first << "bytes aligned to" << sizeAlignment.second << "bytes but got" << memory.size(), );
+
+    _data = memory.data() + padding;
+    _size = sizeAlignment.first;
+    create(items, arrayDeleterItem, destructibleItemCount, arrayDeleterItemNeeded, false);
+    if(deleterDestination) *deleterDestination = noopDeleter;
+}
+
+ArrayTuple::ArrayTuple(const ArrayView<char> memory, std::initializer_list<Item> items): ArrayTuple{memory, arrayView(items)} {}
+
+ArrayTuple::ArrayTuple(ArrayArena& arena, const ArrayView<const Item>& items): ArrayTuple{items, [&arena](std::size_t size, std::size_t alignment) -> std::pair<char*, ArenaDeleter> {
+    if(char* const data = static_cast<char*>(arena.allocate(size, alignment)))
+        return {data, ArenaDeleter{&arena}};
+    return {alignedAllocate(size, alignment), ArenaDeleter{nullptr}};
+}} {}
+
+ArrayTuple::ArrayTuple(ArrayArena& arena, std::initializer_list<Item> items): ArrayTuple{arena, arrayView(items)} {}
+
 ArrayTuple::ArrayTuple(ArrayTuple&& other) noexcept: _data{other._data}, _size{other._size}, _deleter{other._deleter} {
     other._data = nullptr;
     other._size = 0;
@@ -263,7 +370,7 @@ std::pair<std::size_t, std::size_t> ArrayTuple::sizeAlignmentFor(const ArrayView
     return {offset, maxAlignment};
 }
 
-void ArrayTuple::create(const ArrayView<const Item>& items, const Item& arrayDeleterItem, const std::size_t destructibleItemCount, const bool arrayDeleterItemNeeded) {
+void ArrayTuple::create(const ArrayView<const Item>& items, const Item& arrayDeleterItem, const std::size_t destructibleItemCount, const bool arrayDeleterItemNeeded, const bool inPlace) {
     /* If we have destructible entries, store the total count and calculate the
        (unaligned) offset for the first array. If we don't have them, don't
        store anything -- the first array will be right at the start. */
@@ -302,9 +409,10 @@ void ArrayTuple::create(const ArrayView<const Item>& items, const Item& arrayDel
         offset += items[i]._elementCount*items[i]._elementSize;
     }
 
-    /* Check that we're consistent with what sizeFor() calculated */
+    /* Check that we're consistent with what sizeFor() calculated. When
+       recreating in-place, the contents can be smaller than the allocation. */
     CORRADE_INTERNAL_ASSERT(nextDestructibleItem - destructibleItemCount == static_cast<void*>(_data + sizeof(std::size_t)));
-    CORRADE_INTERNAL_ASSERT(offset == _size || (arrayDeleterItemNeeded && arrayDeleterItem._elementAlignment && arrayDeleterItem._elementSize));
+    CORRADE_INTERNAL_ASSERT(offset == _size || (inPlace && offset <= _size) || (arrayDeleterItemNeeded && arrayDeleterItem._elementAlignment && arrayDeleterItem._elementSize));
 
     /* Store the array deleter, if needed */
     if(arrayDeleterItemNeeded) {
@@ -355,6 +463,81 @@ void ArrayTuple::create(const ArrayView<const Item>& items, const Item& arrayDel
     } else _deleter = nullptr;
 }
 
+void ArrayTuple::recreate(const ArrayView<const Item>& items) {
+    if(!recreateInPlace(items)) *this = ArrayTuple{items};
+}
+
+void ArrayTuple::recreate(std::initializer_list<Item> items) {
+    recreate(arrayView(items));
+}
+
+bool ArrayTuple::recreateInPlace(const ArrayView<const Item>& items) {
+    if(!_data) return false;
+
+    /* Extract the memory deleter from the current state. If it's in the last
+       DestructibleItem record and the record doesn't point to the beginning
+       of the allocation, it's a stateful deleter and the new contents have to
+       end before its state. */
+    Deleter memoryDeleter;
+    std::size_t end = _size;
+    DestructibleItem* records = nullptr;
+    std::size_t recordCount = 0;
+    if(_deleter == arrayTupleDeleter) {
+        records = reinterpret_cast<DestructibleItem*>(_data + sizeof(std::size_t));
+        recordCount = *reinterpret_cast<std::size_t*>(_data);
+        const DestructibleItem& memoryRecord = records[recordCount - 1];
+        memoryDeleter = memoryRecord.destructor;
+        if(memoryRecord.data != _data) end = memoryRecord.data - _data;
+    } else memoryDeleter = _deleter;
+    const bool stateful = end != _size;
+
+    /* Calculate the new layout in the same way as sizeAlignmentFor() does */
+    std::size_t destructibleItemCount = 0;
+    std::size_t maxAlignment = 1;
+    for(const Item& item: items) {
+        if(item._elementAlignment > maxAlignment)
+            maxAlignment = item._elementAlignment;
+        if(item._destructor && item._elementCount) ++destructibleItemCount;
+    }
+    const bool arrayDeleterItemNeeded = destructibleItemCount || stateful;
+    std::size_t offset;
+    if(const std::size_t totalDestructibleItems = destructibleItemCount + (arrayDeleterItemNeeded ? 1 : 0))
+        offset = sizeof(std::size_t) + totalDestructibleItems*sizeof(DestructibleItem);
+    else offset = 0;
+    for(const Item& item: items) {
+        offset = alignFor(offset, item._elementAlignment);
+        offset += item._elementSize*item._elementCount;
+    }
+
+    /* Bail if it doesn't fit or the memory isn't aligned enough */
+    if(offset > end || reinterpret_cast<std::size_t>(_data) & (maxAlignment - 1))
+        return false;
+
+    /* Destruct the existing contents, except for the memory itself */
+    for(std::size_t i = 0; i + 1 < recordCount; ++i)
+        for(std::size_t j = 0; j != records[i].elementCount; ++j)
+            records[i].destructor(records[i].data + j*records[i].elementSize, _size);
+
+    /* Create the new layout, pretending the memory deleter is a stateless
+       function pointer. It'll be saved to deleterDestination, which points
+       either to _deleter or to the last DestructibleItem record. */
+    void(**deleterDestination)(char*, std::size_t) = nullptr;
+    Item arrayDeleterItem{nullptr, deleterDestination};
+    create(items, arrayDeleterItem, destructibleItemCount, arrayDeleterItemNeeded, true);
+    CORRADE_INTERNAL_ASSERT(deleterDestination);
+    if(arrayDeleterItemNeeded) {
+        /* The deleter in the record can't be null, so if the memory was
+           deleted with plain delete[] before, wrap it in a function */
+        *deleterDestination = memoryDeleter ? memoryDeleter : defaultDeleter;
+        /* For a stateful deleter, point to its state, which stayed at the
+           original location */
+        if(stateful)
+            (reinterpret_cast<DestructibleItem*>(_data + sizeof(std::size_t)) + destructibleItemCount)->data = _data + end;
+    } else *deleterDestination = memoryDeleter;
+
+    return true;
+}
+
 char* ArrayTuple::release() {
     char* const data = _data;
     _data = nullptr;
@@ -363,6 +546,12 @@ char* ArrayTuple::release() {
     return data;
 }
 
+std::size_t ArrayTuple::Item::alignmentFor(const std::size_t typeAlignment, const std::size_t alignment) {
+    CORRADE_ASSERT(!(alignment & (alignment - 1)),
+        "Containers::ArrayTuple::Item: alignment expected to be a power of two, got" << alignment, typeAlignment);
+    return alignment > typeAlignment ? alignment : typeAlignment;
+}
+
 ArrayTuple::Item::Item(Corrade::NoInitT, const std::size_t size, const std::size_t elementSize, const std::size_t elementAlignment, StridedArrayView2D<char>& outputView): _elementSize{elementSize}, _elementAlignment{elementAlignment}, _elementCount{size}, _constructor{}, _destructor{}, _destinationPointer{&reinterpret_cast<void*&>(Implementation::dataRef(outputView))} {
     /* Populate size of the output view. Pointer gets updated inside create(). */
     outputView = {{nullptr, size*elementSize}, {size, elementSize}};
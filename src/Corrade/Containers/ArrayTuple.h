@@ -80,13 +80,20 @@ in the `info` structure, so the views aren't needed after anymore.
 
 <b></b>
 
-@m_class{m-note m-success}
+@section Containers-ArrayTuple-alignment Item alignment
 
-@par Aligned allocations
-    Please note that @ref ArrayTuple allocations are by default only aligned to
-    @cpp 2*sizeof(void*) @ce. If you need overaligned memory for working with
-    SIMD types, use a @ref Containers-ArrayTuple-allocators-deleters "custom allocator"
-    together with a @ref Utility::allocateAligned() instead.
+Each sub-array is aligned to the alignment of its type. It's possible to
+request a larger alignment for a particular item, such as a cache line to
+avoid false sharing or a page size for memory that gets mapped to a GPU, by
+passing an additional parameter to the @ref Item constructor. The allocation
+itself is then aligned to the largest alignment of all items:
+
+@snippet Containers.cpp ArrayTuple-usage-alignment
+
+If the largest alignment is larger than what @cpp new[] @ce guarantees
+(usually @cpp 2*sizeof(void*) @ce), the default allocator over-allocates and
+aligns the memory itself, and @ref deleter() is then no longer
+@cpp nullptr @ce.
 
 @section Containers-ArrayTuple-nontrivial Storing non-trivial types
 
@@ -113,6 +120,21 @@ offloaded to disk in case of a memory pressure:
 See the @ref ArrayTuple(const ArrayView<const Item>&, A) constructor
 documentation for a detailed description of the allocator and deleter
 signature.
+
+Apart from a custom allocator, the memory can also come from a
+caller-supplied buffer or from an @ref ArrayArena, using the @ref ArrayTuple(ArrayView<char>, const ArrayView<const Item>&)
+and @ref ArrayTuple(ArrayArena&, const ArrayView<const Item>&) constructors.
+In both cases the instance doesn't own the memory, but it still takes care of
+calling destructors of all non-trivially-destructible items.
+
+@section Containers-ArrayTuple-recreate Recreating in-place
+
+When the array sizes change over the lifetime of the tuple, such as when
+editing a mesh, @ref recreate() destroys the current contents and lays out
+the new arrays in the existing allocation, provided they fit. Only if the
+memory isn't large enough or sufficiently aligned, a new allocation is made:
+
+@snippet Containers.cpp ArrayTuple-usage-recreate
 */
 class CORRADE_UTILITY_EXPORT ArrayTuple {
     public:
@@ -177,6 +199,35 @@ class CORRADE_UTILITY_EXPORT ArrayTuple {
         template<class A, class I = Item> explicit ArrayTuple(std::initializer_list<I> items, A allocator): ArrayTuple{arrayView(items), allocator} {}
         #endif
 
+        /**
+         * @brief Construct in a caller-supplied memory
+         * @m_since_latest
+         *
+         * Lays out the arrays in @p memory, aligning its beginning to the
+         * largest alignment of all items first. Expects that the memory is
+         * large enough. The memory isn't owned by the instance and has to
+         * stay in scope for the whole instance lifetime, the destructor only
+         * calls destructors of non-trivially-destructible items.
+         */
+        explicit ArrayTuple(ArrayView<char> memory, const ArrayView<const Item>& items);
+        /** @overload */
+        explicit ArrayTuple(ArrayView<char> memory, std::initializer_list<Item> items);
+
+        /**
+         * @brief Construct in an arena
+         * @m_since_latest
+         *
+         * Allocates the memory from @p arena using @ref ArrayArena::allocate()
+         * and releases it with @ref ArrayArena::deallocate() on destruction.
+         * The arena is thus expected to stay alive for the whole instance
+         * lifetime. If there's not enough space left in the arena, the
+         * memory is allocated on the heap instead, consistently with
+         * @ref ArrayArenaAllocator.
+         */
+        explicit ArrayTuple(ArrayArena& arena, const ArrayView<const Item>& items);
+        /** @overload */
+        explicit ArrayTuple(ArrayArena& arena, std::initializer_list<Item> items);
+
         /** @brief Copying is not allowed */
         ArrayTuple(const ArrayTuple&) = delete;
 
@@ -256,10 +307,51 @@ class CORRADE_UTILITY_EXPORT ArrayTuple {
          */
         char* release();
 
+        /**
+         * @brief Recreate the arrays with a new layout
+         * @m_since_latest
+         *
+         * Calls destructors on all existing non-trivially-destructible items
+         * and then lays out @p items in the existing allocation, if they fit
+         * into it and the allocation is sufficiently aligned for them. The
+         * memory, @ref size() and the way the memory gets deleted stay
+         * unchanged in that case. Otherwise the existing memory is replaced
+         * with a new allocation made using the default allocator, as in
+         * @ref ArrayTuple(const ArrayView<const Item>&). The views in
+         * @p items are populated the same way as on construction in both
+         * cases.
+         */
+        void recreate(const ArrayView<const Item>& items);
+        /** @overload */
+        void recreate(std::initializer_list<Item> items);
+
+        /**
+         * @brief Recreate the arrays with a new layout, using a custom allocator for a new allocation
+         * @m_since_latest
+         *
+         * Same as @ref recreate(const ArrayView<const Item>&), except that
+         * if the items don't fit into the existing allocation, @p allocator
+         * is used to make a new one. See
+         * @ref ArrayTuple(const ArrayView<const Item>&, A) for details about
+         * the allocator signature.
+         */
+        template<class A> void recreate(const ArrayView<const Item>& items, A allocator);
+        /** @overload */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        template<class A> void recreate(std::initializer_list<Item> items, A allocator);
+        #else
+        template<class A, class I = Item> void recreate(std::initializer_list<I> items, A allocator) {
+            recreate(arrayView(items), allocator);
+        }
+        #endif
+
     private:
         static std::pair<std::size_t, std::size_t> sizeAlignmentFor(const ArrayView<const Item>& items, const Item& arrayDeleterItem, std::size_t& destructibleItemCount, bool& arrayDeleterItemNeeded);
 
-        void create(const ArrayView<const Item>& items, const Item& arrayDeleterItem, std::size_t destructibleItemCount, bool arrayDeleterItemNeeded);
+        void create(const ArrayView<const Item>& items, const Item& arrayDeleterItem, std::size_t destructibleItemCount, bool arrayDeleterItemNeeded, bool inPlace);
+
+        /* Returns false if the items don't fit into the current allocation */
+        bool recreateInPlace(const ArrayView<const Item>& items);
 
         char* _data;
         std::size_t _size;
@@ -293,21 +385,25 @@ class CORRADE_UTILITY_EXPORT ArrayTuple::Item {
          * @param[in] size          Desired view size
          * @param[out] outputView   Desired type and a reference where to store
          *      the resulting view
+         * @param[in] alignment     Desired alignment of the first element.
+         *      Expected to be a power of two. If @cpp 0 @ce or less than
+         *      @cpp alignof(T) @ce, @cpp alignof(T) @ce is used. The
+         *      parameter is available since @ref corrade-changelog-latest "latest".
          *
          * All @p size elements are value-initialized (i.e., builtin types are
          * zero-initialized and the default constructor gets called otherwise).
          * Expects that @p T is default-constructible. If it's not, you have to
-         * use @ref Item(NoInitT, std::size_t, ArrayView<T>&) instead and then
-         * manually construct each item in-place.
+         * use @ref Item(NoInitT, std::size_t, ArrayView<T>&, std::size_t)
+         * instead and then manually construct each item in-place.
          */
-        template<class T> /*implicit*/ Item(Corrade::ValueInitT, std::size_t size, ArrayView<T>& outputView): Item{Corrade::ValueInit, size, Implementation::dataRef(outputView)} {
+        template<class T> /*implicit*/ Item(Corrade::ValueInitT, std::size_t size, ArrayView<T>& outputView, std::size_t alignment = 0): Item{Corrade::ValueInit, size, Implementation::dataRef(outputView), alignment} {
             /* Populate size of the output view. Pointer gets updated inside
                create(). */
             outputView = {nullptr, size};
         }
 
         /** @overload */
-        template<class T> /*implicit*/ Item(Corrade::ValueInitT, std::size_t size, StridedArrayView1D<T>& outputView): Item{Corrade::ValueInit, size, Implementation::dataRef(outputView)} {
+        template<class T> /*implicit*/ Item(Corrade::ValueInitT, std::size_t size, StridedArrayView1D<T>& outputView, std::size_t alignment = 0): Item{Corrade::ValueInit, size, Implementation::dataRef(outputView), alignment} {
             /* Populate size of the output view. Pointer gets updated inside
                create(). */
             outputView = {{nullptr, size}, size};
@@ -316,18 +412,22 @@ class CORRADE_UTILITY_EXPORT ArrayTuple::Item {
         /**
          * @brief Construct a view with value-initialized elements
          *
-         * Alias to @ref Item(ValueInitT, std::size_t, ArrayView<T>&).
+         * Alias to @ref Item(ValueInitT, std::size_t, ArrayView<T>&, std::size_t).
          */
-        template<class T> /*implicit*/ Item(std::size_t size, ArrayView<T>& outputView): Item{Corrade::ValueInit, size, outputView} {}
+        template<class T> /*implicit*/ Item(std::size_t size, ArrayView<T>& outputView, std::size_t alignment = 0): Item{Corrade::ValueInit, size, outputView, alignment} {}
 
         /** @overload */
-        template<class T> /*implicit*/ Item(std::size_t size, StridedArrayView1D<T>& outputView): Item{Corrade::ValueInit, size, outputView} {}
+        template<class T> /*implicit*/ Item(std::size_t size, StridedArrayView1D<T>& outputView, std::size_t alignment = 0): Item{Corrade::ValueInit, size, outputView, alignment} {}
 
         /**
          * @brief Construct a view without initializing its elements
          * @param[in] size          Desired view size
          * @param[out] outputView   Desired type and a reference where to store
          *      the resulting view
+         * @param[in] alignment     Desired alignment of the first element.
+         *      Expected to be a power of two. If @cpp 0 @ce or less than
+         *      @cpp alignof(T) @ce, @cpp alignof(T) @ce is used. The
+         *      parameter is available since @ref corrade-changelog-latest "latest".
          *
          * Initialize the values using placement new. Useful if you will be
          * overwriting all elements later anyway, or if the elements have no
@@ -335,14 +435,14 @@ class CORRADE_UTILITY_EXPORT ArrayTuple::Item {
          * gets finally called on *all elements*, regardless of whether they
          * were properly constructed or not.
          */
-        template<class T> /*implicit*/ Item(Corrade::NoInitT, std::size_t size, ArrayView<T>& outputView): Item{Corrade::NoInit, size, Implementation::dataRef(outputView)} {
+        template<class T> /*implicit*/ Item(Corrade::NoInitT, std::size_t size, ArrayView<T>& outputView, std::size_t alignment = 0): Item{Corrade::NoInit, size, Implementation::dataRef(outputView), alignment} {
             /* Populate size of the output view. Pointer gets updated inside
                create(). */
             outputView = {nullptr, size};
         }
 
         /** @overload */
-        template<class T> /*implicit*/ Item(Corrade::NoInitT, std::size_t size, StridedArrayView1D<T>& outputView): Item{Corrade::NoInit, size, Implementation::dataRef(outputView)} {
+        template<class T> /*implicit*/ Item(Corrade::NoInitT, std::size_t size, StridedArrayView1D<T>& outputView, std::size_t alignment = 0): Item{Corrade::NoInit, size, Implementation::dataRef(outputView), alignment} {
             /* Populate size of the output view. Pointer gets updated inside
                create(). */
             outputView = {{nullptr, size}, size};
@@ -356,7 +456,7 @@ class CORRADE_UTILITY_EXPORT ArrayTuple::Item {
          * @param[out] outputView       Reference where to store the resulting
          *      view
          *
-         * A type-erased alternative to @ref Item(Corrade::NoInitT, std::size_t, StridedArrayView1D<T>&)
+         * A type-erased alternative to @ref Item(Corrade::NoInitT, std::size_t, StridedArrayView1D<T>&, std::size_t)
          * where you set both element size and alignment manually. The
          * resulting @p outputView has first dimension of @p size and second of
          * @p elementSize, with stride @p elementSize and @cpp 1 @ce.
@@ -366,8 +466,12 @@ class CORRADE_UTILITY_EXPORT ArrayTuple::Item {
     private:
         friend ArrayTuple;
 
+        /* Checks that the alignment is a power of two and returns the larger
+           of the two */
+        static std::size_t alignmentFor(std::size_t typeAlignment, std::size_t alignment);
+
         /* Common code shared by ArrayView and StridedArrayView variants */
-        template<class T> explicit Item(Corrade::ValueInitT, std::size_t size, T*& destinationPointer): Item{Corrade::NoInit, size, destinationPointer} {
+        template<class T> explicit Item(Corrade::ValueInitT, std::size_t size, T*& destinationPointer, std::size_t alignment): Item{Corrade::NoInit, size, destinationPointer, alignment} {
             static_assert(std::is_default_constructible<T>::value,
                 "can't default-init a type with no default constructor, use NoInit instead and manually initialize each item");
             _constructor = [](void* data) {
@@ -377,8 +481,8 @@ class CORRADE_UTILITY_EXPORT ArrayTuple::Item {
             };
         }
 
-        template<class T> explicit Item(Corrade::NoInitT, std::size_t size, T*& destinationPointer):
-            _elementSize{sizeof(T)}, _elementAlignment{alignof(T)}, _elementCount{size},
+        template<class T> explicit Item(Corrade::NoInitT, std::size_t size, T*& destinationPointer, std::size_t alignment):
+            _elementSize{sizeof(T)}, _elementAlignment{alignmentFor(alignof(T), alignment)}, _elementCount{size},
             _constructor{},
             _destructor{std::is_trivially_destructible<T>::value ? static_cast<void(*)(char*, std::size_t)>(nullptr) :
                 /* MSVC 2015 complains that
@@ -482,7 +586,7 @@ template<class A> ArrayTuple::ArrayTuple(const ArrayView<const Item>& items, A a
        will populate the deleterDestination pointer above. To which we then
        save the deleter -- either its state for a stateful one, or a function
        pointer for a stateless one. */
-    create(items, arrayDeleterItem, destructibleItemCount, arrayDeleterItemNeeded);
+    create(items, arrayDeleterItem, destructibleItemCount, arrayDeleterItemNeeded, false);
     /* Doing a placement-new initialization as calling a copy constructor to an
        uninitialized memory may not do the right thing. In case it's a plain
        function pointer, the two are equivalent. Also using a helper
@@ -492,6 +596,10 @@ template<class A> ArrayTuple::ArrayTuple(const ArrayView<const Item>& items, A a
         Implementation::construct(*deleterDestination, allocated.second);
 }
 
+template<class A> void ArrayTuple::recreate(const ArrayView<const Item>& items, A allocator) {
+    if(!recreateInPlace(items)) *this = ArrayTuple{items, allocator};
+}
+
 }}
 
 #endif
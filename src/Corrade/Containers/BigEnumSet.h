@@ -36,6 +36,7 @@
 #include <cstdint>
 
 #include "Corrade/Containers/EnumSet.h" /* reusing the macros */
+#include "Corrade/Containers/bitHelpers.h"
 #include "Corrade/Containers/sequenceHelpers.h"
 #include "Corrade/Utility/Assert.h"
 
@@ -47,6 +48,56 @@ namespace Implementation {
     }
 }
 
+/**
+@brief Iterator over values in a @ref BigEnumSet
+@m_since_latest
+
+Goes through set bits in the increasing order, skipping all unset bits in
+a constant time per 64-bit word using a count-trailing-zeros instruction.
+Returned by @ref BigEnumSet::begin() and @ref BigEnumSet::end().
+@experimental
+*/
+template<class T, std::size_t size> class BigEnumSetIterator {
+    public:
+        /** @brief Current value */
+        T operator*() const {
+            return T(_i*64 + Implementation::trailingZeros(static_cast<unsigned long long>(_word)));
+        }
+
+        /** @brief Move to the next set value */
+        BigEnumSetIterator<T, size>& operator++() {
+            /* Clear the lowest set bit, then find the next nonzero word */
+            _word &= _word - 1;
+            while(!_word && ++_i != size) _word = _data[_i];
+            return *this;
+        }
+
+        /** @brief Equality comparison */
+        bool operator==(const BigEnumSetIterator<T, size>& other) const {
+            return _i == other._i && _word == other._word;
+        }
+
+        /** @brief Non-equality comparison */
+        bool operator!=(const BigEnumSetIterator<T, size>& other) const {
+            return !operator==(other);
+        }
+
+    private:
+        friend BigEnumSet<T, size>;
+
+        /* Begin iterator, positioned at the first set bit */
+        explicit BigEnumSetIterator(const std::uint64_t* data) noexcept: _data{data}, _i{0}, _word{data[0]} {
+            while(!_word && ++_i != size) _word = _data[_i];
+        }
+
+        /* End iterator */
+        explicit BigEnumSetIterator(const std::uint64_t* data, std::nullptr_t) noexcept: _data{data}, _i{size}, _word{0} {}
+
+        const std::uint64_t* _data;
+        std::size_t _i;
+        std::uint64_t _word;
+};
+
 /**
 @brief Set of more than 64 enum values
 @tparam T           Enum type
@@ -86,6 +137,17 @@ macro is the same:
 
 @endparblock
 
+@section Containers-BigEnumSet-iteration Iterating set values
+
+Besides testing for presence of particular values, the set can be iterated
+over with a range-for, giving back all values that are set in an increasing
+order. The iteration skips unset bits in a constant time per 64-bit word,
+so it's fast even for mostly empty sets. The @ref count() function then
+returns the count of set values, using the @cpp POPCNT @ce instruction on
+x86 if the CPU supports it, detected at runtime:
+
+@snippet Containers.cpp BigEnumSet-iteration
+
 @see @ref bigEnumSetDebugOutput()
 */
 #ifdef DOXYGEN_GENERATING_OUTPUT
@@ -208,6 +270,41 @@ class BigEnumSet {
             return nonZeroInternal(typename Implementation::GenerateSequence<Size>::Type{});
         }
 
+        /**
+         * @brief Count of values in the set
+         * @m_since_latest
+         *
+         * Sums a population count of all @ref Size words. Unlike
+         * @ref BitArrayView::count() it's implemented inline and doesn't
+         * dispatch to a @cpp POPCNT @ce variant at runtime.
+         */
+        std::size_t count() const {
+            std::size_t count = 0;
+            for(std::size_t i = 0; i != Size; ++i)
+                count += Implementation::popcount(_data[i]);
+            return count;
+        }
+
+        /**
+         * @brief Iterator to the first set value
+         * @m_since_latest
+         *
+         * @see @ref Containers-BigEnumSet-iteration
+         */
+        BigEnumSetIterator<T, size> begin() const {
+            return BigEnumSetIterator<T, size>{_data};
+        }
+
+        /**
+         * @brief Iterator to (one item after) the last set value
+         * @m_since_latest
+         *
+         * @see @ref Containers-BigEnumSet-iteration
+         */
+        BigEnumSetIterator<T, size> end() const {
+            return BigEnumSetIterator<T, size>{_data, nullptr};
+        }
+
     private:
         /* Used by the BigEnumSet(T) constructor, void* to avoid accidental
            matches by users */
@@ -0,0 +1,65 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BitArray.h"
+
+#include <cstring>
+#include <utility>
+
+namespace Corrade { namespace Containers {
+
+BitArray::BitArray(Corrade::NoInitT, const std::size_t size): _data{size ? new char[(size + 7) >> 3] : nullptr}, _size{size} {}
+
+BitArray::BitArray(Corrade::ValueInitT, const std::size_t size): BitArray{Corrade::NoInit, size} {
+    if(_data) std::memset(_data, 0, (size + 7) >> 3);
+}
+
+BitArray::BitArray(Corrade::DirectInitT, const std::size_t size, const bool value): BitArray{Corrade::NoInit, size} {
+    if(_data) std::memset(_data, value ? 0xff : 0x00, (size + 7) >> 3);
+}
+
+BitArray::BitArray(BitArray&& other) noexcept: _data{other._data}, _size{other._size} {
+    other._data = nullptr;
+    other._size = 0;
+}
+
+BitArray::~BitArray() { delete[] _data; }
+
+BitArray& BitArray::operator=(BitArray&& other) noexcept {
+    using std::swap;
+    swap(_data, other._data);
+    swap(_size, other._size);
+    return *this;
+}
+
+char* BitArray::release() {
+    char* const data = _data;
+    _data = nullptr;
+    _size = 0;
+    return data;
+}
+
+}}
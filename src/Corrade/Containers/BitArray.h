@@ -0,0 +1,278 @@
+#ifndef Corrade_Containers_BitArray_h
+#define Corrade_Containers_BitArray_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::BitArray
+ * @m_since_latest
+ */
+
+#include "Corrade/Tags.h"
+#include "Corrade/Containers/BitArrayView.h"
+
+namespace Corrade { namespace Containers {
+
+/**
+@brief Bit array
+@m_since_latest
+
+Owning counterpart to @ref BitArrayView and @ref MutableBitArrayView, with
+the bits packed eight to a byte. The memory is allocated with
+@cpp new[] @ce and always starts at a byte boundary, i.e. @ref offset() is
+always @cpp 0 @ce. Bits in the last byte that are outside of @ref size() have
+unspecified values. The array is move-only, all operations on it delegate to
+@ref MutableBitArrayView, see its documentation for details.
+
+@section Containers-BitArray-usage Usage
+
+@snippet Containers.cpp BitArray-usage
+
+@experimental
+*/
+class CORRADE_UTILITY_EXPORT BitArray {
+    public:
+        /** @brief Default constructor */
+        /*implicit*/ BitArray(std::nullptr_t = nullptr) noexcept: _data{}, _size{} {}
+
+        /**
+         * @brief Construct a zero-initialized array
+         *
+         * If @p size is zero, no allocation is done.
+         */
+        explicit BitArray(Corrade::ValueInitT, std::size_t size);
+
+        /**
+         * @brief Construct an array without initializing its contents
+         *
+         * If @p size is zero, no allocation is done.
+         */
+        explicit BitArray(Corrade::NoInitT, std::size_t size);
+
+        /**
+         * @brief Construct an array with all bits set to a value
+         *
+         * If @p size is zero, no allocation is done.
+         */
+        explicit BitArray(Corrade::DirectInitT, std::size_t size, bool value);
+
+        /**
+         * @brief Construct a zero-initialized array
+         *
+         * Alias to @ref BitArray(Corrade::ValueInitT, std::size_t).
+         */
+        explicit BitArray(std::size_t size): BitArray{Corrade::ValueInit, size} {}
+
+        /** @brief Copying is not allowed */
+        BitArray(const BitArray&) = delete;
+
+        /** @brief Move constructor */
+        BitArray(BitArray&& other) noexcept;
+
+        ~BitArray();
+
+        /** @brief Copying is not allowed */
+        BitArray& operator=(const BitArray&) = delete;
+
+        /** @brief Move assignment */
+        BitArray& operator=(BitArray&& other) noexcept;
+
+        /** @brief Convert to a const view */
+        /*implicit*/ operator BitArrayView() const {
+            return BitArrayView{_data, 0, _size};
+        }
+
+        /** @brief Convert to a mutable view */
+        /*implicit*/ operator MutableBitArrayView() {
+            return MutableBitArrayView{_data, 0, _size};
+        }
+
+        /** @brief Array data */
+        char* data() { return _data; }
+        const char* data() const { return _data; } /**< @overload */
+
+        /**
+         * @brief Offset of the first bit in the first byte
+         *
+         * Always @cpp 0 @ce, provided for consistency with
+         * @ref BitArrayView::offset().
+         */
+        std::size_t offset() const { return 0; }
+
+        /** @brief Size in bits */
+        std::size_t size() const { return _size; }
+
+        /** @brief Whether the array is empty */
+        bool isEmpty() const { return !_size; }
+
+        /** @brief Bit at given position */
+        bool operator[](std::size_t i) const {
+            return BitArrayView{*this}[i];
+        }
+
+        /** @brief Set a bit at given position */
+        void set(std::size_t i) {
+            MutableBitArrayView{*this}.set(i);
+        }
+
+        /** @brief Reset a bit at given position */
+        void reset(std::size_t i) {
+            MutableBitArrayView{*this}.reset(i);
+        }
+
+        /** @brief Set or reset a bit at given position */
+        void set(std::size_t i, bool value) {
+            MutableBitArrayView{*this}.set(i, value);
+        }
+
+        /** @brief Set all bits */
+        void setAll() {
+            MutableBitArrayView{*this}.setAll();
+        }
+
+        /** @brief Reset all bits */
+        void resetAll() {
+            MutableBitArrayView{*this}.resetAll();
+        }
+
+        /** @brief Set or reset all bits */
+        void setAll(bool value) {
+            MutableBitArrayView{*this}.setAll(value);
+        }
+
+        /** @brief Invert all bits */
+        void invert() {
+            MutableBitArrayView{*this}.invert();
+        }
+
+        /**
+         * @brief Bitwise AND with a view
+         *
+         * See @ref MutableBitArrayView::andWith() for more information.
+         */
+        void andWith(BitArrayView other) {
+            MutableBitArrayView{*this}.andWith(other);
+        }
+
+        /**
+         * @brief Bitwise OR with a view
+         *
+         * See @ref MutableBitArrayView::orWith() for more information.
+         */
+        void orWith(BitArrayView other) {
+            MutableBitArrayView{*this}.orWith(other);
+        }
+
+        /**
+         * @brief Bitwise XOR with a view
+         *
+         * See @ref MutableBitArrayView::xorWith() for more information.
+         */
+        void xorWith(BitArrayView other) {
+            MutableBitArrayView{*this}.xorWith(other);
+        }
+
+        /**
+         * @brief Count of set bits
+         *
+         * See @ref BitArrayView::count() for more information.
+         */
+        std::size_t count() const {
+            return BitArrayView{*this}.count();
+        }
+
+        /**
+         * @brief Position of the first set bit
+         *
+         * See @ref BitArrayView::findFirstSet() for more information.
+         */
+        Optional<std::size_t> findFirstSet() const {
+            return BitArrayView{*this}.findFirstSet();
+        }
+
+        /** @brief View slice */
+        MutableBitArrayView slice(std::size_t begin, std::size_t end) {
+            return MutableBitArrayView{*this}.slice(begin, end);
+        }
+        /** @overload */
+        BitArrayView slice(std::size_t begin, std::size_t end) const {
+            return BitArrayView{*this}.slice(begin, end);
+        }
+
+        /** @brief View prefix */
+        MutableBitArrayView prefix(std::size_t end) {
+            return MutableBitArrayView{*this}.prefix(end);
+        }
+        /** @overload */
+        BitArrayView prefix(std::size_t end) const {
+            return BitArrayView{*this}.prefix(end);
+        }
+
+        /** @brief View suffix */
+        MutableBitArrayView suffix(std::size_t begin) {
+            return MutableBitArrayView{*this}.suffix(begin);
+        }
+        /** @overload */
+        BitArrayView suffix(std::size_t begin) const {
+            return BitArrayView{*this}.suffix(begin);
+        }
+
+        /** @brief View prefix except the last @p count bits */
+        MutableBitArrayView except(std::size_t count) {
+            return MutableBitArrayView{*this}.except(count);
+        }
+        /** @overload */
+        BitArrayView except(std::size_t count) const {
+            return BitArrayView{*this}.except(count);
+        }
+
+        /**
+         * @brief Release data storage
+         *
+         * Returns the data pointer and resets data pointer and size to zero.
+         * Deleting the returned array is user responsibility, using
+         * @cpp delete[] @ce.
+         */
+        char* release();
+
+    private:
+        char* _data;
+        std::size_t _size;
+};
+
+/**
+@debugoperator{BitArray}
+@m_since_latest
+
+Equivalent to @ref operator<<(Utility::Debug&, BitArrayView).
+*/
+inline Utility::Debug& operator<<(Utility::Debug& debug, const BitArray& value) {
+    return debug << BitArrayView{value};
+}
+
+}}
+
+#endif
@@ -0,0 +1,256 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BitArrayView.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "Corrade/Containers/bitHelpers.h"
+#include "Corrade/Utility/Debug.h"
+#include "Corrade/Utility/Endianness.h"
+#include "Corrade/Utility/Implementation/cpu.h"
+
+#ifdef CORRADE_ENABLE_POPCNT
+#include <nmmintrin.h>
+#endif
+
+namespace Corrade { namespace Containers {
+
+namespace {
+
+/* Loads 64 bits starting at bit `position` of `data`. If the position isn't
+   byte-aligned, one more byte is read, which is still in range as the caller
+   guarantees there are 64 bits after `position`. */
+inline std::uint64_t loadWord(const char* const data, const std::size_t position) {
+    const char* const begin = data + (position >> 3);
+    const std::size_t shift = position & 0x07;
+    std::uint64_t word;
+    std::memcpy(&word, begin, 8);
+    word = Utility::Endianness::littleEndian(word);
+    if(shift)
+        word = (word >> shift)|(std::uint64_t(static_cast<unsigned char>(begin[8])) << (64 - shift));
+    return word;
+}
+
+/* Stores 64 bits to a byte-aligned position */
+inline void storeWord(char* const data, std::uint64_t word) {
+    word = Utility::Endianness::littleEndian(word);
+    std::memcpy(data, &word, 8);
+}
+
+/* Loads `count` bits starting at bit `position` into the low bits of the
+   result, with `count` being between 1 and 64. Reads only the bytes that
+   contain the bits. */
+inline std::uint64_t loadBits(const char* const data, const std::size_t position, const std::size_t count) {
+    const unsigned char* const begin = reinterpret_cast<const unsigned char*>(data) + (position >> 3);
+    const std::size_t shift = position & 0x07;
+    const std::size_t byteCount = (shift + count + 7) >> 3;
+    std::uint64_t word = 0;
+    for(std::size_t i = 0, end = byteCount < 8 ? byteCount : 8; i != end; ++i)
+        word |= std::uint64_t(begin[i]) << i*8;
+    word >>= shift;
+    if(byteCount == 9)
+        word |= std::uint64_t(begin[8]) << (64 - shift);
+    return count == 64 ? word : word & ((std::uint64_t{1} << count) - 1);
+}
+
+/* Stores `count` low bits of `word` to a byte-aligned position, with
+   `count` being between 1 and 64. Remaining bits in the last byte are left
+   untouched. */
+inline void storeBits(char* const data, const std::uint64_t word, const std::size_t count) {
+    unsigned char* const out = reinterpret_cast<unsigned char*>(data);
+    const std::size_t byteCount = count >> 3;
+    for(std::size_t i = 0; i != byteCount; ++i)
+        out[i] = static_cast<unsigned char>(word >> i*8);
+    if(const std::size_t rest = count & 0x07) {
+        const unsigned mask = (1u << rest) - 1;
+        out[byteCount] = static_cast<unsigned char>((out[byteCount] & ~mask)|((word >> byteCount*8) & mask));
+    }
+}
+
+/* Replaces `size` bits of `data` starting at bit `offset` with
+   operation(bits, otherBits), where `otherBits` are the corresponding bits of
+   `other` starting at bit `otherOffset`. The `other` can be the same memory
+   as `data` for unary operations. */
+template<class Operation> void bitTransform(char* data, const std::size_t offset, const char* const other, std::size_t otherOffset, std::size_t size, const Operation operation) {
+    if(!size) return;
+
+    /* Process the bits up to the first byte boundary of data separately, so
+       the rest can be loaded and stored as whole words */
+    if(offset) {
+        const std::size_t count = size < 8 - offset ? size : 8 - offset;
+        const unsigned mask = ((1u << count) - 1) << offset;
+        unsigned char& byte = reinterpret_cast<unsigned char&>(*data);
+        const std::uint64_t result = operation(std::uint64_t(byte >> offset), loadBits(other, otherOffset, count));
+        byte = static_cast<unsigned char>((byte & ~mask)|((result << offset) & mask));
+        ++data;
+        otherOffset += count;
+        size -= count;
+    }
+
+    for(; size >= 64; size -= 64, data += 8, otherOffset += 64)
+        storeWord(data, operation(loadWord(data, 0), loadWord(other, otherOffset)));
+
+    if(size)
+        storeBits(data, operation(loadBits(data, 0, size), loadBits(other, otherOffset, size)), size);
+}
+
+std::size_t bitCountScalar(const char* const data, std::size_t offset, std::size_t size) {
+    std::size_t count = 0;
+    for(; size >= 64; size -= 64, offset += 64)
+        count += Implementation::popcount(loadWord(data, offset));
+    if(size)
+        count += Implementation::popcount(loadBits(data, offset, size));
+    return count;
+}
+
+#ifdef CORRADE_ENABLE_POPCNT
+CORRADE_ENABLE_POPCNT std::size_t bitCountPopcnt(const char* const data, std::size_t offset, std::size_t size) {
+    std::size_t count = 0;
+    for(; size >= 64; size -= 64, offset += 64) {
+        const std::uint64_t word = loadWord(data, offset);
+        #ifndef CORRADE_TARGET_32BIT
+        count += _mm_popcnt_u64(word);
+        #else
+        count += _mm_popcnt_u32(unsigned(word)) + _mm_popcnt_u32(unsigned(word >> 32));
+        #endif
+    }
+    if(size) {
+        const std::uint64_t word = loadBits(data, offset, size);
+        #ifndef CORRADE_TARGET_32BIT
+        count += _mm_popcnt_u64(word);
+        #else
+        count += _mm_popcnt_u32(unsigned(word)) + _mm_popcnt_u32(unsigned(word >> 32));
+        #endif
+    }
+    return count;
+}
+#endif
+
+typedef std::size_t(*BitCountImplementation)(const char*, std::size_t, std::size_t);
+
+BitCountImplementation bitCountImplementation() {
+    #ifdef CORRADE_ENABLE_POPCNT
+    if(Utility::Implementation::cpuFeatures() & Utility::Implementation::CpuPopcnt)
+        return bitCountPopcnt;
+    #endif
+    return bitCountScalar;
+}
+
+}
+
+namespace Implementation {
+
+std::size_t bitCount(const char* const data, const std::size_t offset, const std::size_t size) {
+    /* Unless the whole build targets POPCNT, whether it's available is
+       known only at runtime. Query it on first use and reuse the choice for
+       all following calls. */
+    static const BitCountImplementation implementation = bitCountImplementation();
+    return implementation(data, offset, size);
+}
+
+std::size_t bitFindFirstSet(const char* const data, const std::size_t offset, const std::size_t size) {
+    std::size_t i = 0;
+    for(; size - i >= 64; i += 64)
+        if(const std::uint64_t word = loadWord(data, offset + i))
+            return i + trailingZeros(static_cast<unsigned long long>(word));
+    if(size - i)
+        if(const std::uint64_t word = loadBits(data, offset + i, size - i))
+            return i + trailingZeros(static_cast<unsigned long long>(word));
+    return size;
+}
+
+void bitSetAll(char* data, const std::size_t offset, std::size_t size, const bool value) {
+    if(!size) return;
+
+    const unsigned char byteValue = value ? 0xff : 0x00;
+    unsigned char* out = reinterpret_cast<unsigned char*>(data);
+
+    /* Leading bits in the first byte */
+    if(offset) {
+        const std::size_t count = size < 8 - offset ? size : 8 - offset;
+        const unsigned mask = ((1u << count) - 1) << offset;
+        *out = static_cast<unsigned char>((*out & ~mask)|(byteValue & mask));
+        ++out;
+        size -= count;
+    }
+
+    /* Whole bytes */
+    std::memset(out, byteValue, size >> 3);
+    out += size >> 3;
+
+    /* Trailing bits in the last byte */
+    if(const std::size_t rest = size & 0x07) {
+        const unsigned mask = (1u << rest) - 1;
+        *out = static_cast<unsigned char>((*out & ~mask)|(byteValue & mask));
+    }
+}
+
+void bitInvert(char* const data, const std::size_t offset, const std::size_t size) {
+    bitTransform(data, offset, data, offset, size, [](std::uint64_t a, std::uint64_t) {
+        return ~a;
+    });
+}
+
+void bitAnd(char* const data, const std::size_t offset, const char* const other, const std::size_t otherOffset, const std::size_t size) {
+    bitTransform(data, offset, other, otherOffset, size, [](std::uint64_t a, std::uint64_t b) {
+        return a & b;
+    });
+}
+
+void bitOr(char* const data, const std::size_t offset, const char* const other, const std::size_t otherOffset, const std::size_t size) {
+    bitTransform(data, offset, other, otherOffset, size, [](std::uint64_t a, std::uint64_t b) {
+        return a | b;
+    });
+}
+
+void bitXor(char* const data, const std::size_t offset, const char* const other, const std::size_t otherOffset, const std::size_t size) {
+    bitTransform(data, offset, other, otherOffset, size, [](std::uint64_t a, std::uint64_t b) {
+        return a ^ b;
+    });
+}
+
+}
+
+Utility::Debug& operator<<(Utility::Debug& debug, const BitArrayView value) {
+    debug << "{" << Utility::Debug::nospace;
+
+    const std::size_t size = value.size();
+    char group[9];
+    for(std::size_t i = 0; i < size; i += 8) {
+        if(i) debug << Utility::Debug::nospace << ",";
+        std::size_t j = 0;
+        for(; j != 8 && i + j != size; ++j)
+            group[j] = value[i + j] ? '1' : '0';
+        group[j] = '\0';
+        debug << group;
+    }
+
+    return debug << Utility::Debug::nospace << "}";
+}
+
+}}
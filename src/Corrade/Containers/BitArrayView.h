@@ -0,0 +1,349 @@
+#ifndef Corrade_Containers_BitArrayView_h
+#define Corrade_Containers_BitArrayView_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::BasicBitArrayView, typedef @ref Corrade::Containers::BitArrayView, @ref Corrade::Containers::MutableBitArrayView
+ * @m_since_latest
+ */
+
+#include <cstddef>
+#include <type_traits>
+
+#include "Corrade/Containers/Containers.h"
+#include "Corrade/Containers/Optional.h"
+#include "Corrade/Utility/Assert.h"
+#include "Corrade/Utility/Utility.h"
+#include "Corrade/Utility/visibility.h"
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+    /* All of these operate on `size` bits starting at bit `offset` of
+       `data`, with `offset` being less than 8 */
+    CORRADE_UTILITY_EXPORT std::size_t bitCount(const char* data, std::size_t offset, std::size_t size);
+    /* Returns `size` if no bit is set */
+    CORRADE_UTILITY_EXPORT std::size_t bitFindFirstSet(const char* data, std::size_t offset, std::size_t size);
+    CORRADE_UTILITY_EXPORT void bitSetAll(char* data, std::size_t offset, std::size_t size, bool value);
+    CORRADE_UTILITY_EXPORT void bitInvert(char* data, std::size_t offset, std::size_t size);
+    CORRADE_UTILITY_EXPORT void bitAnd(char* data, std::size_t offset, const char* other, std::size_t otherOffset, std::size_t size);
+    CORRADE_UTILITY_EXPORT void bitOr(char* data, std::size_t offset, const char* other, std::size_t otherOffset, std::size_t size);
+    CORRADE_UTILITY_EXPORT void bitXor(char* data, std::size_t offset, const char* other, std::size_t otherOffset, std::size_t size);
+
+    enum: std::size_t {
+        BitArrayViewOffsetMask = 0x07,
+        BitArrayViewSizeShift = 3
+    };
+}
+
+/**
+@brief Bit array view
+@m_since_latest
+
+A non-owning view on a range of bits, packed eight to a byte. Compared to an
+@ref ArrayView of @cpp bool @ce values it needs eight times less memory, and
+operations on the whole view such as @ref count(), @ref findFirstSet(),
+@ref setAll() or @ref andWith() are done on 64-bit words instead of
+individual bits. The bits are stored in the same order as items in an array
+--- bit @cpp i @ce is the @cpp i % 8 @ce-th least significant bit of byte
+@cpp i / 8 @ce.
+
+The view doesn't need to start at a byte boundary, instead it has an
+@ref offset() of the first bit in the first byte, always less than
+@cpp 8 @ce. That allows taking arbitrary slices of the view. Because three
+bits of the size are used to store the offset, the maximum size is
+@cpp 2^29 - 1 @ce on 32-bit and @cpp 2^61 - 1 @ce on 64-bit systems.
+
+@section Containers-BasicBitArrayView-usage Usage
+
+@snippet Containers.cpp BitArrayView-usage
+
+The class is usually used through the @ref BitArrayView and
+@ref MutableBitArrayView typedefs, an owning variant is @ref BitArray, a
+variant with an arbitrary stride between the bits is
+@ref BasicStridedBitArrayView.
+@experimental
+*/
+template<class T> class BasicBitArrayView {
+    static_assert(std::is_same<typename std::remove_const<T>::type, char>::value, "only char and const char is supported");
+
+    public:
+        /**
+         * @brief Erased type
+         *
+         * Either a @cpp const void @ce or a @cpp void @ce.
+         */
+        typedef typename std::conditional<std::is_const<T>::value, const void, void>::type ErasedType;
+
+        /** @brief Default constructor */
+        constexpr /*implicit*/ BasicBitArrayView(std::nullptr_t = nullptr) noexcept: _data{}, _sizeOffset{} {}
+
+        /**
+         * @brief Constructor
+         * @param data      Pointer to the first byte
+         * @param offset    Offset of the first bit in the first byte. Expected
+         *      to be less than @cpp 8 @ce.
+         * @param size      Size in bits
+         */
+        /*implicit*/ BasicBitArrayView(ErasedType* data, std::size_t offset, std::size_t size) noexcept: _data{static_cast<T*>(data)}, _sizeOffset{(CORRADE_CONSTEXPR_ASSERT(offset < 8,
+            "Containers::BitArrayView: offset expected to be smaller than 8 bits, got" << offset),
+            CORRADE_CONSTEXPR_ASSERT(size < std::size_t{1} << (sizeof(std::size_t)*8 - Implementation::BitArrayViewSizeShift),
+            "Containers::BitArrayView: size expected to be smaller than 2^" << Utility::Debug::nospace << (sizeof(std::size_t)*8 - Implementation::BitArrayViewSizeShift) << "bits, got" << size),
+            size << Implementation::BitArrayViewSizeShift|offset)} {}
+
+        /**
+         * @brief Construct a view on a fixed-size array
+         *
+         * Takes all bits of the array, starting at offset @cpp 0 @ce.
+         */
+        template<std::size_t size> constexpr /*implicit*/ BasicBitArrayView(T(&data)[size]) noexcept: _data{data}, _sizeOffset{size*8 << Implementation::BitArrayViewSizeShift} {}
+
+        /** @brief Construct a @ref BitArrayView from a @ref MutableBitArrayView */
+        template<class U, class = typename std::enable_if<std::is_same<const U, T>::value>::type> /*implicit*/ BasicBitArrayView(const BasicBitArrayView<U>& mutable_) noexcept: _data{static_cast<T*>(mutable_.data())}, _sizeOffset{mutable_.size() << Implementation::BitArrayViewSizeShift|mutable_.offset()} {}
+
+        /** @brief Pointer to the first byte */
+        constexpr ErasedType* data() const { return _data; }
+
+        /** @brief Offset of the first bit in the first byte */
+        constexpr std::size_t offset() const {
+            return _sizeOffset & Implementation::BitArrayViewOffsetMask;
+        }
+
+        /** @brief Size in bits */
+        constexpr std::size_t size() const {
+            return _sizeOffset >> Implementation::BitArrayViewSizeShift;
+        }
+
+        /** @brief Whether the view is empty */
+        constexpr bool isEmpty() const { return !size(); }
+
+        /** @brief Bit at given position */
+        constexpr bool operator[](std::size_t i) const {
+            return _data[(offset() + i) >> 3] & (1 << ((offset() + i) & 0x07));
+        }
+
+        /**
+         * @brief Set a bit at given position
+         *
+         * Available only on a @ref MutableBitArrayView.
+         */
+        template<class U = T, class = typename std::enable_if<!std::is_const<U>::value>::type> void set(std::size_t i) const {
+            _data[(offset() + i) >> 3] |= char(1 << ((offset() + i) & 0x07));
+        }
+
+        /**
+         * @brief Reset a bit at given position
+         *
+         * Available only on a @ref MutableBitArrayView.
+         */
+        template<class U = T, class = typename std::enable_if<!std::is_const<U>::value>::type> void reset(std::size_t i) const {
+            _data[(offset() + i) >> 3] &= char(~(1 << ((offset() + i) & 0x07)));
+        }
+
+        /**
+         * @brief Set or reset a bit at given position
+         *
+         * Available only on a @ref MutableBitArrayView.
+         */
+        template<class U = T, class = typename std::enable_if<!std::is_const<U>::value>::type> void set(std::size_t i, bool value) const {
+            value ? set(i) : reset(i);
+        }
+
+        /**
+         * @brief Set all bits
+         *
+         * Available only on a @ref MutableBitArrayView. Bits outside of the
+         * view in the first and last byte are left untouched. To set a range
+         * of bits, call this function on a @ref slice().
+         */
+        template<class U = T, class = typename std::enable_if<!std::is_const<U>::value>::type> void setAll() const {
+            Implementation::bitSetAll(_data, offset(), size(), true);
+        }
+
+        /**
+         * @brief Reset all bits
+         *
+         * Available only on a @ref MutableBitArrayView.
+         * @see @ref setAll()
+         */
+        template<class U = T, class = typename std::enable_if<!std::is_const<U>::value>::type> void resetAll() const {
+            Implementation::bitSetAll(_data, offset(), size(), false);
+        }
+
+        /**
+         * @brief Set or reset all bits
+         *
+         * Available only on a @ref MutableBitArrayView.
+         * @see @ref setAll()
+         */
+        template<class U = T, class = typename std::enable_if<!std::is_const<U>::value>::type> void setAll(bool value) const {
+            Implementation::bitSetAll(_data, offset(), size(), value);
+        }
+
+        /**
+         * @brief Invert all bits
+         *
+         * Available only on a @ref MutableBitArrayView.
+         */
+        template<class U = T, class = typename std::enable_if<!std::is_const<U>::value>::type> void invert() const {
+            Implementation::bitInvert(_data, offset(), size());
+        }
+
+        /**
+         * @brief Bitwise AND with another view
+         *
+         * Available only on a @ref MutableBitArrayView. Expects that both
+         * views have the same size. The views can have different offsets,
+         * but the operation is fastest if they have the same.
+         */
+        template<class U = T, class = typename std::enable_if<!std::is_const<U>::value>::type> void andWith(BasicBitArrayView<const char> other) const;
+
+        /**
+         * @brief Bitwise OR with another view
+         *
+         * Available only on a @ref MutableBitArrayView.
+         * @see @ref andWith()
+         */
+        template<class U = T, class = typename std::enable_if<!std::is_const<U>::value>::type> void orWith(BasicBitArrayView<const char> other) const;
+
+        /**
+         * @brief Bitwise XOR with another view
+         *
+         * Available only on a @ref MutableBitArrayView.
+         * @see @ref andWith()
+         */
+        template<class U = T, class = typename std::enable_if<!std::is_const<U>::value>::type> void xorWith(BasicBitArrayView<const char> other) const;
+
+        /**
+         * @brief Count of set bits
+         *
+         * Uses the @cpp POPCNT @ce instruction on x86 if the CPU supports it,
+         * detected at runtime.
+         */
+        std::size_t count() const {
+            return Implementation::bitCount(_data, offset(), size());
+        }
+
+        /**
+         * @brief Position of the first set bit
+         *
+         * If no bit is set, returns @ref Containers::NullOpt.
+         */
+        Optional<std::size_t> findFirstSet() const;
+
+        /**
+         * @brief View slice
+         *
+         * Expects that @cpp begin <= end @ce and @p end is not larger than
+         * @ref size().
+         */
+        BasicBitArrayView<T> slice(std::size_t begin, std::size_t end) const {
+            CORRADE_ASSERT(begin <= end && end <= size(),
+                "Containers::BitArrayView::slice(): slice [" << Utility::Debug::nospace << begin << Utility::Debug::nospace << ":" << Utility::Debug::nospace << end << Utility::Debug::nospace << "] out of range for" << size() << "bits", {});
+            return BasicBitArrayView<T>{_data + ((offset() + begin) >> 3), (offset() + begin) & 0x07, end - begin};
+        }
+
+        /**
+         * @brief View prefix
+         *
+         * Equivalent to @cpp data.slice(0, end) @ce.
+         */
+        BasicBitArrayView<T> prefix(std::size_t end) const {
+            return slice(0, end);
+        }
+
+        /**
+         * @brief View suffix
+         *
+         * Equivalent to @cpp data.slice(begin, data.size()) @ce.
+         */
+        BasicBitArrayView<T> suffix(std::size_t begin) const {
+            return slice(begin, size());
+        }
+
+        /**
+         * @brief View prefix except the last @p count bits
+         *
+         * Equivalent to @cpp data.slice(0, data.size() - count) @ce.
+         */
+        BasicBitArrayView<T> except(std::size_t count) const {
+            return slice(0, size() - count);
+        }
+
+    private:
+        T* _data;
+        std::size_t _sizeOffset;
+};
+
+/**
+@brief Const bit array view
+@m_since_latest
+*/
+typedef BasicBitArrayView<const char> BitArrayView;
+
+/**
+@brief Mutable bit array view
+@m_since_latest
+*/
+typedef BasicBitArrayView<char> MutableBitArrayView;
+
+/**
+@debugoperator{BasicBitArrayView}
+@m_since_latest
+
+Prints the bits in the order they're stored, grouped by eight, for example
+@cb{.shell-session} {10010110, 101} @ce.
+*/
+CORRADE_UTILITY_EXPORT Utility::Debug& operator<<(Utility::Debug& debug, BitArrayView value);
+
+template<class T> template<class, class> void BasicBitArrayView<T>::andWith(const BasicBitArrayView<const char> other) const {
+    CORRADE_ASSERT(other.size() == size(),
+        "Containers::BitArrayView::andWith(): expected a view with" << size() << "bits but got" << other.size(), );
+    Implementation::bitAnd(_data, offset(), static_cast<const char*>(other.data()), other.offset(), size());
+}
+
+template<class T> template<class, class> void BasicBitArrayView<T>::orWith(const BasicBitArrayView<const char> other) const {
+    CORRADE_ASSERT(other.size() == size(),
+        "Containers::BitArrayView::orWith(): expected a view with" << size() << "bits but got" << other.size(), );
+    Implementation::bitOr(_data, offset(), static_cast<const char*>(other.data()), other.offset(), size());
+}
+
+template<class T> template<class, class> void BasicBitArrayView<T>::xorWith(const BasicBitArrayView<const char> other) const {
+    CORRADE_ASSERT(other.size() == size(),
+        "Containers::BitArrayView::xorWith(): expected a view with" << size() << "bits but got" << other.size(), );
+    Implementation::bitXor(_data, offset(), static_cast<const char*>(other.data()), other.offset(), size());
+}
+
+template<class T> Optional<std::size_t> BasicBitArrayView<T>::findFirstSet() const {
+    const std::size_t position = Implementation::bitFindFirstSet(_data, offset(), size());
+    if(position == size()) return {};
+    return position;
+}
+
+}}
+
+#endif
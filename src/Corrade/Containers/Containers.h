@@ -40,6 +40,7 @@ namespace Corrade { namespace Containers {
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template<class T, class = void(*)(T*, std::size_t)> class Array;
 template<class> class ArrayView;
+class ArrayArena;
 class ArrayTuple;
 template<std::size_t, class> class StaticArrayView;
 template<class T> using ArrayView1 = StaticArrayView<1, T>;
@@ -53,6 +54,15 @@ template<class T> using Array3 = StaticArray<3, T>;
 template<class T> using Array4 = StaticArray<4, T>;
 
 template<class T, std::size_t size = 1 << (sizeof(T)*8 - 6)> class BigEnumSet;
+template<class, std::size_t> class BigEnumSetIterator;
+
+class BitArray;
+template<class> class BasicBitArrayView;
+typedef BasicBitArrayView<const char> BitArrayView;
+typedef BasicBitArrayView<char> MutableBitArrayView;
+template<class> class BasicStridedBitArrayView;
+typedef BasicStridedBitArrayView<const char> StridedBitArrayView;
+typedef BasicStridedBitArrayView<char> MutableStridedBitArrayView;
 
 template<unsigned, class> class StridedDimensions;
 template<unsigned, class> class StridedArrayView;
@@ -63,22 +73,39 @@ template<class T> using StridedArrayView3D = StridedArrayView<3, T>;
 template<class T> using StridedArrayView4D = StridedArrayView<4, T>;
 
 template<class T, typename std::underlying_type<T>::type fullValue = typename std::underlying_type<T>::type(~0)> class EnumSet;
+template<class> class FreeList;
+template<class> class FreeListItem;
+template<class> class FreeListPointer;
+template<class, class, template<class> class> class HashMap;
 template<class> class LinkedList;
 template<class Derived, class List = LinkedList<Derived>> class LinkedListItem;
 
+template<class> class MpmcQueue;
+
+template<class> class ObjectPool;
+
 template<class> class Optional;
 template<class, class> class Pair;
 template<class> class Pointer;
+template<class> class PoolPointer;
 template<class> class Reference;
 template<class> class MoveReference;
 template<class> class AnyReference;
 
 class ScopeGuard;
+template<std::size_t, class> class SmallArray;
+template<class> class SpscQueue;
 
 class String;
 template<class> class BasicStringView;
 typedef BasicStringView<const char> StringView;
 typedef BasicStringView<char> MutableStringView;
+template<class> class BasicStringSplitter;
+typedef BasicStringSplitter<const char> StringSplitter;
+typedef BasicStringSplitter<char> MutableStringSplitter;
+template<class> class BasicStringSplitIterator;
+typedef BasicStringSplitIterator<const char> StringSplitIterator;
+typedef BasicStringSplitIterator<char> MutableStringSplitIterator;
 
 template<class, class, class> class Triple;
 #endif
@@ -0,0 +1,472 @@
+#ifndef Corrade_Containers_FreeList_h
+#define Corrade_Containers_FreeList_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::FreeList, @ref Corrade::Containers::FreeListItem, @ref Corrade::Containers::FreeListPointer
+ * @m_since_latest
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+#include "Corrade/Containers/ArrayView.h"
+#include "Corrade/Utility/Assert.h"
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+
+/* The list head is a pointer to the first item together with a modification
+   counter, which is incremented on every push and pop to avoid the ABA
+   problem. Both are kept at full width and updated together with a single
+   compare-and-swap. The counter isn't packed into the upper pointer bits, as
+   those aren't guaranteed to be unused -- Android on ARM64, MTE and HWASan
+   store a tag in the top byte and x86 with 5-level paging has 57-bit
+   addresses. */
+struct FreeListHead {
+    void* pointer;
+    std::uintptr_t tag;
+};
+
+#ifdef CORRADE_TARGET_32BIT
+/* Both fit into 64 bits, which can be exchanged lock-free on all supported
+   32-bit targets */
+class FreeListAtomicHead {
+    public:
+        explicit FreeListAtomicHead() noexcept: _data{0} {}
+
+        FreeListHead load(std::memory_order order) const {
+            return unpack(_data.load(order));
+        }
+
+        bool compareExchange(FreeListHead& expected, const FreeListHead& desired, std::memory_order success, std::memory_order failure) {
+            std::uint64_t data = pack(expected);
+            const bool exchanged = _data.compare_exchange_weak(data, pack(desired), success, failure);
+            expected = unpack(data);
+            return exchanged;
+        }
+
+    private:
+        static std::uint64_t pack(const FreeListHead& head) {
+            return std::uint64_t(reinterpret_cast<std::uintptr_t>(head.pointer))|std::uint64_t(head.tag) << 32;
+        }
+        static FreeListHead unpack(std::uint64_t data) {
+            return {reinterpret_cast<void*>(std::uintptr_t(data & 0xffffffffull)), std::uintptr_t(data >> 32)};
+        }
+
+        std::atomic<std::uint64_t> _data;
+};
+#elif defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+/* A 128-bit compare-and-swap can be emitted inline, use it. The std::atomic
+   equivalent goes through libatomic on GCC, which isn't lock-free and would
+   need an extra library to link to. The __sync builtins are full barriers,
+   so the memory order arguments are ignored. */
+__extension__ typedef unsigned __int128 FreeListAtomicHeadData;
+
+class FreeListAtomicHead {
+    public:
+        explicit FreeListAtomicHead() noexcept: _data{0} {}
+
+        FreeListHead load(std::memory_order) const {
+            /* A 128-bit load isn't atomic on its own, exchanging zero with
+               zero is */
+            return unpack(__sync_val_compare_and_swap(&_data, 0, 0));
+        }
+
+        bool compareExchange(FreeListHead& expected, const FreeListHead& desired, std::memory_order, std::memory_order) {
+            const FreeListAtomicHeadData data = pack(expected);
+            const FreeListAtomicHeadData previous = __sync_val_compare_and_swap(&_data, data, pack(desired));
+            expected = unpack(previous);
+            return previous == data;
+        }
+
+    private:
+        static FreeListAtomicHeadData pack(const FreeListHead& head) {
+            return FreeListAtomicHeadData(reinterpret_cast<std::uintptr_t>(head.pointer))|FreeListAtomicHeadData(head.tag) << 64;
+        }
+        static FreeListHead unpack(FreeListAtomicHeadData data) {
+            return {reinterpret_cast<void*>(std::uintptr_t(data)), std::uintptr_t(data >> 64)};
+        }
+
+        mutable FreeListAtomicHeadData _data;
+};
+#else
+/* No inline 128-bit compare-and-swap (MSVC, or GCC and Clang on x86-64
+   without -mcx16), guard the head with a spinlock */
+class FreeListAtomicHead {
+    public:
+        explicit FreeListAtomicHead() noexcept: _locked{false}, _head{} {}
+
+        FreeListHead load(std::memory_order) const {
+            lock();
+            const FreeListHead head = _head;
+            unlock();
+            return head;
+        }
+
+        bool compareExchange(FreeListHead& expected, const FreeListHead& desired, std::memory_order, std::memory_order) {
+            lock();
+            const bool exchanged = _head.pointer == expected.pointer && _head.tag == expected.tag;
+            if(exchanged) _head = desired;
+            else expected = _head;
+            unlock();
+            return exchanged;
+        }
+
+    private:
+        void lock() const {
+            while(_locked.exchange(true, std::memory_order_acquire)) {}
+        }
+        void unlock() const {
+            _locked.store(false, std::memory_order_release);
+        }
+
+        mutable std::atomic<bool> _locked;
+        FreeListHead _head;
+};
+#endif
+
+}
+
+/**
+@brief Lock-free intrusive free list
+@m_since_latest
+
+A LIFO stack of unused objects that any number of threads can concurrently
+@ref push() to and @ref pop() from without locking, useful for recycling
+objects across worker threads without going through the allocator. The
+objects are owned by the caller, the list only links them together through a
+pointer stored in the @ref FreeListItem base, so no allocation happens when
+adding or removing an item.
+
+@snippet Containers.cpp FreeList-usage
+
+The @ref acquire() function returns a @ref FreeListPointer, which puts the
+object back to the list on destruction, similarly to how a @ref Pointer
+deletes it.
+
+@section Containers-FreeList-implementation Implementation details
+
+The list is a Treiber stack with the head containing the pointer to the first
+item and a counter that gets incremented on every modification. That makes
+the compare-and-swap fail if the head got popped and pushed back by another
+thread in the meantime, even though the pointer is the same. Both the pointer
+and the counter are stored at full width, so any address can be pushed,
+including pointers with a tag in the upper bits on Android on ARM64, with
+MTE or HWASan, or addresses above 48 bits with 5-level paging.
+
+Updating the pointer together with the counter needs a double-width
+compare-and-swap. On 32-bit platforms that's a 64-bit operation, which is
+lock-free everywhere. On 64-bit platforms the list is lock-free only if the
+compiler can emit a 128-bit compare-and-swap inline, which is signalled by
+the @cpp __GCC_HAVE_SYNC_COMPARE_AND_SWAP_16 @ce macro on GCC and Clang ---
+for example on x86-64 with @cb{.sh} -mcx16 @ce or a @cb{.sh} -march @ce that
+implies it. Otherwise, and on MSVC, the head is guarded by a spinlock instead.
+The list is still safe to use from multiple threads, but a thread preempted
+while holding the lock stalls the others.
+
+Because a thread that lost the race may still read the next pointer of an
+item that another thread already popped, the items are expected to stay alive
+for the whole lifetime of the list, even when not in it --- which is the case
+for an object pool with a fixed set of objects.
+@see @ref LinkedList
+@experimental
+*/
+template<class T> class FreeList {
+    public:
+        /** @brief Construct an empty list */
+        explicit FreeList() noexcept {}
+
+        /**
+         * @brief Construct a list containing given items
+         *
+         * The items are pushed in reverse order so the first @ref pop()
+         * returns the first item.
+         */
+        explicit FreeList(ArrayView<T> items) noexcept: FreeList{} {
+            for(std::size_t i = items.size(); i != 0; --i) push(items[i - 1]);
+        }
+
+        /** @brief Copying is not allowed */
+        FreeList(const FreeList<T>&) = delete;
+
+        /**
+         * @brief Moving is not allowed
+         *
+         * The head is accessed atomically from multiple threads and
+         * @ref FreeListPointer instances reference the list, moving the
+         * instance would break them.
+         */
+        FreeList(FreeList<T>&&) = delete;
+
+        /** @brief Copying is not allowed */
+        FreeList<T>& operator=(const FreeList<T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        FreeList<T>& operator=(FreeList<T>&&) = delete;
+
+        /**
+         * @brief Whether the list is empty
+         *
+         * If called while other threads are pushing or popping, the value may
+         * be already outdated when returned.
+         */
+        bool isEmpty() const {
+            return !_head.load(std::memory_order_acquire).pointer;
+        }
+
+        /**
+         * @brief Push an item to the list
+         *
+         * Expects that the item isn't in the list already.
+         */
+        void push(T& item);
+
+        /**
+         * @brief Pop an item from the list
+         *
+         * Returns the most recently pushed item or @cpp nullptr @ce if the
+         * list is empty.
+         */
+        T* pop();
+
+        /**
+         * @brief Acquire an item from the list
+         *
+         * Like @ref pop(), but returns a handle that pushes the item back
+         * to the list on destruction. The handle is null if the list is
+         * empty.
+         */
+        FreeListPointer<T> acquire();
+
+    private:
+        Implementation::FreeListAtomicHead _head;
+};
+
+/**
+@brief Free list item
+@m_since_latest
+
+Base class for items stored in a @ref FreeList. Use it via the CRTP pattern,
+similarly to @ref LinkedListItem:
+
+@snippet Containers.cpp FreeList-usage
+
+The item contains a single atomic pointer, which is used only while the item
+is in a list. The item can be in at most one list at a time.
+@experimental
+*/
+template<class Derived> class FreeListItem {
+    friend FreeList<Derived>;
+
+    protected:
+        /**
+         * @brief Default constructor
+         *
+         * Creates an item that's not in any list.
+         */
+        FreeListItem() noexcept: _freeListNext{nullptr} {}
+
+        /** @brief Copying is not allowed */
+        FreeListItem(const FreeListItem<Derived>&) = delete;
+
+        /** @brief Moving is not allowed */
+        FreeListItem(FreeListItem<Derived>&&) = delete;
+
+        ~FreeListItem() = default;
+
+        /** @brief Copying is not allowed */
+        FreeListItem<Derived>& operator=(const FreeListItem<Derived>&) = delete;
+
+        /** @brief Moving is not allowed */
+        FreeListItem<Derived>& operator=(FreeListItem<Derived>&&) = delete;
+
+    private:
+        std::atomic<Derived*> _freeListNext;
+};
+
+/**
+@brief Free list pointer
+@m_since_latest
+
+A move-only handle to an item acquired from a @ref FreeList, similar to
+@ref Pointer. Instead of deleting the item, it's pushed back to the list on
+destruction.
+@see @ref FreeList::acquire()
+@experimental
+*/
+template<class T> class FreeListPointer {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Creates a null pointer.
+         */
+        /*implicit*/ FreeListPointer(std::nullptr_t = nullptr) noexcept: _list{}, _pointer{} {}
+
+        /**
+         * @brief Construct from a list and an item
+         *
+         * Takes ownership of @p pointer, which is pushed back to @p list on
+         * destruction. The @p pointer is expected to not be in @p list.
+         */
+        explicit FreeListPointer(FreeList<T>& list, T* pointer) noexcept: _list{&list}, _pointer{pointer} {}
+
+        /** @brief Copying is not allowed */
+        FreeListPointer(const FreeListPointer<T>&) = delete;
+
+        /** @brief Move constructor */
+        FreeListPointer(FreeListPointer<T>&& other) noexcept: _list{other._list}, _pointer{other._pointer} {
+            other._pointer = nullptr;
+        }
+
+        /**
+         * @brief Destructor
+         *
+         * Pushes the item back to the list, if non-null.
+         */
+        ~FreeListPointer() {
+            if(_pointer) _list->push(*_pointer);
+        }
+
+        /** @brief Copying is not allowed */
+        FreeListPointer<T>& operator=(const FreeListPointer<T>&) = delete;
+
+        /** @brief Move assignment */
+        FreeListPointer<T>& operator=(FreeListPointer<T>&& other) noexcept {
+            std::swap(_list, other._list);
+            std::swap(_pointer, other._pointer);
+            return *this;
+        }
+
+        /**
+         * @brief Whether the pointer is non-null
+         *
+         * Returns @cpp false @ce if stored pointer is @cpp nullptr @ce,
+         * @cpp true @ce otherwise.
+         */
+        explicit operator bool() const { return _pointer; }
+
+        /** @brief Equality comparison to a null pointer */
+        bool operator==(std::nullptr_t) const { return !_pointer; }
+
+        /** @brief Non-equality comparison to a null pointer */
+        bool operator!=(std::nullptr_t) const { return _pointer; }
+
+        /**
+         * @brief List the item gets returned to
+         *
+         * Can be @cpp nullptr @ce only for a default-constructed instance.
+         */
+        FreeList<T>* list() const { return _list; }
+
+        /** @brief Underlying pointer value */
+        T* get() { return _pointer; }
+        const T* get() const { return _pointer; } /**< @overload */
+
+        /**
+         * @brief Access the underlying pointer
+         *
+         * Expects that the pointer is not @cpp nullptr @ce.
+         */
+        T* operator->() {
+            CORRADE_ASSERT(_pointer, "Containers::FreeListPointer: the pointer is null", nullptr);
+            return _pointer;
+        }
+
+        /** @overload */
+        const T* operator->() const {
+            CORRADE_ASSERT(_pointer, "Containers::FreeListPointer: the pointer is null", nullptr);
+            return _pointer;
+        }
+
+        /**
+         * @brief Access the underlying pointer
+         *
+         * Expects that the pointer is not @cpp nullptr @ce.
+         */
+        T& operator*() {
+            CORRADE_ASSERT(_pointer, "Containers::FreeListPointer: the pointer is null", *_pointer);
+            return *_pointer;
+        }
+
+        /** @overload */
+        const T& operator*() const {
+            CORRADE_ASSERT(_pointer, "Containers::FreeListPointer: the pointer is null", *_pointer);
+            return *_pointer;
+        }
+
+        /**
+         * @brief Release the pointer ownership
+         *
+         * Resets the stored pointer to @cpp nullptr @ce, returning the
+         * previous value. The item isn't pushed back to the list.
+         */
+        T* release() {
+            T* const out = _pointer;
+            _pointer = nullptr;
+            return out;
+        }
+
+    private:
+        FreeList<T>* _list;
+        T* _pointer;
+};
+
+template<class T> void FreeList<T>::push(T& item) {
+    Implementation::FreeListHead head = _head.load(std::memory_order_relaxed);
+    do {
+        item._freeListNext.store(static_cast<T*>(head.pointer), std::memory_order_relaxed);
+    } while(!_head.compareExchange(head, Implementation::FreeListHead{&item, head.tag + 1}, std::memory_order_release, std::memory_order_relaxed));
+}
+
+template<class T> T* FreeList<T>::pop() {
+    Implementation::FreeListHead head = _head.load(std::memory_order_acquire);
+    for(;;) {
+        T* const item = static_cast<T*>(head.pointer);
+        if(!item) return nullptr;
+
+        /* If another thread popped the item in the meantime, the next
+           pointer may be already a different one, but then the tag differs
+           as well and the exchange fails. On failure the head gets updated
+           to the current value. */
+        T* const next = item->_freeListNext.load(std::memory_order_relaxed);
+        if(_head.compareExchange(head, Implementation::FreeListHead{next, head.tag + 1}, std::memory_order_acquire, std::memory_order_acquire))
+            return item;
+    }
+}
+
+template<class T> FreeListPointer<T> FreeList<T>::acquire() {
+    T* const item = pop();
+    return item ? FreeListPointer<T>{*this, item} : FreeListPointer<T>{};
+}
+
+}}
+
+#endif
@@ -0,0 +1,639 @@
+#ifndef Corrade_Containers_HashMap_h
+#define Corrade_Containers_HashMap_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::HashMap
+ * @m_since_latest
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <utility> /* std::swap() */
+
+#include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/Containers/Pair.h"
+#include "Corrade/Containers/StringView.h"
+#include "Corrade/Utility/visibility.h"
+
+#ifdef CORRADE_TARGET_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef CORRADE_TARGET_NEON
+#include <arm_neon.h>
+#endif
+#ifdef CORRADE_TARGET_MSVC
+#include <intrin.h>
+#endif
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+
+/* Each item has a control byte. Empty and deleted items have the highest
+   bit set, occupied items store the low seven bits of the hash there, so most
+   mismatches are filtered out without touching the items themselves. */
+enum: signed char {
+    HashMapEmpty = -128,
+    HashMapDeleted = -2
+};
+
+enum: std::size_t {
+    /* Control bytes of this many consecutive items are matched at once. The
+       first group is mirrored after the end of the control array so a group
+       can be loaded from any position without wrapping around. */
+    HashMapGroupSize = 16
+};
+
+/* On NEON there's no movemask, the mask has four bits per item instead of
+   one and only the highest of them is kept */
+#ifdef CORRADE_TARGET_NEON
+typedef std::uint64_t HashMapGroupMask;
+enum: unsigned { HashMapGroupMaskShift = 2 };
+#else
+typedef std::uint32_t HashMapGroupMask;
+enum: unsigned { HashMapGroupMaskShift = 0 };
+#endif
+
+inline unsigned hashMapTrailingZeros(HashMapGroupMask mask) {
+    #ifdef CORRADE_TARGET_GCC
+    return sizeof(HashMapGroupMask) == 8 ? __builtin_ctzll(mask) : __builtin_ctz(unsigned(mask));
+    #elif defined(CORRADE_TARGET_MSVC)
+    unsigned long index;
+    if(sizeof(HashMapGroupMask) == 4 || std::uint32_t(mask)) {
+        _BitScanForward(&index, std::uint32_t(mask));
+        return index;
+    }
+    _BitScanForward(&index, std::uint32_t(std::uint64_t(mask) >> 32));
+    return index + 32;
+    #else
+    unsigned index = 0;
+    while(!(mask & 1)) {
+        mask >>= 1;
+        ++index;
+    }
+    return index;
+    #endif
+}
+
+/* Index of the lowest matching item in the group, the mask is expected to be
+   non-zero */
+inline std::size_t hashMapGroupMaskFirst(HashMapGroupMask mask) {
+    return hashMapTrailingZeros(mask) >> HashMapGroupMaskShift;
+}
+
+/* Items in the group that have given control byte */
+inline HashMapGroupMask hashMapGroupMatch(const signed char* const group, const signed char value) {
+    #ifdef CORRADE_TARGET_SSE2
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(value), _mm_loadu_si128(reinterpret_cast<const __m128i*>(group))));
+    #elif defined(CORRADE_TARGET_NEON)
+    const uint8x16_t eq = vceqq_s8(vdupq_n_s8(value), vld1q_s8(group));
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0) & 0x8888888888888888ull;
+    #else
+    HashMapGroupMask mask = 0;
+    for(std::size_t i = 0; i != HashMapGroupSize; ++i)
+        if(group[i] == value) mask |= 1u << i;
+    return mask;
+    #endif
+}
+
+/* Items in the group that are empty or deleted */
+inline HashMapGroupMask hashMapGroupMatchFree(const signed char* const group) {
+    #ifdef CORRADE_TARGET_SSE2
+    return _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(group)));
+    #elif defined(CORRADE_TARGET_NEON)
+    const uint8x16_t free = vcltq_s8(vld1q_s8(group), vdupq_n_s8(0));
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(free), 4)), 0) & 0x8888888888888888ull;
+    #else
+    HashMapGroupMask mask = 0;
+    for(std::size_t i = 0; i != HashMapGroupSize; ++i)
+        if(group[i] < 0) mask |= 1u << i;
+    return mask;
+    #endif
+}
+
+/* Hashes arbitrary bytes, used for string keys */
+CORRADE_UTILITY_EXPORT std::size_t hashMapHash(const char* data, std::size_t size);
+
+/* Scrambles an integer so both the item position and the control byte have
+   enough entropy. Finalizer from MurmurHash3. */
+inline std::size_t hashMapHash(std::size_t value) {
+    #ifndef CORRADE_TARGET_32BIT
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdull;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ull;
+    value ^= value >> 33;
+    #else
+    value ^= value >> 16;
+    value *= 0x85ebca6bu;
+    value ^= value >> 13;
+    value *= 0xc2b2ae35u;
+    value ^= value >> 16;
+    #endif
+    return value;
+}
+
+/* Specialize to make a custom type usable as a key. LookupType is what the
+   lookup functions accept, which can be different from the key type. */
+template<class T, class = void> struct HashMapTraits;
+template<class T> struct HashMapTraits<T, typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type> {
+    typedef T LookupType;
+    static std::size_t hash(T value) {
+        /* Integers and enums larger than 64 bits aren't a thing, so this
+           cast is enough */
+        return hashMapHash(std::size_t(value));
+    }
+    static bool equals(T a, T b) { return a == b; }
+};
+/* Pointers can't be cast to an integer with a functional cast */
+template<class T> struct HashMapTraits<T*> {
+    typedef T* LookupType;
+    static std::size_t hash(T* value) {
+        return hashMapHash(reinterpret_cast<std::size_t>(value));
+    }
+    static bool equals(T* a, T* b) { return a == b; }
+};
+template<> struct HashMapTraits<StringView> {
+    typedef StringView LookupType;
+    static std::size_t hash(StringView value) {
+        return hashMapHash(value.data(), value.size());
+    }
+    /* Inlined, as opposed to StringView::operator==() */
+    static bool equals(StringView a, StringView b) {
+        return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size()) == 0;
+    }
+};
+/* Strings are looked up through a view, which doesn't need to allocate */
+template<> struct HashMapTraits<String>: HashMapTraits<StringView> {};
+
+/* What the iterator dereferences to. The key is accessible only through a
+   const reference as modifying it would break the lookup. Value is const for
+   iterating a const map. */
+template<class Key, class Value> class HashMapItem {
+    public:
+        typedef typename std::conditional<std::is_const<Value>::value, const Pair<Key, typename std::remove_const<Value>::type>, Pair<Key, Value>>::type Slot;
+
+        explicit HashMapItem(Slot* slot) noexcept: _slot{slot} {}
+
+        const Key& key() const { return _slot->first(); }
+        Value& value() const { return _slot->second(); }
+
+    private:
+        template<class, class> friend class HashMapIterator;
+
+        Slot* _slot;
+};
+
+template<class Key, class Value> class HashMapIterator {
+    public:
+        typedef typename HashMapItem<Key, Value>::Slot Slot;
+
+        /*implicit*/ HashMapIterator(const signed char* control, Slot* slot, Slot* end) noexcept: _control{control}, _item{slot}, _end{end} {
+            skip();
+        }
+
+        const HashMapItem<Key, Value>& operator*() const { return _item; }
+        const HashMapItem<Key, Value>* operator->() const { return &_item; }
+
+        HashMapIterator<Key, Value>& operator++() {
+            ++_control;
+            ++_item._slot;
+            skip();
+            return *this;
+        }
+
+        bool operator==(const HashMapIterator<Key, Value>& other) const {
+            return _item._slot == other._item._slot;
+        }
+        bool operator!=(const HashMapIterator<Key, Value>& other) const {
+            return _item._slot != other._item._slot;
+        }
+
+    private:
+        void skip() {
+            while(_item._slot != _end && *_control < 0) {
+                ++_control;
+                ++_item._slot;
+            }
+        }
+
+        const signed char* _control;
+        HashMapItem<Key, Value> _item;
+        Slot* _end;
+};
+
+}
+
+/**
+@brief Open-addressing hash map
+@m_since_latest
+
+An unordered associative container storing its keys and values contiguously
+in a single array instead of allocating a node for each item like
+@ref std::unordered_map does. This makes lookups significantly more
+cache-friendly and insertions don't allocate except when the map needs to
+grow.
+
+@snippet Containers.cpp HashMap-usage
+
+@section Containers-HashMap-storage Storage and lookup
+
+Each item has an associated control byte that's either empty, deleted, or
+contains the low seven bits of the key hash. Lookup starts at a position
+given by the remaining hash bits and compares control bytes of 16
+consecutive items at once --- with SSE2 or NEON it's a single vector
+comparison. Only items where the control byte matches have their keys
+compared, which means that even in a heavily-loaded map only rarely more
+than a single key comparison is needed.
+
+The capacity is always a power of two and at least 16. The map grows to
+double the capacity once it's more than 7/8 full, or gets rehashed in-place if
+most of the space is occupied by removed items. Both cases move all items to
+new memory, invalidating any pointers to them and iterators.
+
+@section Containers-HashMap-keys Key types
+
+Integers, enums and pointers can be used as keys directly. For
+@ref String and @ref StringView keys, lookup is done through a
+@ref StringView, so looking up a @ref String key with a string literal or a
+view on some other data doesn't allocate. A @ref String is constructed only
+when a new item gets inserted:
+
+@snippet Containers.cpp HashMap-usage-strings
+
+With a @ref StringView key the map doesn't own the key data, it's the user
+responsibility to ensure the viewed memory stays in scope for as long as the
+map uses it.
+
+@section Containers-HashMap-allocators Allocators
+
+The item and control byte memory is allocated using the same allocator
+concept as @ref Containers-Array-growable "growable arrays", the
+@p Allocator template is instantiated for @cpp Pair<Key, Value> @ce and
+@cpp signed char @ce. By default @ref ArrayAllocator is used, which picks
+@ref ArrayMallocAllocator for trivially copyable types and
+@ref ArrayNewAllocator otherwise. Any other allocator such as
+@ref ArrayArenaAllocator can be used as well.
+
+The key and value types are expected to be nothrow move-constructible.
+@experimental
+*/
+template<class Key, class Value, template<class> class Allocator
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    = ArrayAllocator
+    #endif
+> class HashMap {
+    public:
+        /**
+         * @brief Lookup type
+         *
+         * Type accepted by @ref find(), @ref contains() and @ref remove(). For
+         * @ref String keys it's a @ref StringView, otherwise it's the same as
+         * @p Key.
+         */
+        typedef typename Implementation::HashMapTraits<Key>::LookupType LookupType;
+
+        /**
+         * @brief Default constructor
+         *
+         * Doesn't allocate. The map gets allocated on first insertion or on
+         * a call to @ref reserve().
+         */
+        /*implicit*/ HashMap() noexcept: _control{}, _slots{}, _capacity{}, _size{}, _growthLeft{} {}
+
+        /** @brief Copying is not allowed */
+        HashMap(const HashMap<Key, Value, Allocator>&) = delete;
+
+        /** @brief Move constructor */
+        HashMap(HashMap<Key, Value, Allocator>&& other) noexcept: _control{other._control}, _slots{other._slots}, _capacity{other._capacity}, _size{other._size}, _growthLeft{other._growthLeft} {
+            other._control = nullptr;
+            other._slots = nullptr;
+            other._capacity = other._size = other._growthLeft = 0;
+        }
+
+        /** @brief Destructor */
+        ~HashMap() {
+            destruct();
+            deallocate();
+        }
+
+        /** @brief Copying is not allowed */
+        HashMap<Key, Value, Allocator>& operator=(const HashMap<Key, Value, Allocator>&) = delete;
+
+        /** @brief Move assignment */
+        HashMap<Key, Value, Allocator>& operator=(HashMap<Key, Value, Allocator>&& other) noexcept {
+            using std::swap;
+            swap(_control, other._control);
+            swap(_slots, other._slots);
+            swap(_capacity, other._capacity);
+            swap(_size, other._size);
+            swap(_growthLeft, other._growthLeft);
+            return *this;
+        }
+
+        /** @brief Count of items in the map */
+        std::size_t size() const { return _size; }
+
+        /** @brief Whether the map is empty */
+        bool isEmpty() const { return !_size; }
+
+        /**
+         * @brief Map capacity
+         *
+         * Count of allocated items. Items get inserted without growing the
+         * map until 7/8 of the capacity is occupied.
+         */
+        std::size_t capacity() const { return _capacity; }
+
+        /**
+         * @brief Reserve capacity for given count of items
+         *
+         * If the map can't already hold @p size items without growing,
+         * reallocates it to a capacity that can, moving all existing items to
+         * the new memory.
+         */
+        void reserve(std::size_t size);
+
+        /**
+         * @brief Find a value
+         *
+         * Returns a pointer to a value associated with @p key or
+         * @cpp nullptr @ce if there's no such key.
+         */
+        Value* find(LookupType key);
+        const Value* find(LookupType key) const; /**< @overload */
+
+        /** @brief Whether the map contains given key */
+        bool contains(LookupType key) const {
+            return findIndex(key) != ~std::size_t{};
+        }
+
+        /**
+         * @brief Insert a value constructed in-place
+         *
+         * If @p key isn't present, constructs a new key from @p key and a
+         * new value from @p args, and returns a pointer to the value together
+         * with @cpp true @ce. Otherwise returns a pointer to the existing
+         * value together with @cpp false @ce, without constructing anything.
+         */
+        template<class K, class ...Args> Pair<Value*, bool> emplace(K&& key, Args&&... args);
+
+        /**
+         * @brief Insert a value
+         *
+         * Equivalent to calling @ref emplace() with @p value as the only
+         * argument. An existing value is not overwritten.
+         */
+        template<class K, class V> Pair<Value*, bool> insert(K&& key, V&& value) {
+            return emplace(Utility::forward<K>(key), Utility::forward<V>(value));
+        }
+
+        /**
+         * @brief Access a value, inserting a default-constructed one if not present
+         */
+        template<class K> Value& operator[](K&& key) {
+            return *emplace(Utility::forward<K>(key)).first();
+        }
+
+        /**
+         * @brief Remove a value
+         *
+         * Returns @cpp true @ce if @p key was present, @cpp false @ce
+         * otherwise. Doesn't reallocate, the removed item is only marked as
+         * deleted and reused by a later insertion.
+         */
+        bool remove(LookupType key);
+
+        /**
+         * @brief Clear the map
+         *
+         * Destructs all items, keeping the capacity.
+         */
+        void clear();
+
+        /**
+         * @brief Iterator to the first item
+         *
+         * The items are iterated in an unspecified order. Dereferencing the
+         * iterator gives an item with a @cpp key() @ce accessor returning a
+         * const reference, as modifying the key would break the lookup, and a
+         * @cpp value() @ce accessor returning a mutable reference:
+         *
+         * @snippet Containers.cpp HashMap-iteration
+         */
+        Implementation::HashMapIterator<Key, Value> begin() {
+            return {_control, _slots, _slots + _capacity};
+        }
+        /** @overload */
+        Implementation::HashMapIterator<Key, const Value> begin() const {
+            return {_control, _slots, _slots + _capacity};
+        }
+        /** @overload */
+        Implementation::HashMapIterator<Key, const Value> cbegin() const {
+            return begin();
+        }
+
+        /** @brief Iterator to (one item after) the last item */
+        Implementation::HashMapIterator<Key, Value> end() {
+            return {nullptr, _slots + _capacity, _slots + _capacity};
+        }
+        /** @overload */
+        Implementation::HashMapIterator<Key, const Value> end() const {
+            return {nullptr, _slots + _capacity, _slots + _capacity};
+        }
+        /** @overload */
+        Implementation::HashMapIterator<Key, const Value> cend() const {
+            return end();
+        }
+
+    private:
+        typedef Implementation::HashMapTraits<Key> Traits;
+
+        /* Returns ~std::size_t{} if not found */
+        std::size_t findIndex(LookupType key) const;
+        /* Expects that there's at least one free item */
+        std::size_t findFreeIndex(std::size_t hash) const;
+        void setControl(std::size_t i, signed char value) {
+            _control[i] = value;
+            if(i < Implementation::HashMapGroupSize)
+                _control[_capacity + i] = value;
+        }
+        void rehash(std::size_t capacity);
+        /* Same as in constructHelpers.h, {} is preferred but () is needed
+           for an explicit default constructor */
+        template<class First, class ...Next> static Value makeValue(First&& first, Next&&... next) {
+            return Value{Utility::forward<First>(first), Utility::forward<Next>(next)...};
+        }
+        static Value makeValue() { return Value(); }
+        void destruct();
+        void deallocate();
+
+        signed char* _control;
+        Pair<Key, Value>* _slots;
+        std::size_t _capacity, _size, _growthLeft;
+};
+
+template<class Key, class Value, template<class> class Allocator> std::size_t HashMap<Key, Value, Allocator>::findIndex(const LookupType key) const {
+    /* Also catches the case of nothing being allocated yet */
+    if(!_size) return ~std::size_t{};
+
+    const std::size_t hash = Traits::hash(key);
+    const signed char control = hash & 0x7f;
+    const std::size_t mask = _capacity - 1;
+    std::size_t position = (hash >> 7) & mask;
+    for(std::size_t step = Implementation::HashMapGroupSize; ; step += Implementation::HashMapGroupSize) {
+        const signed char* const group = _control + position;
+        for(Implementation::HashMapGroupMask match = Implementation::hashMapGroupMatch(group, control); match; match &= match - 1) {
+            const std::size_t i = (position + Implementation::hashMapGroupMaskFirst(match)) & mask;
+            if(Traits::equals(_slots[i].first(), key)) return i;
+        }
+
+        /* An empty item means the probe sequence ends here. There's always
+           at least one as the map never gets completely full. */
+        if(Implementation::hashMapGroupMatch(group, Implementation::HashMapEmpty))
+            return ~std::size_t{};
+
+        /* Triangular probing visits all groups for power-of-two capacities */
+        position = (position + step) & mask;
+    }
+}
+
+template<class Key, class Value, template<class> class Allocator> std::size_t HashMap<Key, Value, Allocator>::findFreeIndex(const std::size_t hash) const {
+    const std::size_t mask = _capacity - 1;
+    std::size_t position = (hash >> 7) & mask;
+    for(std::size_t step = Implementation::HashMapGroupSize; ; step += Implementation::HashMapGroupSize) {
+        if(const Implementation::HashMapGroupMask match = Implementation::hashMapGroupMatchFree(_control + position))
+            return (position + Implementation::hashMapGroupMaskFirst(match)) & mask;
+        position = (position + step) & mask;
+    }
+}
+
+template<class Key, class Value, template<class> class Allocator> Value* HashMap<Key, Value, Allocator>::find(const LookupType key) {
+    const std::size_t i = findIndex(key);
+    return i == ~std::size_t{} ? nullptr : &_slots[i].second();
+}
+
+template<class Key, class Value, template<class> class Allocator> const Value* HashMap<Key, Value, Allocator>::find(const LookupType key) const {
+    const std::size_t i = findIndex(key);
+    return i == ~std::size_t{} ? nullptr : &_slots[i].second();
+}
+
+template<class Key, class Value, template<class> class Allocator> template<class K, class ...Args> Pair<Value*, bool> HashMap<Key, Value, Allocator>::emplace(K&& key, Args&&... args) {
+    const LookupType lookup = key;
+    const std::size_t found = findIndex(lookup);
+    if(found != ~std::size_t{}) return {&_slots[found].second(), false};
+
+    /* If there's no space left, either grow or, if there's a lot of deleted
+       items, just rehash to get rid of them */
+    if(!_growthLeft)
+        rehash(_size >= _capacity*7/16 ? (_capacity ? _capacity*2 : std::size_t(Implementation::HashMapGroupSize)) : _capacity);
+
+    const std::size_t hash = Traits::hash(lookup);
+    const std::size_t i = findFreeIndex(hash);
+    /* Deleted items don't count towards the free space */
+    if(_control[i] == Implementation::HashMapEmpty) --_growthLeft;
+    setControl(i, hash & 0x7f);
+    Implementation::construct(_slots[i], Key(Utility::forward<K>(key)), makeValue(Utility::forward<Args>(args)...));
+    ++_size;
+    return {&_slots[i].second(), true};
+}
+
+template<class Key, class Value, template<class> class Allocator> bool HashMap<Key, Value, Allocator>::remove(const LookupType key) {
+    const std::size_t i = findIndex(key);
+    if(i == ~std::size_t{}) return false;
+
+    _slots[i].~Pair<Key, Value>();
+    setControl(i, Implementation::HashMapDeleted);
+    --_size;
+    return true;
+}
+
+template<class Key, class Value, template<class> class Allocator> void HashMap<Key, Value, Allocator>::clear() {
+    destruct();
+    if(_capacity) {
+        std::memset(_control, Implementation::HashMapEmpty, _capacity + Implementation::HashMapGroupSize);
+        _growthLeft = _capacity*7/8;
+    }
+    _size = 0;
+}
+
+template<class Key, class Value, template<class> class Allocator> void HashMap<Key, Value, Allocator>::reserve(const std::size_t size) {
+    if(size <= _size + _growthLeft) return;
+
+    std::size_t capacity = Implementation::HashMapGroupSize;
+    while(capacity*7/8 < size) capacity *= 2;
+    rehash(capacity);
+}
+
+template<class Key, class Value, template<class> class Allocator> void HashMap<Key, Value, Allocator>::rehash(const std::size_t capacity) {
+    static_assert(std::is_nothrow_move_constructible<Key>::value && std::is_nothrow_move_constructible<Value>::value,
+        "nothrow move-constructible key and value types are required");
+
+    signed char* const oldControl = _control;
+    Pair<Key, Value>* const oldSlots = _slots;
+    const std::size_t oldCapacity = _capacity;
+
+    _control = Allocator<signed char>::allocate(capacity + Implementation::HashMapGroupSize);
+    _slots = Allocator<Pair<Key, Value>>::allocate(capacity);
+    _capacity = capacity;
+    _growthLeft = capacity*7/8 - _size;
+    std::memset(_control, Implementation::HashMapEmpty, capacity + Implementation::HashMapGroupSize);
+
+    /* There are no deleted items in the new memory so the lookup can be
+       skipped */
+    for(std::size_t i = 0; i != oldCapacity; ++i) {
+        if(oldControl[i] < 0) continue;
+        Pair<Key, Value>& slot = oldSlots[i];
+        const std::size_t hash = Traits::hash(slot.first());
+        const std::size_t j = findFreeIndex(hash);
+        setControl(j, hash & 0x7f);
+        Implementation::construct(_slots[j], Utility::move(slot));
+        slot.~Pair<Key, Value>();
+    }
+
+    if(oldCapacity) {
+        Allocator<signed char>::deallocate(oldControl);
+        Allocator<Pair<Key, Value>>::deallocate(oldSlots);
+    }
+}
+
+template<class Key, class Value, template<class> class Allocator> void HashMap<Key, Value, Allocator>::destruct() {
+    if(!_size) return;
+    for(std::size_t i = 0; i != _capacity; ++i)
+        if(_control[i] >= 0) _slots[i].~Pair<Key, Value>();
+}
+
+template<class Key, class Value, template<class> class Allocator> void HashMap<Key, Value, Allocator>::deallocate() {
+    if(!_capacity) return;
+    Allocator<signed char>::deallocate(_control);
+    Allocator<Pair<Key, Value>>::deallocate(_slots);
+}
+
+}}
+
+#endif
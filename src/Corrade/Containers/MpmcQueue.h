@@ -0,0 +1,313 @@
+#ifndef Corrade_Containers_MpmcQueue_h
+#define Corrade_Containers_MpmcQueue_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+/** @file
+ * @brief Class @ref Corrade::Containers::MpmcQueue
+ * @m_since_latest
+ */
+
+#include <atomic>
+
+#include "Corrade/Tags.h"
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/constructHelpers.h"
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+
+/* A queue item together with a sequence number telling whether it's ready
+   to be written to or read from in given round. The union makes it possible
+   to have an Array of these without T being default-constructible and
+   without calling destructors on items that were never constructed. */
+template<class T> struct MpmcQueueSlot {
+    MpmcQueueSlot() {}
+    ~MpmcQueueSlot() {}
+
+    std::atomic<std::size_t> sequence;
+    union {
+        T value;
+    };
+};
+
+}
+
+/**
+@brief Lock-free bounded multi-producer multi-consumer queue
+@m_since_latest
+
+A fixed-capacity FIFO queue for passing items between any number of threads
+without locking. Any thread is allowed to call @ref push() and @ref pop(),
+concurrently. If there's just a single producer and a single consumer,
+@ref SpscQueue has a lower overhead.
+
+@snippet Containers.cpp MpmcQueue-usage
+
+@section Containers-MpmcQueue-storage Storage and capacity
+
+The items are stored in a @ref Array allocated upfront, no allocations happen
+afterwards. The capacity is rounded up to the nearest power of two and is at
+least @cpp 2 @ce. Each item has a sequence number next to it that tells
+whether the item is ready to be written or read in the current round of the
+ring, which means producers and consumers synchronize only on the item they're
+accessing and on a single atomic index for each side. Item construction and
+destruction happens outside of any critical section. The producer and
+consumer indices are kept at least a cache line apart from each other and from
+the rest of the state using explicit padding, so the queue isn't over-aligned
+and can be allocated with a plain @cpp new @ce even before C++17.
+
+The queue is linearizable only per item --- if a producer thread gets
+preempted between claiming an item and filling it, consumers see the queue as
+empty at that position until it's done, even though items pushed later by
+other producers may be already complete.
+
+@section Containers-MpmcQueue-initialization Item construction
+
+Same as with @ref SpscQueue, items can be constructed in-place with
+@ref push(Corrade::InPlaceInitT, Args&&... args) and popped into
+uninitialized memory with @ref pop(Corrade::NoInitT, T*).
+@see @ref SpscQueue
+@experimental
+*/
+template<class T> class MpmcQueue {
+    public:
+        /**
+         * @brief Constructor
+         * @param capacity  Minimal queue capacity. Expected to be non-zero,
+         *      rounded up to the nearest power of two, but at least
+         *      @cpp 2 @ce.
+         */
+        explicit MpmcQueue(std::size_t capacity);
+
+        /** @brief Copying is not allowed */
+        MpmcQueue(const MpmcQueue<T>&) = delete;
+
+        /**
+         * @brief Moving is not allowed
+         *
+         * The indices are accessed atomically from multiple threads, moving
+         * the instance would break them.
+         */
+        MpmcQueue(MpmcQueue<T>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Calls destructors on items that were not popped. Expects that no
+         * other thread is accessing the queue anymore.
+         */
+        ~MpmcQueue();
+
+        /** @brief Copying is not allowed */
+        MpmcQueue<T>& operator=(const MpmcQueue<T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        MpmcQueue<T>& operator=(MpmcQueue<T>&&) = delete;
+
+        /** @brief Queue capacity */
+        std::size_t capacity() const { return _data.size(); }
+
+        /**
+         * @brief Count of items in the queue
+         *
+         * If called while other threads are pushing or popping, the value
+         * may be already outdated when returned. Includes items that were
+         * claimed by producers but not finished yet.
+         */
+        std::size_t size() const {
+            const std::size_t tail = _tail.load(std::memory_order_acquire);
+            const std::size_t head = _head.load(std::memory_order_acquire);
+            /* The tail could have moved past a head loaded earlier */
+            return head > tail ? head - tail : 0;
+        }
+
+        /**
+         * @brief Whether the queue is empty
+         *
+         * Same caveats as with @ref size() apply.
+         */
+        bool isEmpty() const { return !size(); }
+
+        /**
+         * @brief Push a copy of an item
+         *
+         * Returns @cpp false @ce if the queue is full, @cpp true @ce
+         * otherwise.
+         */
+        bool push(const T& value) { return push(Corrade::InPlaceInit, value); }
+
+        /**
+         * @brief Move an item in
+         *
+         * Returns @cpp false @ce if the queue is full, leaving @p value
+         * untouched, @cpp true @ce otherwise.
+         */
+        bool push(T&& value) { return push(Corrade::InPlaceInit, Utility::move(value)); }
+
+        /**
+         * @brief Construct an item in-place
+         *
+         * Returns @cpp false @ce if the queue is full, in which case nothing
+         * is constructed, @cpp true @ce otherwise.
+         */
+        template<class ...Args> bool push(Corrade::InPlaceInitT, Args&&... args);
+
+        /**
+         * @brief Pop an item
+         *
+         * If the queue is empty, returns @cpp false @ce and leaves @p out
+         * untouched. Otherwise move-assigns the oldest item to @p out, calls
+         * its destructor and returns @cpp true @ce.
+         */
+        bool pop(T& out);
+
+        /**
+         * @brief Pop an item into uninitialized memory
+         *
+         * Compared to @ref pop(T&), the item is move-constructed into
+         * @p out instead of move-assigned.
+         */
+        bool pop(Corrade::NoInitT, T* out);
+
+    private:
+        /* Claims an item for writing or reading, returns nullptr if the
+           queue is full or empty */
+        Implementation::MpmcQueueSlot<T>* claimPush();
+        Implementation::MpmcQueueSlot<T>* claimPop(std::size_t& position);
+
+        /* Shared, read-only after construction. Padded for the same reason
+           as in SpscQueue. */
+        Array<Implementation::MpmcQueueSlot<T>> _data;
+        std::size_t _mask;
+        char _padding0[64];
+
+        /* Shared by all producers */
+        std::atomic<std::size_t> _head;
+        char _padding1[64];
+
+        /* Shared by all consumers */
+        std::atomic<std::size_t> _tail;
+        char _padding2[64];
+};
+
+template<class T> MpmcQueue<T>::MpmcQueue(std::size_t capacity): _head{0}, _tail{0} {
+    CORRADE_ASSERT(capacity,
+        "Containers::MpmcQueue: expected non-zero capacity", );
+    /* With capacity 1 the sequence of a popped item would be the same as of
+       an item ready to be read in the next round */
+    std::size_t rounded = 2;
+    while(rounded < capacity) rounded <<= 1;
+    _data = Array<Implementation::MpmcQueueSlot<T>>{Corrade::DefaultInit, rounded};
+    _mask = rounded - 1;
+    for(std::size_t i = 0; i != rounded; ++i)
+        _data[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+template<class T> MpmcQueue<T>::~MpmcQueue() {
+    const std::size_t head = _head.load(std::memory_order_acquire);
+    for(std::size_t i = _tail.load(std::memory_order_acquire); i != head; ++i)
+        _data[i & _mask].value.~T();
+}
+
+template<class T> Implementation::MpmcQueueSlot<T>* MpmcQueue<T>::claimPush() {
+    std::size_t position = _head.load(std::memory_order_relaxed);
+    for(;;) {
+        Implementation::MpmcQueueSlot<T>& slot = _data[position & _mask];
+        const std::ptrdiff_t difference = std::ptrdiff_t(slot.sequence.load(std::memory_order_acquire)) - std::ptrdiff_t(position);
+
+        /* The item is free in this round, try to claim it. On failure the
+           position gets updated to the current head. */
+        if(difference == 0) {
+            if(_head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                return &slot;
+
+        /* The item wasn't popped yet in the previous round, the queue is
+           full */
+        } else if(difference < 0) return nullptr;
+
+        /* Another producer claimed it already, try again with a fresh head */
+        else position = _head.load(std::memory_order_relaxed);
+    }
+}
+
+template<class T> Implementation::MpmcQueueSlot<T>* MpmcQueue<T>::claimPop(std::size_t& position) {
+    position = _tail.load(std::memory_order_relaxed);
+    for(;;) {
+        Implementation::MpmcQueueSlot<T>& slot = _data[position & _mask];
+        const std::ptrdiff_t difference = std::ptrdiff_t(slot.sequence.load(std::memory_order_acquire)) - std::ptrdiff_t(position + 1);
+
+        /* The item was filled in this round, try to claim it */
+        if(difference == 0) {
+            if(_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                return &slot;
+
+        /* The item wasn't filled yet, the queue is empty */
+        } else if(difference < 0) return nullptr;
+
+        /* Another consumer claimed it already */
+        else position = _tail.load(std::memory_order_relaxed);
+    }
+}
+
+template<class T> template<class ...Args> bool MpmcQueue<T>::push(Corrade::InPlaceInitT, Args&&... args) {
+    Implementation::MpmcQueueSlot<T>* const slot = claimPush();
+    if(!slot) return false;
+
+    /* The sequence was equal to the claimed position, mark the item as
+       ready for reading in this round */
+    const std::size_t position = slot->sequence.load(std::memory_order_relaxed);
+    Implementation::construct(slot->value, Utility::forward<Args>(args)...);
+    slot->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+template<class T> bool MpmcQueue<T>::pop(T& out) {
+    std::size_t position;
+    Implementation::MpmcQueueSlot<T>* const slot = claimPop(position);
+    if(!slot) return false;
+
+    out = Utility::move(slot->value);
+    slot->value.~T();
+    /* Mark the item as free for writing in the next round */
+    slot->sequence.store(position + _mask + 1, std::memory_order_release);
+    return true;
+}
+
+template<class T> bool MpmcQueue<T>::pop(Corrade::NoInitT, T* const out) {
+    std::size_t position;
+    Implementation::MpmcQueueSlot<T>* const slot = claimPop(position);
+    if(!slot) return false;
+
+    Implementation::construct(*out, Utility::move(slot->value));
+    slot->value.~T();
+    slot->sequence.store(position + _mask + 1, std::memory_order_release);
+    return true;
+}
+
+}}
+
+#endif
@@ -0,0 +1,56 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ObjectPool.h"
+
+#include "Corrade/Utility/Macros.h"
+
+namespace Corrade { namespace Containers { namespace Implementation {
+
+#ifdef CORRADE_BUILD_MULTITHREADED
+namespace {
+
+std::atomic<std::size_t> objectPoolThreadCounter{0};
+CORRADE_THREAD_LOCAL std::size_t objectPoolThreadIndexValue = ~std::size_t{};
+
+}
+#endif
+
+std::size_t objectPoolThreadIndex() {
+    #ifdef CORRADE_BUILD_MULTITHREADED
+    /* Assigning the indices sequentially means the first few threads all
+       get a different free list */
+    if(objectPoolThreadIndexValue == ~std::size_t{})
+        objectPoolThreadIndexValue = objectPoolThreadCounter.fetch_add(1, std::memory_order_relaxed);
+    return objectPoolThreadIndexValue;
+    #else
+    /* A plain global would be written to from multiple threads without any
+       synchronization, so instead all threads use the first free list */
+    return 0;
+    #endif
+}
+
+}}}
@@ -0,0 +1,501 @@
+#ifndef Corrade_Containers_ObjectPool_h
+#define Corrade_Containers_ObjectPool_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::ObjectPool, @ref Corrade::Containers::PoolPointer
+ * @m_since_latest
+ */
+
+#include <atomic>
+#include <cstdint>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/bitHelpers.h"
+#include "Corrade/Containers/constructHelpers.h"
+#include "Corrade/Containers/initializeHelpers.h"
+#include "Corrade/Utility/Memory.h"
+#include "Corrade/Utility/visibility.h"
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+
+/* Storage for a single object. The union makes it possible to have an array
+   of these without T being default-constructible and without calling
+   destructors on objects that were never constructed. The free list link is
+   kept separate from the object, as a thread losing a race in
+   ObjectPool::popSlot() may still read it after the slot got reused. */
+template<class T> struct ObjectPoolSlot {
+    ObjectPoolSlot() {}
+    ~ObjectPoolSlot() {}
+
+    /* Index of the next free slot, 0 if there's none */
+    std::atomic<std::uint32_t> next;
+    /* Index of this slot, to be able to put it back to a free list */
+    std::uint32_t index;
+    union {
+        T value;
+    };
+};
+
+enum: std::size_t {
+    ObjectPoolShardCount = 8,
+    /* Slab i is stored in directory chunk log2(i + 1), chunk k has 2^k
+       entries, so 32 chunks are enough for all slabs a 32-bit slot index can
+       address */
+    ObjectPoolDirectorySize = 32
+};
+
+/* Returns a per-thread index, assigned sequentially on first use in each
+   thread. Always 0 if CORRADE_BUILD_MULTITHREADED isn't enabled. Defined in
+   ObjectPool.cpp so there's just one counter even if the header is used from
+   multiple libraries. */
+CORRADE_UTILITY_EXPORT std::size_t objectPoolThreadIndex();
+
+}
+
+/**
+@brief Object pool
+@m_since_latest
+
+A pool allocator for objects of a single type, making creation and
+destruction of many short-lived objects cheaper than going through
+@cpp new @ce and @cpp delete @ce. Objects are created and destroyed using
+@ref create() and @ref destroy(), or with @ref pointer(), which returns a
+@ref PoolPointer that destroys the object on destruction similarly to how
+@ref Pointer deletes it:
+
+@snippet Containers.cpp ObjectPool-usage
+
+The pool is thread-safe --- any thread can create objects and any thread can
+destroy them, including objects created by a different thread.
+
+@section Containers-ObjectPool-storage Storage and threading
+
+Memory is allocated in slabs of @ref slabSize() objects, a new slab is
+allocated only once all previously allocated objects are in use. Slabs are
+never freed before the pool is destroyed, thus the memory use corresponds to
+the peak object count.
+
+Free slots are kept in several lock-free lists, each on a separate cache
+line. Every thread has its own preferred list that it puts destroyed objects
+to and takes new objects from first, only if it's empty the other lists are
+tried. Threads thus mostly don't contend on the same atomic variable and
+objects tend to be reused by the thread that freed them, which is likely to
+still have them in cache.
+
+The lists work the same way as @ref FreeList, but instead of a pointer their
+head contains a 32-bit slot index together with a 32-bit counter that's
+incremented on every modification to avoid the ABA problem. The head thus
+always fits into a 64-bit atomic variable, which is lock-free on all
+supported platforms, and doesn't make any assumptions about unused pointer
+bits. The slot index consists of a slab index and an index of the slot in
+the slab, with the latter taking as many bits as needed for
+@ref slabSize() rounded up to a power of two. The pool can thus hold at
+least 2<sup>31</sup> objects, or almost 2<sup>32</sup> if @ref slabSize() is
+a power of two.
+
+The per-thread list assignment relies on thread-local storage, which is
+enabled only if Corrade is built with @ref CORRADE_BUILD_MULTITHREADED. If
+it's not, all threads share the first list. The pool is still thread-safe in
+that case, just with more contention if it's used from multiple threads.
+
+The lists are allocated separately from the pool instance with
+@ref Utility::allocateAligned() to put them on separate cache lines, so the
+pool itself isn't over-aligned and can be allocated with a plain
+@cpp new @ce even before C++17. Types with alignment larger than what
+@cpp new[] @ce guarantees aren't supported.
+@see @ref FreeList
+@experimental
+*/
+template<class T> class ObjectPool {
+    static_assert(alignof(T) <= Implementation::DefaultAllocationAlignment,
+        "over-aligned types are not supported");
+
+    public:
+        /**
+         * @brief Constructor
+         * @param slabSize  Count of objects allocated at once. Expected to be
+         *      non-zero and fit into 32 bits.
+         *
+         * No memory is allocated until the first object is created.
+         */
+        explicit ObjectPool(std::size_t slabSize = 64);
+
+        /** @brief Copying is not allowed */
+        ObjectPool(const ObjectPool<T>&) = delete;
+
+        /**
+         * @brief Moving is not allowed
+         *
+         * The free lists are accessed atomically from multiple threads and
+         * @ref PoolPointer instances reference the pool, moving the instance
+         * would break them.
+         */
+        ObjectPool(ObjectPool<T>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Frees all slabs. Expects that all objects were destroyed and no
+         * other thread is accessing the pool anymore, destructors of objects
+         * that weren't destroyed are not called.
+         */
+        ~ObjectPool();
+
+        /** @brief Copying is not allowed */
+        ObjectPool<T>& operator=(const ObjectPool<T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        ObjectPool<T>& operator=(ObjectPool<T>&&) = delete;
+
+        /** @brief Count of objects allocated at once */
+        std::size_t slabSize() const { return _slabSize; }
+
+        /**
+         * @brief Count of objects the pool can hold without allocating
+         *
+         * A multiple of @ref slabSize(). If called while other threads are
+         * creating objects, the value may be already outdated when returned.
+         */
+        std::size_t capacity() const {
+            return _capacity.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Create an object
+         *
+         * Constructs the object by passing @p args to its constructor in a
+         * free slot, allocating a new slab if there's none. The object is
+         * expected to be destroyed with @ref destroy() on the same pool.
+         */
+        template<class ...Args> T* create(Args&&... args);
+
+        /**
+         * @brief Destroy an object
+         *
+         * Calls the destructor and returns the slot back to the pool. The
+         * @p object is expected to be created by @ref create() on the same
+         * pool. If @p object is @cpp nullptr @ce, the function is a no-op.
+         */
+        void destroy(T* object);
+
+        /**
+         * @brief Create an object owned by a pool pointer
+         *
+         * Like @ref create(), but the object gets destroyed when the returned
+         * pointer goes out of scope.
+         */
+        template<class ...Args> PoolPointer<T> pointer(Args&&... args);
+
+    private:
+        /* Each free list on its own cache line. Not using alignas(64) as
+           that would make the whole pool over-aligned, instead the shards
+           are padded and allocated with allocateAligned(). The head contains
+           the slot index in the lower 32 bits and a modification counter in
+           the upper 32 bits. */
+        struct Shard {
+            std::atomic<std::uint64_t> head;
+            char padding[64 - sizeof(std::atomic<std::uint64_t>)];
+        };
+
+        Implementation::ObjectPoolSlot<T>& slot(std::uint32_t index);
+        Implementation::ObjectPoolSlot<T>* popSlot(Shard& shard);
+        void pushSlot(Shard& shard, Implementation::ObjectPoolSlot<T>& slot);
+        Implementation::ObjectPoolSlot<T>* acquireSlot(std::size_t shard);
+
+        /* Shared, read-only after construction */
+        std::size_t _slabSize;
+        std::size_t _valueOffset;
+        unsigned _slotBits;
+        std::uint32_t _maxSlabCount;
+        Array<Shard> _shards;
+
+        /* Modified only when allocating a new slab */
+        std::atomic<std::uint32_t> _slabCount;
+        std::atomic<std::size_t> _capacity;
+        std::atomic<std::atomic<Implementation::ObjectPoolSlot<T>*>*> _slabDirectory[Implementation::ObjectPoolDirectorySize];
+};
+
+/**
+@brief Pool pointer
+@m_since_latest
+
+A move-only handle to an object created by @ref ObjectPool::pointer(),
+similar to @ref Pointer. Instead of deleting the object, it's destroyed with
+@ref ObjectPool::destroy() on the originating pool.
+@experimental
+*/
+template<class T> class PoolPointer {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Creates a null pointer.
+         */
+        /*implicit*/ PoolPointer(std::nullptr_t = nullptr) noexcept: _pool{}, _pointer{} {}
+
+        /**
+         * @brief Construct from a pool and an object
+         *
+         * Takes ownership of @p pointer, which is expected to be created with
+         * @ref ObjectPool::create() on @p pool.
+         */
+        explicit PoolPointer(ObjectPool<T>& pool, T* pointer) noexcept: _pool{&pool}, _pointer{pointer} {}
+
+        /** @brief Copying is not allowed */
+        PoolPointer(const PoolPointer<T>&) = delete;
+
+        /** @brief Move constructor */
+        PoolPointer(PoolPointer<T>&& other) noexcept: _pool{other._pool}, _pointer{other._pointer} {
+            other._pointer = nullptr;
+        }
+
+        /**
+         * @brief Destructor
+         *
+         * Calls @ref ObjectPool::destroy() on the stored pointer.
+         */
+        ~PoolPointer() {
+            if(_pointer) _pool->destroy(_pointer);
+        }
+
+        /** @brief Copying is not allowed */
+        PoolPointer<T>& operator=(const PoolPointer<T>&) = delete;
+
+        /** @brief Move assignment */
+        PoolPointer<T>& operator=(PoolPointer<T>&& other) noexcept {
+            std::swap(_pool, other._pool);
+            std::swap(_pointer, other._pointer);
+            return *this;
+        }
+
+        /**
+         * @brief Whether the pointer is non-null
+         *
+         * Returns @cpp false @ce if stored pointer is @cpp nullptr @ce,
+         * @cpp true @ce otherwise.
+         */
+        explicit operator bool() const { return _pointer; }
+
+        /** @brief Equality comparison to a null pointer */
+        bool operator==(std::nullptr_t) const { return !_pointer; }
+
+        /** @brief Non-equality comparison to a null pointer */
+        bool operator!=(std::nullptr_t) const { return _pointer; }
+
+        /**
+         * @brief Pool the object gets returned to
+         *
+         * Can be @cpp nullptr @ce only for a default-constructed instance.
+         */
+        ObjectPool<T>* pool() const { return _pool; }
+
+        /** @brief Underlying pointer value */
+        T* get() { return _pointer; }
+        const T* get() const { return _pointer; } /**< @overload */
+
+        /**
+         * @brief Access the underlying pointer
+         *
+         * Expects that the pointer is not @cpp nullptr @ce.
+         */
+        T* operator->() {
+            CORRADE_ASSERT(_pointer, "Containers::PoolPointer: the pointer is null", nullptr);
+            return _pointer;
+        }
+
+        /** @overload */
+        const T* operator->() const {
+            CORRADE_ASSERT(_pointer, "Containers::PoolPointer: the pointer is null", nullptr);
+            return _pointer;
+        }
+
+        /**
+         * @brief Access the underlying pointer
+         *
+         * Expects that the pointer is not @cpp nullptr @ce.
+         */
+        T& operator*() {
+            CORRADE_ASSERT(_pointer, "Containers::PoolPointer: the pointer is null", *_pointer);
+            return *_pointer;
+        }
+
+        /** @overload */
+        const T& operator*() const {
+            CORRADE_ASSERT(_pointer, "Containers::PoolPointer: the pointer is null", *_pointer);
+            return *_pointer;
+        }
+
+        /**
+         * @brief Release the pointer ownership
+         *
+         * Resets the stored pointer to @cpp nullptr @ce, returning the
+         * previous value. The object is then expected to be destroyed with
+         * @ref ObjectPool::destroy() manually.
+         */
+        T* release() {
+            T* const out = _pointer;
+            _pointer = nullptr;
+            return out;
+        }
+
+    private:
+        ObjectPool<T>* _pool;
+        T* _pointer;
+};
+
+template<class T> ObjectPool<T>::ObjectPool(const std::size_t slabSize): _slabSize{slabSize}, _slotBits{}, _maxSlabCount{}, _shards{Utility::allocateAligned<Shard, 64>(Corrade::DefaultInit, Implementation::ObjectPoolShardCount)}, _slabCount{0}, _capacity{0}, _slabDirectory{} {
+    CORRADE_ASSERT(slabSize,
+        "Containers::ObjectPool: expected non-zero slab size", );
+    CORRADE_ASSERT(std::uint64_t(slabSize) < (std::uint64_t{1} << 32),
+        "Containers::ObjectPool: expected slab size to fit into 32 bits but got" << slabSize, );
+
+    /* The slot layout is the same for all slots, calculate the offset of the
+       value once to be able to get the slot back from an object pointer */
+    Implementation::ObjectPoolSlot<T> slot;
+    _valueOffset = reinterpret_cast<char*>(&slot.value) - reinterpret_cast<char*>(&slot);
+
+    for(Shard& shard: _shards) shard.head.store(0, std::memory_order_relaxed);
+
+    /* Slot index 0 is reserved for an empty list, so the packed index of
+       the last slot of the last slab has to be at most 2^32 - 2 */
+    while((std::uint64_t{1} << _slotBits) < slabSize) ++_slotBits;
+    _maxSlabCount = std::uint32_t((((std::uint64_t{1} << 32) - 1 - slabSize) >> _slotBits) + 1);
+}
+
+template<class T> ObjectPool<T>::~ObjectPool() {
+    /* Slabs may not be stored contiguously if multiple threads were
+       allocating at the same time, go through everything */
+    for(std::atomic<std::atomic<Implementation::ObjectPoolSlot<T>*>*>& chunk: _slabDirectory) {
+        std::atomic<Implementation::ObjectPoolSlot<T>*>* const slabs = chunk.load(std::memory_order_acquire);
+        if(!slabs) continue;
+
+        const std::size_t size = std::size_t{1} << (&chunk - _slabDirectory);
+        for(std::size_t i = 0; i != size; ++i)
+            delete[] slabs[i].load(std::memory_order_acquire);
+        delete[] slabs;
+    }
+}
+
+template<class T> Implementation::ObjectPoolSlot<T>& ObjectPool<T>::slot(const std::uint32_t index) {
+    /* 64-bit to avoid undefined behavior when shifting by 32 for slab sizes
+       over 2^31 */
+    const std::uint64_t slotIndex = index - 1;
+    const std::uint32_t slab = std::uint32_t(slotIndex >> _slotBits);
+    const unsigned chunk = 31 - Implementation::leadingZeros(slab + 1);
+
+    /* The index was published by a release operation on a list head, which
+       happened after the slab was put into the directory, so relaxed loads
+       are enough here */
+    std::atomic<Implementation::ObjectPoolSlot<T>*>* const slabs = _slabDirectory[chunk].load(std::memory_order_relaxed);
+    return slabs[slab + 1 - (std::uint32_t{1} << chunk)].load(std::memory_order_relaxed)[std::size_t(slotIndex & ((std::uint64_t{1} << _slotBits) - 1))];
+}
+
+template<class T> Implementation::ObjectPoolSlot<T>* ObjectPool<T>::popSlot(Shard& shard) {
+    std::uint64_t head = shard.head.load(std::memory_order_acquire);
+    for(;;) {
+        const std::uint32_t index = std::uint32_t(head);
+        if(!index) return nullptr;
+
+        /* If another thread popped the slot in the meantime, the next index
+           may be already a different one, but then the counter differs as
+           well and the exchange fails. On failure the head gets updated to
+           the current value. */
+        Implementation::ObjectPoolSlot<T>& slot = this->slot(index);
+        const std::uint32_t next = slot.next.load(std::memory_order_relaxed);
+        if(shard.head.compare_exchange_weak(head, next|((head >> 32) + 1) << 32, std::memory_order_acquire, std::memory_order_acquire))
+            return &slot;
+    }
+}
+
+template<class T> void ObjectPool<T>::pushSlot(Shard& shard, Implementation::ObjectPoolSlot<T>& slot) {
+    std::uint64_t head = shard.head.load(std::memory_order_relaxed);
+    do {
+        slot.next.store(std::uint32_t(head), std::memory_order_relaxed);
+    } while(!shard.head.compare_exchange_weak(head, slot.index|((head >> 32) + 1) << 32, std::memory_order_release, std::memory_order_relaxed));
+}
+
+template<class T> Implementation::ObjectPoolSlot<T>* ObjectPool<T>::acquireSlot(const std::size_t shard) {
+    /* Try the list of the current thread first, then the others */
+    for(std::size_t i = 0; i != Implementation::ObjectPoolShardCount; ++i)
+        if(Implementation::ObjectPoolSlot<T>* const slot = popSlot(_shards[(shard + i) & (Implementation::ObjectPoolShardCount - 1)]))
+            return slot;
+
+    /* All slots are in use, allocate a new slab. If multiple threads get here
+       at the same time, each allocates its own. */
+    const std::uint32_t slab = _slabCount.fetch_add(1, std::memory_order_relaxed);
+    CORRADE_ASSERT(slab < _maxSlabCount,
+        "Containers::ObjectPool::create(): can't allocate more than" << _maxSlabCount << "slabs of" << _slabSize << "objects", nullptr);
+
+    /* Put the slab into the directory, creating the directory chunk first if
+       this is the first slab in it. If another thread created it in the
+       meantime, use that one instead. */
+    const unsigned chunk = 31 - Implementation::leadingZeros(slab + 1);
+    std::atomic<Implementation::ObjectPoolSlot<T>*>* slabs = _slabDirectory[chunk].load(std::memory_order_acquire);
+    if(!slabs) {
+        auto* const created = new std::atomic<Implementation::ObjectPoolSlot<T>*>[std::size_t{1} << chunk]();
+        if(_slabDirectory[chunk].compare_exchange_strong(slabs, created, std::memory_order_acq_rel, std::memory_order_acquire))
+            slabs = created;
+        else delete[] created;
+    }
+
+    auto* const slots = new Implementation::ObjectPoolSlot<T>[_slabSize];
+    for(std::size_t i = 0; i != _slabSize; ++i)
+        slots[i].index = std::uint32_t((std::uint64_t{slab} << _slotBits)|i) + 1;
+    slabs[slab + 1 - (std::uint32_t{1} << chunk)].store(slots, std::memory_order_release);
+    _capacity.fetch_add(_slabSize, std::memory_order_relaxed);
+
+    /* The first slot is used right away, the rest goes to the list of
+       current thread in reverse so they're taken in memory order */
+    for(std::size_t i = _slabSize - 1; i != 0; --i)
+        pushSlot(_shards[shard], slots[i]);
+    return slots;
+}
+
+template<class T> template<class ...Args> T* ObjectPool<T>::create(Args&&... args) {
+    Implementation::ObjectPoolSlot<T>* const slot = acquireSlot(Implementation::objectPoolThreadIndex() & (Implementation::ObjectPoolShardCount - 1));
+    Implementation::construct(slot->value, Utility::forward<Args>(args)...);
+    return &slot->value;
+}
+
+template<class T> void ObjectPool<T>::destroy(T* const object) {
+    if(!object) return;
+
+    object->~T();
+    auto* const slot = reinterpret_cast<Implementation::ObjectPoolSlot<T>*>(reinterpret_cast<char*>(object) - _valueOffset);
+    pushSlot(_shards[Implementation::objectPoolThreadIndex() & (Implementation::ObjectPoolShardCount - 1)], *slot);
+}
+
+template<class T> template<class ...Args> PoolPointer<T> ObjectPool<T>::pointer(Args&&... args) {
+    return PoolPointer<T>{*this, create(Utility::forward<Args>(args)...)};
+}
+
+}}
+
+#endif
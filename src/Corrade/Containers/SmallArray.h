@@ -0,0 +1,610 @@
+#ifndef Corrade_Containers_SmallArray_h
+#define Corrade_Containers_SmallArray_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::SmallArray, @ref Corrade::Containers::ArraySmallAllocator
+ * @m_since_latest
+ */
+
+#include "Corrade/Containers/GrowableArray.h"
+
+namespace Corrade { namespace Containers {
+
+/**
+@brief Small array allocator
+@m_since_latest
+
+An @ref ArrayAllocator used by @ref SmallArray. Similarly to
+@ref ArrayNewAllocator it's reserving an extra space *before* the front to
+store array capacity, the highest bit of which marks whether the memory is
+inline in a @ref SmallArray instance and thus shouldn't be freed. New
+allocations are always made using @cpp new[] @ce. Expects that @p T is
+nothrow move-constructible.
+@see @ref Containers-Array-growable
+@experimental
+*/
+template<class T> struct ArraySmallAllocator {
+    typedef T Type; /**< Pointer type */
+
+    enum: std::size_t {
+        /** @copydoc ArrayMallocAllocator::AllocationOffset */
+        AllocationOffset = Implementation::AllocatorTraits<T>::Offset,
+
+        /**
+         * Bit marking inline memory. Set in the capacity stored before the
+         * front of the array if the memory is inline in a @ref SmallArray.
+         */
+        InlineBit = std::size_t{1} << (sizeof(std::size_t)*8 - 1)
+    };
+
+    /**
+     * @brief Allocate (but not construct) an array of given capacity
+     *
+     * Same as @ref ArrayNewAllocator::allocate(), the memory is never
+     * inline.
+     */
+    static T* allocate(std::size_t capacity) {
+        char* const memory = new char[capacity*sizeof(T) + AllocationOffset];
+        reinterpret_cast<std::size_t*>(memory)[0] = capacity;
+        return reinterpret_cast<T*>(memory + AllocationOffset);
+    }
+
+    /**
+     * @brief Reallocate an array to given capacity
+     *
+     * Calls @p allocate(), move-constructs @p prevSize elements from @p array
+     * into the new array, calls destructors on the original elements, calls
+     * @ref deallocate() and updates the @p array reference to point to the
+     * new array. If @p array was inline, it's left unused.
+     */
+    static void reallocate(T*& array, std::size_t prevSize, std::size_t newCapacity);
+
+    /**
+     * @brief Deallocate an array
+     *
+     * If the memory isn't inline, calls @cpp delete[] @ce on a pointer
+     * offset by the extra space needed to store its capacity.
+     */
+    static void deallocate(T* data) {
+        if(!isInline(data))
+            delete[] (reinterpret_cast<char*>(data) - AllocationOffset);
+    }
+
+    /**
+     * @brief Grow the array
+     *
+     * Same growth strategy as @ref ArrayNewAllocator::grow(), starting at
+     * the inline capacity.
+     */
+    static std::size_t grow(T* array, std::size_t desired) {
+        return Implementation::arrayGrowth<T>(array ? capacity(array) : 0, desired);
+    }
+
+    /**
+     * @brief Array capacity
+     *
+     * Retrieves the capacity that's stored *before* the front of the
+     * @p array, without the @ref InlineBit.
+     */
+    static std::size_t capacity(T* array) {
+        return *reinterpret_cast<std::size_t*>(base(array)) & ~InlineBit;
+    }
+
+    /**
+     * @brief Whether the array is inline in a @ref SmallArray
+     *
+     * Checks for the @ref InlineBit in the capacity stored *before* the
+     * front of the @p array.
+     */
+    static bool isInline(T* array) {
+        return *reinterpret_cast<std::size_t*>(base(array)) & InlineBit;
+    }
+
+    /**
+     * @brief Array base address
+     *
+     * Returns the address with @ref AllocationOffset subtracted.
+     */
+    static void* base(T* array) {
+        return reinterpret_cast<char*>(array) - AllocationOffset;
+    }
+
+    /**
+     * @brief Array deleter
+     *
+     * Calls a destructor on @p size elements and then delegates into
+     * @ref deallocate().
+     */
+    static void deleter(T* data, std::size_t size);
+};
+
+/**
+@brief Small-buffer-optimized array
+@m_since_latest
+
+A growable @ref Array that stores up to @p N elements inline, inside the
+class instance itself, and allocates only after that. Useful for the common
+case of lists that are usually very short, but can be arbitrarily long,
+avoiding heap allocations in the typical case.
+
+@snippet Containers.cpp SmallArray-usage
+
+@section Containers-SmallArray-growable Growing and interoperability
+
+The instance wraps an @ref Array with a @ref ArraySmallAllocator-based
+deleter, which is accessible through @ref array(). The @ref arrayAppend(),
+@ref arrayResize(), @ref arrayReserve(), @ref arrayRemoveSuffix() and
+@ref arrayCapacity() overloads taking a @ref SmallArray delegate to the
+@ref Containers-Array-growable "growable array" utilities with this
+allocator, which means the elements are kept inline until the capacity is
+exceeded, after which they get moved to a heap allocation that grows the same
+way as a regular growable array. The @ref arrayShrink(SmallArray<N, T>&)
+overload moves the elements back inline if they fit.
+
+The class is implicitly convertible to @ref ArrayView and
+@ref StridedArrayView, and can be passed to any API taking those.
+
+@section Containers-SmallArray-move Move semantics
+
+Unlike @ref Array, moving an instance that stores the elements inline
+move-constructs each element, as the memory can't be transferred. Pointers to
+elements thus get invalidated on move as long as the array is small. For the
+same reason it's not allowed to move the @ref array() out as long as the
+elements are stored inline.
+
+The type is expected to be nothrow move-constructible and its alignment can't
+be larger than the platform default allocation alignment.
+@experimental
+*/
+template<std::size_t N, class T> class SmallArray {
+    static_assert(N, "inline capacity is expected to be non-zero");
+    static_assert(alignof(T) <= Implementation::DefaultAllocationAlignment,
+        "overaligned types are not supported");
+
+    public:
+        /** @brief Inline capacity */
+        enum: std::size_t { Capacity = N };
+
+        /**
+         * @brief Default constructor
+         *
+         * Creates an empty array with inline storage. Doesn't allocate.
+         */
+        /*implicit*/ SmallArray() noexcept: _data{inlineData(), 0, ArraySmallAllocator<T>::deleter} {
+            setInlineCapacity();
+        }
+
+        /**
+         * @brief Construct a default-initialized array
+         *
+         * Allocates only if @p size is larger than @ref Capacity.
+         * @see @ref arrayResize(SmallArray<N, T>&, Corrade::DefaultInitT, std::size_t)
+         */
+        explicit SmallArray(Corrade::DefaultInitT, std::size_t size): SmallArray{} {
+            arrayResize<ArraySmallAllocator>(_data, Corrade::DefaultInit, size);
+        }
+
+        /**
+         * @brief Construct a value-initialized array
+         *
+         * Allocates only if @p size is larger than @ref Capacity.
+         * @see @ref arrayResize(SmallArray<N, T>&, Corrade::ValueInitT, std::size_t)
+         */
+        explicit SmallArray(Corrade::ValueInitT, std::size_t size): SmallArray{} {
+            arrayResize<ArraySmallAllocator>(_data, Corrade::ValueInit, size);
+        }
+
+        /**
+         * @brief Construct an array without initializing its contents
+         *
+         * Allocates only if @p size is larger than @ref Capacity. Destructors
+         * are called on all elements when the array is destroyed.
+         */
+        explicit SmallArray(Corrade::NoInitT, std::size_t size): SmallArray{} {
+            arrayResize<ArraySmallAllocator>(_data, Corrade::NoInit, size);
+        }
+
+        /**
+         * @brief Construct a direct-initialized array
+         *
+         * Constructs the array using the @ref DirectInit tag and then
+         * initializes each element with @p args.
+         */
+        template<class... Args> explicit SmallArray(Corrade::DirectInitT, std::size_t size, Args&&... args): SmallArray{} {
+            arrayResize<ArraySmallAllocator>(_data, Corrade::DirectInit, size, Utility::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Construct a list-initialized array
+         *
+         * Copies the elements from @p list.
+         */
+        explicit SmallArray(Corrade::InPlaceInitT, std::initializer_list<T> list): SmallArray{} {
+            arrayAppend<ArraySmallAllocator>(_data, list);
+        }
+
+        /**
+         * @brief Construct a value-initialized array
+         *
+         * Alias to @ref SmallArray(ValueInitT, std::size_t).
+         */
+        explicit SmallArray(std::size_t size): SmallArray{Corrade::ValueInit, size} {}
+
+        /** @brief Copying is not allowed */
+        SmallArray(const SmallArray<N, T>&) = delete;
+
+        /**
+         * @brief Move constructor
+         *
+         * If @p other stores its elements inline, they get move-constructed
+         * into this instance, otherwise the heap allocation is transferred.
+         * The @p other instance is empty afterwards.
+         */
+        SmallArray(SmallArray<N, T>&& other) noexcept: SmallArray{} {
+            moveFrom(other);
+        }
+
+        /** @brief Copying is not allowed */
+        SmallArray<N, T>& operator=(const SmallArray<N, T>&) = delete;
+
+        /**
+         * @brief Move assignment
+         *
+         * Destructs current contents and then behaves the same as the move
+         * constructor.
+         */
+        SmallArray<N, T>& operator=(SmallArray<N, T>&& other) noexcept {
+            if(&other != this) {
+                _data = Array<T>{inlineData(), 0, ArraySmallAllocator<T>::deleter};
+                moveFrom(other);
+            }
+            return *this;
+        }
+
+        /** @brief Conversion to array type */
+        /*implicit*/ operator T*() & { return _data; }
+
+        /** @overload */
+        /*implicit*/ operator const T*() const & { return _data; }
+
+        /**
+         * @brief Underlying array
+         *
+         * Can be used with APIs that operate on an @ref Array directly.
+         * Moving the array out or replacing it with one that's not using
+         * @ref ArraySmallAllocator while the elements are inline leads to
+         * undefined behavior.
+         */
+        Array<T>& array() { return _data; }
+        const Array<T>& array() const { return _data; } /**< @overload */
+
+        /** @brief Array data */
+        T* data() { return _data.data(); }
+        const T* data() const { return _data.data(); } /**< @overload */
+
+        /** @brief Array size */
+        std::size_t size() const { return _data.size(); }
+
+        /** @brief Whether the array is empty */
+        bool isEmpty() const { return !_data.size(); }
+
+        /**
+         * @brief Whether the elements are stored inline
+         *
+         * Returns @cpp true @ce if the elements are stored inside the class
+         * instance, @cpp false @ce if they're in a heap allocation.
+         */
+        bool isSmall() const {
+            return _data.data() == inlineData();
+        }
+
+        /** @brief Pointer to first element */
+        T* begin() { return _data.begin(); }
+        const T* begin() const { return _data.begin(); } /**< @overload */
+        const T* cbegin() const { return _data.cbegin(); } /**< @overload */
+
+        /** @brief Pointer to (one item after) last element */
+        T* end() { return _data.end(); }
+        const T* end() const { return _data.end(); } /**< @overload */
+        const T* cend() const { return _data.cend(); } /**< @overload */
+
+        /**
+         * @brief First element
+         *
+         * Expects there is at least one element.
+         */
+        T& front() { return _data.front(); }
+        const T& front() const { return _data.front(); } /**< @overload */
+
+        /**
+         * @brief Last element
+         *
+         * Expects there is at least one element.
+         */
+        T& back() { return _data.back(); }
+        const T& back() const { return _data.back(); } /**< @overload */
+
+    private:
+        T* inlineData() {
+            return reinterpret_cast<T*>(_storage + ArraySmallAllocator<T>::AllocationOffset);
+        }
+        const T* inlineData() const {
+            return reinterpret_cast<const T*>(_storage + ArraySmallAllocator<T>::AllocationOffset);
+        }
+        void setInlineCapacity() {
+            *reinterpret_cast<std::size_t*>(_storage) = N|ArraySmallAllocator<T>::InlineBit;
+        }
+        /* Expects that this instance is empty and inline */
+        void moveFrom(SmallArray<N, T>& other) noexcept;
+
+        /* The capacity is stored right before the data, same as in a heap
+           allocation. Has to be before _data, which references it in its
+           deleter. */
+        alignas(T) alignas(std::size_t) char _storage[ArraySmallAllocator<T>::AllocationOffset + N*sizeof(T)];
+        Array<T> _data;
+};
+
+/** @relatesalso SmallArray
+@brief Small array capacity
+@m_since_latest
+
+Returns @ref SmallArray::Capacity if the elements are stored inline and the
+allocated capacity otherwise.
+*/
+template<std::size_t N, class T> inline std::size_t arrayCapacity(SmallArray<N, T>& array) {
+    return arrayCapacity<ArraySmallAllocator>(array.array());
+}
+
+/** @relatesalso SmallArray
+@brief Reserve given capacity in a small array
+@m_since_latest
+
+Delegates to @ref arrayReserve(Array<T>&, std::size_t) with
+@ref ArraySmallAllocator. Doesn't allocate if @p capacity is not larger
+than @ref SmallArray::Capacity.
+*/
+template<std::size_t N, class T> inline std::size_t arrayReserve(SmallArray<N, T>& array, std::size_t capacity) {
+    return arrayReserve<ArraySmallAllocator>(array.array(), capacity);
+}
+
+/** @relatesalso SmallArray
+@brief Resize a small array to given size, default-initializing new elements
+@m_since_latest
+
+Delegates to @ref arrayResize(Array<T>&, Corrade::DefaultInitT, std::size_t)
+with @ref ArraySmallAllocator.
+*/
+template<std::size_t N, class T> inline void arrayResize(SmallArray<N, T>& array, Corrade::DefaultInitT, std::size_t size) {
+    arrayResize<ArraySmallAllocator>(array.array(), Corrade::DefaultInit, size);
+}
+
+/** @relatesalso SmallArray
+@brief Resize a small array to given size, value-initializing new elements
+@m_since_latest
+
+Delegates to @ref arrayResize(Array<T>&, Corrade::ValueInitT, std::size_t)
+with @ref ArraySmallAllocator.
+*/
+template<std::size_t N, class T> inline void arrayResize(SmallArray<N, T>& array, Corrade::ValueInitT, std::size_t size) {
+    arrayResize<ArraySmallAllocator>(array.array(), Corrade::ValueInit, size);
+}
+
+/** @relatesalso SmallArray
+@brief Resize a small array to given size, value-initializing new elements
+@m_since_latest
+
+Alias to @ref arrayResize(SmallArray<N, T>&, Corrade::ValueInitT, std::size_t).
+*/
+template<std::size_t N, class T> inline void arrayResize(SmallArray<N, T>& array, std::size_t size) {
+    arrayResize<ArraySmallAllocator>(array.array(), Corrade::ValueInit, size);
+}
+
+/** @relatesalso SmallArray
+@brief Resize a small array to given size, keeping new elements uninitialized
+@m_since_latest
+
+Delegates to @ref arrayResize(Array<T>&, Corrade::NoInitT, std::size_t) with
+@ref ArraySmallAllocator.
+*/
+template<std::size_t N, class T> inline void arrayResize(SmallArray<N, T>& array, Corrade::NoInitT, std::size_t size) {
+    arrayResize<ArraySmallAllocator>(array.array(), Corrade::NoInit, size);
+}
+
+/** @relatesalso SmallArray
+@brief Resize a small array to given size, constructing new elements using provided arguments
+@m_since_latest
+
+Delegates to @ref arrayResize(Array<T>&, Corrade::DirectInitT, std::size_t, Args&&... args)
+with @ref ArraySmallAllocator.
+*/
+template<std::size_t N, class T, class... Args> inline void arrayResize(SmallArray<N, T>& array, Corrade::DirectInitT, std::size_t size, Args&&... args) {
+    arrayResize<ArraySmallAllocator>(array.array(), Corrade::DirectInit, size, Utility::forward<Args>(args)...);
+}
+
+/** @relatesalso SmallArray
+@brief Copy-append an item to a small array
+@m_since_latest
+
+Delegates to @ref arrayAppend(Array<T>&, const typename std::common_type<T>::type&)
+with @ref ArraySmallAllocator.
+*/
+template<std::size_t N, class T> inline T& arrayAppend(SmallArray<N, T>& array, const typename std::common_type<T>::type& value) {
+    return arrayAppend<ArraySmallAllocator>(array.array(), value);
+}
+
+/** @relatesalso SmallArray
+@brief Move-append an item to a small array
+@m_since_latest
+
+Delegates to @ref arrayAppend(Array<T>&, typename std::common_type<T>::type&&)
+with @ref ArraySmallAllocator.
+*/
+template<std::size_t N, class T> inline T& arrayAppend(SmallArray<N, T>& array, typename std::common_type<T>::type&& value) {
+    return arrayAppend<ArraySmallAllocator>(array.array(), Utility::move(value));
+}
+
+/** @relatesalso SmallArray
+@brief In-place append an item to a small array
+@m_since_latest
+
+Delegates to @ref arrayAppend(Array<T>&, Corrade::InPlaceInitT, Args&&... args)
+with @ref ArraySmallAllocator.
+*/
+template<std::size_t N, class T, class... Args> inline T& arrayAppend(SmallArray<N, T>& array, Corrade::InPlaceInitT, Args&&... args) {
+    return arrayAppend<ArraySmallAllocator>(array.array(), Corrade::InPlaceInit, Utility::forward<Args>(args)...);
+}
+
+/** @relatesalso SmallArray
+@brief Append a list of items to a small array
+@m_since_latest
+
+Delegates to @ref arrayAppend(Array<T>&, ArrayView<const T>) with
+@ref ArraySmallAllocator.
+*/
+template<std::size_t N, class T> inline ArrayView<T> arrayAppend(SmallArray<N, T>& array, typename std::common_type<ArrayView<const T>>::type values) {
+    return arrayAppend<ArraySmallAllocator>(array.array(), values);
+}
+
+/** @relatesalso SmallArray
+@overload
+@m_since_latest
+*/
+template<std::size_t N, class T> inline ArrayView<T> arrayAppend(SmallArray<N, T>& array, std::initializer_list<typename std::common_type<T>::type> values) {
+    return arrayAppend<ArraySmallAllocator>(array.array(), values);
+}
+
+/** @relatesalso SmallArray
+@brief Append given count of uninitialized values to a small array
+@m_since_latest
+
+Delegates to @ref arrayAppend(Array<T>&, Corrade::NoInitT, std::size_t) with
+@ref ArraySmallAllocator.
+*/
+template<std::size_t N, class T> inline ArrayView<T> arrayAppend(SmallArray<N, T>& array, Corrade::NoInitT, std::size_t count) {
+    return arrayAppend<ArraySmallAllocator>(array.array(), Corrade::NoInit, count);
+}
+
+/** @relatesalso SmallArray
+@brief Remove a suffix from a small array
+@m_since_latest
+
+Delegates to @ref arrayRemoveSuffix(Array<T>&, std::size_t) with
+@ref ArraySmallAllocator. Never reallocates.
+*/
+template<std::size_t N, class T> inline void arrayRemoveSuffix(SmallArray<N, T>& array, std::size_t count = 1) {
+    arrayRemoveSuffix<ArraySmallAllocator>(array.array(), count);
+}
+
+/** @relatesalso SmallArray
+@brief Move small array elements back inline
+@m_since_latest
+
+Unlike @ref arrayShrink(Array<T>&, Corrade::NoInitT), which converts the
+array to a non-growable one, if the elements are in a heap allocation and
+their count is not larger than @ref SmallArray::Capacity, moves them back
+inline and frees the allocation. Otherwise does nothing.
+*/
+template<std::size_t N, class T> void arrayShrink(SmallArray<N, T>& array) {
+    if(array.isSmall() || array.size() > N) return;
+
+    SmallArray<N, T> small;
+    Implementation::arrayMoveConstruct<T>(array.data(), small.data(), array.size());
+    /* The moved-from elements get destructed when the original array is
+       replaced */
+    small.array() = Array<T>{small.data(), array.size(), ArraySmallAllocator<T>::deleter};
+    array = Utility::move(small);
+}
+
+namespace Implementation {
+
+template<class U, std::size_t N, class T> struct ArrayViewConverter<U, SmallArray<N, T>> {
+    template<class V = U> static typename std::enable_if<std::is_convertible<T*, V*>::value, ArrayView<U>>::type from(SmallArray<N, T>& other) {
+        static_assert(sizeof(T) == sizeof(U), "types are not compatible");
+        return {other.data(), other.size()};
+    }
+};
+template<class U, std::size_t N, class T> struct ArrayViewConverter<const U, SmallArray<N, T>> {
+    template<class V = U> static typename std::enable_if<std::is_convertible<T*, V*>::value, ArrayView<const U>>::type from(const SmallArray<N, T>& other) {
+        static_assert(sizeof(T) == sizeof(U), "types are not compatible");
+        return {other.data(), other.size()};
+    }
+};
+template<std::size_t N, class T> struct ErasedArrayViewConverter<SmallArray<N, T>>: ArrayViewConverter<T, SmallArray<N, T>> {};
+template<std::size_t N, class T> struct ErasedArrayViewConverter<const SmallArray<N, T>>: ArrayViewConverter<const T, SmallArray<N, T>> {};
+
+}
+
+template<class T> void ArraySmallAllocator<T>::reallocate(T*& array, const std::size_t prevSize, const std::size_t newCapacity) {
+    T* const newArray = allocate(newCapacity);
+    Implementation::arrayMoveConstruct<T>(array, newArray, prevSize);
+    Implementation::arrayDestruct<T>(array, array + prevSize);
+    #ifdef _CORRADE_CONTAINERS_SANITIZER_ENABLED
+    /* The inline memory stays in use by the SmallArray instance, unpoison it
+       so it doesn't cause false positives after */
+    if(isInline(array)) __sanitizer_annotate_contiguous_container(
+        base(array),
+        array + capacity(array),
+        array + prevSize,
+        array + capacity(array));
+    #endif
+    deallocate(array);
+    array = newArray;
+}
+
+template<class T> void ArraySmallAllocator<T>::deleter(T* const data, const std::size_t size) {
+    Implementation::arrayDestruct<T>(data, data + size);
+    #ifdef _CORRADE_CONTAINERS_SANITIZER_ENABLED
+    if(isInline(data)) __sanitizer_annotate_contiguous_container(
+        base(data),
+        data + capacity(data),
+        data + size,
+        data + capacity(data));
+    #endif
+    deallocate(data);
+}
+
+template<std::size_t N, class T> void SmallArray<N, T>::moveFrom(SmallArray<N, T>& other) noexcept {
+    /* Heap allocation, steal it and make the other instance empty inline */
+    if(!other.isSmall()) {
+        Array<T> data = Utility::move(other._data);
+        other._data = Array<T>{other.inlineData(), 0, ArraySmallAllocator<T>::deleter};
+        _data = Utility::move(data);
+        return;
+    }
+
+    /* Inline, the elements have to be moved one by one. The moved-from
+       elements get destructed when the other array is replaced. */
+    const std::size_t size = other._data.size();
+    Implementation::arrayMoveConstruct<T>(other._data.data(), inlineData(), size);
+    _data = Array<T>{inlineData(), size, ArraySmallAllocator<T>::deleter};
+    other._data = Array<T>{other.inlineData(), 0, ArraySmallAllocator<T>::deleter};
+}
+
+}}
+
+#endif
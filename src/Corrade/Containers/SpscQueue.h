@@ -0,0 +1,272 @@
+#ifndef Corrade_Containers_SpscQueue_h
+#define Corrade_Containers_SpscQueue_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+/** @file
+ * @brief Class @ref Corrade::Containers::SpscQueue
+ * @m_since_latest
+ */
+
+#include <atomic>
+
+#include "Corrade/Tags.h"
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/constructHelpers.h"
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+
+/* Storage for a single queue item that's constructed and destructed
+   explicitly. The union makes it possible to have an Array of these without
+   T being default-constructible and without calling destructors on items
+   that were never constructed. */
+template<class T> union SpscQueueSlot {
+    SpscQueueSlot() {}
+    ~SpscQueueSlot() {}
+
+    T value;
+};
+
+}
+
+/**
+@brief Lock-free bounded single-producer single-consumer queue
+@m_since_latest
+
+A fixed-capacity FIFO queue for passing items from one thread to another
+without locking. One thread is allowed to call @ref push(), another thread is
+allowed to call @ref pop(), concurrently. Calling @ref push() from more than
+one thread at a time or @ref pop() from more than one thread at a time is
+undefined behavior, use @ref MpmcQueue for that instead.
+
+@snippet Containers.cpp SpscQueue-usage
+
+@section Containers-SpscQueue-storage Storage and capacity
+
+The items are stored in a @ref Array allocated upfront, no allocations happen
+afterwards. The capacity is rounded up to the nearest power of two so
+wrapping around the end is just a bit mask. The item storage is not
+initialized in any way, items get constructed only when pushed and are
+destructed when popped or when the queue itself is destructed.
+
+The producer and consumer indices are kept at least a cache line apart from
+each other and from the rest of the state, to avoid the two threads
+invalidating each other's cache lines on every operation. That's done with
+explicit padding and not by aligning them, so the queue isn't over-aligned
+and can be allocated with a plain @cpp new @ce even before C++17. Each side
+additionally keeps a cached copy of the other side's index and refreshes it
+only when the queue appears full or empty, so in the common case an operation
+touches only cache lines owned by the calling thread and the item itself.
+
+@section Containers-SpscQueue-initialization Item construction
+
+Apart from copying or moving an item in, @ref push(Corrade::InPlaceInitT, Args&&... args)
+constructs the item directly in the queue storage. On the consumer side,
+@ref pop(T&) move-assigns the item into an existing instance while
+@ref pop(Corrade::NoInitT, T*) move-constructs it into uninitialized memory,
+such as a view returned from @ref arrayAppend(Array<T, Allocator>&, Corrade::NoInitT, std::size_t).
+@see @ref MpmcQueue
+@experimental
+*/
+template<class T> class SpscQueue {
+    public:
+        /**
+         * @brief Constructor
+         * @param capacity  Minimal queue capacity. Expected to be non-zero,
+         *      rounded up to the nearest power of two.
+         */
+        explicit SpscQueue(std::size_t capacity);
+
+        /** @brief Copying is not allowed */
+        SpscQueue(const SpscQueue<T>&) = delete;
+
+        /**
+         * @brief Moving is not allowed
+         *
+         * The indices are accessed atomically from multiple threads, moving
+         * the instance would break them.
+         */
+        SpscQueue(SpscQueue<T>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Calls destructors on items that were not popped. Expects that no
+         * other thread is accessing the queue anymore.
+         */
+        ~SpscQueue();
+
+        /** @brief Copying is not allowed */
+        SpscQueue<T>& operator=(const SpscQueue<T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        SpscQueue<T>& operator=(SpscQueue<T>&&) = delete;
+
+        /** @brief Queue capacity */
+        std::size_t capacity() const { return _data.size(); }
+
+        /**
+         * @brief Count of items in the queue
+         *
+         * If called while the other thread is pushing or popping, the value
+         * may be already outdated when returned.
+         */
+        std::size_t size() const {
+            return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Whether the queue is empty
+         *
+         * Same caveats as with @ref size() apply.
+         */
+        bool isEmpty() const { return !size(); }
+
+        /**
+         * @brief Push a copy of an item
+         *
+         * Returns @cpp false @ce if the queue is full, @cpp true @ce
+         * otherwise. Can be called only from the producer thread.
+         */
+        bool push(const T& value) { return push(Corrade::InPlaceInit, value); }
+
+        /**
+         * @brief Move an item in
+         *
+         * Returns @cpp false @ce if the queue is full, leaving @p value
+         * untouched, @cpp true @ce otherwise. Can be called only from the
+         * producer thread.
+         */
+        bool push(T&& value) { return push(Corrade::InPlaceInit, Utility::move(value)); }
+
+        /**
+         * @brief Construct an item in-place
+         *
+         * Returns @cpp false @ce if the queue is full, in which case nothing
+         * is constructed, @cpp true @ce otherwise. Can be called only from
+         * the producer thread.
+         */
+        template<class ...Args> bool push(Corrade::InPlaceInitT, Args&&... args);
+
+        /**
+         * @brief Pop an item
+         *
+         * If the queue is empty, returns @cpp false @ce and leaves @p out
+         * untouched. Otherwise move-assigns the oldest item to @p out, calls
+         * its destructor and returns @cpp true @ce. Can be called only from
+         * the consumer thread.
+         */
+        bool pop(T& out);
+
+        /**
+         * @brief Pop an item into uninitialized memory
+         *
+         * Compared to @ref pop(T&), the item is move-constructed into
+         * @p out instead of move-assigned. Can be called only from the
+         * consumer thread.
+         */
+        bool pop(Corrade::NoInitT, T* out);
+
+    private:
+        /* Shared, read-only after construction. The padding keeps the
+           indices at least a cache line apart from each other and from the
+           rest. Not using alignas(64) for that, as an over-aligned type isn't
+           correctly allocated by a plain new before C++17. */
+        Array<Implementation::SpscQueueSlot<T>> _data;
+        std::size_t _mask;
+        char _padding0[64];
+
+        /* Written by the producer, read by the consumer. The cached tail is
+           used only by the producer, so it can be on the same cache line. */
+        std::atomic<std::size_t> _head;
+        std::size_t _cachedTail;
+        char _padding1[64];
+
+        /* Written by the consumer, read by the producer */
+        std::atomic<std::size_t> _tail;
+        std::size_t _cachedHead;
+        char _padding2[64];
+};
+
+template<class T> SpscQueue<T>::SpscQueue(std::size_t capacity): _head{0}, _cachedTail{0}, _tail{0}, _cachedHead{0} {
+    CORRADE_ASSERT(capacity,
+        "Containers::SpscQueue: expected non-zero capacity", );
+    std::size_t rounded = 1;
+    while(rounded < capacity) rounded <<= 1;
+    _data = Array<Implementation::SpscQueueSlot<T>>{Corrade::NoInit, rounded};
+    _mask = rounded - 1;
+}
+
+template<class T> SpscQueue<T>::~SpscQueue() {
+    const std::size_t head = _head.load(std::memory_order_acquire);
+    for(std::size_t i = _tail.load(std::memory_order_acquire); i != head; ++i)
+        _data[i & _mask].value.~T();
+}
+
+template<class T> template<class ...Args> bool SpscQueue<T>::push(Corrade::InPlaceInitT, Args&&... args) {
+    const std::size_t head = _head.load(std::memory_order_relaxed);
+    if(head - _cachedTail == _data.size()) {
+        _cachedTail = _tail.load(std::memory_order_acquire);
+        if(head - _cachedTail == _data.size()) return false;
+    }
+
+    Implementation::construct(_data[head & _mask].value, Utility::forward<Args>(args)...);
+    _head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+template<class T> bool SpscQueue<T>::pop(T& out) {
+    const std::size_t tail = _tail.load(std::memory_order_relaxed);
+    if(tail == _cachedHead) {
+        _cachedHead = _head.load(std::memory_order_acquire);
+        if(tail == _cachedHead) return false;
+    }
+
+    T& value = _data[tail & _mask].value;
+    out = Utility::move(value);
+    value.~T();
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+template<class T> bool SpscQueue<T>::pop(Corrade::NoInitT, T* const out) {
+    const std::size_t tail = _tail.load(std::memory_order_relaxed);
+    if(tail == _cachedHead) {
+        _cachedHead = _head.load(std::memory_order_acquire);
+        if(tail == _cachedHead) return false;
+    }
+
+    T& value = _data[tail & _mask].value;
+    Implementation::construct(*out, Utility::move(value));
+    value.~T();
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+}}
+
+#endif
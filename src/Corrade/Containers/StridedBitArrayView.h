@@ -0,0 +1,291 @@
+#ifndef Corrade_Containers_StridedBitArrayView_h
+#define Corrade_Containers_StridedBitArrayView_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::BasicStridedBitArrayView, typedef @ref Corrade::Containers::StridedBitArrayView, @ref Corrade::Containers::MutableStridedBitArrayView
+ * @m_since_latest
+ */
+
+#include "Corrade/Containers/BitArrayView.h"
+
+namespace Corrade { namespace Containers {
+
+/**
+@brief Strided bit array view
+@m_since_latest
+
+A variant of @ref BasicBitArrayView with an arbitrary stride between the
+bits, which can be also zero or negative. Useful for example for accessing
+a single bit of each item in a packed array of flags. Since the bits are not
+consecutive, operations on the whole view such as @ref count() or
+@ref setAll() go bit by bit instead of on whole words, converting back to a
+@ref BasicBitArrayView is preferable for larger data if the stride is
+@cpp 1 @ce.
+
+The stride is in bits, as is the @ref offset() of the first bit in the first
+byte. Similarly to @ref BasicBitArrayView, three bits of the size are used
+to store the offset.
+
+@snippet Containers.cpp StridedBitArrayView-usage
+
+The class is usually used through the @ref StridedBitArrayView and
+@ref MutableStridedBitArrayView typedefs.
+@experimental
+*/
+template<class T> class BasicStridedBitArrayView {
+    public:
+        /**
+         * @brief Erased type
+         *
+         * Either a @cpp const void @ce or a @cpp void @ce.
+         */
+        typedef typename BasicBitArrayView<T>::ErasedType ErasedType;
+
+        /** @brief Default constructor */
+        constexpr /*implicit*/ BasicStridedBitArrayView(std::nullptr_t = nullptr) noexcept: _data{}, _sizeOffset{}, _stride{} {}
+
+        /**
+         * @brief Constructor
+         * @param data      Pointer to the byte containing the first bit
+         * @param offset    Offset of the first bit in the first byte. Expected
+         *      to be less than @cpp 8 @ce.
+         * @param size      Size in bits
+         * @param stride    Stride in bits
+         */
+        /*implicit*/ BasicStridedBitArrayView(ErasedType* data, std::size_t offset, std::size_t size, std::ptrdiff_t stride) noexcept: _data{static_cast<T*>(data)}, _sizeOffset{(CORRADE_CONSTEXPR_ASSERT(offset < 8,
+            "Containers::StridedBitArrayView: offset expected to be smaller than 8 bits, got" << offset),
+            CORRADE_CONSTEXPR_ASSERT(size < std::size_t{1} << (sizeof(std::size_t)*8 - Implementation::BitArrayViewSizeShift),
+            "Containers::StridedBitArrayView: size expected to be smaller than 2^" << Utility::Debug::nospace << (sizeof(std::size_t)*8 - Implementation::BitArrayViewSizeShift) << "bits, got" << size),
+            size << Implementation::BitArrayViewSizeShift|offset)}, _stride{stride} {}
+
+        /**
+         * @brief Construct from a contiguous view
+         *
+         * The stride is set to @cpp 1 @ce.
+         */
+        /*implicit*/ BasicStridedBitArrayView(BasicBitArrayView<T> view) noexcept: _data{static_cast<T*>(view.data())}, _sizeOffset{view.size() << Implementation::BitArrayViewSizeShift|view.offset()}, _stride{1} {}
+
+        /** @brief Construct a @ref StridedBitArrayView from a @ref MutableStridedBitArrayView */
+        template<class U, class = typename std::enable_if<std::is_same<const U, T>::value>::type> /*implicit*/ BasicStridedBitArrayView(const BasicStridedBitArrayView<U>& mutable_) noexcept: _data{static_cast<T*>(mutable_.data())}, _sizeOffset{mutable_.size() << Implementation::BitArrayViewSizeShift|mutable_.offset()}, _stride{mutable_.stride()} {}
+
+        /** @brief Pointer to the byte containing the first bit */
+        constexpr ErasedType* data() const { return _data; }
+
+        /** @brief Offset of the first bit in the first byte */
+        constexpr std::size_t offset() const {
+            return _sizeOffset & Implementation::BitArrayViewOffsetMask;
+        }
+
+        /** @brief Size in bits */
+        constexpr std::size_t size() const {
+            return _sizeOffset >> Implementation::BitArrayViewSizeShift;
+        }
+
+        /** @brief Stride in bits */
+        constexpr std::ptrdiff_t stride() const { return _stride; }
+
+        /** @brief Whether the view is empty */
+        constexpr bool isEmpty() const { return !size(); }
+
+        /** @brief Bit at given position */
+        bool operator[](std::size_t i) const {
+            const std::ptrdiff_t bit = std::ptrdiff_t(offset()) + std::ptrdiff_t(i)*_stride;
+            return _data[byteOffset(bit)] & (1 << (bit - byteOffset(bit)*8));
+        }
+
+        /**
+         * @brief Set a bit at given position
+         *
+         * Available only on a @ref MutableStridedBitArrayView.
+         */
+        template<class U = T, class = typename std::enable_if<!std::is_const<U>::value>::type> void set(std::size_t i) const {
+            const std::ptrdiff_t bit = std::ptrdiff_t(offset()) + std::ptrdiff_t(i)*_stride;
+            _data[byteOffset(bit)] |= char(1 << (bit - byteOffset(bit)*8));
+        }
+
+        /**
+         * @brief Reset a bit at given position
+         *
+         * Available only on a @ref MutableStridedBitArrayView.
+         */
+        template<class U = T, class = typename std::enable_if<!std::is_const<U>::value>::type> void reset(std::size_t i) const {
+            const std::ptrdiff_t bit = std::ptrdiff_t(offset()) + std::ptrdiff_t(i)*_stride;
+            _data[byteOffset(bit)] &= char(~(1 << (bit - byteOffset(bit)*8)));
+        }
+
+        /**
+         * @brief Set or reset a bit at given position
+         *
+         * Available only on a @ref MutableStridedBitArrayView.
+         */
+        template<class U = T, class = typename std::enable_if<!std::is_const<U>::value>::type> void set(std::size_t i, bool value) const {
+            value ? set(i) : reset(i);
+        }
+
+        /**
+         * @brief Set or reset all bits
+         *
+         * Available only on a @ref MutableStridedBitArrayView. If the stride
+         * is @cpp 1 @ce, delegates to @ref BasicBitArrayView::setAll(bool),
+         * otherwise goes bit by bit.
+         */
+        template<class U = T, class = typename std::enable_if<!std::is_const<U>::value>::type> void setAll(bool value) const {
+            if(_stride == 1)
+                return Implementation::bitSetAll(_data, offset(), size(), value);
+            for(std::size_t i = 0, max = size(); i != max; ++i)
+                set(i, value);
+        }
+
+        /**
+         * @brief Set all bits
+         *
+         * Available only on a @ref MutableStridedBitArrayView.
+         * @see @ref setAll(bool)
+         */
+        template<class U = T, class = typename std::enable_if<!std::is_const<U>::value>::type> void setAll() const {
+            setAll(true);
+        }
+
+        /**
+         * @brief Reset all bits
+         *
+         * Available only on a @ref MutableStridedBitArrayView.
+         * @see @ref setAll(bool)
+         */
+        template<class U = T, class = typename std::enable_if<!std::is_const<U>::value>::type> void resetAll() const {
+            setAll(false);
+        }
+
+        /**
+         * @brief Count of set bits
+         *
+         * If the stride is @cpp 1 @ce, delegates to
+         * @ref BasicBitArrayView::count(), otherwise goes bit by bit.
+         */
+        std::size_t count() const {
+            if(_stride == 1)
+                return Implementation::bitCount(_data, offset(), size());
+            std::size_t count = 0;
+            for(std::size_t i = 0, max = size(); i != max; ++i)
+                count += (*this)[i];
+            return count;
+        }
+
+        /**
+         * @brief View slice
+         *
+         * Expects that @cpp begin <= end @ce and @p end is not larger than
+         * @ref size().
+         */
+        BasicStridedBitArrayView<T> slice(std::size_t begin, std::size_t end) const {
+            CORRADE_ASSERT(begin <= end && end <= size(),
+                "Containers::StridedBitArrayView::slice(): slice [" << Utility::Debug::nospace << begin << Utility::Debug::nospace << ":" << Utility::Debug::nospace << end << Utility::Debug::nospace << "] out of range for" << size() << "bits", {});
+            return atBit(std::ptrdiff_t(offset()) + std::ptrdiff_t(begin)*_stride, end - begin, _stride);
+        }
+
+        /**
+         * @brief View prefix
+         *
+         * Equivalent to @cpp data.slice(0, end) @ce.
+         */
+        BasicStridedBitArrayView<T> prefix(std::size_t end) const {
+            return slice(0, end);
+        }
+
+        /**
+         * @brief View suffix
+         *
+         * Equivalent to @cpp data.slice(begin, data.size()) @ce.
+         */
+        BasicStridedBitArrayView<T> suffix(std::size_t begin) const {
+            return slice(begin, size());
+        }
+
+        /**
+         * @brief View prefix except the last @p count bits
+         *
+         * Equivalent to @cpp data.slice(0, data.size() - count) @ce.
+         */
+        BasicStridedBitArrayView<T> except(std::size_t count) const {
+            return slice(0, size() - count);
+        }
+
+        /**
+         * @brief Pick every Nth bit
+         *
+         * Multiplies the stride by @p step and adjusts the size. Expects that
+         * @p step is non-zero.
+         */
+        BasicStridedBitArrayView<T> every(std::size_t step) const {
+            CORRADE_ASSERT(step, "Containers::StridedBitArrayView::every(): expected a non-zero step", {});
+            return BasicStridedBitArrayView<T>{_data, offset(), (size() + step - 1)/step, _stride*std::ptrdiff_t(step)};
+        }
+
+        /**
+         * @brief Flip the view
+         *
+         * The first bit becomes the last and the stride is negated.
+         */
+        BasicStridedBitArrayView<T> flipped() const {
+            if(!size()) return *this;
+            return atBit(std::ptrdiff_t(offset()) + std::ptrdiff_t(size() - 1)*_stride, size(), -_stride);
+        }
+
+    private:
+        /* Byte containing given bit, rounding towards negative infinity */
+        static std::ptrdiff_t byteOffset(std::ptrdiff_t bit) {
+            return bit >= 0 ? bit/8 : -((7 - bit)/8);
+        }
+
+        /* View with the first bit at given (possibly negative) position
+           relative to _data */
+        BasicStridedBitArrayView<T> atBit(std::ptrdiff_t bit, std::size_t size, std::ptrdiff_t stride) const {
+            const std::ptrdiff_t byte = byteOffset(bit);
+            return BasicStridedBitArrayView<T>{_data + byte, std::size_t(bit - byte*8), size, stride};
+        }
+
+        T* _data;
+        std::size_t _sizeOffset;
+        std::ptrdiff_t _stride;
+};
+
+/**
+@brief Const strided bit array view
+@m_since_latest
+*/
+typedef BasicStridedBitArrayView<const char> StridedBitArrayView;
+
+/**
+@brief Mutable strided bit array view
+@m_since_latest
+*/
+typedef BasicStridedBitArrayView<char> MutableStridedBitArrayView;
+
+}}
+
+#endif
@@ -179,6 +179,24 @@ String::String(char* const data, const std::size_t size, void(*deleter)(char*, s
     _large.deleter = deleter;
 }
 
+String::String(Array<char>&& data) noexcept
+    #ifdef CORRADE_GRACEFUL_ASSERT
+    /* Zero-init the contents so the destructor doesn't crash if we assert here */
+    : _large{}
+    #endif
+{
+    /* Checking the size first so the null terminator check doesn't read out
+       of bounds in the test for this assert */
+    CORRADE_ASSERT(data.size() <= std::size_t{1} << (sizeof(std::size_t)*8 - 2),
+        "Containers::String: string expected to be smaller than 2^" << Utility::Debug::nospace << sizeof(std::size_t)*8 - 2 << "bytes, got" << data.size() - 1, );
+    CORRADE_ASSERT(!data.empty() && !data.back(),
+        "Containers::String: can only take ownership of a non-empty null-terminated array", );
+
+    _large.size = data.size() - 1;
+    _large.deleter = data.deleter();
+    _large.data = data.release();
+}
+
 String::String(Corrade::ValueInitT, const std::size_t size): _large{} {
     CORRADE_ASSERT(size < std::size_t{1} << (sizeof(std::size_t)*8 - 2),
         "Containers::String: string expected to be smaller than 2^" << Utility::Debug::nospace << sizeof(std::size_t)*8 - 2 << "bytes, got" << size, );
@@ -476,6 +494,38 @@ Array<StringView> String::splitWithoutEmptyParts() const & {
 }
 #endif
 
+MutableStringSplitter String::splitter(const char delimiter) & {
+    return MutableStringView{*this}.splitter(delimiter);
+}
+
+StringSplitter String::splitter(const char delimiter) const & {
+    return StringView{*this}.splitter(delimiter);
+}
+
+MutableStringSplitter String::splitterWithoutEmptyParts(const char delimiter) & {
+    return MutableStringView{*this}.splitterWithoutEmptyParts(delimiter);
+}
+
+StringSplitter String::splitterWithoutEmptyParts(const char delimiter) const & {
+    return StringView{*this}.splitterWithoutEmptyParts(delimiter);
+}
+
+MutableStringSplitter String::splitterOnAnyWithoutEmptyParts(const StringView delimiters) & {
+    return MutableStringView{*this}.splitterOnAnyWithoutEmptyParts(delimiters);
+}
+
+StringSplitter String::splitterOnAnyWithoutEmptyParts(const StringView delimiters) const & {
+    return StringView{*this}.splitterOnAnyWithoutEmptyParts(delimiters);
+}
+
+MutableStringSplitter String::splitterOnWhitespaceWithoutEmptyParts() & {
+    return MutableStringView{*this}.splitterOnWhitespaceWithoutEmptyParts();
+}
+
+StringSplitter String::splitterOnWhitespaceWithoutEmptyParts() const & {
+    return StringView{*this}.splitterOnWhitespaceWithoutEmptyParts();
+}
+
 Array3<MutableStringView> String::partition(const char separator) & {
     return MutableStringView{*this}.partition(separator);
 }
@@ -102,10 +102,25 @@ string) are guaranteed to be null-terminated, which means a conversion to
 
 As with @ref BasicStringView "StringView", the class is implicitly convertible
 to @ref ArrayView. In addition it's also move-convertible to @ref Array, transferring the ownership of the internal data array to it. Ownership transfer
-in the other direction is not provided because it's not possible to implicitly
-guarantee null termination of the input @ref Array --- use the explicit
-@ref String(char*, std::size_t, Deleter) constructor together with
-@ref Array::release() in that case.
+in the other direction isn't implicit because it's not possible to implicitly
+guarantee null termination of the input @ref Array --- either use the explicit
+@ref String(Array<char>&&) constructor, which expects the array to end with a
+null terminator, or the @ref String(char*, std::size_t, Deleter) constructor
+together with @ref Array::release().
+
+@subsection Containers-String-usage-building Building strings incrementally
+
+The class itself isn't growable. When a string is assembled from many pieces,
+repeatedly concatenating or calling @ref join() on a growing list reallocates
+every time. Instead, build it in a growable @ref Array of @cpp char @ce ---
+appending to it with @ref arrayAppend() or
+@ref Utility::formatInto(Containers::Array<char>&, std::size_t, const char*, const Args&... args)
+has amortized growth --- and then hand the memory over to a @ref String using
+@ref String(Array<char>&&) after appending a null terminator. As the growable
+array almost always has spare capacity for it, the handoff is done without
+copying:
+
+@snippet Containers.cpp String-usage-building
 
 @subsection Containers-String-usage-sso Small string optimization
 
@@ -325,6 +340,21 @@ class CORRADE_UTILITY_EXPORT String {
          */
         explicit String(std::nullptr_t, std::size_t size, Deleter deleter) = delete;
 
+        /**
+         * @brief Take ownership of a null-terminated array
+         * @m_since_latest
+         *
+         * Expects that @p data is non-empty and its last element is a null
+         * terminator, which is then excluded from @ref size(). The memory
+         * together with the deleter is taken over without any copy, leaving
+         * @p data empty. Meant to be used for strings assembled in a growable
+         * array, where appending the null terminator with
+         * @ref arrayAppend() is usually done without a reallocation, see
+         * @ref Containers-String-usage-building for an example. The resulting
+         * instance is never SSO, even if it's small.
+         */
+        explicit String(Array<char>&& data) noexcept;
+
         /**
          * @brief Create a zero-initialized string of given size
          * @param size      Size excluding the null terminator
@@ -610,6 +640,49 @@ class CORRADE_UTILITY_EXPORT String {
         CORRADE_DEPRECATED("use splitOnWhitespaceWithoutEmptyParts() instead") Array<StringView> splitWithoutEmptyParts() const &;
         #endif
 
+        /**
+         * @brief Lazily split on given character
+         * @m_since_latest
+         *
+         * Equivalent to @ref BasicStringView::splitter(). Not allowed to be
+         * called on a rvalue since the returned views would become dangling.
+         */
+        MutableStringSplitter splitter(char delimiter) &;
+        StringSplitter splitter(char delimiter) const &; /**< @overload */
+
+        /**
+         * @brief Lazily split on given character, removing empty parts
+         * @m_since_latest
+         *
+         * Equivalent to @ref BasicStringView::splitterWithoutEmptyParts().
+         * Not allowed to be called on a rvalue since the returned views would
+         * become dangling.
+         */
+        MutableStringSplitter splitterWithoutEmptyParts(char delimiter) &;
+        StringSplitter splitterWithoutEmptyParts(char delimiter) const &; /**< @overload */
+
+        /**
+         * @brief Lazily split on any character from given set, removing empty parts
+         * @m_since_latest
+         *
+         * Equivalent to @ref BasicStringView::splitterOnAnyWithoutEmptyParts().
+         * Not allowed to be called on a rvalue since the returned views would
+         * become dangling.
+         */
+        MutableStringSplitter splitterOnAnyWithoutEmptyParts(StringView delimiters) &;
+        StringSplitter splitterOnAnyWithoutEmptyParts(StringView delimiters) const &; /**< @overload */
+
+        /**
+         * @brief Lazily split on whitespace, removing empty parts
+         * @m_since_latest
+         *
+         * Equivalent to @ref BasicStringView::splitterOnWhitespaceWithoutEmptyParts().
+         * Not allowed to be called on a rvalue since the returned views would
+         * become dangling.
+         */
+        MutableStringSplitter splitterOnWhitespaceWithoutEmptyParts() &;
+        StringSplitter splitterOnWhitespaceWithoutEmptyParts() const &; /**< @overload */
+
         /**
          * @brief Partition
          *
@@ -30,12 +30,26 @@
 #include <cstring>
 #include <string>
 
+#ifdef CORRADE_TARGET_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef CORRADE_TARGET_NEON
+#include <cstdint>
+#include <arm_neon.h>
+#endif
+
 #include "Corrade/Containers/Array.h"
 #include "Corrade/Containers/ArrayView.h"
 #include "Corrade/Containers/GrowableArray.h"
 #include "Corrade/Containers/EnumSet.hpp"
 #include "Corrade/Containers/StaticArray.h"
+#include "Corrade/Containers/bitHelpers.h"
 #include "Corrade/Utility/DebugStl.h"
+#include "Corrade/Utility/Implementation/cpu.h"
+
+#ifdef CORRADE_ENABLE_AVX2
+#include <immintrin.h>
+#endif
 
 namespace Corrade { namespace Containers {
 
@@ -126,29 +140,62 @@ namespace {
 
     https://github.com/bminor/glibc/blob/43b1048ab9418e902aac8c834a7a9a88c501620a/sysdeps/x86_64/multiarch/strcspn-c.c
 
-   and the only trick I realized above the nested loop is using memchr() in an
-   inverse way. In all honesty, I think that'll still be *at least* as fast as
-   std::find_first_of() because I doubt STL implementations explicitly optimize
-   for that case. Yes, std::string::find_first_of() probably would have that,
-   but I'd first need to allocate to make use of that and FUCK NO. */
-inline const char* findFirstOf(const char* begin, const char* const end, const char* const characters, std::size_t characterCount) {
+   What all the non-trivial implementations have in common is building a
+   lookup table out of the character set first, so each byte of the input is
+   then tested with a single load instead of going through the whole set with
+   memchr(). That makes the whole thing O(n + m) instead of O(nm). A 256-bit
+   bitmap is enough for that, it's cheap to build (so it can be done on every
+   call) and fits into four registers. */
+struct CharacterSet {
+    explicit CharacterSet(const char* const characters, const std::size_t characterCount): data{} {
+        for(std::size_t i = 0; i != characterCount; ++i) {
+            const unsigned char c = characters[i];
+            data[c >> 6] |= 1ull << (c & 0x3f);
+        }
+    }
+
+    explicit CharacterSet(const unsigned long long(&data)[4]): data{data[0], data[1], data[2], data[3]} {}
+
+    bool contains(const char character) const {
+        const unsigned char c = character;
+        return data[c >> 6] & (1ull << (c & 0x3f));
+    }
+
+    unsigned long long data[4];
+};
+
+inline const char* findFirstOf(const char* begin, const char* const end, const CharacterSet& characters) {
     for(; begin != end; ++begin)
-        if(std::memchr(characters, *begin, characterCount)) return begin;
+        if(characters.contains(*begin)) return begin;
     return end;
 }
 
 /* Variants of the above. Not sure if those even have any vaguely corresponding
    C lib API. Probably not. */
 
-inline const char* findFirstNotOf(const char* begin, const char* const end, const char* const characters, std::size_t characterCount) {
+inline const char* findFirstNotOf(const char* begin, const char* const end, const CharacterSet& characters) {
     for(; begin != end; ++begin)
-        if(!std::memchr(characters, *begin, characterCount)) return begin;
+        if(!characters.contains(*begin)) return begin;
     return end;
 }
 
-inline const char* findLastNotOf(const char* const begin, const char* end, const char* const characters, std::size_t characterCount) {
+/* Single-character variants of the above, used by the lazy splitter to not
+   need to build the lookup table */
+
+inline const char* findFirstOf(const char* const begin, const char* const end, const char character) {
+    const void* const found = std::memchr(begin, character, end - begin);
+    return found ? static_cast<const char*>(found) : end;
+}
+
+inline const char* findFirstNotOf(const char* begin, const char* const end, const char character) {
+    for(; begin != end; ++begin)
+        if(*begin != character) return begin;
+    return end;
+}
+
+inline const char* findLastNotOf(const char* const begin, const char* end, const CharacterSet& characters) {
     for(; end != begin; --end)
-        if(!std::memchr(characters, *(end - 1), characterCount)) return end;
+        if(!characters.contains(*(end - 1))) return end;
     return begin;
 }
 
@@ -156,13 +203,12 @@ inline const char* findLastNotOf(const char* const begin, const char* end, const
 
 template<class T> Array<BasicStringView<T>> BasicStringView<T>::splitOnAnyWithoutEmptyParts(const Containers::StringView delimiters) const {
     Array<BasicStringView<T>> parts;
-    const char* const characters = delimiters.begin();
-    const std::size_t characterCount = delimiters.size();
+    const CharacterSet characters{delimiters.data(), delimiters.size()};
     T* const end = this->end();
     T* oldpos = _data;
 
     while(oldpos < end) {
-        T* const pos = const_cast<T*>(findFirstOf(oldpos, end, characters, characterCount));
+        T* const pos = const_cast<T*>(findFirstOf(oldpos, end, characters));
         if(pos != oldpos)
             arrayAppend(parts, slice(oldpos, pos));
 
@@ -214,6 +260,86 @@ template<class T> Array<BasicStringView<T>> BasicStringView<T>::splitWithoutEmpt
 }
 #endif
 
+template<class T> BasicStringSplitter<T> BasicStringView<T>::splitter(const char delimiter) const {
+    return BasicStringSplitter<T>{BasicStringSplitIterator<T>{*this, delimiter, false}};
+}
+
+template<class T> BasicStringSplitter<T> BasicStringView<T>::splitterWithoutEmptyParts(const char delimiter) const {
+    return BasicStringSplitter<T>{BasicStringSplitIterator<T>{*this, delimiter, true}};
+}
+
+template<class T> BasicStringSplitter<T> BasicStringView<T>::splitterOnAnyWithoutEmptyParts(const StringView delimiters) const {
+    return BasicStringSplitter<T>{BasicStringSplitIterator<T>{*this, delimiters, true}};
+}
+
+template<class T> BasicStringSplitter<T> BasicStringView<T>::splitterOnWhitespaceWithoutEmptyParts() const {
+    #ifdef CORRADE_MSVC2019_COMPATIBILITY
+    using namespace Containers::Literals;
+    return splitterOnAnyWithoutEmptyParts(WHITESPACE_MACRO_BECAUSE_MSVC_IS_STUPID);
+    #else
+    return splitterOnAnyWithoutEmptyParts(Whitespace);
+    #endif
+}
+
+template<class T> BasicStringSplitIterator<T>::BasicStringSplitIterator(const BasicStringView<T> string, const char delimiter, const bool skipEmptyParts): _characters{}, _delimiter{delimiter}, _singleDelimiter{true}, _skipEmptyParts{skipEmptyParts} {
+    /* Same as with split(), an empty string has no parts. Otherwise the whole
+       string is the rest that's yet to be split, and the first increment
+       finds the first part in it. */
+    if(!string.isEmpty()) {
+        _rest = string;
+        ++*this;
+    }
+}
+
+template<class T> BasicStringSplitIterator<T>::BasicStringSplitIterator(const BasicStringView<T> string, const StringView delimiters, const bool skipEmptyParts): _characters{}, _delimiter{}, _singleDelimiter{}, _skipEmptyParts{skipEmptyParts} {
+    const CharacterSet characters{delimiters.data(), delimiters.size()};
+    for(std::size_t i = 0; i != 4; ++i) _characters[i] = characters.data[i];
+
+    if(!string.isEmpty()) {
+        _rest = string;
+        ++*this;
+    }
+}
+
+template<class T> BasicStringSplitIterator<T>& BasicStringSplitIterator<T>::operator++() {
+    const CharacterSet characters{_characters};
+
+    /* Skip delimiters at the start, if requested. If that consumes the whole
+       rest, there are no more parts. */
+    if(_skipEmptyParts && _rest._data) {
+        _rest = _rest.suffix(const_cast<T*>(_singleDelimiter ?
+            findFirstNotOf(_rest.begin(), _rest.end(), _delimiter) :
+            findFirstNotOf(_rest.begin(), _rest.end(), characters)));
+        if(_rest.isEmpty()) _rest = {};
+    }
+
+    /* Nothing left, this is the end */
+    if(!_rest._data) {
+        _part = {};
+        return *this;
+    }
+
+    T* const end = _rest.end();
+    T* const pos = const_cast<T*>(_singleDelimiter ?
+        findFirstOf(_rest.begin(), end, _delimiter) :
+        findFirstOf(_rest.begin(), end, characters));
+
+    /* Delimiter found, the rest continues after it. It might be empty, in
+       which case it's either an empty last part or nothing, depending on
+       whether empty parts are skipped. */
+    if(pos != end) {
+        _part = _rest.prefix(pos);
+        _rest = _rest.suffix(pos + 1);
+
+    /* No delimiter found, the rest is the last part */
+    } else {
+        _part = _rest;
+        _rest = {};
+    }
+
+    return *this;
+}
+
 template<class T> Array3<BasicStringView<T>> BasicStringView<T>::partition(const char separator) const {
     /** @todo partition() using multiple characters, would need implementing
         a non-shitty strstr() that can work on non-null-terminated strings */
@@ -346,7 +472,7 @@ template<class T> BasicStringView<T> BasicStringView<T>::trimmed() const {
 }
 
 template<class T> BasicStringView<T> BasicStringView<T>::trimmedPrefix(const StringView characters) const {
-    return suffix(const_cast<T*>(findFirstNotOf(_data, end(), characters.data(), characters.size())));
+    return suffix(const_cast<T*>(findFirstNotOf(_data, end(), CharacterSet{characters.data(), characters.size()})));
 }
 
 template<class T> BasicStringView<T> BasicStringView<T>::trimmedPrefix() const {
@@ -359,7 +485,7 @@ template<class T> BasicStringView<T> BasicStringView<T>::trimmedPrefix() const {
 }
 
 template<class T> BasicStringView<T> BasicStringView<T>::trimmedSuffix(const StringView characters) const {
-    return prefix(const_cast<T*>(findLastNotOf(_data, end(), characters.data(), characters.size())));
+    return prefix(const_cast<T*>(findLastNotOf(_data, end(), CharacterSet{characters.data(), characters.size()})));
 }
 
 template<class T> BasicStringView<T> BasicStringView<T>::trimmedSuffix() const {
@@ -373,6 +499,130 @@ template<class T> BasicStringView<T> BasicStringView<T>::trimmedSuffix() const {
 
 namespace {
 
+/* The kernels below get a [begin, end) range of candidate positions, i.e.
+   end is not the end of the string but one past the last position where the
+   substring can start. The substring is always at least two bytes, smaller
+   ones are handled directly in findFirst(). */
+
+const char* findFirstScalar(const char* i, const char* const end, const char* const substring, const std::size_t substringSize) {
+    const char first = substring[0];
+    for(; i != end; ++i)
+        if(*i == first && std::memcmp(i + 1, substring + 1, substringSize - 1) == 0)
+            return i;
+    return {};
+}
+
+/* Comparing the first and the last byte of the substring against a block of
+   candidate positions at once and verifying only the positions where both
+   match, as described in http://0x80.pl/articles/simd-strfind.html. Compared
+   to checking just the first byte, the last byte filters out most false
+   positives in natural text where certain letters are very common. */
+
+#ifdef CORRADE_TARGET_SSE2
+const char* findFirstSse2(const char* i, const char* const end, const char* const substring, const std::size_t substringSize) {
+    const __m128i first = _mm_set1_epi8(substring[0]);
+    const __m128i last = _mm_set1_epi8(substring[substringSize - 1]);
+
+    /* The second load reads substringSize - 1 bytes further, which is still
+       in bounds as end is substringSize - 1 bytes before the string end */
+    for(; end - i >= 16; i += 16) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(i + substringSize - 1));
+        unsigned mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last)));
+        while(mask) {
+            const unsigned bit = Implementation::trailingZeros(mask);
+            if(std::memcmp(i + bit + 1, substring + 1, substringSize - 2) == 0)
+                return i + bit;
+            mask &= mask - 1;
+        }
+    }
+
+    return findFirstScalar(i, end, substring, substringSize);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX2
+CORRADE_ENABLE_AVX2 const char* findFirstAvx2(const char* i, const char* const end, const char* const substring, const std::size_t substringSize) {
+    const __m256i first = _mm256_set1_epi8(substring[0]);
+    const __m256i last = _mm256_set1_epi8(substring[substringSize - 1]);
+
+    /* Go through two blocks at once and verify them only if there's any
+       candidate, that's a single branch per 64 bytes in the common case */
+    for(; end - i >= 64; i += 64) {
+        const __m256i a0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(i));
+        const __m256i b0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(i + substringSize - 1));
+        const __m256i a1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(i + 32));
+        const __m256i b1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(i + 32 + substringSize - 1));
+        const __m256i eq0 = _mm256_and_si256(_mm256_cmpeq_epi8(a0, first), _mm256_cmpeq_epi8(b0, last));
+        const __m256i eq1 = _mm256_and_si256(_mm256_cmpeq_epi8(a1, first), _mm256_cmpeq_epi8(b1, last));
+        if(_mm256_testz_si256(_mm256_or_si256(eq0, eq1), _mm256_or_si256(eq0, eq1)))
+            continue;
+
+        unsigned long long mask = unsigned(_mm256_movemask_epi8(eq0))|(static_cast<unsigned long long>(unsigned(_mm256_movemask_epi8(eq1))) << 32);
+        while(mask) {
+            const unsigned bit = Implementation::trailingZeros(mask);
+            if(std::memcmp(i + bit + 1, substring + 1, substringSize - 2) == 0)
+                return i + bit;
+            mask &= mask - 1;
+        }
+    }
+
+    for(; end - i >= 32; i += 32) {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(i));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(i + substringSize - 1));
+        unsigned mask = _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last)));
+        while(mask) {
+            const unsigned bit = Implementation::trailingZeros(mask);
+            if(std::memcmp(i + bit + 1, substring + 1, substringSize - 2) == 0)
+                return i + bit;
+            mask &= mask - 1;
+        }
+    }
+
+    return findFirstScalar(i, end, substring, substringSize);
+}
+#endif
+
+#ifdef CORRADE_TARGET_NEON
+const char* findFirstNeon(const char* i, const char* const end, const char* const substring, const std::size_t substringSize) {
+    const uint8x16_t first = vdupq_n_u8(substring[0]);
+    const uint8x16_t last = vdupq_n_u8(substring[substringSize - 1]);
+
+    for(; end - i >= 16; i += 16) {
+        const uint8x16_t a = vld1q_u8(reinterpret_cast<const std::uint8_t*>(i));
+        const uint8x16_t b = vld1q_u8(reinterpret_cast<const std::uint8_t*>(i + substringSize - 1));
+        const uint8x16_t eq = vandq_u8(vceqq_u8(a, first), vceqq_u8(b, last));
+        /* There's no movemask on NEON, shifting each 16-bit lane right by
+           four and narrowing gives a 64-bit mask with four bits per byte */
+        unsigned long long mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+        while(mask) {
+            const unsigned bit = Implementation::trailingZeros(mask)/4;
+            if(std::memcmp(i + bit + 1, substring + 1, substringSize - 2) == 0)
+                return i + bit;
+            mask &= ~(0xfull << bit*4);
+        }
+    }
+
+    return findFirstScalar(i, end, substring, substringSize);
+}
+#endif
+
+typedef const char*(*FindFirstImplementation)(const char*, const char*, const char*, std::size_t);
+
+FindFirstImplementation findFirstImplementation() {
+    #ifdef CORRADE_ENABLE_AVX2
+    if(Utility::Implementation::cpuFeatures() & Utility::Implementation::CpuAvx2)
+        return findFirstAvx2;
+    #endif
+    #ifdef CORRADE_TARGET_SSE2
+    return findFirstSse2;
+    #elif defined(CORRADE_TARGET_NEON)
+    return findFirstNeon;
+    #else
+    return findFirstScalar;
+    #endif
+}
+
 inline const char* findFirst(const char* data, const std::size_t size, const char* substring, const std::size_t substringSize) {
     /* If the substring is not larger than the string we search in */
     if(substringSize <= size) {
@@ -380,15 +630,19 @@ inline const char* findFirst(const char* data, const std::size_t size, const cha
            return a pointer to the first character. This also avoids some
            potential "this is UB so I can whatever YOLO!" misoptimizations and
            implementation differences when calling memcmp() with zero size and
-           potentially null pointers also. */
-        if(!size) return data;
-
-        /* Otherwise compare it with the string at all possible positions in
-           the string until we have a match. */
-        for(const char* const max = data + size - substringSize; data <= max; ++data) {
-            if(std::memcmp(data, substring, substringSize) == 0)
-                return data;
-        }
+           potentially null pointers also. An empty substring is found right
+           at the start as well. */
+        if(!substringSize) return data;
+
+        /* Single-byte substrings are best handled by memchr() */
+        if(substringSize == 1)
+            return static_cast<const char*>(std::memchr(data, *substring, size));
+
+        /* Otherwise pick the best implementation for this machine, just once.
+           The function-local static makes this safe to call even from global
+           constructors. */
+        static const FindFirstImplementation implementation = findFirstImplementation();
+        return implementation(data, data + size - substringSize + 1, substring, substringSize);
     }
 
     /* If the substring is larger or no match was found, fail */
@@ -442,6 +696,16 @@ template class
     CORRADE_UTILITY_EXPORT
     #endif
     BasicStringView<const char>;
+template class
+    #if defined(CORRADE_TARGET_CLANG) || defined(CORRADE_TARGET_MSVC)
+    CORRADE_UTILITY_EXPORT
+    #endif
+    BasicStringSplitIterator<char>;
+template class
+    #if defined(CORRADE_TARGET_CLANG) || defined(CORRADE_TARGET_MSVC)
+    CORRADE_UTILITY_EXPORT
+    #endif
+    BasicStringSplitIterator<const char>;
 #endif
 
 bool operator==(const StringView a, const StringView b) {
@@ -155,7 +155,8 @@ string:
 
 <ul>
 <li>@ref split() and @ref splitWithoutEmptyParts() split the view on given set
-of delimiter characters</li>
+of delimiter characters, @ref splitter() and related functions do the same
+lazily without allocating</li>
 <li>@ref join() and @ref joinWithoutEmptyParts() is an inverse of the
 above</li>
 <li>@ref partition() is similar to @ref split(), but always returning three
@@ -513,6 +514,55 @@ template<class T> class CORRADE_UTILITY_EXPORT BasicStringView {
         CORRADE_DEPRECATED("use splitOnWhitespaceWithoutEmptyParts() instead") Array<BasicStringView<T>> splitWithoutEmptyParts() const;
         #endif
 
+        /**
+         * @brief Lazily split on given character
+         * @m_since_latest
+         *
+         * Produces the same parts as @ref split(), but instead of collecting
+         * them into an array, returns a range that finds the next part only
+         * when it's iterated to. No allocation is done, which makes it
+         * suitable for tokenizing large inputs:
+         *
+         * @snippet Containers.cpp StringView-splitter
+         *
+         * The returned range references the original string, which thus has
+         * to stay in scope for as long as the range is iterated.
+         * @see @ref splitterWithoutEmptyParts(),
+         *      @ref splitterOnAnyWithoutEmptyParts(),
+         *      @ref splitterOnWhitespaceWithoutEmptyParts()
+         */
+        BasicStringSplitter<T> splitter(char delimiter) const;
+
+        /**
+         * @brief Lazily split on given character, removing empty parts
+         * @m_since_latest
+         *
+         * Produces the same parts as @ref splitWithoutEmptyParts(char) const,
+         * see @ref splitter() for more information.
+         */
+        BasicStringSplitter<T> splitterWithoutEmptyParts(char delimiter) const;
+
+        /**
+         * @brief Lazily split on any character from given set, removing empty parts
+         * @m_since_latest
+         *
+         * Produces the same parts as @ref splitOnAnyWithoutEmptyParts(), see
+         * @ref splitter() for more information. The @p delimiters are
+         * converted to a character set when the range is created, so unlike
+         * the original string they don't need to stay in scope.
+         */
+        BasicStringSplitter<T> splitterOnAnyWithoutEmptyParts(StringView delimiters) const;
+
+        /**
+         * @brief Lazily split on whitespace, removing empty parts
+         * @m_since_latest
+         *
+         * Produces the same parts as
+         * @ref splitOnWhitespaceWithoutEmptyParts(), see @ref splitter() for
+         * more information.
+         */
+        BasicStringSplitter<T> splitterOnWhitespaceWithoutEmptyParts() const;
+
         /**
          * @brief Partition
          *
@@ -691,14 +741,18 @@ template<class T> class CORRADE_UTILITY_EXPORT BasicStringView {
          * @ref slice() internally, meaning it propagates the @ref flags() as
          * appropriate.
          *
-         * Note that the function operates with a @f$ \mathcal{O}(nm) @f$
-         * complexity and as such is meant mainly for one-time searches in
-         * non-performance-critical code. For repeated searches or searches of
-         * large substrings it's recommended to use the @ref std::search()
-         * algorithms, especially @ref std::boyer_moore_searcher and its
-         * variants. Those algorithms on the other hand have to perform certain
-         * preprocessing of the input and keep extra state and due to that
-         * overhead aren't generally suited for one-time searches.
+         * The search compares the first and the last byte of the substring
+         * with 16 or 32 positions at once using SSE2, AVX2 or NEON,
+         * depending on what's available on the target, and verifies the rest
+         * of the substring only where both match. The AVX2 variant is picked
+         * at runtime if the CPU supports it. The worst-case complexity is
+         * still @f$ \mathcal{O}(nm) @f$ however, so for repeated searches
+         * of large substrings with many partial matches it's recommended to
+         * use the @ref std::search() algorithms, especially
+         * @ref std::boyer_moore_searcher and its variants. Those algorithms
+         * on the other hand have to perform certain preprocessing of the
+         * input and keep extra state and due to that overhead aren't
+         * generally suited for one-time searches.
          *
          * Consider using @ref find(char) const for single-byte substrings.
          * @see @ref contains()
@@ -734,6 +788,7 @@ template<class T> class CORRADE_UTILITY_EXPORT BasicStringView {
         /* Needed for mutable/immutable conversion */
         template<class> friend class BasicStringView;
         friend String;
+        template<class> friend class BasicStringSplitIterator;
 
         /* MSVC demands the export macro to be here as well */
         friend CORRADE_UTILITY_EXPORT bool operator==(StringView a, StringView b);
@@ -767,6 +822,132 @@ typedef BasicStringView<const char> StringView;
 */
 typedef BasicStringView<char> MutableStringView;
 
+/**
+@brief Lazy string split iterator
+@m_since_latest
+
+Returned from @ref BasicStringSplitter::begin(). Dereferencing gives the
+current part, incrementing finds the next one. See
+@ref BasicStringView::splitter() for more information.
+@experimental
+*/
+template<class T> class CORRADE_UTILITY_EXPORT BasicStringSplitIterator {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Equivalent to the iterator returned by
+         * @ref BasicStringSplitter::end().
+         */
+        constexpr /*implicit*/ BasicStringSplitIterator() noexcept: _characters{}, _delimiter{}, _singleDelimiter{}, _skipEmptyParts{} {}
+
+        /** @brief Current part */
+        constexpr const BasicStringView<T>& operator*() const { return _part; }
+
+        /** @brief Access members of the current part */
+        constexpr const BasicStringView<T>* operator->() const { return &_part; }
+
+        /** @brief Equality comparison */
+        constexpr bool operator==(const BasicStringSplitIterator<T>& other) const {
+            return _part._data == other._part._data;
+        }
+
+        /** @brief Non-equality comparison */
+        constexpr bool operator!=(const BasicStringSplitIterator<T>& other) const {
+            return _part._data != other._part._data;
+        }
+
+        /** @brief Advance to the next part */
+        BasicStringSplitIterator<T>& operator++();
+
+        /** @brief Advance to the next part */
+        BasicStringSplitIterator<T> operator++(int) {
+            BasicStringSplitIterator<T> copy{*this};
+            ++*this;
+            return copy;
+        }
+
+    private:
+        friend BasicStringSplitter<T>;
+
+        friend BasicStringView<T>;
+
+        explicit BasicStringSplitIterator(BasicStringView<T> string, char delimiter, bool skipEmptyParts);
+        explicit BasicStringSplitIterator(BasicStringView<T> string, StringView delimiters, bool skipEmptyParts);
+
+        /* A null _part means the end iterator, a null _rest means there's
+           nothing left after _part */
+        BasicStringView<T> _part, _rest;
+        /* Bitmap of delimiter characters, built just once for the whole
+           iteration. Unused if there's just a single delimiter, in which case
+           memchr() is used instead. */
+        unsigned long long _characters[4];
+        char _delimiter;
+        bool _singleDelimiter;
+        bool _skipEmptyParts;
+};
+
+/**
+@brief Lazy string split range
+@m_since_latest
+
+Returned from @ref BasicStringView::splitter() and related functions, meant to
+be used in a range-for loop. See @ref BasicStringView::splitter() for more
+information.
+@experimental
+*/
+template<class T> class BasicStringSplitter {
+    public:
+        /** @brief Iterator to the first part */
+        constexpr BasicStringSplitIterator<T> begin() const { return _begin; }
+        /** @copydoc begin() */
+        constexpr BasicStringSplitIterator<T> cbegin() const { return _begin; }
+
+        /** @brief Iterator to (one item after) the last part */
+        constexpr BasicStringSplitIterator<T> end() const { return {}; }
+        /** @copydoc end() */
+        constexpr BasicStringSplitIterator<T> cend() const { return {}; }
+
+    private:
+        friend BasicStringView<T>;
+
+        constexpr explicit BasicStringSplitter(const BasicStringSplitIterator<T>& begin) noexcept: _begin{begin} {}
+
+        BasicStringSplitIterator<T> _begin;
+};
+
+/**
+@brief Lazy string split iterator
+@m_since_latest
+
+Immutable, use @ref MutableStringSplitIterator for mutable access.
+*/
+typedef BasicStringSplitIterator<const char> StringSplitIterator;
+
+/**
+@brief Mutable lazy string split iterator
+@m_since_latest
+
+@see @ref StringSplitIterator
+*/
+typedef BasicStringSplitIterator<char> MutableStringSplitIterator;
+
+/**
+@brief Lazy string split range
+@m_since_latest
+
+Immutable, use @ref MutableStringSplitter for mutable access.
+*/
+typedef BasicStringSplitter<const char> StringSplitter;
+
+/**
+@brief Mutable lazy string split range
+@m_since_latest
+
+@see @ref StringSplitter
+*/
+typedef BasicStringSplitter<char> MutableStringSplitter;
+
 /**
 @brief String view equality comparison
 @m_since_latest
@@ -0,0 +1,529 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+
+#include "Corrade/Containers/ArrayArena.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/TestSuite/Compare/Container.h"
+#include "Corrade/TestSuite/Compare/Numeric.h"
+#include "Corrade/Utility/DebugStl.h"
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct ArrayArenaTest: TestSuite::Tester {
+    explicit ArrayArenaTest();
+
+    void construct();
+    void constructNested();
+    void constructCopy();
+    void constructMove();
+
+    void allocate();
+    void allocateAligned();
+    void allocateTooLarge();
+    void allocateInvalidAlignment();
+    void reallocate();
+    void reallocateNotLast();
+    void deallocate();
+    void deallocateNotLast();
+    void reset();
+
+    template<class T> void appendInPlace();
+    template<class T> void appendNotLast();
+    template<class T> void appendFallback();
+    void appendNoCurrentArena();
+    void appendOriginalArena();
+    void overaligned();
+    void nonTriviallyDestructible();
+
+    void benchmarkScratchMalloc();
+    void benchmarkScratchArena();
+};
+
+struct Movable {
+    static int constructed;
+    static int destructed;
+    static int moved;
+
+    /*implicit*/ Movable(int a = 0) noexcept: a{a} { ++constructed; }
+    Movable(const Movable&) = delete;
+    Movable(Movable&& other) noexcept: a(other.a) {
+        ++constructed;
+        ++moved;
+    }
+    ~Movable() { ++destructed; }
+    Movable& operator=(const Movable&) = delete;
+    Movable& operator=(Movable&&) = delete;
+
+    int a;
+};
+
+int Movable::constructed = 0;
+int Movable::destructed = 0;
+int Movable::moved = 0;
+
+int value(int a) { return a; }
+int value(const Movable& a) { return a.a; }
+
+template<class> struct TypeName;
+template<> struct TypeName<int> {
+    static const char* name() { return "int"; }
+};
+template<> struct TypeName<Movable> {
+    static const char* name() { return "Movable"; }
+};
+
+ArrayArenaTest::ArrayArenaTest() {
+    addTests({&ArrayArenaTest::construct,
+              &ArrayArenaTest::constructNested,
+              &ArrayArenaTest::constructCopy,
+              &ArrayArenaTest::constructMove,
+
+              &ArrayArenaTest::allocate,
+              &ArrayArenaTest::allocateAligned,
+              &ArrayArenaTest::allocateTooLarge,
+              &ArrayArenaTest::allocateInvalidAlignment,
+              &ArrayArenaTest::reallocate,
+              &ArrayArenaTest::reallocateNotLast,
+              &ArrayArenaTest::deallocate,
+              &ArrayArenaTest::deallocateNotLast,
+              &ArrayArenaTest::reset,
+
+              &ArrayArenaTest::appendInPlace<int>,
+              &ArrayArenaTest::appendInPlace<Movable>,
+              &ArrayArenaTest::appendNotLast<int>,
+              &ArrayArenaTest::appendNotLast<Movable>,
+              &ArrayArenaTest::appendFallback<int>,
+              &ArrayArenaTest::appendFallback<Movable>,
+              &ArrayArenaTest::appendNoCurrentArena,
+              &ArrayArenaTest::appendOriginalArena,
+              &ArrayArenaTest::overaligned,
+              &ArrayArenaTest::nonTriviallyDestructible});
+
+    addBenchmarks({&ArrayArenaTest::benchmarkScratchMalloc,
+                   &ArrayArenaTest::benchmarkScratchArena}, 10);
+}
+
+void ArrayArenaTest::construct() {
+    CORRADE_VERIFY(!ArrayArena::current());
+
+    char memory[64];
+    {
+        ArrayArena arena{memory};
+        CORRADE_COMPARE(ArrayArena::current(), &arena);
+        CORRADE_COMPARE(static_cast<const void*>(arena.data()), memory);
+        CORRADE_COMPARE(arena.capacity(), 64);
+        CORRADE_COMPARE(arena.size(), 0);
+    }
+
+    CORRADE_VERIFY(!ArrayArena::current());
+}
+
+void ArrayArenaTest::constructNested() {
+    char memory[64];
+    ArrayArena a{memory};
+    {
+        ArrayArena b{memory};
+        CORRADE_COMPARE(ArrayArena::current(), &b);
+        {
+            ArrayArena c{memory};
+            CORRADE_COMPARE(ArrayArena::current(), &c);
+        }
+        CORRADE_COMPARE(ArrayArena::current(), &b);
+    }
+    CORRADE_COMPARE(ArrayArena::current(), &a);
+}
+
+void ArrayArenaTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<ArrayArena>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<ArrayArena>{});
+}
+
+void ArrayArenaTest::constructMove() {
+    CORRADE_VERIFY(!std::is_move_constructible<ArrayArena>{});
+    CORRADE_VERIFY(!std::is_move_assignable<ArrayArena>{});
+}
+
+void ArrayArenaTest::allocate() {
+    char memory[64];
+    ArrayArena arena{memory};
+
+    void* a = arena.allocate(12, 1);
+    CORRADE_COMPARE(a, static_cast<void*>(memory));
+    CORRADE_COMPARE(arena.size(), 12);
+
+    void* b = arena.allocate(52, 1);
+    CORRADE_COMPARE(b, static_cast<void*>(memory + 12));
+    CORRADE_COMPARE(arena.size(), 64);
+}
+
+void ArrayArenaTest::allocateAligned() {
+    alignas(16) char memory[64];
+    /* Offset the memory so the absolute address alignment is tested, not
+       just the offset */
+    ArrayArena arena{{memory + 1, 63}};
+
+    void* a = arena.allocate(1, 1);
+    CORRADE_COMPARE(a, static_cast<void*>(memory + 1));
+
+    void* b = arena.allocate(4, 8);
+    CORRADE_COMPARE(b, static_cast<void*>(memory + 8));
+    CORRADE_COMPARE(arena.size(), 11);
+
+    void* c = arena.allocate(4, 16);
+    CORRADE_COMPARE(c, static_cast<void*>(memory + 16));
+    CORRADE_COMPARE(arena.size(), 19);
+}
+
+void ArrayArenaTest::allocateTooLarge() {
+    alignas(16) char memory[32];
+    ArrayArena arena{memory};
+
+    CORRADE_VERIFY(!arena.allocate(33, 1));
+    CORRADE_COMPARE(arena.size(), 0);
+
+    CORRADE_VERIFY(arena.allocate(17, 1));
+    /* Fits without the padding but not with it */
+    CORRADE_VERIFY(!arena.allocate(12, 16));
+    CORRADE_VERIFY(!arena.allocate(~std::size_t{}, 1));
+    CORRADE_COMPARE(arena.size(), 17);
+
+    CORRADE_VERIFY(arena.allocate(15, 1));
+    CORRADE_COMPARE(arena.size(), 32);
+}
+
+void ArrayArenaTest::allocateInvalidAlignment() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    char memory[32];
+    ArrayArena arena{memory};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    arena.allocate(4, 0);
+    arena.allocate(4, 3);
+    CORRADE_COMPARE(out.str(),
+        "Containers::ArrayArena::allocate(): alignment expected to be a power of two, got 0\n"
+        "Containers::ArrayArena::allocate(): alignment expected to be a power of two, got 3\n");
+}
+
+void ArrayArenaTest::reallocate() {
+    char memory[64];
+    ArrayArena arena{memory};
+
+    arena.allocate(8, 1);
+    void* a = arena.allocate(8, 1);
+    CORRADE_COMPARE(arena.size(), 16);
+
+    CORRADE_VERIFY(arena.reallocate(a, 32));
+    CORRADE_COMPARE(arena.size(), 40);
+
+    /* Shrinking works too */
+    CORRADE_VERIFY(arena.reallocate(a, 4));
+    CORRADE_COMPARE(arena.size(), 12);
+
+    /* Not enough space */
+    CORRADE_VERIFY(!arena.reallocate(a, 57));
+    CORRADE_COMPARE(arena.size(), 12);
+
+    CORRADE_VERIFY(arena.reallocate(a, 56));
+    CORRADE_COMPARE(arena.size(), 64);
+}
+
+void ArrayArenaTest::reallocateNotLast() {
+    char memory[64];
+    ArrayArena arena{memory};
+
+    void* a = arena.allocate(8, 1);
+    arena.allocate(8, 1);
+    CORRADE_VERIFY(!arena.reallocate(a, 12));
+    CORRADE_COMPARE(arena.size(), 16);
+
+    /* Memory outside of the arena */
+    char other[8];
+    CORRADE_VERIFY(!arena.reallocate(other, 12));
+    CORRADE_COMPARE(arena.size(), 16);
+}
+
+void ArrayArenaTest::deallocate() {
+    char memory[64];
+    ArrayArena arena{memory};
+
+    void* a = arena.allocate(8, 1);
+    void* b = arena.allocate(8, 1);
+    CORRADE_COMPARE(arena.size(), 16);
+
+    arena.deallocate(b);
+    CORRADE_COMPARE(arena.size(), 8);
+
+    /* The previous allocation isn't tracked anymore, so it can't be
+       reclaimed or grown in-place */
+    arena.deallocate(a);
+    CORRADE_COMPARE(arena.size(), 8);
+    CORRADE_VERIFY(!arena.reallocate(a, 12));
+
+    /* But allocating again reuses the reclaimed space */
+    CORRADE_COMPARE(arena.allocate(4, 1), b);
+    CORRADE_COMPARE(arena.size(), 12);
+}
+
+void ArrayArenaTest::deallocateNotLast() {
+    char memory[64];
+    ArrayArena arena{memory};
+
+    void* a = arena.allocate(8, 1);
+    arena.allocate(8, 1);
+    arena.deallocate(a);
+    CORRADE_COMPARE(arena.size(), 16);
+}
+
+void ArrayArenaTest::reset() {
+    char memory[64];
+    ArrayArena arena{memory};
+
+    void* a = arena.allocate(8, 1);
+    arena.allocate(56, 1);
+    CORRADE_COMPARE(arena.size(), 64);
+    CORRADE_VERIFY(!arena.allocate(1, 1));
+
+    arena.reset();
+    CORRADE_COMPARE(arena.size(), 0);
+    CORRADE_COMPARE(arena.allocate(8, 1), a);
+}
+
+template<class T> void ArrayArenaTest::appendInPlace() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    Movable::constructed = Movable::destructed = Movable::moved = 0;
+
+    alignas(16) char memory[1024];
+    {
+        ArrayArena arena{memory};
+
+        Array<T> a;
+        arrayAppend<ArrayArenaAllocator>(a, T{1});
+        const T* data = a.data();
+        CORRADE_COMPARE(static_cast<const void*>(data), memory + ArrayArenaAllocator<T>::AllocationOffset);
+        CORRADE_COMPARE(ArrayArenaAllocator<T>::arena(a.data()), &arena);
+        CORRADE_VERIFY(arrayIsGrowable<ArrayArenaAllocator>(a));
+
+        /* As the array is the last allocation, it's grown in-place */
+        for(int i = 2; i != 100; ++i)
+            arrayAppend<ArrayArenaAllocator>(a, T{i});
+        CORRADE_COMPARE(a.data(), data);
+        CORRADE_COMPARE(a.size(), 99);
+        CORRADE_COMPARE(value(a[0]), 1);
+        CORRADE_COMPARE(value(a[98]), 99);
+        CORRADE_COMPARE(arena.size(), ArrayArenaAllocator<T>::AllocationOffset + arrayCapacity<ArrayArenaAllocator>(a)*sizeof(T));
+
+        if(std::is_same<T, Movable>::value)
+            CORRADE_COMPARE(Movable::moved, 99); /* only the temporaries */
+    }
+
+    if(std::is_same<T, Movable>::value)
+        CORRADE_COMPARE(Movable::constructed, Movable::destructed);
+}
+
+template<class T> void ArrayArenaTest::appendNotLast() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    Movable::constructed = Movable::destructed = Movable::moved = 0;
+
+    alignas(16) char memory[1024];
+    {
+        ArrayArena arena{memory};
+
+        Array<T> a;
+        arrayAppend<ArrayArenaAllocator>(a, T{1});
+        arrayAppend<ArrayArenaAllocator>(a, T{2});
+        const T* data = a.data();
+        const std::size_t capacity = arrayCapacity<ArrayArenaAllocator>(a);
+
+        Array<T> b;
+        arrayAppend<ArrayArenaAllocator>(b, T{3});
+        CORRADE_COMPARE(ArrayArenaAllocator<T>::arena(b.data()), &arena);
+
+        /* The array isn't last anymore, so it gets moved */
+        arrayResize<ArrayArenaAllocator>(a, capacity + 1);
+        CORRADE_VERIFY(a.data() != data);
+        CORRADE_VERIFY(a.data() > b.data());
+        CORRADE_COMPARE(ArrayArenaAllocator<T>::arena(a.data()), &arena);
+        CORRADE_COMPARE(value(a[0]), 1);
+        CORRADE_COMPARE(value(a[1]), 2);
+        CORRADE_COMPARE(value(b[0]), 3);
+    }
+
+    if(std::is_same<T, Movable>::value)
+        CORRADE_COMPARE(Movable::constructed, Movable::destructed);
+}
+
+template<class T> void ArrayArenaTest::appendFallback() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    Movable::constructed = Movable::destructed = Movable::moved = 0;
+
+    alignas(16) char memory[64];
+    {
+        ArrayArena arena{memory};
+
+        Array<T> a;
+        arrayAppend<ArrayArenaAllocator>(a, T{1});
+        CORRADE_COMPARE(ArrayArenaAllocator<T>::arena(a.data()), &arena);
+
+        /* Grows past the arena capacity, falls back to malloc */
+        for(int i = 2; i != 100; ++i)
+            arrayAppend<ArrayArenaAllocator>(a, T{i});
+        CORRADE_VERIFY(!ArrayArenaAllocator<T>::arena(a.data()));
+        CORRADE_VERIFY(arrayIsGrowable<ArrayArenaAllocator>(a));
+        CORRADE_COMPARE(a.size(), 99);
+        CORRADE_COMPARE(value(a[0]), 1);
+        CORRADE_COMPARE(value(a[98]), 99);
+
+        /* The original allocation was the last, so it got reclaimed */
+        CORRADE_COMPARE(arena.size(), 0);
+
+        /* A small allocation still fits into the arena */
+        Array<T> b;
+        arrayAppend<ArrayArenaAllocator>(b, T{3});
+        CORRADE_COMPARE(ArrayArenaAllocator<T>::arena(b.data()), &arena);
+    }
+
+    if(std::is_same<T, Movable>::value)
+        CORRADE_COMPARE(Movable::constructed, Movable::destructed);
+}
+
+void ArrayArenaTest::appendNoCurrentArena() {
+    CORRADE_VERIFY(!ArrayArena::current());
+
+    Array<int> a;
+    arrayAppend<ArrayArenaAllocator>(a, {1, 2, 3});
+    CORRADE_VERIFY(!ArrayArenaAllocator<int>::arena(a.data()));
+    CORRADE_VERIFY(arrayIsGrowable<ArrayArenaAllocator>(a));
+    CORRADE_COMPARE_AS(a, arrayView({1, 2, 3}),
+        TestSuite::Compare::Container);
+}
+
+void ArrayArenaTest::appendOriginalArena() {
+    alignas(16) char memoryA[1024];
+    alignas(16) char memoryB[1024];
+
+    ArrayArena arenaA{memoryA};
+    Array<int> a;
+    arrayAppend<ArrayArenaAllocator>(a, 1);
+
+    {
+        ArrayArena arenaB{memoryB};
+        Array<int> b;
+        arrayAppend<ArrayArenaAllocator>(b, 2);
+        CORRADE_COMPARE(ArrayArenaAllocator<int>::arena(b.data()), &arenaB);
+
+        /* Growing the first array stays in the original arena */
+        for(int i = 2; i != 100; ++i)
+            arrayAppend<ArrayArenaAllocator>(a, i);
+        CORRADE_COMPARE(ArrayArenaAllocator<int>::arena(a.data()), &arenaA);
+        CORRADE_COMPARE(arenaB.size(), ArrayArenaAllocator<int>::AllocationOffset + arrayCapacity<ArrayArenaAllocator>(b)*sizeof(int));
+    }
+}
+
+void ArrayArenaTest::overaligned() {
+    struct alignas(16) Vec4 {
+        float data[4];
+    };
+
+    alignas(16) char memory[1024];
+    /* Offset the memory to verify the allocation gets aligned */
+    ArrayArena arena{{memory + 4, 1020}};
+
+    Array<Vec4> a;
+    arrayAppend<ArrayArenaAllocator>(a, Vec4{{1.0f, 2.0f, 3.0f, 4.0f}});
+    CORRADE_COMPARE(ArrayArenaAllocator<Vec4>::arena(a.data()), &arena);
+    CORRADE_COMPARE(reinterpret_cast<std::size_t>(a.data()) % 16, 0);
+    CORRADE_COMPARE(a[0].data[3], 4.0f);
+}
+
+void ArrayArenaTest::nonTriviallyDestructible() {
+    Movable::constructed = Movable::destructed = Movable::moved = 0;
+
+    alignas(16) char memory[1024];
+    ArrayArena arena{memory};
+    {
+        Array<Movable> a;
+        arrayAppend<ArrayArenaAllocator>(a, Corrade::InPlaceInit, 1);
+        arrayAppend<ArrayArenaAllocator>(a, Corrade::InPlaceInit, 2);
+        arrayAppend<ArrayArenaAllocator>(a, Corrade::InPlaceInit, 3);
+        CORRADE_COMPARE(Movable::constructed, 3);
+        CORRADE_COMPARE(Movable::destructed, 0);
+    }
+
+    CORRADE_COMPARE(Movable::constructed, 3);
+    CORRADE_COMPARE(Movable::destructed, 3);
+    /* Was the last allocation, so it got reclaimed */
+    CORRADE_COMPARE(arena.size(), 0);
+}
+
+/* Emulating per-frame scratch data -- a bunch of short arrays being built
+   and thrown away */
+constexpr std::size_t ScratchArrayCount = 1000;
+constexpr std::size_t ScratchArraySize = 50;
+
+void ArrayArenaTest::benchmarkScratchMalloc() {
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i != ScratchArrayCount; ++i) {
+            Array<int> a;
+            for(std::size_t j = 0; j != ScratchArraySize; ++j)
+                arrayAppend<ArrayMallocAllocator>(a, int(j));
+            sum += a.back();
+        }
+    }
+
+    CORRADE_COMPARE(sum, 10*ScratchArrayCount*(ScratchArraySize - 1));
+}
+
+void ArrayArenaTest::benchmarkScratchArena() {
+    Array<char> memory{Corrade::NoInit, 1024*1024};
+    ArrayArena arena{memory};
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i != ScratchArrayCount; ++i) {
+            Array<int> a;
+            for(std::size_t j = 0; j != ScratchArraySize; ++j)
+                arrayAppend<ArrayArenaAllocator>(a, int(j));
+            sum += a.back();
+        }
+        arena.reset();
+    }
+
+    CORRADE_COMPARE(sum, 10*ScratchArrayCount*(ScratchArraySize - 1));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::ArrayArenaTest)
@@ -32,6 +32,7 @@
 #include <sstream>
 
 #include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/ArrayArena.h"
 #include "Corrade/Containers/StridedArrayView.h"
 #include "Corrade/Containers/String.h"
 #include "Corrade/TestSuite/Tester.h"
@@ -63,6 +64,24 @@ struct ArrayTupleTest: TestSuite::Tester {
 
     void constructBig();
 
+    void constructItemAlignment();
+    void constructItemAlignmentInvalid();
+
+    void constructBuffer();
+    void constructBufferUnaligned();
+    void constructBufferTooSmall();
+
+    void constructArena();
+    void constructArenaFull();
+
+    void recreateInPlace();
+    void recreateInPlaceDestructibleItems();
+    void recreateInPlaceStatefulDeleter();
+    void recreateTooLarge();
+    void recreateOveraligned();
+    void recreateEmpty();
+    void recreateCustomAllocator();
+
     void allocatorAlignmentEmpty();
     template<int a> void allocatorAlignmentFromItems();
     template<int a> void allocatorAlignmentFromDeleter();
@@ -96,6 +115,24 @@ ArrayTupleTest::ArrayTupleTest() {
 
               &ArrayTupleTest::constructBig,
 
+              &ArrayTupleTest::constructItemAlignment,
+              &ArrayTupleTest::constructItemAlignmentInvalid,
+
+              &ArrayTupleTest::constructBuffer,
+              &ArrayTupleTest::constructBufferUnaligned,
+              &ArrayTupleTest::constructBufferTooSmall,
+
+              &ArrayTupleTest::constructArena,
+              &ArrayTupleTest::constructArenaFull,
+
+              &ArrayTupleTest::recreateInPlace,
+              &ArrayTupleTest::recreateInPlaceDestructibleItems,
+              &ArrayTupleTest::recreateInPlaceStatefulDeleter,
+              &ArrayTupleTest::recreateTooLarge,
+              &ArrayTupleTest::recreateOveraligned,
+              &ArrayTupleTest::recreateEmpty,
+              &ArrayTupleTest::recreateCustomAllocator,
+
               &ArrayTupleTest::allocatorAlignmentEmpty,
               &ArrayTupleTest::allocatorAlignmentFromItems<1>,
               &ArrayTupleTest::allocatorAlignmentFromItems<16>,
@@ -781,6 +818,391 @@ void ArrayTupleTest::constructBig()
     CORRADE_COMPARE(Big::destructed, 7);
 }
 
+void ArrayTupleTest::constructItemAlignment() {
+    NonCopyable::constructed = 0;
+    NonCopyable::destructed = 0;
+
+    {
+        ArrayView<char> chars;
+        ArrayView<NonCopyable> noncopyable;
+        ArrayView<int> ints;
+        ArrayTuple data{
+            {3, chars},
+            {2, noncopyable, 64},
+            {Corrade::NoInit, 5, ints, 4096}
+        };
+
+        /* The whole allocation is aligned to the largest alignment, items
+           to their own */
+        CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(data.data()) % 4096, 0);
+        CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(noncopyable.data()) % 64, 0);
+        CORRADE_COMPARE(static_cast<void*>(ints.data()), data.data() + 4096);
+        CORRADE_COMPARE(data.size(), 4096 + 5*4);
+        CORRADE_COMPARE(chars.size(), 3);
+        CORRADE_COMPARE(noncopyable.size(), 2);
+        CORRADE_COMPARE(ints.size(), 5);
+
+        /* The memory isn't allocated with new[] anymore */
+        CORRADE_VERIFY(data.deleter());
+        CORRADE_COMPARE(NonCopyable::constructed, 2);
+    }
+
+    CORRADE_COMPARE(NonCopyable::destructed, 2);
+}
+
+void ArrayTupleTest::constructItemAlignmentInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    ArrayView<int> ints;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    ArrayTuple::Item{3, ints, 24};
+    CORRADE_COMPARE(out.str(), "Containers::ArrayTuple::Item: alignment expected to be a power of two, got 24\n");
+}
+
+void ArrayTupleTest::constructBuffer() {
+    NonCopyable::constructed = 0;
+    NonCopyable::destructed = 0;
+
+    alignas(16) char buffer[256];
+    for(char& i: buffer) i = '\xce';
+
+    {
+        ArrayView<char> chars;
+        ArrayView<NonCopyable> noncopyable;
+        ArrayView<int> ints;
+        ArrayTuple data{buffer, {
+            {15, chars},
+            {3, noncopyable},
+            {Corrade::NoInit, 4, ints}
+        }};
+
+        /* The buffer gets used directly */
+        CORRADE_COMPARE(data.data(), static_cast<void*>(buffer));
+        CORRADE_COMPARE(data.size(),
+            sizeof(void*) +         /* destructible item count */
+            2*(4*sizeof(void*)) +   /* one destructible item + deleter */
+            15 + 3 +                /* chars + noncopyable */
+            2 +                     /* padding to align ints */
+            4*4);
+        CORRADE_VERIFY(data.deleter());
+        CORRADE_COMPARE(static_cast<void*>(chars.data()), buffer + sizeof(void*) + 2*(4*sizeof(void*)));
+        for(char i: chars) CORRADE_COMPARE(i, 0);
+        for(int i: ints) CORRADE_COMPARE(i, int(0xcececece));
+        CORRADE_COMPARE(NonCopyable::constructed, 3);
+        CORRADE_COMPARE(NonCopyable::destructed, 0);
+    }
+
+    /* Destructors get called but the memory is left alone -- if the memory
+       would get freed, it'd crash */
+    CORRADE_COMPARE(NonCopyable::destructed, 3);
+    CORRADE_COMPARE(buffer[255], '\xce');
+}
+
+void ArrayTupleTest::constructBufferUnaligned() {
+    alignas(16) char buffer[64];
+
+    ArrayView<char> chars;
+    ArrayView<double> doubles;
+    ArrayTuple data{arrayView(buffer).suffix(1), {
+        {3, chars},
+        {Corrade::NoInit, 2, doubles, 16}
+    }};
+
+    /* The data get aligned to the largest item alignment, with the buffer
+       start being skipped */
+    CORRADE_COMPARE(data.data(), static_cast<void*>(buffer + 16));
+    CORRADE_COMPARE(data.size(), 16 + 2*8);
+    CORRADE_COMPARE(static_cast<void*>(doubles.data()), buffer + 32);
+    /* No destructible items and a stateless deleter, so it's stored
+       directly */
+    CORRADE_VERIFY(data.deleter());
+}
+
+void ArrayTupleTest::constructBufferTooSmall() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    alignas(16) char buffer[40];
+
+    ArrayView<char> chars;
+    ArrayView<double> doubles;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    ArrayTuple{arrayView(buffer).suffix(1), {
+        {3, chars},
+        {Corrade::NoInit, 2, doubles, 16}
+    }};
+    CORRADE_COMPARE(out.str(), "Containers::ArrayTuple: expected at least 47 bytes of memory for 32 bytes aligned to 16 bytes but got 39\n");
+}
+
+void ArrayTupleTest::constructArena() {
+    NonCopyable::constructed = 0;
+    NonCopyable::destructed = 0;
+
+    alignas(16) char memory[1024];
+    ArrayArena arena{memory};
+
+    std::ptrdiff_t offset;
+    {
+        ArrayView<char> chars;
+        ArrayView<NonCopyable> noncopyable;
+        ArrayView<int> ints;
+        ArrayTuple data{arena, {
+            {15, chars},
+            {3, noncopyable},
+            {7, ints, 64}
+        }};
+
+        /* The memory is allocated from the arena, including the deleter state
+           at the end */
+        CORRADE_VERIFY(data.data() >= memory && data.data() + data.size() <= memory + 1024);
+        CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(ints.data()) % 64, 0);
+        offset = data.data() - memory;
+        CORRADE_COMPARE(arena.size(), offset + data.size());
+        CORRADE_VERIFY(data.deleter());
+        CORRADE_COMPARE(NonCopyable::constructed, 3);
+    }
+
+    /* The allocation was the last one, so it's returned back to the arena,
+       except for the alignment padding */
+    CORRADE_COMPARE(NonCopyable::destructed, 3);
+    CORRADE_COMPARE(arena.size(), offset);
+}
+
+void ArrayTupleTest::constructArenaFull() {
+    NonCopyable::constructed = 0;
+    NonCopyable::destructed = 0;
+
+    char memory[64];
+    ArrayArena arena{memory};
+
+    {
+        ArrayView<NonCopyable> noncopyable;
+        ArrayView<int> ints;
+        ArrayTuple data{arena, {
+            {3, noncopyable},
+            {100, ints, 64}
+        }};
+
+        /* Not enough space in the arena, so it's allocated on the heap
+           instead */
+        CORRADE_VERIFY(data.data() < memory || data.data() >= memory + 64);
+        CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(ints.data()) % 64, 0);
+        CORRADE_COMPARE(ints.size(), 100);
+        CORRADE_COMPARE(arena.size(), 0);
+        CORRADE_COMPARE(NonCopyable::constructed, 3);
+    }
+
+    /* The heap allocation gets freed, otherwise ASan / Valgrind would
+       complain */
+    CORRADE_COMPARE(NonCopyable::destructed, 3);
+}
+
+void ArrayTupleTest::recreateInPlace() {
+    ArrayView<int> ints;
+    ArrayView<char> chars;
+    ArrayTuple data{
+        {10, ints},
+        {20, chars}
+    };
+    char* const pointer = data.data();
+    const std::size_t size = data.size();
+    CORRADE_VERIFY(!data.deleter());
+    CORRADE_COMPARE(size, 10*4 + 20);
+
+    /* A smaller layout fits into the existing allocation */
+    ArrayView<double> doubles;
+    data.recreate({
+        {3, chars},
+        {Corrade::NoInit, 5, doubles}
+    });
+    CORRADE_COMPARE(data.data(), static_cast<void*>(pointer));
+    CORRADE_COMPARE(data.size(), size);
+    CORRADE_VERIFY(!data.deleter());
+    CORRADE_COMPARE(static_cast<void*>(chars.data()), pointer);
+    CORRADE_COMPARE(chars.size(), 3);
+    CORRADE_COMPARE(static_cast<void*>(doubles.data()), pointer + 8);
+    CORRADE_COMPARE(doubles.size(), 5);
+    for(char i: chars) CORRADE_COMPARE(i, 0);
+
+    /* Going back to the original layout is also fine */
+    data.recreate({
+        {10, ints},
+        {20, chars}
+    });
+    CORRADE_COMPARE(data.data(), static_cast<void*>(pointer));
+    CORRADE_COMPARE(static_cast<void*>(ints.data()), pointer);
+    CORRADE_COMPARE(static_cast<void*>(chars.data()), pointer + 40);
+    for(int i: ints) CORRADE_COMPARE(i, 0);
+}
+
+void ArrayTupleTest::recreateInPlaceDestructibleItems() {
+    NonCopyable::constructed = 0;
+    NonCopyable::destructed = 0;
+
+    {
+        ArrayView<int> ints;
+        ArrayTuple data{
+            {30, ints}
+        };
+        char* const pointer = data.data();
+        CORRADE_VERIFY(!data.deleter());
+
+        /* The default deleter now has to be stored in a DestructibleItem
+           record next to the NonCopyable one */
+        ArrayView<NonCopyable> noncopyable;
+        data.recreate({
+            {3, noncopyable}
+        });
+        CORRADE_COMPARE(data.data(), static_cast<void*>(pointer));
+        CORRADE_VERIFY(data.deleter());
+        CORRADE_COMPARE(static_cast<void*>(noncopyable.data()), pointer + sizeof(void*) + 2*(4*sizeof(void*)));
+        CORRADE_COMPARE(NonCopyable::constructed, 3);
+        CORRADE_COMPARE(NonCopyable::destructed, 0);
+
+        /* Recreating destroys the previous items */
+        data.recreate({
+            {2, noncopyable}
+        });
+        CORRADE_COMPARE(data.data(), static_cast<void*>(pointer));
+        CORRADE_COMPARE(NonCopyable::constructed, 5);
+        CORRADE_COMPARE(NonCopyable::destructed, 3);
+
+        /* And going back to trivially destructible types uses the original
+           deleter directly again */
+        data.recreate({
+            {5, ints}
+        });
+        CORRADE_COMPARE(data.data(), static_cast<void*>(pointer));
+        CORRADE_VERIFY(data.deleter());
+        CORRADE_COMPARE(NonCopyable::constructed, 5);
+        CORRADE_COMPARE(NonCopyable::destructed, 5);
+    }
+
+    /* The memory gets freed correctly, otherwise ASan / Valgrind would
+       complain */
+    CORRADE_COMPARE(NonCopyable::destructed, 5);
+}
+
+void ArrayTupleTest::recreateInPlaceStatefulDeleter() {
+    NonCopyable::constructed = 0;
+    NonCopyable::destructed = 0;
+
+    alignas(16) char preallocated[256];
+    void* usedThisPointer;
+    char* usedDeleterPointer = nullptr;
+    std::size_t usedDeleterSize = 0;
+    int copyConstructorCallCount{}, destructorCallCount{};
+
+    std::size_t size;
+    {
+        ArrayView<char> chars;
+        ArrayView<NonCopyable> noncopyable;
+        ArrayTuple data{
+            {{64, chars}},
+            [&](std::size_t, std::size_t) -> std::pair<char*, StatefulAlignedNonTriviallyDestructibleDeleter> {
+                return {preallocated, StatefulAlignedNonTriviallyDestructibleDeleter{usedThisPointer, usedDeleterPointer, usedDeleterSize, copyConstructorCallCount, destructorCallCount}};
+            }
+        };
+        size = data.size();
+
+        /* The new contents have to fit before the deleter state, which stays
+           at the end */
+        data.recreate({
+            {3, noncopyable},
+            {10, chars}
+        });
+        CORRADE_COMPARE(data.data(), static_cast<void*>(preallocated));
+        CORRADE_COMPARE(data.size(), size);
+        CORRADE_COMPARE(NonCopyable::constructed, 3);
+        CORRADE_COMPARE(usedDeleterPointer, nullptr);
+    }
+
+    /* The deleter is still called with the original pointer and size */
+    CORRADE_COMPARE(usedDeleterPointer, static_cast<void*>(preallocated));
+    CORRADE_COMPARE(usedDeleterSize, size);
+    CORRADE_COMPARE(destructorCallCount, copyConstructorCallCount + 1);
+    CORRADE_COMPARE(NonCopyable::destructed, 3);
+}
+
+void ArrayTupleTest::recreateTooLarge() {
+    ArrayView<int> ints;
+    ArrayTuple data{
+        {10, ints}
+    };
+
+    /* Doesn't fit, a new allocation is made */
+    data.recreate({
+        {11, ints}
+    });
+    CORRADE_COMPARE(data.size(), 11*4);
+    CORRADE_COMPARE(static_cast<void*>(ints.data()), data.data());
+    CORRADE_COMPARE(ints.size(), 11);
+}
+
+void ArrayTupleTest::recreateOveraligned() {
+    /* Aligned to 256 so the suffix below is never aligned enough */
+    alignas(256) char buffer[512];
+
+    ArrayView<int> ints;
+    ArrayTuple data{arrayView(buffer).suffix(16), {
+        {100, ints}
+    }};
+    CORRADE_COMPARE(data.data(), static_cast<void*>(buffer + 16));
+
+    /* The size would fit, but the memory isn't aligned enough, so a new
+       allocation is made */
+    data.recreate({
+        {10, ints, 256}
+    });
+    CORRADE_VERIFY(data.data() < buffer || data.data() >= buffer + 512);
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(ints.data()) % 256, 0);
+}
+
+void ArrayTupleTest::recreateEmpty() {
+    ArrayTuple data;
+
+    ArrayView<int> ints;
+    data.recreate({
+        {10, ints}
+    });
+    CORRADE_VERIFY(data.data());
+    CORRADE_COMPARE(static_cast<void*>(ints.data()), data.data());
+    CORRADE_COMPARE(ints.size(), 10);
+}
+
+void ArrayTupleTest::recreateCustomAllocator() {
+    alignas(16) char preallocated[256];
+    int allocatorCallCount = 0;
+    auto allocator = [&](std::size_t, std::size_t) -> std::pair<char*, void(*)(char*, std::size_t)> {
+        ++allocatorCallCount;
+        return {preallocated, [](char*, std::size_t) {}};
+    };
+
+    ArrayView<int> ints;
+    ArrayTuple data{{{10, ints}}, allocator};
+    CORRADE_COMPARE(allocatorCallCount, 1);
+
+    /* Fits, the allocator doesn't get called */
+    data.recreate({{5, ints}}, allocator);
+    CORRADE_COMPARE(allocatorCallCount, 1);
+    CORRADE_COMPARE(data.data(), static_cast<void*>(preallocated));
+    CORRADE_COMPARE(ints.size(), 5);
+
+    /* Doesn't fit, the allocator gets called again */
+    data.recreate({{20, ints}}, allocator);
+    CORRADE_COMPARE(allocatorCallCount, 2);
+    CORRADE_COMPARE(data.data(), static_cast<void*>(preallocated));
+    CORRADE_COMPARE(data.size(), 20*4);
+    CORRADE_COMPARE(ints.size(), 20);
+}
+
 void ArrayTupleTest::allocatorAlignmentEmpty() {
     std::size_t alignmentRequirement = ~std::size_t{};
 
@@ -52,6 +52,11 @@ struct BigEnumSetTest: TestSuite::Tester {
     void operatorInverse();
     void compare();
 
+    void count();
+    void iterate();
+    void iterateEmpty();
+    void iterateFull();
+
     void templateFriendOperators();
 
     void debug();
@@ -72,6 +77,11 @@ BigEnumSetTest::BigEnumSetTest() {
               &BigEnumSetTest::operatorInverse,
               &BigEnumSetTest::compare,
 
+              &BigEnumSetTest::count,
+              &BigEnumSetTest::iterate,
+              &BigEnumSetTest::iterateEmpty,
+              &BigEnumSetTest::iterateFull,
+
               &BigEnumSetTest::templateFriendOperators,
 
               &BigEnumSetTest::debug});
@@ -481,6 +491,58 @@ void BigEnumSetTest::templateFriendOperators() {
     CORRADE_COMPARE(a.data()[3], 0);
 }
 
+void BigEnumSetTest::count() {
+    CORRADE_COMPARE(Features{}.count(), 0);
+    CORRADE_COMPARE(Features{Feature::Tested}.count(), 1);
+    CORRADE_COMPARE((Feature::Popular|Feature::Fast|Feature::Cheap|Feature::Tested).count(), 4);
+    CORRADE_COMPARE((~Features{}).count(), 256);
+    CORRADE_COMPARE((~(Feature::Popular|Feature::Fast)).count(), 254);
+}
+
+void BigEnumSetTest::iterate() {
+    Features features = Feature::Popular|Feature::Fast|Feature::Cheap|Feature(63)|Feature(64)|Feature(255);
+
+    Feature values[8];
+    std::size_t count = 0;
+    for(Feature i: features) {
+        CORRADE_VERIFY(count < 8);
+        values[count++] = i;
+    }
+
+    /* Should go in an increasing order, across word boundaries */
+    CORRADE_COMPARE(count, 6);
+    CORRADE_COMPARE(values[0], Feature::Fast);
+    CORRADE_COMPARE(values[1], Feature::Cheap);
+    CORRADE_COMPARE(values[2], Feature(63));
+    CORRADE_COMPARE(values[3], Feature(64));
+    CORRADE_COMPARE(values[4], Feature::Popular);
+    CORRADE_COMPARE(values[5], Feature(255));
+}
+
+void BigEnumSetTest::iterateEmpty() {
+    Features features;
+    CORRADE_VERIFY(features.begin() == features.end());
+    CORRADE_VERIFY(!(features.begin() != features.end()));
+
+    /* A set with only the last bit set */
+    Features last = Feature(255);
+    auto it = last.begin();
+    CORRADE_VERIFY(it != last.end());
+    CORRADE_COMPARE(*it, Feature(255));
+    CORRADE_VERIFY(++it == last.end());
+}
+
+void BigEnumSetTest::iterateFull() {
+    const Features features = ~Features{};
+
+    std::size_t expected = 0;
+    for(Feature i: features) {
+        CORRADE_COMPARE(std::uint16_t(i), expected);
+        ++expected;
+    }
+    CORRADE_COMPARE(expected, 256);
+}
+
 Utility::Debug& operator<<(Utility::Debug& debug, Feature value) {
     switch(value) {
         #define _c(value) case Feature::value: return debug << "Feature::" #value;
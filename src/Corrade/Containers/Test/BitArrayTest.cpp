@@ -0,0 +1,270 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+
+#include "Corrade/Containers/BitArray.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/DebugStl.h" /** @todo remove when <sstream> is gone */
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct BitArrayTest: TestSuite::Tester {
+    explicit BitArrayTest();
+
+    void constructDefault();
+    void constructValueInit();
+    void constructNoInit();
+    void constructDirectInit();
+    void constructZeroSize();
+    void constructMove();
+
+    void convertView();
+    void access();
+    void operations();
+    void slice();
+    void release();
+
+    void debug();
+};
+
+BitArrayTest::BitArrayTest() {
+    addTests({&BitArrayTest::constructDefault,
+              &BitArrayTest::constructValueInit,
+              &BitArrayTest::constructNoInit,
+              &BitArrayTest::constructDirectInit,
+              &BitArrayTest::constructZeroSize,
+              &BitArrayTest::constructMove,
+
+              &BitArrayTest::convertView,
+              &BitArrayTest::access,
+              &BitArrayTest::operations,
+              &BitArrayTest::slice,
+              &BitArrayTest::release,
+
+              &BitArrayTest::debug});
+}
+
+void BitArrayTest::constructDefault() {
+    BitArray a;
+    BitArray b = nullptr;
+    CORRADE_VERIFY(!a.data());
+    CORRADE_VERIFY(!b.data());
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(b.size(), 0);
+    CORRADE_VERIFY(a.isEmpty());
+    CORRADE_VERIFY(b.isEmpty());
+
+    CORRADE_VERIFY(std::is_nothrow_default_constructible<BitArray>::value);
+}
+
+void BitArrayTest::constructValueInit() {
+    BitArray a{Corrade::ValueInit, 75};
+    CORRADE_VERIFY(a.data());
+    CORRADE_COMPARE(a.offset(), 0);
+    CORRADE_COMPARE(a.size(), 75);
+    CORRADE_VERIFY(!a.isEmpty());
+    CORRADE_COMPARE(a.count(), 0);
+
+    /* Implicit value initialization */
+    BitArray b{75};
+    CORRADE_COMPARE(b.size(), 75);
+    CORRADE_COMPARE(b.count(), 0);
+
+    CORRADE_VERIFY(!std::is_convertible<std::size_t, BitArray>::value);
+}
+
+void BitArrayTest::constructNoInit() {
+    BitArray a{Corrade::NoInit, 75};
+    CORRADE_VERIFY(a.data());
+    CORRADE_COMPARE(a.size(), 75);
+}
+
+void BitArrayTest::constructDirectInit() {
+    BitArray a{Corrade::DirectInit, 75, true};
+    CORRADE_COMPARE(a.size(), 75);
+    CORRADE_COMPARE(a.count(), 75);
+    CORRADE_VERIFY(a[0]);
+    CORRADE_VERIFY(a[74]);
+
+    BitArray b{Corrade::DirectInit, 75, false};
+    CORRADE_COMPARE(b.count(), 0);
+}
+
+void BitArrayTest::constructZeroSize() {
+    BitArray a{Corrade::ValueInit, 0};
+    BitArray b{Corrade::NoInit, 0};
+    BitArray c{Corrade::DirectInit, 0, true};
+    CORRADE_VERIFY(!a.data());
+    CORRADE_VERIFY(!b.data());
+    CORRADE_VERIFY(!c.data());
+    CORRADE_VERIFY(a.isEmpty());
+    CORRADE_VERIFY(b.isEmpty());
+    CORRADE_VERIFY(c.isEmpty());
+}
+
+void BitArrayTest::constructMove() {
+    BitArray a{Corrade::DirectInit, 13, true};
+    const void* data = a.data();
+
+    BitArray b = std::move(a);
+    CORRADE_VERIFY(!a.data());
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(b.data(), data);
+    CORRADE_COMPARE(b.size(), 13);
+
+    BitArray c{5};
+    c = std::move(b);
+    CORRADE_COMPARE(c.data(), data);
+    CORRADE_COMPARE(c.size(), 13);
+    CORRADE_VERIFY(b.data());
+    CORRADE_COMPARE(b.size(), 5);
+
+    CORRADE_VERIFY(!std::is_copy_constructible<BitArray>::value);
+    CORRADE_VERIFY(!std::is_copy_assignable<BitArray>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<BitArray>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<BitArray>::value);
+}
+
+void BitArrayTest::convertView() {
+    BitArray a{Corrade::ValueInit, 19};
+    const BitArray& ca = a;
+
+    MutableBitArrayView b = a;
+    CORRADE_COMPARE(b.data(), a.data());
+    CORRADE_COMPARE(b.offset(), 0);
+    CORRADE_COMPARE(b.size(), 19);
+
+    BitArrayView cb = ca;
+    CORRADE_COMPARE(cb.data(), a.data());
+    CORRADE_COMPARE(cb.offset(), 0);
+    CORRADE_COMPARE(cb.size(), 19);
+
+    /* Modifications through the view are visible in the array */
+    b.set(17);
+    CORRADE_VERIFY(a[17]);
+}
+
+void BitArrayTest::access() {
+    BitArray a{Corrade::ValueInit, 19};
+    a.set(3);
+    a.set(11, true);
+    a.set(18);
+    CORRADE_VERIFY(a[3]);
+    CORRADE_VERIFY(a[11]);
+    CORRADE_VERIFY(a[18]);
+    CORRADE_VERIFY(!a[4]);
+    CORRADE_COMPARE(a.count(), 3);
+    CORRADE_COMPARE(a.findFirstSet(), 3);
+
+    a.reset(3);
+    a.set(11, false);
+    CORRADE_COMPARE(a.count(), 1);
+    CORRADE_COMPARE(a.findFirstSet(), 18);
+
+    a.setAll();
+    CORRADE_COMPARE(a.count(), 19);
+    a.resetAll();
+    CORRADE_COMPARE(a.count(), 0);
+    CORRADE_COMPARE(a.findFirstSet(), Containers::NullOpt);
+    a.setAll(true);
+    CORRADE_COMPARE(a.count(), 19);
+}
+
+void BitArrayTest::operations() {
+    BitArray a{Corrade::ValueInit, 130};
+    BitArray b{Corrade::ValueInit, 130};
+    a.prefix(100).setAll();
+    b.suffix(50).setAll();
+
+    BitArray c{Corrade::ValueInit, 130};
+    c.orWith(a);
+    c.andWith(b);
+    /* Bits 50 to 99 */
+    CORRADE_COMPARE(c.count(), 50);
+    CORRADE_COMPARE(c.findFirstSet(), 50);
+
+    c.xorWith(a);
+    /* Bits 0 to 49 */
+    CORRADE_COMPARE(c.count(), 50);
+    CORRADE_COMPARE(c.findFirstSet(), 0);
+
+    c.invert();
+    /* Bits 50 to 129 */
+    CORRADE_COMPARE(c.count(), 80);
+    CORRADE_COMPARE(c.findFirstSet(), 50);
+}
+
+void BitArrayTest::slice() {
+    BitArray a{Corrade::ValueInit, 30};
+    const BitArray& ca = a;
+
+    MutableBitArrayView b = a.slice(10, 25);
+    CORRADE_COMPARE(b.data(), a.data() + 1);
+    CORRADE_COMPARE(b.offset(), 2);
+    CORRADE_COMPARE(b.size(), 15);
+
+    BitArrayView cb = ca.slice(10, 25);
+    CORRADE_COMPARE(cb.data(), a.data() + 1);
+    CORRADE_COMPARE(cb.offset(), 2);
+    CORRADE_COMPARE(cb.size(), 15);
+
+    CORRADE_COMPARE(a.prefix(9).size(), 9);
+    CORRADE_COMPARE(ca.prefix(9).size(), 9);
+    CORRADE_COMPARE(a.suffix(9).size(), 21);
+    CORRADE_COMPARE(ca.suffix(9).size(), 21);
+    CORRADE_COMPARE(a.except(9).size(), 21);
+    CORRADE_COMPARE(ca.except(9).size(), 21);
+
+    b.setAll();
+    CORRADE_COMPARE(a.count(), 15);
+    CORRADE_COMPARE(a.findFirstSet(), 10);
+}
+
+void BitArrayTest::release() {
+    BitArray a{Corrade::ValueInit, 13};
+    char* const data = a.data();
+    char* const released = a.release();
+    delete[] released;
+
+    CORRADE_COMPARE(data, released);
+    CORRADE_VERIFY(!a.data());
+    CORRADE_COMPARE(a.size(), 0);
+}
+
+void BitArrayTest::debug() {
+    BitArray a{Corrade::ValueInit, 10};
+    a.set(0);
+    a.set(9);
+
+    std::ostringstream out;
+    Debug{&out} << a;
+    CORRADE_COMPARE(out.str(), "{10000000, 01}\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::BitArrayTest)
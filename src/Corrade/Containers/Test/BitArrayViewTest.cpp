@@ -0,0 +1,457 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <sstream>
+
+#include "Corrade/Containers/BitArrayView.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/DebugStl.h" /** @todo remove when <sstream> is gone */
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct BitArrayViewTest: TestSuite::Tester {
+    explicit BitArrayViewTest();
+
+    void constructDefault();
+    void construct();
+    void constructFixedSize();
+    void constructConstFromMutable();
+    void constructOffsetTooLarge();
+    void constructSizeTooLarge();
+
+    void access();
+    void accessMutableSet();
+    void accessMutableReset();
+
+    void setAll();
+    void invert();
+    void count();
+    void findFirstSet();
+    void findFirstSetNone();
+
+    void andWith();
+    void orWith();
+    void xorWith();
+    void bitwiseSizeMismatch();
+
+    void slice();
+    void sliceInvalid();
+
+    void debug();
+
+    private:
+        template<class F, class G> void verifyBitwise(F operation, G reference);
+};
+
+const struct {
+    const char* name;
+    std::size_t offset, otherOffset, size;
+} OperationData[]{
+    {"empty", 3, 5, 0},
+    {"single bit", 7, 0, 1},
+    {"within a byte", 2, 2, 5},
+    {"across two bytes", 6, 1, 5},
+    {"one word, aligned", 0, 0, 64},
+    {"one word, same offset", 3, 3, 64},
+    {"several words, aligned", 0, 0, 256},
+    {"several words, same offset", 5, 5, 203},
+    {"several words, different offset", 1, 6, 203},
+    {"several words, different offset 2", 7, 2, 333},
+};
+
+BitArrayViewTest::BitArrayViewTest() {
+    addTests({&BitArrayViewTest::constructDefault,
+              &BitArrayViewTest::construct,
+              &BitArrayViewTest::constructFixedSize,
+              &BitArrayViewTest::constructConstFromMutable,
+              &BitArrayViewTest::constructOffsetTooLarge,
+              &BitArrayViewTest::constructSizeTooLarge,
+
+              &BitArrayViewTest::access,
+              &BitArrayViewTest::accessMutableSet,
+              &BitArrayViewTest::accessMutableReset});
+
+    addInstancedTests({&BitArrayViewTest::setAll,
+                       &BitArrayViewTest::invert,
+                       &BitArrayViewTest::count,
+                       &BitArrayViewTest::findFirstSet},
+        Containers::arraySize(OperationData));
+
+    addTests({&BitArrayViewTest::findFirstSetNone});
+
+    addInstancedTests({&BitArrayViewTest::andWith,
+                       &BitArrayViewTest::orWith,
+                       &BitArrayViewTest::xorWith},
+        Containers::arraySize(OperationData));
+
+    addTests({&BitArrayViewTest::bitwiseSizeMismatch,
+
+              &BitArrayViewTest::slice,
+              &BitArrayViewTest::sliceInvalid,
+
+              &BitArrayViewTest::debug});
+}
+
+/* Fills the data with a deterministic pseudo-random bit pattern */
+void fillPattern(char* data, std::size_t size, std::uint32_t seed) {
+    for(std::size_t i = 0; i != size; ++i) {
+        seed = seed*1103515245u + 12345u;
+        data[i] = char(seed >> 16);
+    }
+}
+
+bool bitAt(const char* data, std::size_t i) {
+    return data[i >> 3] & (1 << (i & 0x07));
+}
+
+void BitArrayViewTest::constructDefault() {
+    BitArrayView a;
+    BitArrayView b = nullptr;
+    CORRADE_VERIFY(!a.data());
+    CORRADE_VERIFY(!b.data());
+    CORRADE_COMPARE(a.offset(), 0);
+    CORRADE_COMPARE(b.offset(), 0);
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(b.size(), 0);
+    CORRADE_VERIFY(a.isEmpty());
+    CORRADE_VERIFY(b.isEmpty());
+
+    constexpr BitArrayView ca;
+    constexpr const void* dataA = ca.data();
+    constexpr std::size_t sizeA = ca.size();
+    CORRADE_VERIFY(!dataA);
+    CORRADE_COMPARE(sizeA, 0);
+
+    CORRADE_VERIFY(std::is_nothrow_default_constructible<BitArrayView>::value);
+}
+
+constexpr char Data[]{'\xf0', '\x0f', '\x55'};
+
+void BitArrayViewTest::construct() {
+    const char data[3]{};
+    BitArrayView a{data, 5, 17};
+    CORRADE_COMPARE(a.data(), &data[0]);
+    CORRADE_COMPARE(a.offset(), 5);
+    CORRADE_COMPARE(a.size(), 17);
+    CORRADE_VERIFY(!a.isEmpty());
+
+    CORRADE_VERIFY(std::is_nothrow_constructible<BitArrayView, const void*, std::size_t, std::size_t>::value);
+}
+
+void BitArrayViewTest::constructFixedSize() {
+    char data[3]{};
+    MutableBitArrayView a = data;
+    CORRADE_COMPARE(a.data(), &data[0]);
+    CORRADE_COMPARE(a.offset(), 0);
+    CORRADE_COMPARE(a.size(), 24);
+
+    constexpr BitArrayView ca = Data;
+    constexpr const void* dataA = ca.data();
+    constexpr std::size_t offsetA = ca.offset();
+    constexpr std::size_t sizeA = ca.size();
+    constexpr bool bitA = ca[8];
+    CORRADE_COMPARE(dataA, &Data[0]);
+    CORRADE_COMPARE(offsetA, 0);
+    CORRADE_COMPARE(sizeA, 24);
+    CORRADE_VERIFY(bitA);
+}
+
+void BitArrayViewTest::constructConstFromMutable() {
+    char data[3]{};
+    MutableBitArrayView a{data, 3, 19};
+    BitArrayView b = a;
+    CORRADE_COMPARE(b.data(), &data[0]);
+    CORRADE_COMPARE(b.offset(), 3);
+    CORRADE_COMPARE(b.size(), 19);
+
+    CORRADE_VERIFY(std::is_nothrow_constructible<BitArrayView, MutableBitArrayView>::value);
+    CORRADE_VERIFY(!std::is_constructible<MutableBitArrayView, BitArrayView>::value);
+}
+
+void BitArrayViewTest::constructOffsetTooLarge() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    BitArrayView{nullptr, 8, 0};
+    CORRADE_COMPARE(out.str(), "Containers::BitArrayView: offset expected to be smaller than 8 bits, got 8\n");
+}
+
+void BitArrayViewTest::constructSizeTooLarge() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    BitArrayView{nullptr, 0, std::size_t{1} << (sizeof(std::size_t)*8 - 3)};
+    CORRADE_COMPARE(out.str(), sizeof(std::size_t) == 4 ?
+        "Containers::BitArrayView: size expected to be smaller than 2^29 bits, got 536870912\n" :
+        "Containers::BitArrayView: size expected to be smaller than 2^61 bits, got 2305843009213693952\n");
+}
+
+void BitArrayViewTest::access() {
+    /* 0b11110000, 0b00001111, 0b01010101 starting at bit 2 */
+    BitArrayView a{Data, 2, 20};
+    CORRADE_VERIFY(!a[0]);
+    CORRADE_VERIFY(!a[1]);
+    CORRADE_VERIFY(a[2]);
+    CORRADE_VERIFY(a[5]);
+    CORRADE_VERIFY(a[6]);
+    CORRADE_VERIFY(a[9]);
+    CORRADE_VERIFY(!a[10]);
+    CORRADE_VERIFY(a[14]);
+    CORRADE_VERIFY(!a[15]);
+    CORRADE_VERIFY(a[16]);
+}
+
+void BitArrayViewTest::accessMutableSet() {
+    char data[]{'\x00', '\x00'};
+    MutableBitArrayView a{data, 3, 11};
+    a.set(0);
+    a.set(5);
+    a.set(10, true);
+    a.set(9, false);
+    CORRADE_COMPARE(data[0], '\x08');
+    CORRADE_COMPARE(data[1], '\x21');
+}
+
+void BitArrayViewTest::accessMutableReset() {
+    char data[]{'\xff', '\xff'};
+    MutableBitArrayView a{data, 3, 11};
+    a.reset(0);
+    a.reset(5);
+    a.set(10, false);
+    a.set(9, true);
+    CORRADE_COMPARE(data[0], '\xf7');
+    CORRADE_COMPARE(data[1], '\xde');
+}
+
+void BitArrayViewTest::setAll() {
+    auto&& data = OperationData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    char original[48];
+    fillPattern(original, sizeof(original), 17);
+
+    for(bool value: {true, false}) {
+        CORRADE_ITERATION(value);
+
+        char bits[48];
+        std::memcpy(bits, original, sizeof(bits));
+        MutableBitArrayView{bits, data.offset, data.size}.setAll(value);
+
+        /* Bits inside the view are changed, bits outside stay untouched */
+        for(std::size_t i = 0; i != sizeof(bits)*8; ++i) {
+            CORRADE_ITERATION(i);
+            if(i >= data.offset && i < data.offset + data.size)
+                CORRADE_COMPARE(bitAt(bits, i), value);
+            else
+                CORRADE_COMPARE(bitAt(bits, i), bitAt(original, i));
+        }
+    }
+}
+
+void BitArrayViewTest::invert() {
+    auto&& data = OperationData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    char original[48];
+    fillPattern(original, sizeof(original), 23);
+    char bits[48];
+    std::memcpy(bits, original, sizeof(bits));
+    MutableBitArrayView{bits, data.offset, data.size}.invert();
+
+    for(std::size_t i = 0; i != sizeof(bits)*8; ++i) {
+        CORRADE_ITERATION(i);
+        if(i >= data.offset && i < data.offset + data.size)
+            CORRADE_COMPARE(bitAt(bits, i), !bitAt(original, i));
+        else
+            CORRADE_COMPARE(bitAt(bits, i), bitAt(original, i));
+    }
+}
+
+void BitArrayViewTest::count() {
+    auto&& data = OperationData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    char bits[48];
+    fillPattern(bits, sizeof(bits), 31);
+
+    std::size_t expected = 0;
+    for(std::size_t i = 0; i != data.size; ++i)
+        expected += bitAt(bits, data.offset + i);
+
+    CORRADE_COMPARE(BitArrayView(bits, data.offset, data.size).count(), expected);
+}
+
+void BitArrayViewTest::findFirstSet() {
+    auto&& data = OperationData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Set bits only past the expected position, and also right before the
+       view to verify the offset is taken into account */
+    char bits[48]{};
+    MutableBitArrayView view{bits, data.offset, data.size};
+    if(data.offset) bits[0] |= char(1 << (data.offset - 1));
+
+    if(data.size) {
+        const std::size_t position = data.size*2/3;
+        view.set(position);
+        if(position + 1 < data.size) view.set(position + 1);
+        CORRADE_COMPARE(view.findFirstSet(), position);
+    } else CORRADE_COMPARE(view.findFirstSet(), Containers::NullOpt);
+}
+
+void BitArrayViewTest::findFirstSetNone() {
+    /* All bits set except the ones in the view */
+    char bits[48];
+    std::memset(bits, '\xff', sizeof(bits));
+    MutableBitArrayView view{bits + 1, 3, 300};
+    view.resetAll();
+    CORRADE_COMPARE(view.findFirstSet(), Containers::NullOpt);
+    CORRADE_COMPARE(view.count(), 0);
+}
+
+template<class F, class G> void BitArrayViewTest::verifyBitwise(F operation, G reference) {
+    auto&& data = OperationData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    char original[48];
+    fillPattern(original, sizeof(original), 7);
+    char other[48];
+    fillPattern(other, sizeof(other), 13);
+
+    char bits[48];
+    std::memcpy(bits, original, sizeof(bits));
+    operation(MutableBitArrayView{bits, data.offset, data.size}, BitArrayView{other, data.otherOffset, data.size});
+
+    for(std::size_t i = 0; i != sizeof(bits)*8; ++i) {
+        CORRADE_ITERATION(i);
+        if(i >= data.offset && i < data.offset + data.size)
+            CORRADE_COMPARE(bitAt(bits, i), reference(bitAt(original, i), bitAt(other, i - data.offset + data.otherOffset)));
+        else
+            CORRADE_COMPARE(bitAt(bits, i), bitAt(original, i));
+    }
+}
+
+void BitArrayViewTest::andWith() {
+    verifyBitwise(
+        [](MutableBitArrayView a, BitArrayView b) { a.andWith(b); },
+        [](bool a, bool b) { return a && b; });
+}
+
+void BitArrayViewTest::orWith() {
+    verifyBitwise(
+        [](MutableBitArrayView a, BitArrayView b) { a.orWith(b); },
+        [](bool a, bool b) { return a || b; });
+}
+
+void BitArrayViewTest::xorWith() {
+    verifyBitwise(
+        [](MutableBitArrayView a, BitArrayView b) { a.xorWith(b); },
+        [](bool a, bool b) { return a != b; });
+}
+
+void BitArrayViewTest::bitwiseSizeMismatch() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    char a[2]{};
+    char b[2]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    MutableBitArrayView{a, 0, 10}.andWith(BitArrayView{b, 0, 11});
+    MutableBitArrayView{a, 0, 10}.orWith(BitArrayView{b, 0, 9});
+    MutableBitArrayView{a, 0, 10}.xorWith(BitArrayView{b, 1, 15});
+    CORRADE_COMPARE(out.str(),
+        "Containers::BitArrayView::andWith(): expected a view with 10 bits but got 11\n"
+        "Containers::BitArrayView::orWith(): expected a view with 10 bits but got 9\n"
+        "Containers::BitArrayView::xorWith(): expected a view with 10 bits but got 15\n");
+}
+
+void BitArrayViewTest::slice() {
+    char data[4]{};
+    MutableBitArrayView a{data, 5, 25};
+
+    MutableBitArrayView b = a.slice(4, 17);
+    CORRADE_COMPARE(b.data(), &data[1]);
+    CORRADE_COMPARE(b.offset(), 1);
+    CORRADE_COMPARE(b.size(), 13);
+
+    MutableBitArrayView c = a.prefix(7);
+    CORRADE_COMPARE(c.data(), &data[0]);
+    CORRADE_COMPARE(c.offset(), 5);
+    CORRADE_COMPARE(c.size(), 7);
+
+    MutableBitArrayView d = a.suffix(19);
+    CORRADE_COMPARE(d.data(), &data[3]);
+    CORRADE_COMPARE(d.offset(), 0);
+    CORRADE_COMPARE(d.size(), 6);
+
+    MutableBitArrayView e = a.except(5);
+    CORRADE_COMPARE(e.data(), &data[0]);
+    CORRADE_COMPARE(e.offset(), 5);
+    CORRADE_COMPARE(e.size(), 20);
+
+    /* Setting a bit through a slice affects the original */
+    b.set(0);
+    CORRADE_VERIFY(a[4]);
+    CORRADE_COMPARE(data[1], '\x02');
+}
+
+void BitArrayViewTest::sliceInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    char data[4]{};
+    BitArrayView a{data, 5, 25};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    a.slice(5, 26);
+    a.slice(6, 5);
+    CORRADE_COMPARE(out.str(),
+        "Containers::BitArrayView::slice(): slice [5:26] out of range for 25 bits\n"
+        "Containers::BitArrayView::slice(): slice [6:5] out of range for 25 bits\n");
+}
+
+void BitArrayViewTest::debug() {
+    /* 0b11110000, 0b00001111, 0b01010101 starting at bit 2 */
+    std::ostringstream out;
+    Debug{&out} << BitArrayView{Data, 2, 20} << BitArrayView{};
+    CORRADE_COMPARE(out.str(), "{00111111, 11000010, 1010} {}\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::BitArrayViewTest)
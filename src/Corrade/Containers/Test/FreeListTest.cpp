@@ -0,0 +1,353 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/FreeList.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/DebugStl.h"
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <functional> /* std::ref() */
+#include <thread>
+#endif
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct FreeListTest: TestSuite::Tester {
+    explicit FreeListTest();
+
+    void construct();
+    void constructItems();
+    void constructCopy();
+    void constructMove();
+
+    void pushPop();
+    void popEmpty();
+    void headHighPointerBits();
+
+    void acquire();
+    void acquireEmpty();
+    void pointerConstructDefault();
+    void pointerMove();
+    void pointerRelease();
+    void pointerAccessNull();
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    void threaded();
+    #endif
+};
+
+FreeListTest::FreeListTest() {
+    addTests({&FreeListTest::construct,
+              &FreeListTest::constructItems,
+              &FreeListTest::constructCopy,
+              &FreeListTest::constructMove,
+
+              &FreeListTest::pushPop,
+              &FreeListTest::popEmpty,
+              &FreeListTest::headHighPointerBits,
+
+              &FreeListTest::acquire,
+              &FreeListTest::acquireEmpty,
+              &FreeListTest::pointerConstructDefault,
+              &FreeListTest::pointerMove,
+              &FreeListTest::pointerRelease,
+              &FreeListTest::pointerAccessNull});
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    addRepeatedTests({&FreeListTest::threaded}, 10);
+    #endif
+}
+
+struct Item: FreeListItem<Item> {
+    explicit Item(int value = 0): value{value} {}
+
+    int value;
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    std::atomic<int> owners{0};
+    #endif
+};
+
+void FreeListTest::construct() {
+    FreeList<Item> list;
+    CORRADE_VERIFY(list.isEmpty());
+}
+
+void FreeListTest::constructItems() {
+    Item items[3];
+    FreeList<Item> list{items};
+    CORRADE_VERIFY(!list.isEmpty());
+
+    /* The first item is popped first */
+    CORRADE_COMPARE(list.pop(), &items[0]);
+    CORRADE_COMPARE(list.pop(), &items[1]);
+    CORRADE_COMPARE(list.pop(), &items[2]);
+    CORRADE_VERIFY(list.isEmpty());
+}
+
+void FreeListTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<FreeList<Item>>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<FreeList<Item>>{});
+    CORRADE_VERIFY(!std::is_copy_constructible<FreeListPointer<Item>>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<FreeListPointer<Item>>{});
+}
+
+void FreeListTest::constructMove() {
+    CORRADE_VERIFY(!std::is_move_constructible<FreeList<Item>>{});
+    CORRADE_VERIFY(!std::is_move_assignable<FreeList<Item>>{});
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<FreeListPointer<Item>>{});
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<FreeListPointer<Item>>{});
+}
+
+void FreeListTest::pushPop() {
+    Item a, b, c;
+    FreeList<Item> list;
+    list.push(a);
+    list.push(b);
+    CORRADE_VERIFY(!list.isEmpty());
+
+    /* LIFO order */
+    CORRADE_COMPARE(list.pop(), &b);
+
+    list.push(c);
+    list.push(b);
+    CORRADE_COMPARE(list.pop(), &b);
+    CORRADE_COMPARE(list.pop(), &c);
+    CORRADE_COMPARE(list.pop(), &a);
+    CORRADE_VERIFY(list.isEmpty());
+}
+
+void FreeListTest::popEmpty() {
+    FreeList<Item> list;
+    CORRADE_COMPARE(list.pop(), nullptr);
+
+    /* Popping from a list that became empty */
+    Item a;
+    list.push(a);
+    CORRADE_COMPARE(list.pop(), &a);
+    CORRADE_COMPARE(list.pop(), nullptr);
+}
+
+void FreeListTest::headHighPointerBits() {
+    /* Addresses with a tag in the top byte (Android on ARM64, MTE, HWASan)
+       or above 48 bits (5-level paging) can't be dereferenced here, so the
+       push() can't be tested with a real item. Verify that the head stores
+       such a pointer unchanged instead. */
+    #ifndef CORRADE_TARGET_32BIT
+    void* const pointer = reinterpret_cast<void*>(std::uintptr_t(0xb400007fa3c2e0f0ull));
+    #else
+    void* const pointer = reinterpret_cast<void*>(std::uintptr_t(0xfffe12f0u));
+    #endif
+
+    Implementation::FreeListAtomicHead head;
+    Implementation::FreeListHead expected = head.load(std::memory_order_relaxed);
+    CORRADE_VERIFY(!expected.pointer);
+    CORRADE_COMPARE(expected.tag, 0);
+
+    /* The exchange is allowed to fail spuriously, in which case the expected
+       value gets updated to the (same) current value */
+    while(!head.compareExchange(expected, Implementation::FreeListHead{pointer, ~std::uintptr_t{}}, std::memory_order_release, std::memory_order_relaxed)) {}
+    Implementation::FreeListHead loaded = head.load(std::memory_order_acquire);
+    CORRADE_COMPARE(loaded.pointer, pointer);
+    CORRADE_COMPARE(loaded.tag, ~std::uintptr_t{});
+
+    /* A stale exchange fails and gives back the full current value */
+    Implementation::FreeListHead stale{pointer, 0};
+    CORRADE_VERIFY(!head.compareExchange(stale, Implementation::FreeListHead{nullptr, 1}, std::memory_order_release, std::memory_order_relaxed));
+    CORRADE_COMPARE(stale.pointer, pointer);
+    CORRADE_COMPARE(stale.tag, ~std::uintptr_t{});
+
+    /* The counter wrapping around doesn't leak into the pointer */
+    while(!head.compareExchange(loaded, Implementation::FreeListHead{pointer, loaded.tag + 1}, std::memory_order_release, std::memory_order_relaxed)) {}
+    loaded = head.load(std::memory_order_acquire);
+    CORRADE_COMPARE(loaded.pointer, pointer);
+    CORRADE_COMPARE(loaded.tag, 0);
+}
+
+void FreeListTest::acquire() {
+    Item items[2];
+    items[0].value = 1;
+    FreeList<Item> list{items};
+
+    {
+        FreeListPointer<Item> a = list.acquire();
+        CORRADE_VERIFY(a);
+        CORRADE_VERIFY(a != nullptr);
+        CORRADE_COMPARE(a.list(), &list);
+        CORRADE_COMPARE(a.get(), &items[0]);
+        CORRADE_COMPARE(a->value, 1);
+        CORRADE_COMPARE((*a).value, 1);
+
+        FreeListPointer<Item> b = list.acquire();
+        CORRADE_COMPARE(b.get(), &items[1]);
+        CORRADE_VERIFY(list.isEmpty());
+    }
+
+    /* Both got returned back, in reverse order of destruction */
+    CORRADE_COMPARE(list.pop(), &items[0]);
+    CORRADE_COMPARE(list.pop(), &items[1]);
+    CORRADE_VERIFY(list.isEmpty());
+}
+
+void FreeListTest::acquireEmpty() {
+    FreeList<Item> list;
+    FreeListPointer<Item> a = list.acquire();
+    CORRADE_VERIFY(!a);
+    CORRADE_VERIFY(a == nullptr);
+    CORRADE_COMPARE(a.get(), nullptr);
+}
+
+void FreeListTest::pointerConstructDefault() {
+    const FreeListPointer<Item> a;
+    const FreeListPointer<Item> b = nullptr;
+    CORRADE_VERIFY(!a);
+    CORRADE_VERIFY(!b);
+    CORRADE_COMPARE(a.list(), nullptr);
+    CORRADE_COMPARE(a.get(), nullptr);
+
+    CORRADE_VERIFY(std::is_nothrow_default_constructible<FreeListPointer<Item>>{});
+}
+
+void FreeListTest::pointerMove() {
+    Item items[2];
+    FreeList<Item> list{items};
+
+    {
+        FreeListPointer<Item> a = list.acquire();
+        FreeListPointer<Item> b = Utility::move(a);
+        CORRADE_VERIFY(!a);
+        CORRADE_COMPARE(b.get(), &items[0]);
+
+        FreeListPointer<Item> c = list.acquire();
+        c = Utility::move(b);
+        CORRADE_COMPARE(b.get(), &items[1]);
+        CORRADE_COMPARE(c.get(), &items[0]);
+        CORRADE_VERIFY(list.isEmpty());
+    }
+
+    /* Each got returned exactly once */
+    CORRADE_VERIFY(list.pop());
+    CORRADE_VERIFY(list.pop());
+    CORRADE_VERIFY(list.isEmpty());
+}
+
+void FreeListTest::pointerRelease() {
+    Item a;
+    FreeList<Item> list;
+    list.push(a);
+
+    {
+        FreeListPointer<Item> p = list.acquire();
+        CORRADE_COMPARE(p.release(), &a);
+        CORRADE_VERIFY(!p);
+    }
+
+    /* Not returned back */
+    CORRADE_VERIFY(list.isEmpty());
+}
+
+void FreeListTest::pointerAccessNull() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    FreeListPointer<Item> a;
+    const FreeListPointer<Item> ca;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    a.operator->();
+    ca.operator->();
+    /* These are undefined behavior, so don't dereference the result */
+    static_cast<void>(*a);
+    static_cast<void>(*ca);
+    CORRADE_COMPARE(out.str(),
+        "Containers::FreeListPointer: the pointer is null\n"
+        "Containers::FreeListPointer: the pointer is null\n"
+        "Containers::FreeListPointer: the pointer is null\n"
+        "Containers::FreeListPointer: the pointer is null\n");
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void FreeListTest::threaded() {
+    constexpr std::size_t ThreadCount = 4;
+    constexpr std::size_t ItemCount = 8;
+    constexpr std::size_t Count = 100000;
+
+    /* Less items than threads*2 so the threads are fighting over the head */
+    Array<Item> items{ItemCount};
+    FreeList<Item> list{items};
+
+    /* Each thread acquires up to two items at a time and verifies nobody
+       else is holding them. If the ABA problem wasn't handled, the same item
+       would get handed out twice. */
+    struct Result {
+        std::size_t acquired{};
+        bool exclusive = true;
+    } results[ThreadCount];
+    std::thread threads[ThreadCount];
+    for(std::size_t i = 0; i != ThreadCount; ++i) threads[i] = std::thread{[&list](Result& result) {
+        for(std::size_t j = 0; j != Count; ++j) {
+            FreeListPointer<Item> a = list.acquire();
+            FreeListPointer<Item> b = list.acquire();
+            for(FreeListPointer<Item>* p: {&a, &b}) {
+                if(!*p) continue;
+                if((*p)->owners.fetch_add(1, std::memory_order_relaxed) != 0)
+                    result.exclusive = false;
+                ++(*p)->value;
+                ++result.acquired;
+            }
+            for(FreeListPointer<Item>* p: {&a, &b})
+                if(*p) (*p)->owners.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }, std::ref(results[i])};
+
+    for(std::thread& i: threads) i.join();
+
+    std::size_t acquired = 0;
+    for(const Result& result: results) {
+        CORRADE_VERIFY(result.exclusive);
+        acquired += result.acquired;
+    }
+
+    /* All items are back and the per-item counters add up, i.e. no item
+       was modified concurrently */
+    std::size_t sum = 0;
+    std::size_t count = 0;
+    while(Item* item = list.pop()) {
+        sum += item->value;
+        ++count;
+    }
+    CORRADE_COMPARE(count, ItemCount);
+    CORRADE_COMPARE(sum, acquired);
+}
+#endif
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::FreeListTest)
@@ -0,0 +1,231 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <string>
+#include <unordered_map>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/HashMap.h"
+#include "Corrade/Containers/String.h"
+#include "Corrade/Containers/StringStl.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/FormatStl.h"
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct HashMapBenchmark: TestSuite::Tester {
+    explicit HashMapBenchmark();
+
+    void insertInt();
+    void insertIntStl();
+    void findInt();
+    void findIntStl();
+    void findIntMissing();
+    void findIntMissingStl();
+
+    void insertString();
+    void insertStringStl();
+    void findString();
+    void findStringStl();
+};
+
+/* Enough items for the map to not fit into L1 and for the STL nodes to be
+   scattered over memory, while keeping the whole run short even in Debug
+   builds. 64k items of 16 bytes is 1 MB for the integer maps. */
+constexpr std::size_t Count = 1 << 16;
+
+/* Keys spread over the whole range, so they don't end up being sequential
+   for the STL which uses identity hash for integers */
+std::size_t key(std::size_t i) { return i*0x9e3779b97f4a7c15ull; }
+
+/* Lookups are done in a different order than insertions, as the STL would
+   otherwise benefit from nodes being allocated sequentially in memory. Count
+   is a power of two so this visits each index exactly once. */
+std::size_t lookupOrder(std::size_t i) { return (i*7919) & (Count - 1); }
+
+Array<String> makeStrings() {
+    Array<String> out{Count};
+    for(std::size_t i = 0; i != Count; ++i)
+        out[i] = Utility::formatString("a string key number {}", key(i));
+    return out;
+}
+
+HashMapBenchmark::HashMapBenchmark() {
+    addBenchmarks({&HashMapBenchmark::insertInt,
+                   &HashMapBenchmark::insertIntStl,
+                   &HashMapBenchmark::findInt,
+                   &HashMapBenchmark::findIntStl,
+                   &HashMapBenchmark::findIntMissing,
+                   &HashMapBenchmark::findIntMissingStl,
+
+                   &HashMapBenchmark::insertString,
+                   &HashMapBenchmark::insertStringStl,
+                   &HashMapBenchmark::findString,
+                   &HashMapBenchmark::findStringStl}, 5);
+}
+
+void HashMapBenchmark::insertInt() {
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1) {
+        HashMap<std::size_t, std::size_t> map;
+        for(std::size_t i = 0; i != Count; ++i)
+            map.insert(key(i), i);
+        size += map.size();
+    }
+
+    CORRADE_COMPARE(size, Count);
+}
+
+void HashMapBenchmark::insertIntStl() {
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1) {
+        std::unordered_map<std::size_t, std::size_t> map;
+        for(std::size_t i = 0; i != Count; ++i)
+            map.emplace(key(i), i);
+        size += map.size();
+    }
+
+    CORRADE_COMPARE(size, Count);
+}
+
+void HashMapBenchmark::findInt() {
+    HashMap<std::size_t, std::size_t> map;
+    for(std::size_t i = 0; i != Count; ++i)
+        map.insert(key(i), i);
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Count; ++i)
+            sum += *map.find(key(lookupOrder(i)));
+
+    CORRADE_COMPARE(sum, Count*(Count - 1)/2);
+}
+
+void HashMapBenchmark::findIntStl() {
+    std::unordered_map<std::size_t, std::size_t> map;
+    for(std::size_t i = 0; i != Count; ++i)
+        map.emplace(key(i), i);
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Count; ++i)
+            sum += map.find(key(lookupOrder(i)))->second;
+
+    CORRADE_COMPARE(sum, Count*(Count - 1)/2);
+}
+
+void HashMapBenchmark::findIntMissing() {
+    HashMap<std::size_t, std::size_t> map;
+    for(std::size_t i = 0; i != Count; ++i)
+        map.insert(key(i), i);
+
+    std::size_t found = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Count; ++i)
+            found += map.contains(key(i + Count));
+
+    CORRADE_COMPARE(found, 0);
+}
+
+void HashMapBenchmark::findIntMissingStl() {
+    std::unordered_map<std::size_t, std::size_t> map;
+    for(std::size_t i = 0; i != Count; ++i)
+        map.emplace(key(i), i);
+
+    std::size_t found = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Count; ++i)
+            found += map.count(key(i + Count));
+
+    CORRADE_COMPARE(found, 0);
+}
+
+void HashMapBenchmark::insertString() {
+    const Array<String> strings = makeStrings();
+
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1) {
+        HashMap<String, std::size_t> map;
+        for(std::size_t i = 0; i != Count; ++i)
+            map.insert(strings[i], i);
+        size += map.size();
+    }
+
+    CORRADE_COMPARE(size, Count);
+}
+
+void HashMapBenchmark::insertStringStl() {
+    const Array<String> strings = makeStrings();
+
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1) {
+        std::unordered_map<std::string, std::size_t> map;
+        for(std::size_t i = 0; i != Count; ++i)
+            map.emplace(strings[i], i);
+        size += map.size();
+    }
+
+    CORRADE_COMPARE(size, Count);
+}
+
+void HashMapBenchmark::findString() {
+    const Array<String> strings = makeStrings();
+    HashMap<String, std::size_t> map;
+    for(std::size_t i = 0; i != Count; ++i)
+        map.insert(strings[i], i);
+
+    /* Looked up through a view, no allocation */
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Count; ++i)
+            sum += *map.find(strings[lookupOrder(i)]);
+
+    CORRADE_COMPARE(sum, Count*(Count - 1)/2);
+}
+
+void HashMapBenchmark::findStringStl() {
+    const Array<String> strings = makeStrings();
+    std::unordered_map<std::string, std::size_t> map;
+    for(std::size_t i = 0; i != Count; ++i)
+        map.emplace(strings[i], i);
+
+    /* Before C++20 there's no heterogeneous lookup, so the lookup key has to
+       be a std::string as well */
+    Array<std::string> stlStrings{Count};
+    for(std::size_t i = 0; i != Count; ++i)
+        stlStrings[i] = strings[i];
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Count; ++i)
+            sum += map.find(stlStrings[lookupOrder(i)])->second;
+
+    CORRADE_COMPARE(sum, Count*(Count - 1)/2);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::HashMapBenchmark)
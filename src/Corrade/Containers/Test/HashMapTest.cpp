@@ -0,0 +1,510 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Corrade/Containers/ArrayArena.h"
+#include "Corrade/Containers/HashMap.h"
+#include "Corrade/Containers/String.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers {
+
+namespace Test { namespace {
+
+/* All keys of this type have the same hash, so every lookup has to go
+   through the whole probe sequence */
+struct Colliding {
+    int value;
+};
+
+}}
+
+namespace Implementation {
+
+template<> struct HashMapTraits<Test::Colliding> {
+    typedef Test::Colliding LookupType;
+    static std::size_t hash(Test::Colliding) { return 0x12345; }
+    static bool equals(Test::Colliding a, Test::Colliding b) {
+        return a.value == b.value;
+    }
+};
+
+}
+
+namespace Test { namespace {
+
+struct HashMapTest: TestSuite::Tester {
+    explicit HashMapTest();
+
+    void construct();
+    void constructCopy();
+    void constructMove();
+
+    void insertFind();
+    void insertExisting();
+    void emplace();
+    void emplaceExplicitDefault();
+    void accessOperator();
+    void remove();
+    void removeReinsert();
+    void grow();
+    void growRehashDeleted();
+    void collisions();
+    void reserve();
+    void clear();
+    void iterate();
+    void iterateEmpty();
+
+    void stringKeys();
+    void stringViewKeys();
+    void enumKeys();
+    void pointerKeys();
+
+    void nonTrivial();
+    void customAllocator();
+};
+
+HashMapTest::HashMapTest() {
+    addTests({&HashMapTest::construct,
+              &HashMapTest::constructCopy,
+              &HashMapTest::constructMove,
+
+              &HashMapTest::insertFind,
+              &HashMapTest::insertExisting,
+              &HashMapTest::emplace,
+              &HashMapTest::emplaceExplicitDefault,
+              &HashMapTest::accessOperator,
+              &HashMapTest::remove,
+              &HashMapTest::removeReinsert,
+              &HashMapTest::grow,
+              &HashMapTest::growRehashDeleted,
+              &HashMapTest::collisions,
+              &HashMapTest::reserve,
+              &HashMapTest::clear,
+              &HashMapTest::iterate,
+              &HashMapTest::iterateEmpty,
+
+              &HashMapTest::stringKeys,
+              &HashMapTest::stringViewKeys,
+              &HashMapTest::enumKeys,
+              &HashMapTest::pointerKeys,
+
+              &HashMapTest::nonTrivial,
+              &HashMapTest::customAllocator});
+}
+
+using namespace Literals;
+
+void HashMapTest::construct() {
+    const HashMap<int, float> map;
+    CORRADE_COMPARE(map.size(), 0);
+    CORRADE_COMPARE(map.capacity(), 0);
+    CORRADE_VERIFY(map.isEmpty());
+    CORRADE_VERIFY(!map.find(3));
+    CORRADE_VERIFY(!map.contains(3));
+}
+
+void HashMapTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<HashMap<int, float>>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<HashMap<int, float>>{});
+}
+
+void HashMapTest::constructMove() {
+    HashMap<int, float> a;
+    a.insert(3, 1.5f);
+    a.insert(7, 2.5f);
+    const std::size_t capacity = a.capacity();
+
+    HashMap<int, float> b = std::move(a);
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(a.capacity(), 0);
+    CORRADE_VERIFY(!a.find(3));
+    CORRADE_COMPARE(b.size(), 2);
+    CORRADE_COMPARE(b.capacity(), capacity);
+    CORRADE_VERIFY(b.find(3));
+    CORRADE_COMPARE(*b.find(3), 1.5f);
+
+    HashMap<int, float> c;
+    c.insert(5, 0.5f);
+    c = std::move(b);
+    CORRADE_COMPARE(c.size(), 2);
+    CORRADE_VERIFY(c.find(7));
+    CORRADE_COMPARE(*c.find(7), 2.5f);
+    CORRADE_VERIFY(!c.find(5));
+    CORRADE_VERIFY(b.find(5));
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<HashMap<int, float>>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<HashMap<int, float>>::value);
+}
+
+void HashMapTest::insertFind() {
+    HashMap<int, float> map;
+    Pair<float*, bool> a = map.insert(3, 1.5f);
+    CORRADE_VERIFY(a.first());
+    CORRADE_VERIFY(a.second());
+    CORRADE_COMPARE(*a.first(), 1.5f);
+
+    Pair<float*, bool> b = map.insert(-7, 2.5f);
+    CORRADE_VERIFY(b.second());
+    CORRADE_COMPARE(map.size(), 2);
+    CORRADE_COMPARE(map.capacity(), 16);
+    CORRADE_VERIFY(!map.isEmpty());
+
+    CORRADE_COMPARE(map.find(3), a.first());
+    CORRADE_COMPARE(map.find(-7), b.first());
+    CORRADE_VERIFY(!map.find(4));
+    CORRADE_VERIFY(map.contains(-7));
+    CORRADE_VERIFY(!map.contains(7));
+
+    /* Const overload */
+    const HashMap<int, float>& cmap = map;
+    CORRADE_VERIFY(cmap.find(3));
+    CORRADE_COMPARE(*cmap.find(3), 1.5f);
+}
+
+void HashMapTest::insertExisting() {
+    HashMap<int, float> map;
+    Pair<float*, bool> a = map.insert(3, 1.5f);
+    Pair<float*, bool> b = map.insert(3, 2.5f);
+    CORRADE_COMPARE(b.first(), a.first());
+    CORRADE_VERIFY(!b.second());
+    /* The existing value is not overwritten */
+    CORRADE_COMPARE(*b.first(), 1.5f);
+    CORRADE_COMPARE(map.size(), 1);
+}
+
+struct Aggregate {
+    int a, b;
+};
+
+void HashMapTest::emplace() {
+    HashMap<int, Aggregate> map;
+    Pair<Aggregate*, bool> a = map.emplace(3, 4, 5);
+    CORRADE_VERIFY(a.second());
+    CORRADE_COMPARE(a.first()->a, 4);
+    CORRADE_COMPARE(a.first()->b, 5);
+
+    /* Default construction */
+    Pair<Aggregate*, bool> b = map.emplace(4);
+    CORRADE_VERIFY(b.second());
+    CORRADE_COMPARE(b.first()->a, 0);
+    CORRADE_COMPARE(b.first()->b, 0);
+}
+
+struct ExplicitDefault {
+    explicit ExplicitDefault() = default;
+};
+
+struct ContainingExplicitDefault {
+    ExplicitDefault a;
+};
+
+void HashMapTest::emplaceExplicitDefault() {
+    /* Same as in constructHelpers.h, this should compile */
+    HashMap<int, ContainingExplicitDefault> map;
+    CORRADE_VERIFY(map.emplace(3).second());
+}
+
+void HashMapTest::accessOperator() {
+    HashMap<int, int> map;
+    map[3] = 15;
+    ++map[3];
+    ++map[5];
+    CORRADE_COMPARE(map.size(), 2);
+    CORRADE_COMPARE(*map.find(3), 16);
+    CORRADE_COMPARE(*map.find(5), 1);
+}
+
+void HashMapTest::remove() {
+    HashMap<int, int> map;
+    map.insert(1, 10);
+    map.insert(2, 20);
+    map.insert(3, 30);
+
+    CORRADE_VERIFY(map.remove(2));
+    CORRADE_VERIFY(!map.remove(2));
+    CORRADE_VERIFY(!map.remove(4));
+    CORRADE_COMPARE(map.size(), 2);
+    CORRADE_VERIFY(!map.find(2));
+    CORRADE_COMPARE(*map.find(1), 10);
+    CORRADE_COMPARE(*map.find(3), 30);
+}
+
+void HashMapTest::removeReinsert() {
+    HashMap<int, int> map;
+    map.insert(1, 10);
+    map.remove(1);
+    Pair<int*, bool> a = map.insert(1, 11);
+    CORRADE_VERIFY(a.second());
+    CORRADE_COMPARE(*a.first(), 11);
+    CORRADE_COMPARE(map.size(), 1);
+    CORRADE_COMPARE(map.capacity(), 16);
+}
+
+void HashMapTest::grow() {
+    HashMap<int, int> map;
+    for(int i = 0; i != 14; ++i) map.insert(i, i*10);
+    /* 7/8 of 16 is still not over the limit */
+    CORRADE_COMPARE(map.capacity(), 16);
+
+    map.insert(14, 140);
+    CORRADE_COMPARE(map.capacity(), 32);
+
+    for(int i = 15; i != 10000; ++i) map.insert(i, i*10);
+    CORRADE_COMPARE(map.size(), 10000);
+    CORRADE_COMPARE(map.capacity(), 16384);
+
+    for(int i = 0; i != 10000; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(map.find(i));
+        CORRADE_COMPARE(*map.find(i), i*10);
+    }
+    CORRADE_VERIFY(!map.find(10000));
+}
+
+void HashMapTest::growRehashDeleted() {
+    HashMap<int, int> map;
+
+    /* Inserting and removing different keys fills the map with deleted
+       items. It should get rehashed in-place instead of growing. */
+    for(int i = 0; i != 1000; ++i) {
+        CORRADE_VERIFY(map.insert(i, i).second());
+        if(i >= 2) CORRADE_VERIFY(map.remove(i - 2));
+    }
+    CORRADE_COMPARE(map.size(), 2);
+    CORRADE_COMPARE(map.capacity(), 16);
+    CORRADE_COMPARE(*map.find(998), 998);
+    CORRADE_COMPARE(*map.find(999), 999);
+}
+
+void HashMapTest::collisions() {
+    HashMap<Colliding, int> map;
+    for(int i = 0; i != 100; ++i) map.insert(Colliding{i}, i);
+    CORRADE_COMPARE(map.size(), 100);
+    for(int i = 0; i != 100; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(map.find(Colliding{i}));
+        CORRADE_COMPARE(*map.find(Colliding{i}), i);
+    }
+    CORRADE_VERIFY(!map.find(Colliding{100}));
+
+    /* Removing from the middle of the probe sequence doesn't break lookup of
+       items after it */
+    for(int i = 0; i != 100; i += 2) CORRADE_VERIFY(map.remove(Colliding{i}));
+    for(int i = 1; i < 100; i += 2) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(map.find(Colliding{i}));
+        CORRADE_COMPARE(*map.find(Colliding{i}), i);
+    }
+    CORRADE_VERIFY(!map.find(Colliding{50}));
+}
+
+void HashMapTest::reserve() {
+    HashMap<int, int> map;
+    map.reserve(100);
+    CORRADE_COMPARE(map.capacity(), 128);
+    CORRADE_COMPARE(map.size(), 0);
+
+    map.insert(1, 2);
+    int* value = map.find(1);
+
+    /* Inserting up to the reserved size doesn't reallocate */
+    for(int i = 2; i != 101; ++i) map.insert(i, i);
+    CORRADE_COMPARE(map.capacity(), 128);
+    CORRADE_COMPARE(map.find(1), value);
+
+    /* Reserving less than current capacity is a no-op */
+    map.reserve(50);
+    CORRADE_COMPARE(map.capacity(), 128);
+    CORRADE_COMPARE(map.find(1), value);
+
+    map.reserve(1000);
+    CORRADE_COMPARE(map.capacity(), 2048);
+    CORRADE_COMPARE(map.size(), 100);
+    CORRADE_COMPARE(*map.find(1), 2);
+    CORRADE_COMPARE(*map.find(100), 100);
+}
+
+void HashMapTest::clear() {
+    HashMap<int, int> map;
+    for(int i = 0; i != 100; ++i) map.insert(i, i);
+    const std::size_t capacity = map.capacity();
+
+    map.clear();
+    CORRADE_COMPARE(map.size(), 0);
+    CORRADE_COMPARE(map.capacity(), capacity);
+    CORRADE_VERIFY(!map.find(50));
+
+    map.insert(50, 3);
+    CORRADE_COMPARE(*map.find(50), 3);
+
+    /* Clearing an empty map does nothing */
+    HashMap<int, int> empty;
+    empty.clear();
+    CORRADE_COMPARE(empty.capacity(), 0);
+}
+
+void HashMapTest::iterate() {
+    HashMap<int, int> map;
+    for(int i = 0; i != 100; ++i) map.insert(i, i*2);
+    for(int i = 0; i < 100; i += 3) map.remove(i);
+
+    int count = 0, keySum = 0;
+    for(auto&& i: map) {
+        CORRADE_COMPARE(i.value(), i.key()*2);
+        ++count;
+        keySum += i.key();
+        i.value() = 0;
+    }
+    CORRADE_COMPARE(count, 66);
+    CORRADE_COMPARE(keySum, 4950 - 1683);
+
+    /* Values can be modified through the iterator */
+    const HashMap<int, int>& cmap = map;
+    for(auto&& i: cmap)
+        CORRADE_COMPARE(i.value(), 0);
+
+    /* Only the value is mutable, and only for a mutable map */
+    CORRADE_VERIFY(std::is_same<decltype(map.begin()->key()), const int&>::value);
+    CORRADE_VERIFY(std::is_same<decltype(map.begin()->value()), int&>::value);
+    CORRADE_VERIFY(std::is_same<decltype(cmap.begin()->key()), const int&>::value);
+    CORRADE_VERIFY(std::is_same<decltype(cmap.begin()->value()), const int&>::value);
+}
+
+void HashMapTest::iterateEmpty() {
+    HashMap<int, int> map;
+    CORRADE_VERIFY(map.begin() == map.end());
+
+    map.insert(3, 5);
+    map.remove(3);
+    CORRADE_VERIFY(map.begin() == map.end());
+    CORRADE_VERIFY(map.cbegin() == map.cend());
+}
+
+void HashMapTest::stringKeys() {
+    HashMap<String, int> map;
+    map.insert("hello", 3);
+    map.insert(String{"a string that's too long for SSO"}, 4);
+    map.insert("hello"_s, 5);
+    CORRADE_COMPARE(map.size(), 2);
+
+    /* Looking up with a view or a literal */
+    CORRADE_VERIFY(map.find("hello"_s));
+    CORRADE_COMPARE(*map.find("hello"_s), 3);
+    CORRADE_VERIFY(map.find("a string that's too long for SSO"));
+    CORRADE_COMPARE(*map.find("a string that's too long for SSO"), 4);
+    CORRADE_VERIFY(!map.find("hell"));
+    CORRADE_VERIFY(!map.find("hello!"_s.prefix(4)));
+    CORRADE_VERIFY(map.find("hello!"_s.prefix(5)));
+}
+
+void HashMapTest::stringViewKeys() {
+    const char data[] = "hello world";
+    HashMap<StringView, int> map;
+    map.insert(StringView{data}.prefix(5), 3);
+    map.insert(StringView{data}.suffix(6), 4);
+
+    CORRADE_COMPARE(*map.find("hello"), 3);
+    CORRADE_COMPARE(*map.find("world"), 4);
+    CORRADE_VERIFY(!map.find("hello world"));
+
+    /* The map doesn't copy the data */
+    for(auto&& i: map)
+        CORRADE_VERIFY(i.key().data() == data || i.key().data() == data + 6);
+}
+
+void HashMapTest::enumKeys() {
+    enum class Enum: unsigned char { A = 3, B = 255 };
+    HashMap<Enum, int> map;
+    map.insert(Enum::A, 1);
+    map.insert(Enum::B, 2);
+    CORRADE_COMPARE(*map.find(Enum::A), 1);
+    CORRADE_COMPARE(*map.find(Enum::B), 2);
+}
+
+void HashMapTest::pointerKeys() {
+    int a, b;
+    HashMap<const int*, int> map;
+    map.insert(&a, 1);
+    CORRADE_COMPARE(*map.find(&a), 1);
+    CORRADE_VERIFY(!map.find(&b));
+    CORRADE_VERIFY(!map.find(nullptr));
+}
+
+struct Counted {
+    static int constructed;
+    static int destructed;
+
+    explicit Counted(int a) noexcept: a{a} { ++constructed; }
+    Counted(const Counted&) = delete;
+    Counted(Counted&& other) noexcept: a{other.a} { ++constructed; }
+    ~Counted() { ++destructed; }
+    Counted& operator=(const Counted&) = delete;
+    Counted& operator=(Counted&&) = delete;
+
+    int a;
+};
+
+int Counted::constructed = 0;
+int Counted::destructed = 0;
+
+void HashMapTest::nonTrivial() {
+    Counted::constructed = Counted::destructed = 0;
+
+    {
+        HashMap<int, Counted> map;
+        for(int i = 0; i != 100; ++i) map.emplace(i, i*2);
+        CORRADE_COMPARE(map.find(37)->a, 74);
+
+        map.remove(37);
+        /* All moved-from and removed instances are destructed */
+        CORRADE_COMPARE(Counted::constructed - Counted::destructed, 99);
+
+        /* Not constructed if the key exists */
+        const int constructed = Counted::constructed;
+        CORRADE_VERIFY(!map.emplace(36, 1337).second());
+        CORRADE_COMPARE(Counted::constructed, constructed);
+    }
+
+    CORRADE_COMPARE(Counted::constructed, Counted::destructed);
+}
+
+void HashMapTest::customAllocator() {
+    char memory[32768];
+    HashMap<int, int, ArrayArenaAllocator> map;
+    {
+        ArrayArena arena{memory};
+        for(int i = 0; i != 100; ++i) map.insert(i, i*3);
+        /* Both the control bytes and the items are in the arena */
+        CORRADE_VERIFY(reinterpret_cast<char*>(map.find(50)) >= memory);
+        CORRADE_VERIFY(reinterpret_cast<char*>(map.find(50)) < memory + sizeof(memory));
+        CORRADE_COMPARE(*map.find(99), 297);
+        map = HashMap<int, int, ArrayArenaAllocator>{};
+    }
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::HashMapTest)
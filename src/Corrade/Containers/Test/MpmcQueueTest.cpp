@@ -0,0 +1,398 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <sstream>
+
+#include "Corrade/Containers/Pointer.h"
+#include "Corrade/Containers/MpmcQueue.h"
+#include "Corrade/Containers/initializeHelpers.h" /* DefaultAllocationAlignment */
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/TestSuite/Compare/Numeric.h"
+#include "Corrade/Utility/DebugStl.h"
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <functional> /* std::ref() */
+#include <thread>
+#endif
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct MpmcQueueTest: TestSuite::Tester {
+    explicit MpmcQueueTest();
+
+    void construct();
+    void constructCapacityRounded();
+    void constructZeroCapacity();
+    void constructHeap();
+    void constructCopy();
+    void constructMove();
+
+    void pushPop();
+    void pushFull();
+    void popEmpty();
+    void pushPopWrapAround();
+    void pushInPlace();
+    void popNoInit();
+    void moveOnly();
+    void destructRemaining();
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    void threaded();
+    void threadedMultiple();
+    #endif
+};
+
+MpmcQueueTest::MpmcQueueTest() {
+    addTests({&MpmcQueueTest::construct,
+              &MpmcQueueTest::constructCapacityRounded,
+              &MpmcQueueTest::constructZeroCapacity,
+              &MpmcQueueTest::constructHeap,
+              &MpmcQueueTest::constructCopy,
+              &MpmcQueueTest::constructMove,
+
+              &MpmcQueueTest::pushPop,
+              &MpmcQueueTest::pushFull,
+              &MpmcQueueTest::popEmpty,
+              &MpmcQueueTest::pushPopWrapAround,
+              &MpmcQueueTest::pushInPlace,
+              &MpmcQueueTest::popNoInit,
+              &MpmcQueueTest::moveOnly,
+              &MpmcQueueTest::destructRemaining});
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    addRepeatedTests({&MpmcQueueTest::threaded,
+                      &MpmcQueueTest::threadedMultiple}, 10);
+    #endif
+}
+
+void MpmcQueueTest::construct() {
+    MpmcQueue<int> queue{16};
+    CORRADE_COMPARE(queue.capacity(), 16);
+    CORRADE_COMPARE(queue.size(), 0);
+    CORRADE_VERIFY(queue.isEmpty());
+}
+
+void MpmcQueueTest::constructCapacityRounded() {
+    /* Capacity 1 is not possible for the sequence numbers to work */
+    MpmcQueue<int> a{1};
+    CORRADE_COMPARE(a.capacity(), 2);
+
+    MpmcQueue<int> b{17};
+    CORRADE_COMPARE(b.capacity(), 32);
+}
+
+void MpmcQueueTest::constructZeroCapacity() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    MpmcQueue<int>{0};
+    CORRADE_COMPARE(out.str(), "Containers::MpmcQueue: expected non-zero capacity\n");
+}
+
+void MpmcQueueTest::constructHeap() {
+    /* The indices are on separate cache lines, but the queue itself
+       shouldn't be over-aligned, otherwise a plain new wouldn't be enough
+       for it before C++17 */
+    CORRADE_COMPARE_AS(alignof(MpmcQueue<int>),
+        Implementation::DefaultAllocationAlignment,
+        TestSuite::Compare::LessOrEqual);
+
+    Pointer<MpmcQueue<int>> queue{Corrade::InPlaceInit, 4u};
+    CORRADE_VERIFY(queue->push(3));
+    int out{};
+    CORRADE_VERIFY(queue->pop(out));
+    CORRADE_COMPARE(out, 3);
+}
+
+void MpmcQueueTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<MpmcQueue<int>>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<MpmcQueue<int>>{});
+}
+
+void MpmcQueueTest::constructMove() {
+    CORRADE_VERIFY(!std::is_move_constructible<MpmcQueue<int>>{});
+    CORRADE_VERIFY(!std::is_move_assignable<MpmcQueue<int>>{});
+}
+
+void MpmcQueueTest::pushPop() {
+    MpmcQueue<int> queue{4};
+    CORRADE_VERIFY(queue.push(1));
+    const int two = 2;
+    CORRADE_VERIFY(queue.push(two));
+    CORRADE_COMPARE(queue.size(), 2);
+    CORRADE_VERIFY(!queue.isEmpty());
+
+    int out = 0;
+    CORRADE_VERIFY(queue.pop(out));
+    CORRADE_COMPARE(out, 1);
+    CORRADE_VERIFY(queue.pop(out));
+    CORRADE_COMPARE(out, 2);
+    CORRADE_COMPARE(queue.size(), 0);
+}
+
+void MpmcQueueTest::pushFull() {
+    MpmcQueue<int> queue{2};
+    CORRADE_VERIFY(queue.push(1));
+    CORRADE_VERIFY(queue.push(2));
+    CORRADE_VERIFY(!queue.push(3));
+    CORRADE_COMPARE(queue.size(), 2);
+
+    /* After popping there's space again */
+    int out;
+    CORRADE_VERIFY(queue.pop(out));
+    CORRADE_VERIFY(queue.push(3));
+}
+
+void MpmcQueueTest::popEmpty() {
+    MpmcQueue<int> queue{2};
+    int out = 1337;
+    CORRADE_VERIFY(!queue.pop(out));
+    CORRADE_COMPARE(out, 1337);
+}
+
+void MpmcQueueTest::pushPopWrapAround() {
+    MpmcQueue<int> queue{4};
+
+    /* Go around the ring several times */
+    int out;
+    for(int i = 0; i != 10; ++i) {
+        CORRADE_VERIFY(queue.push(i*3 + 0));
+        CORRADE_VERIFY(queue.push(i*3 + 1));
+        CORRADE_VERIFY(queue.push(i*3 + 2));
+        CORRADE_VERIFY(queue.pop(out));
+        CORRADE_COMPARE(out, i*3 + 0);
+        CORRADE_VERIFY(queue.pop(out));
+        CORRADE_COMPARE(out, i*3 + 1);
+        CORRADE_VERIFY(queue.pop(out));
+        CORRADE_COMPARE(out, i*3 + 2);
+    }
+
+    CORRADE_VERIFY(queue.isEmpty());
+}
+
+struct Immovable {
+    static int constructed;
+    static int destructed;
+
+    explicit Immovable(int a, int b): a{a + b} { ++constructed; }
+    Immovable(const Immovable&) = delete;
+    Immovable(Immovable&&) noexcept;
+    ~Immovable() { ++destructed; }
+    Immovable& operator=(const Immovable&) = delete;
+    Immovable& operator=(Immovable&&) = delete;
+
+    int a;
+};
+
+int Immovable::constructed = 0;
+int Immovable::destructed = 0;
+
+/* Used only by popNoInit(), which needs move construction */
+Immovable::Immovable(Immovable&& other) noexcept: a{other.a} { ++constructed; }
+
+void MpmcQueueTest::pushInPlace() {
+    Immovable::constructed = Immovable::destructed = 0;
+
+    {
+        MpmcQueue<Immovable> queue{2};
+        CORRADE_VERIFY(queue.push(Corrade::InPlaceInit, 3, 4));
+        CORRADE_VERIFY(queue.push(Corrade::InPlaceInit, 5, 6));
+
+        /* Nothing gets constructed if the queue is full */
+        CORRADE_VERIFY(!queue.push(Corrade::InPlaceInit, 7, 8));
+        CORRADE_COMPARE(Immovable::constructed, 2);
+        CORRADE_COMPARE(Immovable::destructed, 0);
+    }
+
+    CORRADE_COMPARE(Immovable::constructed, 2);
+    CORRADE_COMPARE(Immovable::destructed, 2);
+}
+
+void MpmcQueueTest::popNoInit() {
+    Immovable::constructed = Immovable::destructed = 0;
+
+    {
+        MpmcQueue<Immovable> queue{2};
+        CORRADE_VERIFY(queue.push(Corrade::InPlaceInit, 3, 4));
+
+        union Storage {
+            Storage() {}
+            ~Storage() {}
+            Immovable value;
+        } storage;
+        CORRADE_VERIFY(queue.pop(Corrade::NoInit, &storage.value));
+        CORRADE_COMPARE(storage.value.a, 7);
+        CORRADE_COMPARE(Immovable::constructed, 2);
+        CORRADE_COMPARE(Immovable::destructed, 1);
+
+        /* Nothing gets constructed if the queue is empty */
+        CORRADE_VERIFY(!queue.pop(Corrade::NoInit, &storage.value));
+        CORRADE_COMPARE(Immovable::constructed, 2);
+        storage.value.~Immovable();
+    }
+
+    CORRADE_COMPARE(Immovable::constructed, 2);
+    CORRADE_COMPARE(Immovable::destructed, 2);
+}
+
+void MpmcQueueTest::moveOnly() {
+    MpmcQueue<Pointer<int>> queue{2};
+    Pointer<int> a{Corrade::InPlaceInit, 1337};
+    CORRADE_VERIFY(queue.push(std::move(a)));
+    CORRADE_VERIFY(!a);
+
+    /* If full, the value is not moved from */
+    Pointer<int> b{Corrade::InPlaceInit, 42};
+    CORRADE_VERIFY(queue.push(Pointer<int>{Corrade::InPlaceInit, 0}));
+    CORRADE_VERIFY(!queue.push(std::move(b)));
+    CORRADE_VERIFY(b);
+
+    Pointer<int> out;
+    CORRADE_VERIFY(queue.pop(out));
+    CORRADE_VERIFY(out);
+    CORRADE_COMPARE(*out, 1337);
+}
+
+void MpmcQueueTest::destructRemaining() {
+    Immovable::constructed = Immovable::destructed = 0;
+
+    {
+        MpmcQueue<Immovable> queue{4};
+        Immovable out{0, 0};
+        CORRADE_VERIFY(queue.push(Corrade::InPlaceInit, 1, 0));
+        CORRADE_VERIFY(queue.push(Corrade::InPlaceInit, 2, 0));
+        CORRADE_VERIFY(queue.push(Corrade::InPlaceInit, 3, 0));
+        out.~Immovable();
+        CORRADE_VERIFY(queue.pop(Corrade::NoInit, &out));
+        out.~Immovable();
+        CORRADE_VERIFY(queue.pop(Corrade::NoInit, &out));
+
+        /* Wrap around so the remaining items are on both ends of the
+           storage */
+        CORRADE_VERIFY(queue.push(Corrade::InPlaceInit, 4, 0));
+        CORRADE_VERIFY(queue.push(Corrade::InPlaceInit, 5, 0));
+        CORRADE_VERIFY(queue.push(Corrade::InPlaceInit, 6, 0));
+        CORRADE_COMPARE(queue.size(), 4);
+        CORRADE_COMPARE(Immovable::constructed, 9);
+        CORRADE_COMPARE(Immovable::destructed, 4);
+    }
+
+    /* The four remaining items and `out` got destructed */
+    CORRADE_COMPARE(Immovable::constructed, 9);
+    CORRADE_COMPARE(Immovable::destructed, 9);
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void MpmcQueueTest::threaded() {
+    constexpr std::size_t Count = 100000;
+    MpmcQueue<std::size_t> queue{64};
+
+    std::thread producer{[&queue]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            while(!queue.push(i)) std::this_thread::yield();
+    }};
+
+    /* All items should arrive in order */
+    std::size_t mismatch = ~std::size_t{};
+    for(std::size_t i = 0; i != Count; ++i) {
+        std::size_t out;
+        while(!queue.pop(out)) std::this_thread::yield();
+        if(out != i && mismatch == ~std::size_t{}) mismatch = i;
+    }
+
+    producer.join();
+    CORRADE_COMPARE(mismatch, ~std::size_t{});
+    CORRADE_VERIFY(queue.isEmpty());
+}
+
+void MpmcQueueTest::threadedMultiple() {
+    constexpr std::size_t ThreadCount = 4;
+    constexpr std::size_t Count = 25000;
+    MpmcQueue<std::size_t> queue{64};
+
+    /* Each producer pushes its index in the top bits and a counter in the
+       bottom bits */
+    std::thread producers[ThreadCount];
+    for(std::size_t i = 0; i != ThreadCount; ++i) producers[i] = std::thread{[&queue, i]() {
+        for(std::size_t j = 0; j != Count; ++j)
+            while(!queue.push(i << 24 | j)) std::this_thread::yield();
+    }};
+
+    /* Each consumer should see items from a particular producer in order,
+       and all items together should arrive exactly once */
+    struct Result {
+        std::size_t popped[ThreadCount]{};
+        std::size_t sum[ThreadCount]{};
+        bool ordered = true;
+    } results[ThreadCount];
+    std::thread consumers[ThreadCount];
+    std::atomic<std::size_t> remaining{ThreadCount*Count};
+    for(std::size_t i = 0; i != ThreadCount; ++i) consumers[i] = std::thread{[&queue, &remaining](Result& result) {
+        std::size_t last[ThreadCount];
+        for(std::size_t& j: last) j = ~std::size_t{};
+        while(remaining.load(std::memory_order_relaxed)) {
+            std::size_t out;
+            if(!queue.pop(out)) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            remaining.fetch_sub(1, std::memory_order_relaxed);
+            const std::size_t producer = out >> 24;
+            const std::size_t counter = out & 0xffffff;
+            if(last[producer] != ~std::size_t{} && counter <= last[producer])
+                result.ordered = false;
+            last[producer] = counter;
+            ++result.popped[producer];
+            result.sum[producer] += counter;
+        }
+    }, std::ref(results[i])};
+
+    for(std::thread& i: producers) i.join();
+    for(std::thread& i: consumers) i.join();
+
+    for(std::size_t i = 0; i != ThreadCount; ++i) {
+        CORRADE_ITERATION(i);
+        std::size_t popped = 0, sum = 0;
+        for(const Result& result: results) {
+            CORRADE_VERIFY(result.ordered);
+            popped += result.popped[i];
+            sum += result.sum[i];
+        }
+        CORRADE_COMPARE(popped, Count);
+        CORRADE_COMPARE(sum, Count*(Count - 1)/2);
+    }
+    CORRADE_VERIFY(queue.isEmpty());
+}
+#endif
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::MpmcQueueTest)
@@ -0,0 +1,466 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+
+#include "Corrade/Containers/MpmcQueue.h"
+#include "Corrade/Containers/ObjectPool.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/TestSuite/Compare/Numeric.h"
+#include "Corrade/Utility/DebugStl.h"
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <functional> /* std::ref() */
+#include <thread>
+#endif
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct ObjectPoolTest: TestSuite::Tester {
+    explicit ObjectPoolTest();
+
+    void construct();
+    void constructZeroSlabSize();
+    #ifndef CORRADE_TARGET_32BIT
+    void constructSlabSizeTooLarge();
+    #endif
+    void constructHeap();
+    void constructCopy();
+    void constructMove();
+
+    void createDestroy();
+    void createNonDefaultConstructible();
+    void destroyNull();
+    void reuse();
+    void grow();
+    void growManySlabs();
+
+    void pointer();
+    void pointerConstructDefault();
+    void pointerMove();
+    void pointerRelease();
+    void pointerAccessNull();
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    void threaded();
+    void threadedCrossThreadDestroy();
+    #endif
+};
+
+ObjectPoolTest::ObjectPoolTest() {
+    addTests({&ObjectPoolTest::construct,
+              &ObjectPoolTest::constructZeroSlabSize,
+              #ifndef CORRADE_TARGET_32BIT
+              &ObjectPoolTest::constructSlabSizeTooLarge,
+              #endif
+              &ObjectPoolTest::constructHeap,
+              &ObjectPoolTest::constructCopy,
+              &ObjectPoolTest::constructMove,
+
+              &ObjectPoolTest::createDestroy,
+              &ObjectPoolTest::createNonDefaultConstructible,
+              &ObjectPoolTest::destroyNull,
+              &ObjectPoolTest::reuse,
+              &ObjectPoolTest::grow,
+              &ObjectPoolTest::growManySlabs,
+
+              &ObjectPoolTest::pointer,
+              &ObjectPoolTest::pointerConstructDefault,
+              &ObjectPoolTest::pointerMove,
+              &ObjectPoolTest::pointerRelease,
+              &ObjectPoolTest::pointerAccessNull});
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    addRepeatedTests({&ObjectPoolTest::threaded,
+                      &ObjectPoolTest::threadedCrossThreadDestroy}, 10);
+    #endif
+}
+
+struct Counted {
+    explicit Counted(int value = 0): value{value} { ++constructed; }
+    Counted(const Counted&) = delete;
+    Counted& operator=(const Counted&) = delete;
+    ~Counted() { ++destructed; }
+
+    int value;
+
+    static int constructed;
+    static int destructed;
+};
+
+int Counted::constructed = 0;
+int Counted::destructed = 0;
+
+void ObjectPoolTest::construct() {
+    ObjectPool<int> pool{16};
+    CORRADE_COMPARE(pool.slabSize(), 16);
+    /* Nothing allocated upfront */
+    CORRADE_COMPARE(pool.capacity(), 0);
+
+    ObjectPool<int> defaultPool;
+    CORRADE_COMPARE(defaultPool.slabSize(), 64);
+}
+
+void ObjectPoolTest::constructZeroSlabSize() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    ObjectPool<int> pool{0};
+    CORRADE_COMPARE(out.str(), "Containers::ObjectPool: expected non-zero slab size\n");
+}
+
+#ifndef CORRADE_TARGET_32BIT
+void ObjectPoolTest::constructSlabSizeTooLarge() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    /* Nothing is allocated in the constructor, so this is fine */
+    std::ostringstream out;
+    Error redirectError{&out};
+    ObjectPool<int> pool{std::size_t{1} << 32};
+    CORRADE_COMPARE(out.str(), "Containers::ObjectPool: expected slab size to fit into 32 bits but got 4294967296\n");
+}
+#endif
+
+void ObjectPoolTest::constructHeap() {
+    /* The free lists are on separate cache lines, but the pool itself
+       shouldn't be over-aligned, otherwise a plain new wouldn't be enough
+       for it before C++17 */
+    CORRADE_COMPARE_AS(alignof(ObjectPool<int>),
+        Implementation::DefaultAllocationAlignment,
+        TestSuite::Compare::LessOrEqual);
+
+    ObjectPool<int>* pool = new ObjectPool<int>{4};
+    int* a = pool->create(3);
+    CORRADE_COMPARE(*a, 3);
+    pool->destroy(a);
+    delete pool;
+}
+
+void ObjectPoolTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<ObjectPool<int>>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<ObjectPool<int>>{});
+    CORRADE_VERIFY(!std::is_copy_constructible<PoolPointer<int>>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<PoolPointer<int>>{});
+}
+
+void ObjectPoolTest::constructMove() {
+    CORRADE_VERIFY(!std::is_move_constructible<ObjectPool<int>>{});
+    CORRADE_VERIFY(!std::is_move_assignable<ObjectPool<int>>{});
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<PoolPointer<int>>{});
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<PoolPointer<int>>{});
+}
+
+void ObjectPoolTest::createDestroy() {
+    Counted::constructed = 0;
+    Counted::destructed = 0;
+
+    ObjectPool<Counted> pool{4};
+    Counted* a = pool.create(3);
+    Counted* b = pool.create();
+    CORRADE_COMPARE(a->value, 3);
+    CORRADE_COMPARE(b->value, 0);
+    CORRADE_VERIFY(a != b);
+    CORRADE_COMPARE(pool.capacity(), 4);
+    CORRADE_COMPARE(Counted::constructed, 2);
+    CORRADE_COMPARE(Counted::destructed, 0);
+
+    pool.destroy(a);
+    pool.destroy(b);
+    CORRADE_COMPARE(Counted::constructed, 2);
+    CORRADE_COMPARE(Counted::destructed, 2);
+}
+
+void ObjectPoolTest::createNonDefaultConstructible() {
+    struct NonDefaultConstructible {
+        explicit NonDefaultConstructible(int a, float b): a{a}, b{b} {}
+        int a;
+        float b;
+    };
+
+    ObjectPool<NonDefaultConstructible> pool;
+    NonDefaultConstructible* a = pool.create(5, 0.5f);
+    CORRADE_COMPARE(a->a, 5);
+    CORRADE_COMPARE(a->b, 0.5f);
+    pool.destroy(a);
+}
+
+void ObjectPoolTest::destroyNull() {
+    ObjectPool<Counted> pool;
+    Counted::destructed = 0;
+
+    /* Like delete, this is a no-op */
+    pool.destroy(nullptr);
+    CORRADE_COMPARE(Counted::destructed, 0);
+}
+
+void ObjectPoolTest::reuse() {
+    ObjectPool<int> pool{4};
+    int* a = pool.create(1);
+    pool.destroy(a);
+
+    /* The most recently destroyed object slot is reused on the same thread */
+    int* b = pool.create(2);
+    CORRADE_COMPARE(b, a);
+    CORRADE_COMPARE(*b, 2);
+    CORRADE_COMPARE(pool.capacity(), 4);
+    pool.destroy(b);
+}
+
+void ObjectPoolTest::grow() {
+    ObjectPool<int> pool{2};
+
+    int* objects[5];
+    for(std::size_t i = 0; i != 5; ++i) {
+        objects[i] = pool.create(int(i));
+        *objects[i] = int(i*10);
+    }
+
+    /* Three slabs allocated, the objects don't overlap */
+    CORRADE_COMPARE(pool.capacity(), 6);
+    for(std::size_t i = 0; i != 5; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(*objects[i], int(i*10));
+    }
+
+    /* Slots from the first slab are taken in memory order */
+    CORRADE_COMPARE_AS(reinterpret_cast<std::uintptr_t>(objects[1]),
+        reinterpret_cast<std::uintptr_t>(objects[0]),
+        TestSuite::Compare::Greater);
+
+    for(int* i: objects) pool.destroy(i);
+
+    /* Destroyed objects get reused, no new slab allocated */
+    for(std::size_t i = 0; i != 5; ++i) objects[i] = pool.create();
+    CORRADE_COMPARE(pool.capacity(), 6);
+    for(int* i: objects) pool.destroy(i);
+}
+
+void ObjectPoolTest::growManySlabs() {
+    /* A non-power-of-two slab size, the slot index within a slab takes 2 bits
+       but only three values are used. 35 slabs are spread over six
+       directory chunks. */
+    ObjectPool<int> pool{3};
+
+    int* objects[104];
+    for(std::size_t i = 0; i != Containers::arraySize(objects); ++i)
+        objects[i] = pool.create(int(i*10));
+    CORRADE_COMPARE(pool.capacity(), 105);
+
+    /* All objects are distinct and none got overwritten */
+    for(std::size_t i = 0; i != Containers::arraySize(objects); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(*objects[i], int(i*10));
+    }
+
+    for(int* i: objects) pool.destroy(i);
+
+    /* All slots can be found again, no new slab allocated */
+    for(std::size_t i = 0; i != Containers::arraySize(objects); ++i)
+        objects[i] = pool.create(int(i));
+    CORRADE_COMPARE(pool.capacity(), 105);
+    for(std::size_t i = 0; i != Containers::arraySize(objects); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(*objects[i], int(i));
+    }
+    for(int* i: objects) pool.destroy(i);
+}
+
+void ObjectPoolTest::pointer() {
+    Counted::constructed = 0;
+    Counted::destructed = 0;
+
+    ObjectPool<Counted> pool;
+    {
+        PoolPointer<Counted> a = pool.pointer(42);
+        CORRADE_VERIFY(a);
+        CORRADE_VERIFY(a != nullptr);
+        CORRADE_COMPARE(a.pool(), &pool);
+        CORRADE_COMPARE(a->value, 42);
+        CORRADE_COMPARE((*a).value, 42);
+        CORRADE_COMPARE(Counted::constructed, 1);
+        CORRADE_COMPARE(Counted::destructed, 0);
+
+        const PoolPointer<Counted>& ca = a;
+        CORRADE_COMPARE(ca.get(), a.get());
+        CORRADE_COMPARE(ca->value, 42);
+    }
+
+    CORRADE_COMPARE(Counted::constructed, 1);
+    CORRADE_COMPARE(Counted::destructed, 1);
+}
+
+void ObjectPoolTest::pointerConstructDefault() {
+    const PoolPointer<int> a;
+    const PoolPointer<int> b = nullptr;
+    CORRADE_VERIFY(!a);
+    CORRADE_VERIFY(!b);
+    CORRADE_VERIFY(a == nullptr);
+    CORRADE_COMPARE(a.pool(), nullptr);
+    CORRADE_COMPARE(a.get(), nullptr);
+
+    CORRADE_VERIFY(std::is_nothrow_default_constructible<PoolPointer<int>>{});
+}
+
+void ObjectPoolTest::pointerMove() {
+    Counted::constructed = 0;
+    Counted::destructed = 0;
+
+    ObjectPool<Counted> pool;
+    {
+        PoolPointer<Counted> a = pool.pointer(1);
+        PoolPointer<Counted> b = Utility::move(a);
+        CORRADE_VERIFY(!a);
+        CORRADE_COMPARE(b->value, 1);
+
+        PoolPointer<Counted> c = pool.pointer(2);
+        c = Utility::move(b);
+        CORRADE_COMPARE(b->value, 2);
+        CORRADE_COMPARE(c->value, 1);
+        CORRADE_COMPARE(Counted::destructed, 0);
+    }
+
+    /* Each got destroyed exactly once */
+    CORRADE_COMPARE(Counted::constructed, 2);
+    CORRADE_COMPARE(Counted::destructed, 2);
+}
+
+void ObjectPoolTest::pointerRelease() {
+    Counted::constructed = 0;
+    Counted::destructed = 0;
+
+    ObjectPool<Counted> pool;
+    Counted* released;
+    {
+        PoolPointer<Counted> a = pool.pointer(3);
+        released = a.release();
+        CORRADE_VERIFY(!a);
+        CORRADE_COMPARE(released->value, 3);
+    }
+
+    /* Not destroyed */
+    CORRADE_COMPARE(Counted::destructed, 0);
+
+    pool.destroy(released);
+    CORRADE_COMPARE(Counted::destructed, 1);
+}
+
+void ObjectPoolTest::pointerAccessNull() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    PoolPointer<int> a;
+    const PoolPointer<int> ca;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    a.operator->();
+    ca.operator->();
+    /* These are undefined behavior, so don't dereference the result */
+    static_cast<void>(*a);
+    static_cast<void>(*ca);
+    CORRADE_COMPARE(out.str(),
+        "Containers::PoolPointer: the pointer is null\n"
+        "Containers::PoolPointer: the pointer is null\n"
+        "Containers::PoolPointer: the pointer is null\n"
+        "Containers::PoolPointer: the pointer is null\n");
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void ObjectPoolTest::threaded() {
+    constexpr std::size_t ThreadCount = 4;
+    constexpr std::size_t Count = 20000;
+    ObjectPool<std::size_t> pool{16};
+
+    /* Each thread keeps a few objects alive at a time and verifies nobody
+       else overwrote them */
+    bool intact[ThreadCount]{};
+    std::thread threads[ThreadCount];
+    for(std::size_t i = 0; i != ThreadCount; ++i) threads[i] = std::thread{[&pool, i](bool& result) {
+        result = true;
+        PoolPointer<std::size_t> objects[8];
+        for(std::size_t j = 0; j != Count; ++j) {
+            PoolPointer<std::size_t>& object = objects[j % 8];
+            if(object && *object != (i << 24 | (j - 8))) result = false;
+            object = pool.pointer(i << 24 | j);
+        }
+        for(std::size_t j = 0; j != 8; ++j)
+            if(*objects[(Count + j) % 8] != (i << 24 | (Count - 8 + j))) result = false;
+    }, std::ref(intact[i])};
+
+    for(std::thread& i: threads) i.join();
+
+    for(std::size_t i = 0; i != ThreadCount; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(intact[i]);
+    }
+
+    /* At most 9 objects per thread are alive at the same time, the capacity
+       can be larger if threads race to allocate a new slab but it should be
+       nowhere near the total count of created objects */
+    CORRADE_COMPARE_AS(pool.capacity(), 1024,
+        TestSuite::Compare::LessOrEqual);
+}
+
+void ObjectPoolTest::threadedCrossThreadDestroy() {
+    Counted::constructed = 0;
+    Counted::destructed = 0;
+
+    constexpr std::size_t Count = 20000;
+    ObjectPool<Counted> pool{32};
+    MpmcQueue<Counted*> queue{64};
+
+    /* Objects created on one thread and destroyed on another */
+    std::thread producer{[&pool, &queue]() {
+        for(std::size_t i = 0; i != Count; ++i) {
+            Counted* object = pool.create(int(i));
+            while(!queue.push(object)) std::this_thread::yield();
+        }
+    }};
+
+    std::size_t mismatch = ~std::size_t{};
+    for(std::size_t i = 0; i != Count; ++i) {
+        Counted* object;
+        while(!queue.pop(object)) std::this_thread::yield();
+        if(object->value != int(i) && mismatch == ~std::size_t{}) mismatch = i;
+        pool.destroy(object);
+    }
+
+    producer.join();
+    CORRADE_COMPARE(mismatch, ~std::size_t{});
+    CORRADE_COMPARE(Counted::constructed, int(Count));
+    CORRADE_COMPARE(Counted::destructed, int(Count));
+}
+#endif
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::ObjectPoolTest)
@@ -0,0 +1,157 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <mutex>
+#include <thread>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/MpmcQueue.h"
+#include "Corrade/Containers/SpscQueue.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct QueueBenchmark: TestSuite::Tester {
+    explicit QueueBenchmark();
+
+    void spsc();
+    void mpmc();
+    void mutex();
+
+    void mpmcMultiple();
+    void mutexMultiple();
+};
+
+/* Each benchmark passes a million items through a queue of this capacity */
+constexpr std::size_t Capacity = 1024;
+constexpr std::size_t Count = 1000000;
+constexpr std::size_t ThreadCount = 4;
+
+/* Baseline, a fixed-size ring guarded by a mutex */
+class MutexQueue {
+    public:
+        explicit MutexQueue(std::size_t capacity): _data{Corrade::NoInit, capacity}, _head{}, _tail{} {}
+
+        bool push(std::size_t value) {
+            std::lock_guard<std::mutex> lock{_mutex};
+            if(_head - _tail == _data.size()) return false;
+            _data[_head++ % _data.size()] = value;
+            return true;
+        }
+
+        bool pop(std::size_t& out) {
+            std::lock_guard<std::mutex> lock{_mutex};
+            if(_head == _tail) return false;
+            out = _data[_tail++ % _data.size()];
+            return true;
+        }
+
+    private:
+        std::mutex _mutex;
+        Array<std::size_t> _data;
+        std::size_t _head, _tail;
+};
+
+QueueBenchmark::QueueBenchmark() {
+    addBenchmarks({&QueueBenchmark::spsc,
+                   &QueueBenchmark::mpmc,
+                   &QueueBenchmark::mutex,
+
+                   &QueueBenchmark::mpmcMultiple,
+                   &QueueBenchmark::mutexMultiple}, 5);
+}
+
+template<class Queue> std::size_t passThrough(Queue& queue, std::size_t threadCount) {
+    const std::size_t perThread = Count/threadCount;
+
+    Array<std::thread> producers{threadCount};
+    for(std::thread& producer: producers) producer = std::thread{[&queue, perThread]() {
+        for(std::size_t i = 0; i != perThread; ++i)
+            while(!queue.push(i)) std::this_thread::yield();
+    }};
+
+    Array<std::size_t> sums{Corrade::ValueInit, threadCount};
+    Array<std::thread> consumers{threadCount};
+    for(std::size_t i = 0; i != threadCount; ++i) consumers[i] = std::thread{[&queue, perThread](std::size_t& sum) {
+        for(std::size_t j = 0; j != perThread; ++j) {
+            std::size_t out;
+            while(!queue.pop(out)) std::this_thread::yield();
+            sum += out;
+        }
+    }, std::ref(sums[i])};
+
+    for(std::thread& producer: producers) producer.join();
+    for(std::thread& consumer: consumers) consumer.join();
+
+    std::size_t sum = 0;
+    for(std::size_t i: sums) sum += i;
+    return sum;
+}
+
+void QueueBenchmark::spsc() {
+    SpscQueue<std::size_t> queue{Capacity};
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        sum += passThrough(queue, 1);
+    CORRADE_COMPARE(sum, Count*(Count - 1)/2);
+}
+
+void QueueBenchmark::mpmc() {
+    MpmcQueue<std::size_t> queue{Capacity};
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        sum += passThrough(queue, 1);
+    CORRADE_COMPARE(sum, Count*(Count - 1)/2);
+}
+
+void QueueBenchmark::mutex() {
+    MutexQueue queue{Capacity};
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        sum += passThrough(queue, 1);
+    CORRADE_COMPARE(sum, Count*(Count - 1)/2);
+}
+
+void QueueBenchmark::mpmcMultiple() {
+    MpmcQueue<std::size_t> queue{Capacity};
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        sum += passThrough(queue, ThreadCount);
+    CORRADE_COMPARE(sum, ThreadCount*(Count/ThreadCount)*(Count/ThreadCount - 1)/2);
+}
+
+void QueueBenchmark::mutexMultiple() {
+    MutexQueue queue{Capacity};
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        sum += passThrough(queue, ThreadCount);
+    CORRADE_COMPARE(sum, ThreadCount*(Count/ThreadCount)*(Count/ThreadCount - 1)/2);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::QueueBenchmark)
@@ -0,0 +1,430 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Corrade/Containers/SmallArray.h"
+#include "Corrade/Containers/StridedArrayView.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/TestSuite/Compare/Container.h"
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct SmallArrayTest: TestSuite::Tester {
+    explicit SmallArrayTest();
+
+    void construct();
+    void constructDefaultInit();
+    void constructValueInit();
+    void constructNoInit();
+    void constructDirectInit();
+    void constructInPlaceInit();
+    void constructLarge();
+    void constructCopy();
+    void constructMoveSmall();
+    void constructMoveLarge();
+    void moveAssign();
+
+    void convertView();
+    void convertStridedView();
+
+    void append();
+    void appendSpill();
+    void appendList();
+    void appendInPlace();
+    void resize();
+    void reserve();
+    void removeSuffix();
+    void shrink();
+    void shrinkTooLarge();
+
+    void nonTrivial();
+};
+
+SmallArrayTest::SmallArrayTest() {
+    addTests({&SmallArrayTest::construct,
+              &SmallArrayTest::constructDefaultInit,
+              &SmallArrayTest::constructValueInit,
+              &SmallArrayTest::constructNoInit,
+              &SmallArrayTest::constructDirectInit,
+              &SmallArrayTest::constructInPlaceInit,
+              &SmallArrayTest::constructLarge,
+              &SmallArrayTest::constructCopy,
+              &SmallArrayTest::constructMoveSmall,
+              &SmallArrayTest::constructMoveLarge,
+              &SmallArrayTest::moveAssign,
+
+              &SmallArrayTest::convertView,
+              &SmallArrayTest::convertStridedView,
+
+              &SmallArrayTest::append,
+              &SmallArrayTest::appendSpill,
+              &SmallArrayTest::appendList,
+              &SmallArrayTest::appendInPlace,
+              &SmallArrayTest::resize,
+              &SmallArrayTest::reserve,
+              &SmallArrayTest::removeSuffix,
+              &SmallArrayTest::shrink,
+              &SmallArrayTest::shrinkTooLarge,
+
+              &SmallArrayTest::nonTrivial});
+}
+
+/* Pointer to the start of the SmallArray instance itself, used to verify the
+   data are stored inline */
+template<std::size_t N, class T> bool isInside(const SmallArray<N, T>& array, const void* pointer) {
+    return pointer >= static_cast<const void*>(&array) && pointer < static_cast<const void*>(&array + 1);
+}
+
+void SmallArrayTest::construct() {
+    SmallArray<4, int> a;
+    CORRADE_VERIFY(a.isEmpty());
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_VERIFY(isInside(a, a.data()));
+    CORRADE_COMPARE(arrayCapacity(a), 4);
+    CORRADE_COMPARE((SmallArray<4, int>::Capacity), 4);
+    CORRADE_VERIFY(a.begin() == a.end());
+
+    CORRADE_VERIFY(std::is_nothrow_default_constructible<SmallArray<4, int>>::value);
+}
+
+void SmallArrayTest::constructDefaultInit() {
+    SmallArray<4, int> a{Corrade::DefaultInit, 3};
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_VERIFY(a.isSmall());
+}
+
+void SmallArrayTest::constructValueInit() {
+    SmallArray<4, int> a{Corrade::ValueInit, 3};
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_COMPARE_AS(arrayView(a), arrayView({0, 0, 0}), TestSuite::Compare::Container);
+
+    SmallArray<4, int> b{2};
+    CORRADE_COMPARE(b.size(), 2);
+    CORRADE_COMPARE(b[1], 0);
+}
+
+void SmallArrayTest::constructNoInit() {
+    SmallArray<4, int> a{Corrade::NoInit, 4};
+    CORRADE_COMPARE(a.size(), 4);
+    CORRADE_VERIFY(a.isSmall());
+}
+
+void SmallArrayTest::constructDirectInit() {
+    SmallArray<4, int> a{Corrade::DirectInit, 3, 7};
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_COMPARE_AS(arrayView(a), arrayView({7, 7, 7}), TestSuite::Compare::Container);
+}
+
+void SmallArrayTest::constructInPlaceInit() {
+    SmallArray<4, int> a{Corrade::InPlaceInit, {1, 2, 3}};
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_COMPARE(a.front(), 1);
+    CORRADE_COMPARE(a.back(), 3);
+    CORRADE_COMPARE_AS(arrayView(a), arrayView({1, 2, 3}), TestSuite::Compare::Container);
+}
+
+void SmallArrayTest::constructLarge() {
+    SmallArray<4, int> a{Corrade::DirectInit, 5, 3};
+    CORRADE_COMPARE(a.size(), 5);
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_VERIFY(!isInside(a, a.data()));
+    CORRADE_COMPARE_AS(arrayView(a), arrayView({3, 3, 3, 3, 3}), TestSuite::Compare::Container);
+}
+
+void SmallArrayTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<SmallArray<4, int>>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<SmallArray<4, int>>{});
+}
+
+void SmallArrayTest::constructMoveSmall() {
+    SmallArray<4, int> a{Corrade::InPlaceInit, {1, 2, 3}};
+
+    SmallArray<4, int> b = std::move(a);
+    CORRADE_VERIFY(a.isEmpty());
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_VERIFY(b.isSmall());
+    CORRADE_VERIFY(isInside(b, b.data()));
+    CORRADE_COMPARE_AS(arrayView(b), arrayView({1, 2, 3}), TestSuite::Compare::Container);
+
+    /* The moved-from instance is usable again */
+    arrayAppend(a, 4);
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_COMPARE(a.size(), 1);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<SmallArray<4, int>>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<SmallArray<4, int>>::value);
+}
+
+void SmallArrayTest::constructMoveLarge() {
+    SmallArray<2, int> a{Corrade::InPlaceInit, {1, 2, 3}};
+    CORRADE_VERIFY(!a.isSmall());
+    const int* data = a.data();
+
+    /* The allocation is transferred */
+    SmallArray<2, int> b = std::move(a);
+    CORRADE_VERIFY(a.isEmpty());
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_VERIFY(!b.isSmall());
+    CORRADE_COMPARE(b.data(), data);
+    CORRADE_COMPARE_AS(arrayView(b), arrayView({1, 2, 3}), TestSuite::Compare::Container);
+}
+
+void SmallArrayTest::moveAssign() {
+    SmallArray<2, int> a{Corrade::InPlaceInit, {1, 2, 3}};
+    SmallArray<2, int> b{Corrade::InPlaceInit, {4}};
+    SmallArray<2, int> c{Corrade::InPlaceInit, {5, 6}};
+
+    /* Large into small */
+    b = std::move(a);
+    CORRADE_VERIFY(!b.isSmall());
+    CORRADE_COMPARE_AS(arrayView(b), arrayView({1, 2, 3}), TestSuite::Compare::Container);
+    CORRADE_VERIFY(a.isEmpty());
+
+    /* Small into large */
+    b = std::move(c);
+    CORRADE_VERIFY(b.isSmall());
+    CORRADE_COMPARE_AS(arrayView(b), arrayView({5, 6}), TestSuite::Compare::Container);
+    CORRADE_VERIFY(c.isEmpty());
+}
+
+void SmallArrayTest::convertView() {
+    SmallArray<4, int> a{Corrade::InPlaceInit, {1, 2, 3}};
+    const SmallArray<4, int>& ca = a;
+
+    ArrayView<int> b = a;
+    CORRADE_COMPARE(b.data(), a.data());
+    CORRADE_COMPARE(b.size(), 3);
+
+    ArrayView<const int> cb = ca;
+    CORRADE_COMPARE(cb.data(), a.data());
+    CORRADE_COMPARE(cb.size(), 3);
+
+    auto c = arrayView(a);
+    CORRADE_VERIFY(std::is_same<decltype(c), ArrayView<int>>::value);
+    CORRADE_COMPARE(c.data(), a.data());
+
+    auto cc = arrayView(ca);
+    CORRADE_VERIFY(std::is_same<decltype(cc), ArrayView<const int>>::value);
+    CORRADE_COMPARE(cc.size(), 3);
+
+    /* Pointer decay */
+    int* d = a;
+    CORRADE_COMPARE(d, a.data());
+    CORRADE_COMPARE(a[2], 3);
+}
+
+void SmallArrayTest::convertStridedView() {
+    SmallArray<4, int> a{Corrade::InPlaceInit, {1, 2, 3}};
+    const SmallArray<4, int>& ca = a;
+
+    StridedArrayView1D<int> b = a;
+    CORRADE_COMPARE(b.data(), a.data());
+    CORRADE_COMPARE(b.size(), 3);
+    CORRADE_COMPARE(b.stride(), 4);
+
+    StridedArrayView1D<const int> cb = ca;
+    CORRADE_COMPARE(cb.data(), a.data());
+    CORRADE_COMPARE(cb.size(), 3);
+}
+
+void SmallArrayTest::append() {
+    SmallArray<4, int> a;
+    int& first = arrayAppend(a, 1);
+    const int two = 2;
+    arrayAppend(a, two);
+    CORRADE_COMPARE(&first, a.data());
+    CORRADE_COMPARE(a.size(), 2);
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_COMPARE(arrayCapacity(a), 4);
+    CORRADE_COMPARE_AS(arrayView(a), arrayView({1, 2}), TestSuite::Compare::Container);
+}
+
+void SmallArrayTest::appendSpill() {
+    SmallArray<4, int> a;
+    for(int i = 0; i != 4; ++i) arrayAppend(a, i);
+    CORRADE_VERIFY(a.isSmall());
+
+    arrayAppend(a, 4);
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_VERIFY(!isInside(a, a.data()));
+    CORRADE_VERIFY(arrayCapacity(a) > 4);
+    CORRADE_COMPARE_AS(arrayView(a), arrayView({0, 1, 2, 3, 4}), TestSuite::Compare::Container);
+
+    /* Further growth happens on the heap */
+    for(int i = 5; i != 100; ++i) arrayAppend(a, i);
+    CORRADE_COMPARE(a.size(), 100);
+    CORRADE_COMPARE(a[99], 99);
+}
+
+void SmallArrayTest::appendList() {
+    SmallArray<4, int> a;
+    ArrayView<int> b = arrayAppend(a, {1, 2});
+    CORRADE_COMPARE(b.data(), a.data());
+    CORRADE_COMPARE(b.size(), 2);
+
+    const int data[]{3, 4, 5};
+    ArrayView<int> c = arrayAppend(a, data);
+    CORRADE_COMPARE(c.size(), 3);
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE_AS(arrayView(a), arrayView({1, 2, 3, 4, 5}), TestSuite::Compare::Container);
+
+    ArrayView<int> d = arrayAppend(a, Corrade::NoInit, 2);
+    CORRADE_COMPARE(d.size(), 2);
+    CORRADE_COMPARE(a.size(), 7);
+}
+
+struct Aggregate {
+    int a, b;
+};
+
+void SmallArrayTest::appendInPlace() {
+    SmallArray<2, Aggregate> a;
+    arrayAppend(a, Corrade::InPlaceInit, 1, 2);
+    Aggregate& b = arrayAppend(a, Corrade::InPlaceInit, 3, 4);
+    CORRADE_COMPARE(b.a, 3);
+    CORRADE_COMPARE(b.b, 4);
+    CORRADE_VERIFY(a.isSmall());
+
+    arrayAppend(a, Aggregate{5, 6});
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE(a[0].b, 2);
+    CORRADE_COMPARE(a[2].a, 5);
+}
+
+void SmallArrayTest::resize() {
+    SmallArray<4, int> a;
+    arrayResize(a, 3);
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_COMPARE_AS(arrayView(a), arrayView({0, 0, 0}), TestSuite::Compare::Container);
+
+    arrayResize(a, Corrade::DirectInit, 5, 7);
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE_AS(arrayView(a), arrayView({0, 0, 0, 7, 7}), TestSuite::Compare::Container);
+
+    arrayResize(a, Corrade::NoInit, 2);
+    CORRADE_COMPARE(a.size(), 2);
+    arrayResize(a, Corrade::DefaultInit, 6);
+    CORRADE_COMPARE(a.size(), 6);
+    arrayResize(a, Corrade::ValueInit, 7);
+    CORRADE_COMPARE(a[6], 0);
+}
+
+void SmallArrayTest::reserve() {
+    SmallArray<4, int> a;
+    CORRADE_COMPARE(arrayReserve(a, 3), 4);
+    CORRADE_VERIFY(a.isSmall());
+
+    CORRADE_COMPARE(arrayReserve(a, 10), 10);
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE(arrayCapacity(a), 10);
+}
+
+void SmallArrayTest::removeSuffix() {
+    SmallArray<2, int> a{Corrade::InPlaceInit, {1, 2, 3}};
+    arrayRemoveSuffix(a);
+    CORRADE_COMPARE(a.size(), 2);
+    /* Doesn't go back inline */
+    CORRADE_VERIFY(!a.isSmall());
+
+    arrayRemoveSuffix(a, 2);
+    CORRADE_VERIFY(a.isEmpty());
+}
+
+void SmallArrayTest::shrink() {
+    SmallArray<2, int> a{Corrade::InPlaceInit, {1, 2, 3}};
+    arrayRemoveSuffix(a);
+    CORRADE_VERIFY(!a.isSmall());
+
+    arrayShrink(a);
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_VERIFY(isInside(a, a.data()));
+    CORRADE_COMPARE_AS(arrayView(a), arrayView({1, 2}), TestSuite::Compare::Container);
+
+    /* Shrinking an inline array does nothing */
+    arrayShrink(a);
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_COMPARE(a.size(), 2);
+}
+
+void SmallArrayTest::shrinkTooLarge() {
+    SmallArray<2, int> a{Corrade::InPlaceInit, {1, 2, 3}};
+    const int* data = a.data();
+    arrayShrink(a);
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE(a.data(), data);
+}
+
+struct Counted {
+    static int constructed;
+    static int destructed;
+
+    explicit Counted(int a = 0) noexcept: a{a} { ++constructed; }
+    Counted(const Counted& other) noexcept: a{other.a} { ++constructed; }
+    Counted(Counted&& other) noexcept: a{other.a} { ++constructed; }
+    ~Counted() { ++destructed; }
+    Counted& operator=(const Counted&) = default;
+    Counted& operator=(Counted&&) = default;
+
+    int a;
+};
+
+int Counted::constructed = 0;
+int Counted::destructed = 0;
+
+void SmallArrayTest::nonTrivial() {
+    Counted::constructed = Counted::destructed = 0;
+
+    {
+        SmallArray<2, Counted> a;
+        arrayAppend(a, Corrade::InPlaceInit, 1);
+        arrayAppend(a, Corrade::InPlaceInit, 2);
+        CORRADE_COMPARE(Counted::constructed, 2);
+        CORRADE_COMPARE(Counted::destructed, 0);
+
+        /* Spilling moves the two and destructs the originals */
+        arrayAppend(a, Corrade::InPlaceInit, 3);
+        CORRADE_COMPARE(Counted::constructed - Counted::destructed, 3);
+        CORRADE_COMPARE(a[0].a, 1);
+        CORRADE_COMPARE(a[2].a, 3);
+
+        SmallArray<2, Counted> b{Corrade::InPlaceInit, {Counted{4}}};
+        SmallArray<2, Counted> c = std::move(b);
+        CORRADE_COMPARE(Counted::constructed - Counted::destructed, 4);
+
+        arrayRemoveSuffix(a, 2);
+        arrayShrink(a);
+        CORRADE_VERIFY(a.isSmall());
+        CORRADE_COMPARE(a[0].a, 1);
+        CORRADE_COMPARE(Counted::constructed - Counted::destructed, 2);
+    }
+
+    CORRADE_COMPARE(Counted::constructed, Counted::destructed);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::SmallArrayTest)
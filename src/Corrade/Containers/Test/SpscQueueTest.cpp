@@ -0,0 +1,334 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <sstream>
+
+#include "Corrade/Containers/Pointer.h"
+#include "Corrade/Containers/SpscQueue.h"
+#include "Corrade/Containers/initializeHelpers.h" /* DefaultAllocationAlignment */
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/TestSuite/Compare/Numeric.h"
+#include "Corrade/Utility/DebugStl.h"
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#endif
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct SpscQueueTest: TestSuite::Tester {
+    explicit SpscQueueTest();
+
+    void construct();
+    void constructCapacityRounded();
+    void constructZeroCapacity();
+    void constructHeap();
+    void constructCopy();
+    void constructMove();
+
+    void pushPop();
+    void pushFull();
+    void popEmpty();
+    void pushPopWrapAround();
+    void pushInPlace();
+    void popNoInit();
+    void moveOnly();
+    void destructRemaining();
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    void threaded();
+    #endif
+};
+
+SpscQueueTest::SpscQueueTest() {
+    addTests({&SpscQueueTest::construct,
+              &SpscQueueTest::constructCapacityRounded,
+              &SpscQueueTest::constructZeroCapacity,
+              &SpscQueueTest::constructHeap,
+              &SpscQueueTest::constructCopy,
+              &SpscQueueTest::constructMove,
+
+              &SpscQueueTest::pushPop,
+              &SpscQueueTest::pushFull,
+              &SpscQueueTest::popEmpty,
+              &SpscQueueTest::pushPopWrapAround,
+              &SpscQueueTest::pushInPlace,
+              &SpscQueueTest::popNoInit,
+              &SpscQueueTest::moveOnly,
+              &SpscQueueTest::destructRemaining});
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    addRepeatedTests({&SpscQueueTest::threaded}, 10);
+    #endif
+}
+
+void SpscQueueTest::construct() {
+    SpscQueue<int> queue{16};
+    CORRADE_COMPARE(queue.capacity(), 16);
+    CORRADE_COMPARE(queue.size(), 0);
+    CORRADE_VERIFY(queue.isEmpty());
+}
+
+void SpscQueueTest::constructCapacityRounded() {
+    SpscQueue<int> a{1};
+    CORRADE_COMPARE(a.capacity(), 1);
+
+    SpscQueue<int> b{17};
+    CORRADE_COMPARE(b.capacity(), 32);
+}
+
+void SpscQueueTest::constructZeroCapacity() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    SpscQueue<int>{0};
+    CORRADE_COMPARE(out.str(), "Containers::SpscQueue: expected non-zero capacity\n");
+}
+
+void SpscQueueTest::constructHeap() {
+    /* The indices are on separate cache lines, but the queue itself
+       shouldn't be over-aligned, otherwise a plain new wouldn't be enough
+       for it before C++17 */
+    CORRADE_COMPARE_AS(alignof(SpscQueue<int>),
+        Implementation::DefaultAllocationAlignment,
+        TestSuite::Compare::LessOrEqual);
+
+    Pointer<SpscQueue<int>> queue{Corrade::InPlaceInit, 4u};
+    CORRADE_VERIFY(queue->push(3));
+    int out{};
+    CORRADE_VERIFY(queue->pop(out));
+    CORRADE_COMPARE(out, 3);
+}
+
+void SpscQueueTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<SpscQueue<int>>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<SpscQueue<int>>{});
+}
+
+void SpscQueueTest::constructMove() {
+    CORRADE_VERIFY(!std::is_move_constructible<SpscQueue<int>>{});
+    CORRADE_VERIFY(!std::is_move_assignable<SpscQueue<int>>{});
+}
+
+void SpscQueueTest::pushPop() {
+    SpscQueue<int> queue{4};
+    CORRADE_VERIFY(queue.push(1));
+    const int two = 2;
+    CORRADE_VERIFY(queue.push(two));
+    CORRADE_COMPARE(queue.size(), 2);
+    CORRADE_VERIFY(!queue.isEmpty());
+
+    int out = 0;
+    CORRADE_VERIFY(queue.pop(out));
+    CORRADE_COMPARE(out, 1);
+    CORRADE_VERIFY(queue.pop(out));
+    CORRADE_COMPARE(out, 2);
+    CORRADE_COMPARE(queue.size(), 0);
+}
+
+void SpscQueueTest::pushFull() {
+    SpscQueue<int> queue{2};
+    CORRADE_VERIFY(queue.push(1));
+    CORRADE_VERIFY(queue.push(2));
+    CORRADE_VERIFY(!queue.push(3));
+    CORRADE_COMPARE(queue.size(), 2);
+
+    /* After popping there's space again */
+    int out;
+    CORRADE_VERIFY(queue.pop(out));
+    CORRADE_VERIFY(queue.push(3));
+}
+
+void SpscQueueTest::popEmpty() {
+    SpscQueue<int> queue{2};
+    int out = 1337;
+    CORRADE_VERIFY(!queue.pop(out));
+    CORRADE_COMPARE(out, 1337);
+}
+
+void SpscQueueTest::pushPopWrapAround() {
+    SpscQueue<int> queue{4};
+
+    /* Go around the ring several times */
+    int out;
+    for(int i = 0; i != 10; ++i) {
+        CORRADE_VERIFY(queue.push(i*3 + 0));
+        CORRADE_VERIFY(queue.push(i*3 + 1));
+        CORRADE_VERIFY(queue.push(i*3 + 2));
+        CORRADE_VERIFY(queue.pop(out));
+        CORRADE_COMPARE(out, i*3 + 0);
+        CORRADE_VERIFY(queue.pop(out));
+        CORRADE_COMPARE(out, i*3 + 1);
+        CORRADE_VERIFY(queue.pop(out));
+        CORRADE_COMPARE(out, i*3 + 2);
+    }
+
+    CORRADE_VERIFY(queue.isEmpty());
+}
+
+struct Immovable {
+    static int constructed;
+    static int destructed;
+
+    explicit Immovable(int a, int b): a{a + b} { ++constructed; }
+    Immovable(const Immovable&) = delete;
+    Immovable(Immovable&&) noexcept;
+    ~Immovable() { ++destructed; }
+    Immovable& operator=(const Immovable&) = delete;
+    Immovable& operator=(Immovable&&) = delete;
+
+    int a;
+};
+
+int Immovable::constructed = 0;
+int Immovable::destructed = 0;
+
+/* Used only by popNoInit(), which needs move construction */
+Immovable::Immovable(Immovable&& other) noexcept: a{other.a} { ++constructed; }
+
+void SpscQueueTest::pushInPlace() {
+    Immovable::constructed = Immovable::destructed = 0;
+
+    {
+        SpscQueue<Immovable> queue{2};
+        CORRADE_VERIFY(queue.push(Corrade::InPlaceInit, 3, 4));
+        CORRADE_VERIFY(queue.push(Corrade::InPlaceInit, 5, 6));
+
+        /* Nothing gets constructed if the queue is full */
+        CORRADE_VERIFY(!queue.push(Corrade::InPlaceInit, 7, 8));
+        CORRADE_COMPARE(Immovable::constructed, 2);
+        CORRADE_COMPARE(Immovable::destructed, 0);
+    }
+
+    CORRADE_COMPARE(Immovable::constructed, 2);
+    CORRADE_COMPARE(Immovable::destructed, 2);
+}
+
+void SpscQueueTest::popNoInit() {
+    Immovable::constructed = Immovable::destructed = 0;
+
+    {
+        SpscQueue<Immovable> queue{2};
+        CORRADE_VERIFY(queue.push(Corrade::InPlaceInit, 3, 4));
+
+        union Storage {
+            Storage() {}
+            ~Storage() {}
+            Immovable value;
+        } storage;
+        CORRADE_VERIFY(queue.pop(Corrade::NoInit, &storage.value));
+        CORRADE_COMPARE(storage.value.a, 7);
+        CORRADE_COMPARE(Immovable::constructed, 2);
+        CORRADE_COMPARE(Immovable::destructed, 1);
+
+        /* Nothing gets constructed if the queue is empty */
+        CORRADE_VERIFY(!queue.pop(Corrade::NoInit, &storage.value));
+        CORRADE_COMPARE(Immovable::constructed, 2);
+        storage.value.~Immovable();
+    }
+
+    CORRADE_COMPARE(Immovable::constructed, 2);
+    CORRADE_COMPARE(Immovable::destructed, 2);
+}
+
+void SpscQueueTest::moveOnly() {
+    SpscQueue<Pointer<int>> queue{2};
+    Pointer<int> a{Corrade::InPlaceInit, 1337};
+    CORRADE_VERIFY(queue.push(std::move(a)));
+    CORRADE_VERIFY(!a);
+
+    /* If full, the value is not moved from */
+    Pointer<int> b{Corrade::InPlaceInit, 42};
+    CORRADE_VERIFY(queue.push(Pointer<int>{Corrade::InPlaceInit, 0}));
+    CORRADE_VERIFY(!queue.push(std::move(b)));
+    CORRADE_VERIFY(b);
+
+    Pointer<int> out;
+    CORRADE_VERIFY(queue.pop(out));
+    CORRADE_VERIFY(out);
+    CORRADE_COMPARE(*out, 1337);
+}
+
+void SpscQueueTest::destructRemaining() {
+    Immovable::constructed = Immovable::destructed = 0;
+
+    {
+        SpscQueue<Immovable> queue{4};
+        Immovable out{0, 0};
+        CORRADE_VERIFY(queue.push(Corrade::InPlaceInit, 1, 0));
+        CORRADE_VERIFY(queue.push(Corrade::InPlaceInit, 2, 0));
+        CORRADE_VERIFY(queue.push(Corrade::InPlaceInit, 3, 0));
+        out.~Immovable();
+        CORRADE_VERIFY(queue.pop(Corrade::NoInit, &out));
+        out.~Immovable();
+        CORRADE_VERIFY(queue.pop(Corrade::NoInit, &out));
+
+        /* Wrap around so the remaining items are on both ends of the
+           storage */
+        CORRADE_VERIFY(queue.push(Corrade::InPlaceInit, 4, 0));
+        CORRADE_VERIFY(queue.push(Corrade::InPlaceInit, 5, 0));
+        CORRADE_VERIFY(queue.push(Corrade::InPlaceInit, 6, 0));
+        CORRADE_COMPARE(queue.size(), 4);
+        CORRADE_COMPARE(Immovable::constructed, 9);
+        CORRADE_COMPARE(Immovable::destructed, 4);
+    }
+
+    /* The four remaining items and `out` got destructed */
+    CORRADE_COMPARE(Immovable::constructed, 9);
+    CORRADE_COMPARE(Immovable::destructed, 9);
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void SpscQueueTest::threaded() {
+    constexpr std::size_t Count = 100000;
+    SpscQueue<std::size_t> queue{64};
+
+    std::thread producer{[&queue]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            while(!queue.push(i)) std::this_thread::yield();
+    }};
+
+    /* All items should arrive in order */
+    std::size_t mismatch = ~std::size_t{};
+    for(std::size_t i = 0; i != Count; ++i) {
+        std::size_t out;
+        while(!queue.pop(out)) std::this_thread::yield();
+        if(out != i && mismatch == ~std::size_t{}) mismatch = i;
+    }
+
+    producer.join();
+    CORRADE_COMPARE(mismatch, ~std::size_t{});
+    CORRADE_VERIFY(queue.isEmpty());
+}
+#endif
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::SpscQueueTest)
@@ -0,0 +1,316 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+
+#include "Corrade/Containers/StridedBitArrayView.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/DebugStl.h" /** @todo remove when <sstream> is gone */
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct StridedBitArrayViewTest: TestSuite::Tester {
+    explicit StridedBitArrayViewTest();
+
+    void constructDefault();
+    void construct();
+    void constructFromView();
+    void constructConstFromMutable();
+    void constructOffsetTooLarge();
+
+    void access();
+    void accessNegativeStride();
+    void accessMutable();
+
+    void setAll();
+    void setAllContiguous();
+    void count();
+
+    void slice();
+    void sliceInvalid();
+    void every();
+    void everyInvalid();
+    void flipped();
+};
+
+StridedBitArrayViewTest::StridedBitArrayViewTest() {
+    addTests({&StridedBitArrayViewTest::constructDefault,
+              &StridedBitArrayViewTest::construct,
+              &StridedBitArrayViewTest::constructFromView,
+              &StridedBitArrayViewTest::constructConstFromMutable,
+              &StridedBitArrayViewTest::constructOffsetTooLarge,
+
+              &StridedBitArrayViewTest::access,
+              &StridedBitArrayViewTest::accessNegativeStride,
+              &StridedBitArrayViewTest::accessMutable,
+
+              &StridedBitArrayViewTest::setAll,
+              &StridedBitArrayViewTest::setAllContiguous,
+              &StridedBitArrayViewTest::count,
+
+              &StridedBitArrayViewTest::slice,
+              &StridedBitArrayViewTest::sliceInvalid,
+              &StridedBitArrayViewTest::every,
+              &StridedBitArrayViewTest::everyInvalid,
+              &StridedBitArrayViewTest::flipped});
+}
+
+/* 0b10110100, 0b01100011, 0b11001010, 0b00011111 */
+constexpr char Data[]{'\xb4', '\x63', '\xca', '\x1f'};
+
+void StridedBitArrayViewTest::constructDefault() {
+    StridedBitArrayView a;
+    StridedBitArrayView b = nullptr;
+    CORRADE_VERIFY(!a.data());
+    CORRADE_VERIFY(!b.data());
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(b.size(), 0);
+    CORRADE_COMPARE(a.stride(), 0);
+    CORRADE_VERIFY(a.isEmpty());
+
+    constexpr StridedBitArrayView ca;
+    constexpr std::size_t sizeA = ca.size();
+    CORRADE_COMPARE(sizeA, 0);
+
+    CORRADE_VERIFY(std::is_nothrow_default_constructible<StridedBitArrayView>::value);
+}
+
+void StridedBitArrayViewTest::construct() {
+    StridedBitArrayView a{Data, 3, 7, 4};
+    CORRADE_COMPARE(a.data(), &Data[0]);
+    CORRADE_COMPARE(a.offset(), 3);
+    CORRADE_COMPARE(a.size(), 7);
+    CORRADE_COMPARE(a.stride(), 4);
+    CORRADE_VERIFY(!a.isEmpty());
+
+    StridedBitArrayView b{Data, 3, 7, -4};
+    CORRADE_COMPARE(b.stride(), -4);
+}
+
+void StridedBitArrayViewTest::constructFromView() {
+    char data[3]{};
+    MutableStridedBitArrayView a = MutableBitArrayView{data, 5, 13};
+    CORRADE_COMPARE(a.data(), &data[0]);
+    CORRADE_COMPARE(a.offset(), 5);
+    CORRADE_COMPARE(a.size(), 13);
+    CORRADE_COMPARE(a.stride(), 1);
+}
+
+void StridedBitArrayViewTest::constructConstFromMutable() {
+    char data[3]{};
+    MutableStridedBitArrayView a{data, 5, 6, 3};
+    StridedBitArrayView b = a;
+    CORRADE_COMPARE(b.data(), &data[0]);
+    CORRADE_COMPARE(b.offset(), 5);
+    CORRADE_COMPARE(b.size(), 6);
+    CORRADE_COMPARE(b.stride(), 3);
+
+    CORRADE_VERIFY(!std::is_constructible<MutableStridedBitArrayView, StridedBitArrayView>::value);
+}
+
+void StridedBitArrayViewTest::constructOffsetTooLarge() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    StridedBitArrayView{nullptr, 9, 0, 1};
+    CORRADE_COMPARE(out.str(), "Containers::StridedBitArrayView: offset expected to be smaller than 8 bits, got 9\n");
+}
+
+void StridedBitArrayViewTest::access() {
+    /* Bits 2, 5, 8, 11, ..., 29 */
+    StridedBitArrayView a{Data, 2, 10, 3};
+    CORRADE_VERIFY(a[0]);   /* byte 0 bit 2 */
+    CORRADE_VERIFY(a[1]);   /* byte 0 bit 5 */
+    CORRADE_VERIFY(a[2]);   /* byte 1 bit 0 */
+    CORRADE_VERIFY(!a[3]);  /* byte 1 bit 3 */
+    CORRADE_VERIFY(a[4]);   /* byte 1 bit 6 */
+    CORRADE_VERIFY(a[5]);   /* byte 2 bit 1 */
+    CORRADE_VERIFY(!a[6]);  /* byte 2 bit 4 */
+    CORRADE_VERIFY(a[7]);   /* byte 2 bit 7 */
+    CORRADE_VERIFY(a[8]);   /* byte 3 bit 2 */
+    CORRADE_VERIFY(!a[9]);  /* byte 3 bit 5 */
+}
+
+void StridedBitArrayViewTest::accessNegativeStride() {
+    /* Bits 29, 26, 23, ..., 2 */
+    StridedBitArrayView a{Data + 3, 5, 10, -3};
+    CORRADE_VERIFY(!a[0]);
+    CORRADE_VERIFY(a[1]);
+    CORRADE_VERIFY(a[2]);
+    CORRADE_VERIFY(!a[3]);
+    CORRADE_VERIFY(a[9]);
+}
+
+void StridedBitArrayViewTest::accessMutable() {
+    char data[4]{};
+    MutableStridedBitArrayView a{data + 3, 7, 4, -8};
+    a.set(0);
+    a.set(1, true);
+    a.set(3);
+    CORRADE_COMPARE(data[0], '\x80');
+    CORRADE_COMPARE(data[1], '\x00');
+    CORRADE_COMPARE(data[2], '\x80');
+    CORRADE_COMPARE(data[3], '\x80');
+
+    a.reset(0);
+    a.set(3, false);
+    CORRADE_COMPARE(data[0], '\x00');
+    CORRADE_COMPARE(data[2], '\x80');
+    CORRADE_COMPARE(data[3], '\x00');
+}
+
+void StridedBitArrayViewTest::setAll() {
+    char data[4]{};
+    MutableStridedBitArrayView a{data, 1, 8, 4};
+    a.setAll();
+    CORRADE_COMPARE(data[0], '\x22');
+    CORRADE_COMPARE(data[1], '\x22');
+    CORRADE_COMPARE(data[2], '\x22');
+    CORRADE_COMPARE(data[3], '\x22');
+
+    a.every(2).resetAll();
+    CORRADE_COMPARE(data[0], '\x20');
+    CORRADE_COMPARE(data[3], '\x20');
+
+    a.setAll(true);
+    CORRADE_COMPARE(data[1], '\x22');
+}
+
+void StridedBitArrayViewTest::setAllContiguous() {
+    char data[4]{};
+    MutableStridedBitArrayView a = MutableBitArrayView{data, 3, 20};
+    a.setAll();
+    CORRADE_COMPARE(data[0], '\xf8');
+    CORRADE_COMPARE(data[1], '\xff');
+    CORRADE_COMPARE(data[2], '\x7f');
+    CORRADE_COMPARE(data[3], '\x00');
+}
+
+void StridedBitArrayViewTest::count() {
+    CORRADE_COMPARE((StridedBitArrayView{Data, 2, 10, 3}.count()), 7);
+    CORRADE_COMPARE((StridedBitArrayView{Data + 3, 5, 10, -3}.count()), 7);
+    /* Contiguous, delegates to BitArrayView */
+    CORRADE_COMPARE((StridedBitArrayView{Data, 0, 32, 1}.count()), 17);
+}
+
+void StridedBitArrayViewTest::slice() {
+    StridedBitArrayView a{Data, 2, 10, 3};
+
+    StridedBitArrayView b = a.slice(3, 8);
+    CORRADE_COMPARE(b.data(), &Data[1]);
+    CORRADE_COMPARE(b.offset(), 3);
+    CORRADE_COMPARE(b.size(), 5);
+    CORRADE_COMPARE(b.stride(), 3);
+    CORRADE_VERIFY(!b[0]);
+    CORRADE_VERIFY(b[1]);
+
+    CORRADE_COMPARE(a.prefix(4).size(), 4);
+    CORRADE_COMPARE(a.suffix(4).size(), 6);
+    CORRADE_COMPARE(a.suffix(4).data(), &Data[1]);
+    CORRADE_COMPARE(a.suffix(4).offset(), 6);
+    CORRADE_COMPARE(a.except(4).size(), 6);
+
+    /* Negative stride, slicing to bits before the data pointer */
+    StridedBitArrayView c{Data + 3, 5, 10, -3};
+    StridedBitArrayView d = c.suffix(9);
+    CORRADE_COMPARE(d.data(), &Data[0]);
+    CORRADE_COMPARE(d.offset(), 2);
+    CORRADE_COMPARE(d.size(), 1);
+    CORRADE_VERIFY(d[0]);
+}
+
+void StridedBitArrayViewTest::sliceInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    StridedBitArrayView a{Data, 2, 10, 3};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    a.slice(3, 11);
+    CORRADE_COMPARE(out.str(),
+        "Containers::StridedBitArrayView::slice(): slice [3:11] out of range for 10 bits\n");
+}
+
+void StridedBitArrayViewTest::every() {
+    StridedBitArrayView a{Data, 2, 10, 3};
+
+    StridedBitArrayView b = a.every(3);
+    CORRADE_COMPARE(b.size(), 4);
+    CORRADE_COMPARE(b.stride(), 9);
+    CORRADE_VERIFY(b[0]);
+    CORRADE_VERIFY(!b[1]);
+    CORRADE_VERIFY(!b[2]);
+    CORRADE_VERIFY(!b[3]);
+
+    CORRADE_COMPARE(a.every(1).size(), 10);
+    CORRADE_COMPARE(a.every(10).size(), 1);
+    CORRADE_COMPARE(a.every(11).size(), 1);
+}
+
+void StridedBitArrayViewTest::everyInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    StridedBitArrayView a{Data, 2, 10, 3};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    a.every(0);
+    CORRADE_COMPARE(out.str(),
+        "Containers::StridedBitArrayView::every(): expected a non-zero step\n");
+}
+
+void StridedBitArrayViewTest::flipped() {
+    StridedBitArrayView a{Data, 2, 10, 3};
+
+    StridedBitArrayView b = a.flipped();
+    CORRADE_COMPARE(b.data(), &Data[3]);
+    CORRADE_COMPARE(b.offset(), 5);
+    CORRADE_COMPARE(b.size(), 10);
+    CORRADE_COMPARE(b.stride(), -3);
+    for(std::size_t i = 0; i != 10; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(b[i], a[9 - i]);
+    }
+
+    /* Flipping twice gives back the original */
+    StridedBitArrayView c = b.flipped();
+    CORRADE_COMPARE(c.data(), a.data());
+    CORRADE_COMPARE(c.offset(), a.offset());
+    CORRADE_COMPARE(c.stride(), a.stride());
+
+    CORRADE_VERIFY(StridedBitArrayView{}.flipped().isEmpty());
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::StridedBitArrayViewTest)
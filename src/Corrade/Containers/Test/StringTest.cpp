@@ -27,7 +27,7 @@
 #include <cstring>
 #include <sstream>
 
-#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/GrowableArray.h"
 #include "Corrade/Containers/StaticArray.h"
 #include "Corrade/Containers/String.h"
 #include "Corrade/Containers/StringView.h"
@@ -78,6 +78,10 @@ struct StringTest: TestSuite::Tester {
     void constructTakeOwnershipNull();
     void constructTakeOwnershipNotNullTerminated();
     void constructTakeOwnershipTooLarge();
+    void constructTakeOwnershipArray();
+    void constructTakeOwnershipArrayNotGrowable();
+    void constructTakeOwnershipArrayNotNullTerminated();
+    void constructTakeOwnershipArrayTooLarge();
     void constructPointer();
     void constructPointerSmall();
     void constructPointerNull();
@@ -138,6 +142,7 @@ struct StringTest: TestSuite::Tester {
     void split();
     void splitOnAny();
     void splitOnWhitespace();
+    void splitter();
 
     void partition();
 
@@ -170,6 +175,10 @@ StringTest::StringTest() {
               &StringTest::constructTakeOwnershipNull,
               &StringTest::constructTakeOwnershipNotNullTerminated,
               &StringTest::constructTakeOwnershipTooLarge,
+              &StringTest::constructTakeOwnershipArray,
+              &StringTest::constructTakeOwnershipArrayNotGrowable,
+              &StringTest::constructTakeOwnershipArrayNotNullTerminated,
+              &StringTest::constructTakeOwnershipArrayTooLarge,
               &StringTest::constructPointer,
               &StringTest::constructPointerSmall,
               &StringTest::constructPointerNull,
@@ -230,6 +239,7 @@ StringTest::StringTest() {
               &StringTest::split,
               &StringTest::splitOnAny,
               &StringTest::splitOnWhitespace,
+              &StringTest::splitter,
 
               &StringTest::partition,
 
@@ -346,6 +356,75 @@ void StringTest::constructTakeOwnershipTooLarge() {
         "Containers::String: string expected to be smaller than 2^62 bytes, got 18446744073709551615\n");
 }
 
+void StringTest::constructTakeOwnershipArray() {
+    Array<char> data;
+    arrayAppend(data, {'h', 'e', 'l', 'l', 'o'});
+    arrayReserve(data, 100);
+    const char* pointer = data.data();
+
+    /* Appending the null terminator fits into existing capacity */
+    arrayAppend(data, '\0');
+    CORRADE_COMPARE(static_cast<const void*>(data.data()), pointer);
+
+    String a{std::move(data)};
+    CORRADE_VERIFY(!data);
+    CORRADE_COMPARE(data.size(), 0);
+    /* Even though it'd fit into SSO, the memory got taken over without a
+       copy */
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE(a.size(), 5);
+    CORRADE_COMPARE(static_cast<const void*>(a.data()), pointer);
+    CORRADE_COMPARE(a, "hello");
+    CORRADE_VERIFY(a.deleter() == ArrayAllocator<char>::deleter);
+}
+
+void StringTest::constructTakeOwnershipArrayNotGrowable() {
+    Array<char> data{Corrade::InPlaceInit, {'h', 'e', 'l', 'l', 'o', '\0'}};
+    const char* pointer = data.data();
+
+    String a{std::move(data)};
+    CORRADE_VERIFY(!data);
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE(a.size(), 5);
+    CORRADE_COMPARE(static_cast<const void*>(a.data()), pointer);
+    CORRADE_COMPARE(a, "hello");
+    /* The default deleter is the same for both */
+    CORRADE_VERIFY(!a.deleter());
+}
+
+void StringTest::constructTakeOwnershipArrayNotNullTerminated() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Array<char> data{Corrade::InPlaceInit, {'h', 'e', 'y'}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    String{Array<char>{}};
+    String{std::move(data)};
+    /* The array should stay untouched */
+    CORRADE_COMPARE(data.size(), 3);
+    CORRADE_COMPARE(out.str(),
+        "Containers::String: can only take ownership of a non-empty null-terminated array\n"
+        "Containers::String: can only take ownership of a non-empty null-terminated array\n");
+}
+
+void StringTest::constructTakeOwnershipArrayTooLarge() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    char data[1];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    String a{Array<char>{data, ~std::size_t{}, [](char*, std::size_t) {}}};
+    CORRADE_COMPARE(out.str(), sizeof(std::size_t) == 4 ?
+        "Containers::String: string expected to be smaller than 2^30 bytes, got 4294967294\n" :
+        "Containers::String: string expected to be smaller than 2^62 bytes, got 18446744073709551614\n");
+}
+
 void StringTest::constructPointer() {
     String a = "Allocated hello for a verbose world\0that rules";
     CORRADE_VERIFY(!a.isSmall());
@@ -1391,6 +1470,52 @@ void StringTest::splitOnWhitespace() {
     }
 }
 
+void StringTest::splitter() {
+    /* These rely on StringView conversion and then delegate there so we don't
+       need to verify SSO behavior, only the basics and flag propagation */
+
+    const String ca = "ab//c def";
+    {
+        StringSplitter s = ca.splitter('/');
+        StringSplitIterator it = s.begin();
+        CORRADE_COMPARE(*it, "ab");
+        CORRADE_COMPARE(it->flags(), StringViewFlags{});
+        CORRADE_COMPARE(*++it, "");
+        CORRADE_COMPARE(*++it, "c def");
+        CORRADE_COMPARE(it->flags(), StringViewFlag::NullTerminated);
+        CORRADE_VERIFY(++it == s.end());
+    } {
+        StringSplitter s = ca.splitterWithoutEmptyParts('/');
+        StringSplitIterator it = s.begin();
+        CORRADE_COMPARE(*it, "ab");
+        CORRADE_COMPARE(*++it, "c def");
+        CORRADE_VERIFY(++it == s.end());
+    } {
+        StringSplitter s = ca.splitterOnAnyWithoutEmptyParts("/ ");
+        StringSplitIterator it = s.begin();
+        CORRADE_COMPARE(*it, "ab");
+        CORRADE_COMPARE(*++it, "c");
+        CORRADE_COMPARE(*++it, "def");
+        CORRADE_VERIFY(++it == s.end());
+    } {
+        StringSplitter s = ca.splitterOnWhitespaceWithoutEmptyParts();
+        StringSplitIterator it = s.begin();
+        CORRADE_COMPARE(*it, "ab//c");
+        CORRADE_COMPARE(*++it, "def");
+        CORRADE_VERIFY(++it == s.end());
+    }
+
+    String a = "ab/c";
+    {
+        MutableStringSplitter s = a.splitter('/');
+        MutableStringSplitIterator it = s.begin();
+        CORRADE_COMPARE(it->data(), a.data());
+        CORRADE_COMPARE(it->size(), 2);
+        CORRADE_COMPARE((++it)->data(), a.data() + 3);
+        CORRADE_VERIFY(++it == s.end());
+    }
+}
+
 void StringTest::partition() {
     /* These rely on StringView conversion and then delegate there so we don't
        need to verify SSO behavior, only the basics and flag propagation */
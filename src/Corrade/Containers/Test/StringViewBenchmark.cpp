@@ -0,0 +1,222 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <string>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/String.h"
+#include "Corrade/Containers/StringStl.h"
+#include "Corrade/Containers/StringView.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct StringViewBenchmark: TestSuite::Tester {
+    explicit StringViewBenchmark();
+
+    void find();
+    void findStl();
+    #ifdef CORRADE_TARGET_UNIX
+    void findMemmem();
+    #endif
+
+    void findCommonPrefix();
+    void findCommonPrefixStl();
+    #ifdef CORRADE_TARGET_UNIX
+    void findCommonPrefixMemmem();
+    #endif
+
+    void split();
+    void splitter();
+    void splitOnWhitespace();
+    void splitterOnWhitespace();
+};
+
+using namespace Literals;
+
+constexpr StringView LoremIpsum =
+    "Lorem ipsum dolor sit amet, consectetuer adipiscing elit. Duis viverra diam non justo. Integer pellentesque quam vel velit. Pellentesque pretium lectus id turpis. Fusce suscipit libero eget elit. Vestibulum fermentum tortor id mi. Neque porro quisquam est, qui dolorem ipsum quia dolor sit amet, consectetur, adipisci velit, sed quia non numquam eius modi tempora incidunt ut labore et dolore magnam aliquam quaerat voluptatem. Nullam sit amet magna in magna gravida vehicula. Class aptent taciti sociosqu ad litora torquent per conubia nostra, per inceptos hymenaeos. Donec ipsum massa, ullamcorper in, auctor et, scelerisque sed, est. Nam sed tellus id magna elementum tincidunt.\n"
+    "Aliquam erat volutpat. Vivamus ac leo pretium faucibus. Etiam commodo dui eget wisi. Class aptent taciti sociosqu ad litora torquent per conubia nostra, per inceptos hymenaeos. Maecenas ipsum velit, consectetuer eu lobortis ut, dictum at dui. Integer imperdiet lectus quis justo. Ut enim ad minima veniam, quis nostrum exercitationem ullam corporis suscipit laboriosam, nisi ut aliquid ex ea commodi consequatur? Integer tempor. Integer rutrum, orci vestibulum ullamcorper ultricies, lacus quam ultricies odio, vitae placerat pede sem sit amet enim. Pellentesque pretium lectus id turpis.\n"_s;
+
+/* A few hundred kB of text with the needle only at the very end */
+constexpr std::size_t Repeats = 256;
+constexpr StringView Needle = "hippopotamus"_s;
+/* Most of the words in the text start with this, but the last letter
+   doesn't match */
+constexpr StringView NeedleCommonPrefix = "Integer pellentesqueX"_s;
+
+/* 100 MB of text for the split benchmarks */
+constexpr std::size_t SplitRepeats = 100*1024*1024/LoremIpsum.size();
+
+String makeSplitData() {
+    String data{Corrade::NoInit, LoremIpsum.size()*SplitRepeats};
+    for(std::size_t i = 0; i != SplitRepeats; ++i)
+        std::memcpy(data.data() + i*LoremIpsum.size(), LoremIpsum.data(), LoremIpsum.size());
+    return data;
+}
+
+String makeData(StringView needle) {
+    String data{Corrade::NoInit, LoremIpsum.size()*Repeats + needle.size()};
+    for(std::size_t i = 0; i != Repeats; ++i)
+        std::memcpy(data.data() + i*LoremIpsum.size(), LoremIpsum.data(), LoremIpsum.size());
+    std::memcpy(data.data() + Repeats*LoremIpsum.size(), needle.data(), needle.size());
+    return data;
+}
+
+StringViewBenchmark::StringViewBenchmark() {
+    addBenchmarks({&StringViewBenchmark::find,
+                   &StringViewBenchmark::findStl,
+                   #ifdef CORRADE_TARGET_UNIX
+                   &StringViewBenchmark::findMemmem,
+                   #endif
+
+                   &StringViewBenchmark::findCommonPrefix,
+                   &StringViewBenchmark::findCommonPrefixStl,
+                   #ifdef CORRADE_TARGET_UNIX
+                   &StringViewBenchmark::findCommonPrefixMemmem
+                   #endif
+                   }, 10);
+
+    addBenchmarks({&StringViewBenchmark::split,
+                   &StringViewBenchmark::splitter,
+                   &StringViewBenchmark::splitOnWhitespace,
+                   &StringViewBenchmark::splitterOnWhitespace}, 3);
+}
+
+void StringViewBenchmark::find() {
+    const String data = makeData(Needle);
+
+    StringView found;
+    CORRADE_BENCHMARK(10)
+        found = data.find(Needle);
+
+    CORRADE_COMPARE(found.data(), data.end() - Needle.size());
+}
+
+void StringViewBenchmark::findStl() {
+    const std::string data = makeData(Needle);
+
+    std::size_t found{};
+    CORRADE_BENCHMARK(10)
+        found = data.find(Needle.data(), 0, Needle.size());
+
+    CORRADE_COMPARE(found, data.size() - Needle.size());
+}
+
+#ifdef CORRADE_TARGET_UNIX
+void StringViewBenchmark::findMemmem() {
+    const String data = makeData(Needle);
+
+    const void* found{};
+    CORRADE_BENCHMARK(10)
+        found = memmem(data.data(), data.size(), Needle.data(), Needle.size());
+
+    CORRADE_COMPARE(found, data.end() - Needle.size());
+}
+#endif
+
+void StringViewBenchmark::findCommonPrefix() {
+    const String data = makeData(NeedleCommonPrefix);
+
+    StringView found;
+    CORRADE_BENCHMARK(10)
+        found = data.find(NeedleCommonPrefix);
+
+    CORRADE_COMPARE(found.data(), data.end() - NeedleCommonPrefix.size());
+}
+
+void StringViewBenchmark::findCommonPrefixStl() {
+    const std::string data = makeData(NeedleCommonPrefix);
+
+    std::size_t found{};
+    CORRADE_BENCHMARK(10)
+        found = data.find(NeedleCommonPrefix.data(), 0, NeedleCommonPrefix.size());
+
+    CORRADE_COMPARE(found, data.size() - NeedleCommonPrefix.size());
+}
+
+#ifdef CORRADE_TARGET_UNIX
+void StringViewBenchmark::findCommonPrefixMemmem() {
+    const String data = makeData(NeedleCommonPrefix);
+
+    const void* found{};
+    CORRADE_BENCHMARK(10)
+        found = memmem(data.data(), data.size(), NeedleCommonPrefix.data(), NeedleCommonPrefix.size());
+
+    CORRADE_COMPARE(found, data.end() - NeedleCommonPrefix.size());
+}
+#endif
+
+void StringViewBenchmark::split() {
+    const String data = makeSplitData();
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        count += data.split('\n').size();
+
+    CORRADE_COMPARE(count, SplitRepeats*2 + 1);
+}
+
+void StringViewBenchmark::splitter() {
+    const String data = makeSplitData();
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        for(StringView line: data.splitter('\n')) {
+            static_cast<void>(line);
+            ++count;
+        }
+
+    CORRADE_COMPARE(count, SplitRepeats*2 + 1);
+}
+
+void StringViewBenchmark::splitOnWhitespace() {
+    const String data = makeSplitData();
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        count += data.splitOnWhitespaceWithoutEmptyParts().size();
+
+    CORRADE_COMPARE(count, SplitRepeats*185);
+}
+
+void StringViewBenchmark::splitterOnWhitespace() {
+    const String data = makeSplitData();
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        for(StringView word: data.splitterOnWhitespaceWithoutEmptyParts()) {
+            static_cast<void>(word);
+            ++count;
+        }
+
+    CORRADE_COMPARE(count, SplitRepeats*185);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::StringViewBenchmark)
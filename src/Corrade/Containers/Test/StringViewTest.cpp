@@ -27,7 +27,9 @@
 #include <sstream>
 
 #include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/GrowableArray.h"
 #include "Corrade/Containers/StaticArray.h"
+#include "Corrade/Containers/String.h"
 #include "Corrade/Containers/StringView.h"
 #include "Corrade/TestSuite/Tester.h"
 #include "Corrade/TestSuite/Compare/Container.h"
@@ -135,6 +137,10 @@ struct StringViewTest: TestSuite::Tester {
     void splitOnAnyFlags();
     void splitOnWhitespace();
     void splitNullView();
+    void splitter();
+    void splitterFlags();
+    void splitterMutable();
+    void splitterNullView();
 
     void partition();
     void partitionFlags();
@@ -160,6 +166,7 @@ struct StringViewTest: TestSuite::Tester {
 
     void find();
     void findEmpty();
+    void findLong();
     void findFlags();
 
     void debugFlag();
@@ -213,6 +220,10 @@ StringViewTest::StringViewTest() {
               &StringViewTest::splitOnAnyFlags,
               &StringViewTest::splitOnWhitespace,
               &StringViewTest::splitNullView,
+              &StringViewTest::splitter,
+              &StringViewTest::splitterFlags,
+              &StringViewTest::splitterMutable,
+              &StringViewTest::splitterNullView,
 
               &StringViewTest::partition,
               &StringViewTest::partitionFlags,
@@ -236,6 +247,7 @@ StringViewTest::StringViewTest() {
 
               &StringViewTest::find,
               &StringViewTest::findEmpty,
+              &StringViewTest::findLong,
               &StringViewTest::findFlags,
 
               &StringViewTest::debugFlag,
@@ -956,6 +968,11 @@ void StringViewTest::splitOnAny() {
         array({"ab"_s, "c"_s, "def"_s}),
         TestSuite::Compare::Container);
 
+    /* Delimiters with the highest bit set */
+    CORRADE_COMPARE_AS("ab\xa0" "c\xff\x80\x7f"_s.splitOnAnyWithoutEmptyParts("\x80\xa0\xff"),
+        array({"ab"_s, "c"_s, "\x7f"_s}),
+        TestSuite::Compare::Container);
+
     /* Empty parts */
     CORRADE_COMPARE_AS("ab:c;;def."_s.splitOnAnyWithoutEmptyParts(delimiters),
         array({"ab"_s, "c"_s, "def"_s}),
@@ -1016,6 +1033,99 @@ void StringViewTest::splitNullView() {
         TestSuite::Compare::Container);
 }
 
+template<class T> Array<BasicStringView<T>> collect(const BasicStringSplitter<T>& splitter) {
+    Array<BasicStringView<T>> out;
+    for(const BasicStringView<T>& part: splitter) arrayAppend(out, part);
+    return out;
+}
+
+void StringViewTest::splitter() {
+    /* The output should be exactly the same as with the eager variants,
+       including all corner cases */
+    for(StringView string: {""_s, "/"_s, "//"_s, "abcdef"_s, "ab/c/def"_s,
+                            "ab//c/def//"_s, "/ab/"_s, "a"_s}) {
+        CORRADE_ITERATION(string);
+
+        CORRADE_COMPARE_AS(collect(string.splitter('/')),
+            string.split('/'),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(collect(string.splitterWithoutEmptyParts('/')),
+            string.splitWithoutEmptyParts('/'),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(collect(string.splitterOnAnyWithoutEmptyParts("/")),
+            string.splitOnAnyWithoutEmptyParts("/"),
+            TestSuite::Compare::Container);
+    }
+
+    for(StringView string: {""_s, ".:;"_s, "ab:c;def"_s, "ab:c;;def."_s,
+                            ";;ab"_s}) {
+        CORRADE_ITERATION(string);
+
+        CORRADE_COMPARE_AS(collect(string.splitterOnAnyWithoutEmptyParts(".:;")),
+            string.splitOnAnyWithoutEmptyParts(".:;"),
+            TestSuite::Compare::Container);
+    }
+
+    for(StringView string: {""_s, " \t\n"_s, "ab c  \t \ndef\r"_s,
+                            "\f\vab"_s}) {
+        CORRADE_ITERATION(string);
+
+        CORRADE_COMPARE_AS(collect(string.splitterOnWhitespaceWithoutEmptyParts()),
+            string.splitOnWhitespaceWithoutEmptyParts(),
+            TestSuite::Compare::Container);
+    }
+
+    /* The parts should point to the original data */
+    StringView a = "ab/c"_s;
+    StringSplitter splitter = a.splitter('/');
+    StringSplitIterator it = splitter.begin();
+    CORRADE_VERIFY(it != splitter.end());
+    CORRADE_COMPARE(*it, "ab");
+    CORRADE_COMPARE(static_cast<const void*>(it->data()), a.data());
+    StringSplitIterator prev = it++;
+    CORRADE_COMPARE(*prev, "ab");
+    CORRADE_COMPARE(*it, "c");
+    CORRADE_COMPARE(static_cast<const void*>(it->data()), a.data() + 3);
+    CORRADE_VERIFY(++it == splitter.end());
+}
+
+void StringViewTest::splitterFlags() {
+    /* Same as splitFlags(), as both use slice() */
+    {
+        Array<StringView> a = collect("a/b/c"_s.splitter('/'));
+        CORRADE_COMPARE_AS(a, arrayView({"a"_s, "b"_s, "c"_s}),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE(a[0].flags(), StringViewFlag::Global);
+        CORRADE_COMPARE(a[1].flags(), StringViewFlag::Global);
+        CORRADE_COMPARE(a[2].flags(), StringViewFlag::Global|StringViewFlag::NullTerminated);
+
+    /* Empty last part is null-terminated as well */
+    } {
+        Array<StringView> a = collect("a/"_s.splitter('/'));
+        CORRADE_COMPARE_AS(a, arrayView({"a"_s, ""_s}),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE(a[0].flags(), StringViewFlag::Global);
+        CORRADE_COMPARE(a[1].flags(), StringViewFlag::Global|StringViewFlag::NullTerminated);
+    }
+}
+
+void StringViewTest::splitterMutable() {
+    char data[] = "ab c\tdef";
+    MutableStringView a = data;
+
+    for(MutableStringView part: a.splitterOnWhitespaceWithoutEmptyParts())
+        part[0] = 'X';
+
+    CORRADE_COMPARE(StringView{data}, "Xb X\tXef");
+}
+
+void StringViewTest::splitterNullView() {
+    CORRADE_VERIFY(StringView{}.splitter(' ').begin() == StringView{}.splitter(' ').end());
+    CORRADE_VERIFY(StringView{}.splitterWithoutEmptyParts(' ').begin() == StringView{}.splitterWithoutEmptyParts(' ').end());
+    CORRADE_VERIFY(StringView{}.splitterOnAnyWithoutEmptyParts(" ").begin() == StringView{}.splitterOnAnyWithoutEmptyParts(" ").end());
+    CORRADE_VERIFY(StringView{}.splitterOnWhitespaceWithoutEmptyParts().begin() == StringView{}.splitterOnWhitespaceWithoutEmptyParts().end());
+}
+
 void StringViewTest::partition() {
     /* Happy case */
     CORRADE_COMPARE_AS("ab=c"_s.partition('='),
@@ -1199,6 +1309,10 @@ void StringViewTest::trimmed() {
     CORRADE_COMPARE("oubya"_s.trimmedPrefix("aeiyou"), "bya");
     CORRADE_COMPARE("oubya"_s.trimmedSuffix("aeiyou"), "oub");
     CORRADE_COMPARE("oubya"_s.trimmed("aeiyou"), "b");
+
+    /* Characters with the highest bit set, and a null character */
+    CORRADE_COMPARE("\xff\x80\0a\x7f\xfe\x81"_s.trimmedPrefix("\xff\0\x80"_s), "a\x7f\xfe\x81");
+    CORRADE_COMPARE("\xff\x80\0a\x7f\xfe\x81"_s.trimmedSuffix("\x81\xfe\x7f"), "\xff\x80\0a"_s);
 }
 
 void StringViewTest::trimmedFlags() {
@@ -1423,6 +1537,41 @@ void StringViewTest::findEmpty() {
     }
 }
 
+void StringViewTest::findLong() {
+    /* The string is all 'a's, so the first and last character of "aba"
+       matches on every position, exercising the verification of the middle.
+       Going through sizes that cover the SIMD block sizes and the scalar
+       fallback for the remainder. */
+    for(std::size_t size: {3, 15, 16, 17, 18, 31, 32, 33, 34, 47, 64, 65, 66, 100}) {
+        CORRADE_ITERATION(size);
+
+        String data{Corrade::DirectInit, size, 'a'};
+        StringView a = data;
+        CORRADE_VERIFY(!a.contains("aba"));
+        CORRADE_VERIFY(!a.find("aba").data());
+
+        for(std::size_t i = 0; i != size - 2; ++i) {
+            CORRADE_ITERATION(i);
+
+            data[i + 1] = 'b';
+            CORRADE_VERIFY(a.contains("aba"));
+            StringView found = a.find("aba");
+            CORRADE_COMPARE(found, "aba");
+            CORRADE_COMPARE(static_cast<const void*>(found.data()), a.data() + i);
+
+            /* A two-character substring doesn't need any verification */
+            StringView foundTwo = a.find("ab");
+            CORRADE_COMPARE(foundTwo, "ab");
+            CORRADE_COMPARE(static_cast<const void*>(foundTwo.data()), a.data() + i);
+            data[i + 1] = 'a';
+        }
+
+        /* Substrings spanning the whole string or larger */
+        CORRADE_COMPARE(static_cast<const void*>(a.find(a).data()), a.data());
+        CORRADE_VERIFY(!a.prefix(size - 1).contains(a));
+    }
+}
+
 void StringViewTest::findFlags() {
     StringView a = "hello world"_s;
 
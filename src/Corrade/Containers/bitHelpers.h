@@ -0,0 +1,105 @@
+#ifndef Corrade_Containers_bitHelpers_h
+#define Corrade_Containers_bitHelpers_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdint>
+
+#include "Corrade/configure.h"
+
+#ifdef CORRADE_TARGET_MSVC
+#include <intrin.h>
+#endif
+
+/* Used by BigEnumSet and ObjectPool, which are header-only, and by the
+   BitArrayView and StringView implementations */
+
+namespace Corrade { namespace Containers { namespace Implementation {
+
+/* Index of the lowest set bit, the value is expected to be non-zero */
+inline unsigned trailingZeros(unsigned value) {
+    #ifdef CORRADE_TARGET_MSVC
+    unsigned long index;
+    _BitScanForward(&index, value);
+    return index;
+    #elif defined(CORRADE_TARGET_GCC)
+    return __builtin_ctz(value);
+    #else
+    unsigned index = 0;
+    while(!(value & 1)) {
+        value >>= 1;
+        ++index;
+    }
+    return index;
+    #endif
+}
+
+inline unsigned trailingZeros(unsigned long long value) {
+    #if defined(CORRADE_TARGET_GCC)
+    return __builtin_ctzll(value);
+    #else
+    const unsigned low = unsigned(value);
+    return low ? trailingZeros(low) : 32 + trailingZeros(unsigned(value >> 32));
+    #endif
+}
+
+/* Count of zero bits above the highest set bit of a 32-bit value, the value
+   is expected to be non-zero */
+inline unsigned leadingZeros(std::uint32_t value) {
+    #ifdef CORRADE_TARGET_MSVC
+    unsigned long index;
+    _BitScanReverse(&index, value);
+    return 31 - index;
+    #elif defined(CORRADE_TARGET_GCC)
+    return __builtin_clz(value);
+    #else
+    unsigned count = 0;
+    while(!(value & 0x80000000u)) {
+        value <<= 1;
+        ++count;
+    }
+    return count;
+    #endif
+}
+
+/* Count of set bits */
+inline unsigned popcount(std::uint64_t value) {
+    #if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_X86)
+    /* On ARM and elsewhere this compiles to a dedicated instruction. On x86
+       it'd be a libgcc call if POPCNT isn't enabled for the whole build,
+       which is slower than the code below. */
+    return __builtin_popcountll(value);
+    #else
+    value = value - ((value >> 1) & 0x5555555555555555ull);
+    value = (value & 0x3333333333333333ull) + ((value >> 2) & 0x3333333333333333ull);
+    value = (value + (value >> 4)) & 0x0f0f0f0f0f0f0f0full;
+    return (value*0x0101010101010101ull) >> 56;
+    #endif
+}
+
+}}}
+
+#endif
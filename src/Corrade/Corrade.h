@@ -747,6 +747,25 @@ the console. This is done automatically when you link to the
 */
 #define CORRADE_UTILITY_USE_ANSI_COLORS
 #undef CORRADE_UTILITY_USE_ANSI_COLORS
+
+/**
+@brief Use multiple threads in parallel algorithms
+@m_since_latest
+
+If defined, @ref Corrade::Utility::copyParallel() "Utility::copyParallel()",
+@ref Corrade::Utility::flipInPlaceParallel() "flipInPlaceParallel()",
+@ref Corrade::Utility::sortParallel() "sortParallel()",
+@ref Corrade::Utility::sortIndicesParallel() "sortIndicesParallel()" and
+@ref Corrade::Utility::Directory::hashFileChunked() "Directory::hashFileChunked()"
+split the work across multiple threads, otherwise everything is done on the
+calling thread. The @ref Corrade::Utility "Utility" library then depends on
+the system thread library. Not available on
+@ref CORRADE_TARGET_EMSCRIPTEN "Emscripten". Enabled using the
+`UTILITY_USE_THREADS` CMake option when building Corrade.
+@see @ref building-corrade, @ref corrade-cmake
+*/
+#define CORRADE_UTILITY_USE_THREADS
+#undef CORRADE_UTILITY_USE_THREADS
 #endif
 
 }
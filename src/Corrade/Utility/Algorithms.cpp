@@ -30,8 +30,58 @@
 /* CORRADE_FALLTHROUGH, needed on Clang when CORRADE_NO_ASSERT is defined */
 #include <Corrade/Utility/Macros.h>
 
+#ifdef CORRADE_TARGET_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Utility/Implementation/parallel.h"
+
 namespace Corrade { namespace Utility {
 
+namespace {
+
+/* Kernels for copying items of a fixed size, used for the common case of a
+   typed view where the last dimension is just the type itself. The memcpy()
+   has a compile-time size, which makes the compiler turn it into a single
+   (or, for 12 bytes, a pair of) unaligned load & store, compared to a
+   function call for each item with a runtime size. Unrolled four times to
+   give the CPU a few independent loads to work on in parallel, as the
+   strides usually make the prefetcher the bottleneck anyway. */
+template<std::size_t size> void copyItems(const char* src, char* dst, const std::size_t count, const std::ptrdiff_t srcStride, const std::ptrdiff_t dstStride) {
+    std::size_t i = 0;
+    for(const std::size_t max = count & ~std::size_t{3}; i != max; i += 4) {
+        char tmp[4][size];
+        std::memcpy(tmp[0], src, size);
+        std::memcpy(tmp[1], src + srcStride, size);
+        std::memcpy(tmp[2], src + 2*srcStride, size);
+        std::memcpy(tmp[3], src + 3*srcStride, size);
+        std::memcpy(dst, tmp[0], size);
+        std::memcpy(dst + dstStride, tmp[1], size);
+        std::memcpy(dst + 2*dstStride, tmp[2], size);
+        std::memcpy(dst + 3*dstStride, tmp[3], size);
+        src += 4*srcStride;
+        dst += 4*dstStride;
+    }
+    for(; i != count; ++i) {
+        std::memcpy(dst, src, size);
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+template<std::size_t size> void copyItems(const char* const srcPtr, char* const dstPtr, const std::size_t* const count, const std::ptrdiff_t* const srcStride, const std::ptrdiff_t* const dstStride) {
+    for(std::size_t i0 = 0; i0 != count[0]; ++i0) {
+        const char* srcPtr0 = srcPtr + i0*srcStride[0];
+        char* dstPtr0 = dstPtr + i0*dstStride[0];
+        for(std::size_t i1 = 0; i1 != count[1]; ++i1)
+            copyItems<size>(srcPtr0 + i1*srcStride[1],
+                            dstPtr0 + i1*dstStride[1],
+                            count[2], srcStride[2], dstStride[2]);
+    }
+}
+}
+
 /* I might be going a bit overboard with the avoidance of inline function calls
    in Debug -- should revisit with a clearer mind later.
 
@@ -166,6 +216,32 @@ void copy(const Containers::StridedArrayView4D<const char>& src, const Container
                         std::memcpy(dstPtr0 + i1*dstStride[1],
                                     srcPtr0 + i1*srcStride[1], size23);
                 }
+            } else if(src.isContiguous<3>() && dst.isContiguous<3>() && (
+                size[3] == 1 || size[3] == 2 || size[3] == 4 ||
+                size[3] == 8 || size[3] == 12 || size[3] == 16))
+            {
+                /* Item sizes corresponding to builtin types and 2-, 3- and
+                   4-component vectors of them, where the per-item copy
+                   overhead dominates. For these there's a dedicated kernel
+                   with a compile-time item size. Numbers for
+                   copyBenchmark3DNonContiguous() on GCC 11, x86-64, in µs
+                   (including filling the source data):
+
+                    bytes   generic kernel
+                    ------- ------- ------
+                    1B      44.8    25.3
+                    4B      38.3    18.2
+                    8B      19.5    10.1
+                    16B     16.3     6.4 */
+                switch(size[3]) {
+                    case 1: return copyItems<1>(srcPtr, dstPtr, size, srcStride, dstStride);
+                    case 2: return copyItems<2>(srcPtr, dstPtr, size, srcStride, dstStride);
+                    case 4: return copyItems<4>(srcPtr, dstPtr, size, srcStride, dstStride);
+                    case 8: return copyItems<8>(srcPtr, dstPtr, size, srcStride, dstStride);
+                    case 12: return copyItems<12>(srcPtr, dstPtr, size, srcStride, dstStride);
+                    case 16: return copyItems<16>(srcPtr, dstPtr, size, srcStride, dstStride);
+                }
+                CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
             } else {
                 /* On Clang, for smaller sizes in the last dimension we prefer
                    Duff's device. The size is chosen based on the benchmark in
@@ -180,7 +256,8 @@ void copy(const Containers::StridedArrayView4D<const char>& src, const Container
 
                    It becomes slightly worse in Debug (but not slower than a
                    hand-written loop using operator[], so I think that's still
-                   acceptable). OTOH, GCC is slower with Duff in both Debug and Release, so there we use the loop instead. */
+                   acceptable). OTOH, GCC is slower with Duff in both Debug
+                   and Release, so there we use the loop instead. */
                 if(src.isContiguous<3>() && dst.isContiguous<3>() && size[3] >= 8) {
                     for(std::size_t i0 = 0; i0 != size[0]; ++i0) {
                         const char* srcPtr0 = srcPtr + i0*srcStride[0];
@@ -254,6 +331,375 @@ void copy(const Containers::StridedArrayView4D<const char>& src, const Container
     }
 }
 
+void copyParallel(const Containers::ArrayView<const void>& src, const Containers::ArrayView<void>& dst, const std::size_t threadCount) {
+    const std::size_t srcSize = src.size();
+    #ifndef CORRADE_NO_ASSERT
+    const std::size_t dstSize = dst.size();
+    #endif
+    CORRADE_ASSERT(srcSize == dstSize,
+        "Utility::Algorithms::copyParallel(): sizes" << srcSize << "and" << dstSize << "don't match", );
+
+    const std::size_t chunkCount = Implementation::parallelChunkCount(threadCount, srcSize, srcSize);
+    if(chunkCount == 1) return copy(src, dst);
+
+    const char* const srcPtr = static_cast<const char*>(src.data());
+    char* const dstPtr = static_cast<char*>(dst.data());
+    Implementation::parallelFor(srcSize, chunkCount, [srcPtr, dstPtr](const std::size_t begin, const std::size_t end) {
+        std::memcpy(dstPtr + begin, srcPtr + begin, end - begin);
+    });
+}
+
+void copyParallel(const Containers::StridedArrayView1D<const char>& src, const Containers::StridedArrayView1D<char>& dst, const std::size_t threadCount) {
+    const std::size_t srcSize = src.size();
+    #ifndef CORRADE_NO_ASSERT
+    const std::size_t dstSize = dst.size();
+    #endif
+    CORRADE_ASSERT(srcSize == dstSize,
+        "Utility::Algorithms::copyParallel(): sizes" << srcSize << "and" << dstSize << "don't match", );
+
+    const std::ptrdiff_t srcStride = src.stride();
+    const std::ptrdiff_t dstStride = dst.stride();
+    return copyParallel(Containers::StridedArrayView4D<const char>{
+            {static_cast<const char*>(src.data()), ~std::size_t{}},
+            {1, 1, 1, srcSize},
+            {srcStride, srcStride, srcStride, srcStride}},
+        Containers::StridedArrayView4D<char>{
+            {static_cast<char*>(dst.data()), ~std::size_t{}},
+            {1, 1, 1, srcSize},
+            {dstStride, dstStride, dstStride, dstStride}}, threadCount);
+}
+
+void copyParallel(const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView2D<char>& dst, const std::size_t threadCount) {
+    const Containers::StridedDimensions<2, std::size_t> srcSize = src.size();
+    #ifndef CORRADE_NO_ASSERT
+    const Containers::StridedDimensions<2, std::size_t> dstSize = dst.size();
+    #endif
+    CORRADE_ASSERT(srcSize == dstSize,
+        "Utility::Algorithms::copyParallel(): sizes" << srcSize << "and" << dstSize << "don't match", );
+
+    const std::size_t* const size = srcSize.begin();
+    const std::ptrdiff_t* const srcStride = src.stride().begin();
+    const std::ptrdiff_t* const dstStride = dst.stride().begin();
+    return copyParallel(Containers::StridedArrayView4D<const char>{
+            {static_cast<const char*>(src.data()), ~std::size_t{}},
+            {1, 1, size[0], size[1]},
+            {srcStride[0], srcStride[0], srcStride[0], srcStride[1]}},
+        Containers::StridedArrayView4D<char>{
+            {static_cast<char*>(dst.data()), ~std::size_t{}},
+            {1, 1, size[0], size[1]},
+            {dstStride[0], dstStride[0], dstStride[0], dstStride[1]}}, threadCount);
+}
+
+void copyParallel(const Containers::StridedArrayView3D<const char>& src, const Containers::StridedArrayView3D<char>& dst, const std::size_t threadCount) {
+    const Containers::StridedDimensions<3, std::size_t> srcSize = src.size();
+    #ifndef CORRADE_NO_ASSERT
+    const Containers::StridedDimensions<3, std::size_t> dstSize = dst.size();
+    #endif
+    CORRADE_ASSERT(srcSize == dstSize,
+        "Utility::Algorithms::copyParallel(): sizes" << srcSize << "and" << dstSize << "don't match", );
+
+    const std::size_t* const size = srcSize.begin();
+    const std::ptrdiff_t* const srcStride = src.stride().begin();
+    const std::ptrdiff_t* const dstStride = dst.stride().begin();
+    return copyParallel(Containers::StridedArrayView4D<const char>{
+            {static_cast<const char*>(src.data()), ~std::size_t{}},
+            {1, size[0], size[1], size[2]},
+            {srcStride[0], srcStride[0], srcStride[1], srcStride[2]}},
+        Containers::StridedArrayView4D<char>{
+            {static_cast<char*>(dst.data()), ~std::size_t{}},
+            {1, size[0], size[1], size[2]},
+            {dstStride[0], dstStride[0], dstStride[1], dstStride[2]}}, threadCount);
+}
+
+void copyParallel(const Containers::StridedArrayView4D<const char>& src, const Containers::StridedArrayView4D<char>& dst, const std::size_t threadCount) {
+    const Containers::StridedDimensions<4, std::size_t> srcSize = src.size();
+    #ifndef CORRADE_NO_ASSERT
+    const Containers::StridedDimensions<4, std::size_t> dstSize = dst.size();
+    #endif
+    CORRADE_ASSERT(srcSize == dstSize,
+        "Utility::Algorithms::copyParallel(): sizes" << srcSize << "and" << dstSize << "don't match", );
+
+    /* Split the first dimension that has more than one item. The 1D/2D/3D
+       variants above pad the front with dimensions of size 1, so this is the
+       outermost dimension of the original view. */
+    const std::size_t* const size = srcSize.begin();
+    std::size_t dimension = 0;
+    while(dimension != 3 && size[dimension] == 1) ++dimension;
+
+    const std::size_t chunkCount = Implementation::parallelChunkCount(threadCount, size[dimension], size[0]*size[1]*size[2]*size[3]);
+    if(chunkCount == 1) return copy(src, dst);
+
+    const Containers::StridedDimensions<4, std::ptrdiff_t> srcStride = src.stride();
+    const Containers::StridedDimensions<4, std::ptrdiff_t> dstStride = dst.stride();
+    const char* const srcPtr = static_cast<const char*>(src.data());
+    char* const dstPtr = static_cast<char*>(dst.data());
+    Implementation::parallelFor(size[dimension], chunkCount, [&](const std::size_t begin, const std::size_t end) {
+        Containers::StridedDimensions<4, std::size_t> chunkSize = srcSize;
+        chunkSize[dimension] = end - begin;
+        /* Using ~std::size_t{} for arrayview size as a shortcut -- there
+           it's just for the size assert anyway */
+        copy(Containers::StridedArrayView4D<const char>{
+                {srcPtr + std::ptrdiff_t(begin)*srcStride[dimension], ~std::size_t{}},
+                chunkSize, srcStride},
+            Containers::StridedArrayView4D<char>{
+                {dstPtr + std::ptrdiff_t(begin)*dstStride[dimension], ~std::size_t{}},
+                chunkSize, dstStride});
+    });
+}
+
+namespace {
+
+/* Tile size in items. With 8-byte items a 32x32 tile of both the source and
+   the destination is 16 kB, fitting into the L1 cache even on older CPUs,
+   and all SIMD block sizes below divide it. Compared to
+   copy(src.transposed<0, 1>(), dst) on a 4096x4096 matrix (GCC 12, Release,
+   x86-64 with SSE2 only):
+
+    1B  197.0 ms -> 28.5 ms
+    2B  229.3 ms -> 38.8 ms
+    4B  238.4 ms -> 70.1 ms
+    8B  303.8 ms -> 117.6 ms */
+constexpr std::size_t TransposeTileSize = 32;
+
+/* Scalar transpose of a rows x cols block, with a compile-time item size for
+   the common cases */
+template<std::size_t size> void transposeBlockScalar(const char* const src, char* const dst, const std::size_t rows, const std::size_t cols, const std::ptrdiff_t srcRowStride, const std::ptrdiff_t srcItemStride, const std::ptrdiff_t dstRowStride, const std::ptrdiff_t dstItemStride) {
+    for(std::size_t i = 0; i != rows; ++i) {
+        const char* srcItem = src + std::ptrdiff_t(i)*srcRowStride;
+        char* dstItem = dst + std::ptrdiff_t(i)*dstItemStride;
+        for(std::size_t j = 0; j != cols; ++j) {
+            std::memcpy(dstItem, srcItem, size);
+            srcItem += srcItemStride;
+            dstItem += dstRowStride;
+        }
+    }
+}
+
+void transposeBlockScalarAnySize(const char* const src, char* const dst, const std::size_t rows, const std::size_t cols, const std::ptrdiff_t srcRowStride, const std::ptrdiff_t srcItemStride, const std::ptrdiff_t dstRowStride, const std::ptrdiff_t dstItemStride, const std::size_t size) {
+    for(std::size_t i = 0; i != rows; ++i) {
+        const char* srcItem = src + std::ptrdiff_t(i)*srcRowStride;
+        char* dstItem = dst + std::ptrdiff_t(i)*dstItemStride;
+        for(std::size_t j = 0; j != cols; ++j) {
+            std::memcpy(dstItem, srcItem, size);
+            srcItem += srcItemStride;
+            dstItem += dstRowStride;
+        }
+    }
+}
+
+#ifdef CORRADE_TARGET_SSE2
+/* SIMD kernels transposing a single BlockSize x BlockSize block, items in
+   each row being contiguous. All of them are a sequence of unpacks that
+   interleave pairs of rows with progressively larger granularity. */
+template<std::size_t size> struct TransposeKernel;
+
+template<> struct TransposeKernel<1> {
+    enum: std::size_t { BlockSize = 8 };
+
+    static void transpose(const char* const src, char* const dst, const std::ptrdiff_t srcRowStride, const std::ptrdiff_t dstRowStride) {
+        const __m128i r0 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + 0*srcRowStride));
+        const __m128i r1 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + 1*srcRowStride));
+        const __m128i r2 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + 2*srcRowStride));
+        const __m128i r3 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + 3*srcRowStride));
+        const __m128i r4 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + 4*srcRowStride));
+        const __m128i r5 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + 5*srcRowStride));
+        const __m128i r6 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + 6*srcRowStride));
+        const __m128i r7 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + 7*srcRowStride));
+
+        /* a0 b0 a1 b1 ... a7 b7 */
+        const __m128i t0 = _mm_unpacklo_epi8(r0, r1);
+        const __m128i t1 = _mm_unpacklo_epi8(r2, r3);
+        const __m128i t2 = _mm_unpacklo_epi8(r4, r5);
+        const __m128i t3 = _mm_unpacklo_epi8(r6, r7);
+        /* a0 b0 c0 d0 a1 b1 c1 d1 ... a3 b3 c3 d3 */
+        const __m128i u0 = _mm_unpacklo_epi16(t0, t1);
+        const __m128i u1 = _mm_unpackhi_epi16(t0, t1);
+        const __m128i u2 = _mm_unpacklo_epi16(t2, t3);
+        const __m128i u3 = _mm_unpackhi_epi16(t2, t3);
+        /* a0 b0 c0 d0 e0 f0 g0 h0 a1 b1 c1 d1 e1 f1 g1 h1 */
+        const __m128i v0 = _mm_unpacklo_epi32(u0, u2);
+        const __m128i v1 = _mm_unpackhi_epi32(u0, u2);
+        const __m128i v2 = _mm_unpacklo_epi32(u1, u3);
+        const __m128i v3 = _mm_unpackhi_epi32(u1, u3);
+
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + 0*dstRowStride), v0);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + 1*dstRowStride), _mm_unpackhi_epi64(v0, v0));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + 2*dstRowStride), v1);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + 3*dstRowStride), _mm_unpackhi_epi64(v1, v1));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + 4*dstRowStride), v2);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + 5*dstRowStride), _mm_unpackhi_epi64(v2, v2));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + 6*dstRowStride), v3);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + 7*dstRowStride), _mm_unpackhi_epi64(v3, v3));
+    }
+};
+
+template<> struct TransposeKernel<2> {
+    enum: std::size_t { BlockSize = 8 };
+
+    static void transpose(const char* const src, char* const dst, const std::ptrdiff_t srcRowStride, const std::ptrdiff_t dstRowStride) {
+        const __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 0*srcRowStride));
+        const __m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 1*srcRowStride));
+        const __m128i r2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2*srcRowStride));
+        const __m128i r3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 3*srcRowStride));
+        const __m128i r4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 4*srcRowStride));
+        const __m128i r5 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 5*srcRowStride));
+        const __m128i r6 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 6*srcRowStride));
+        const __m128i r7 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 7*srcRowStride));
+
+        /* a0 b0 a1 b1 a2 b2 a3 b3, a4 b4 ... a7 b7 */
+        const __m128i t0 = _mm_unpacklo_epi16(r0, r1);
+        const __m128i t1 = _mm_unpackhi_epi16(r0, r1);
+        const __m128i t2 = _mm_unpacklo_epi16(r2, r3);
+        const __m128i t3 = _mm_unpackhi_epi16(r2, r3);
+        const __m128i t4 = _mm_unpacklo_epi16(r4, r5);
+        const __m128i t5 = _mm_unpackhi_epi16(r4, r5);
+        const __m128i t6 = _mm_unpacklo_epi16(r6, r7);
+        const __m128i t7 = _mm_unpackhi_epi16(r6, r7);
+        /* a0 b0 c0 d0 a1 b1 c1 d1, ... */
+        const __m128i u0 = _mm_unpacklo_epi32(t0, t2);
+        const __m128i u1 = _mm_unpackhi_epi32(t0, t2);
+        const __m128i u2 = _mm_unpacklo_epi32(t1, t3);
+        const __m128i u3 = _mm_unpackhi_epi32(t1, t3);
+        const __m128i u4 = _mm_unpacklo_epi32(t4, t6);
+        const __m128i u5 = _mm_unpackhi_epi32(t4, t6);
+        const __m128i u6 = _mm_unpacklo_epi32(t5, t7);
+        const __m128i u7 = _mm_unpackhi_epi32(t5, t7);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 0*dstRowStride), _mm_unpacklo_epi64(u0, u4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 1*dstRowStride), _mm_unpackhi_epi64(u0, u4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 2*dstRowStride), _mm_unpacklo_epi64(u1, u5));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 3*dstRowStride), _mm_unpackhi_epi64(u1, u5));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4*dstRowStride), _mm_unpacklo_epi64(u2, u6));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 5*dstRowStride), _mm_unpackhi_epi64(u2, u6));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 6*dstRowStride), _mm_unpacklo_epi64(u3, u7));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 7*dstRowStride), _mm_unpackhi_epi64(u3, u7));
+    }
+};
+
+template<> struct TransposeKernel<4> {
+    enum: std::size_t { BlockSize = 4 };
+
+    static void transpose(const char* const src, char* const dst, const std::ptrdiff_t srcRowStride, const std::ptrdiff_t dstRowStride) {
+        const __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 0*srcRowStride));
+        const __m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 1*srcRowStride));
+        const __m128i r2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2*srcRowStride));
+        const __m128i r3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 3*srcRowStride));
+
+        /* a0 b0 a1 b1, a2 b2 a3 b3 */
+        const __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+        const __m128i t1 = _mm_unpacklo_epi32(r2, r3);
+        const __m128i t2 = _mm_unpackhi_epi32(r0, r1);
+        const __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 0*dstRowStride), _mm_unpacklo_epi64(t0, t1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 1*dstRowStride), _mm_unpackhi_epi64(t0, t1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 2*dstRowStride), _mm_unpacklo_epi64(t2, t3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 3*dstRowStride), _mm_unpackhi_epi64(t2, t3));
+    }
+};
+
+template<> struct TransposeKernel<8> {
+    enum: std::size_t { BlockSize = 2 };
+
+    static void transpose(const char* const src, char* const dst, const std::ptrdiff_t srcRowStride, const std::ptrdiff_t dstRowStride) {
+        const __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 0*srcRowStride));
+        const __m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 1*srcRowStride));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 0*dstRowStride), _mm_unpacklo_epi64(r0, r1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 1*dstRowStride), _mm_unpackhi_epi64(r0, r1));
+    }
+};
+
+/* Transposes full blocks with the SIMD kernel and the remaining edges with
+   the scalar variant. Expects items in rows of both views to be
+   contiguous. */
+template<std::size_t size> void transposeBlockSimd(const char* const src, char* const dst, const std::size_t rows, const std::size_t cols, const std::ptrdiff_t srcRowStride, const std::ptrdiff_t dstRowStride) {
+    constexpr std::size_t BlockSize = TransposeKernel<size>::BlockSize;
+    const std::size_t fullRows = rows - rows%BlockSize;
+    const std::size_t fullCols = cols - cols%BlockSize;
+    for(std::size_t i = 0; i != fullRows; i += BlockSize)
+        for(std::size_t j = 0; j != fullCols; j += BlockSize)
+            TransposeKernel<size>::transpose(
+                src + std::ptrdiff_t(i)*srcRowStride + j*size,
+                dst + std::ptrdiff_t(j)*dstRowStride + i*size,
+                srcRowStride, dstRowStride);
+
+    /* Right edge of the full rows, then the bottom rows */
+    transposeBlockScalar<size>(src + fullCols*size, dst + std::ptrdiff_t(fullCols)*dstRowStride, fullRows, cols - fullCols, srcRowStride, size, dstRowStride, size);
+    transposeBlockScalar<size>(src + std::ptrdiff_t(fullRows)*srcRowStride, dst + fullRows*size, rows - fullRows, cols, srcRowStride, size, dstRowStride, size);
+}
+#endif
+
+/* Goes through the views in tiles and calls the block transpose on each */
+template<class F> void transposeTiled(const char* const src, char* const dst, const std::size_t rows, const std::size_t cols, const std::ptrdiff_t srcRowStride, const std::ptrdiff_t srcItemStride, const std::ptrdiff_t dstRowStride, const std::ptrdiff_t dstItemStride, const F& function) {
+    for(std::size_t i = 0; i < rows; i += TransposeTileSize) {
+        const std::size_t tileRows = rows - i < TransposeTileSize ? rows - i : TransposeTileSize;
+        for(std::size_t j = 0; j < cols; j += TransposeTileSize) {
+            const std::size_t tileCols = cols - j < TransposeTileSize ? cols - j : TransposeTileSize;
+            function(src + std::ptrdiff_t(i)*srcRowStride + std::ptrdiff_t(j)*srcItemStride,
+                     dst + std::ptrdiff_t(j)*dstRowStride + std::ptrdiff_t(i)*dstItemStride,
+                     tileRows, tileCols);
+        }
+    }
+}
+
+}
+
+void transposeInto(const Containers::StridedArrayView3D<const char>& src, const Containers::StridedArrayView3D<char>& dst) {
+    const Containers::StridedDimensions<3, std::size_t> srcSize = src.size();
+    const Containers::StridedDimensions<3, std::size_t> dstSize = dst.size();
+    CORRADE_ASSERT(srcSize[0] == dstSize[1] && srcSize[1] == dstSize[0] && srcSize[2] == dstSize[2],
+        "Utility::transposeInto(): can't transpose" << srcSize << "into" << dstSize, );
+    CORRADE_ASSERT(src.isContiguous<2>() && dst.isContiguous<2>(),
+        "Utility::transposeInto(): last view dimension is not contiguous", );
+
+    const std::size_t rows = srcSize[0];
+    const std::size_t cols = srcSize[1];
+    const std::size_t size = srcSize[2];
+    if(!rows || !cols || !size) return;
+
+    const char* const srcPtr = static_cast<const char*>(src.data());
+    char* const dstPtr = static_cast<char*>(dst.data());
+    const std::ptrdiff_t srcRowStride = src.stride()[0];
+    const std::ptrdiff_t srcItemStride = src.stride()[1];
+    const std::ptrdiff_t dstRowStride = dst.stride()[0];
+    const std::ptrdiff_t dstItemStride = dst.stride()[1];
+
+    #ifdef CORRADE_TARGET_SSE2
+    if(srcItemStride == std::ptrdiff_t(size) && dstItemStride == std::ptrdiff_t(size)) {
+        #define _c(size)                                                    \
+            case size: return transposeTiled(srcPtr, dstPtr, rows, cols, srcRowStride, srcItemStride, dstRowStride, dstItemStride, [&](const char* src, char* dst, std::size_t tileRows, std::size_t tileCols) { \
+                transposeBlockSimd<size>(src, dst, tileRows, tileCols, srcRowStride, dstRowStride); \
+            });
+        switch(size) {
+            _c(1)
+            _c(2)
+            _c(4)
+            _c(8)
+        }
+        #undef _c
+    }
+    #endif
+
+    #define _c(size)                                                        \
+        case size: return transposeTiled(srcPtr, dstPtr, rows, cols, srcRowStride, srcItemStride, dstRowStride, dstItemStride, [&](const char* src, char* dst, std::size_t tileRows, std::size_t tileCols) { \
+            transposeBlockScalar<size>(src, dst, tileRows, tileCols, srcRowStride, srcItemStride, dstRowStride, dstItemStride); \
+        });
+    switch(size) {
+        _c(1)
+        _c(2)
+        _c(4)
+        _c(8)
+        _c(12)
+        _c(16)
+    }
+    #undef _c
+
+    transposeTiled(srcPtr, dstPtr, rows, cols, srcRowStride, srcItemStride, dstRowStride, dstItemStride, [&](const char* src, char* dst, std::size_t tileRows, std::size_t tileCols) {
+        transposeBlockScalarAnySize(src, dst, tileRows, tileCols, srcRowStride, srcItemStride, dstRowStride, dstItemStride, size);
+    });
+}
+
 namespace Implementation {
 
 void flipSecondToLastDimensionInPlace(const Containers::StridedArrayView2D<char>& view) {
@@ -280,11 +726,11 @@ void flipSecondToLastDimensionInPlace(const Containers::StridedArrayView3D<char>
     });
 }
 
-void flipSecondToLastDimensionInPlace(const Containers::StridedArrayView4D<char>& view) {
-    /* Should have been checked by flipInPlace() already, just verifying that
-       all the bubbling back to four dimensions went correct */
-    CORRADE_INTERNAL_ASSERT(view.isContiguous<3>());
+namespace {
 
+/* Flips items [pairBegin, pairEnd) in the third dimension with their
+   counterparts in the other half */
+void flipSecondToLastDimensionInPlace(const Containers::StridedArrayView4D<char>& view, const std::size_t pairBegin, const std::size_t pairEnd) {
     auto* const ptr = static_cast<char*>(view.data());
     const std::size_t* size = view.size().begin();
     const std::ptrdiff_t* stride = view.stride().begin();
@@ -294,9 +740,9 @@ void flipSecondToLastDimensionInPlace(const Containers::StridedArrayView4D<char>
         for(std::size_t i1 = 0; i1 != size[1]; ++i1) {
             char* const ptr1 = ptr0 + i1*stride[1];
 
-            /* Go through half of the items in third dimension and flip them
-               with the other half */
-            for(std::size_t i2 = 0, i2Max = size[2]/2; i2 != i2Max; ++i2) {
+            /* Go through given range of the first half of the items in third
+               dimension and flip them with the other half */
+            for(std::size_t i2 = pairBegin; i2 != pairEnd; ++i2) {
                 char* const ptr2Left = ptr1 + i2*stride[2];
                 char* const ptr2Right = ptr1 + (size[2] - i2 - 1)*stride[2];
 
@@ -329,4 +775,353 @@ void flipSecondToLastDimensionInPlace(const Containers::StridedArrayView4D<char>
 
 }
 
+void flipSecondToLastDimensionInPlace(const Containers::StridedArrayView4D<char>& view) {
+    /* Should have been checked by flipInPlace() already, just verifying that
+       all the bubbling back to four dimensions went correct */
+    CORRADE_INTERNAL_ASSERT(view.isContiguous<3>());
+
+    flipSecondToLastDimensionInPlace(view, 0, view.size()[2]/2);
+}
+
+void flipSecondToLastDimensionInPlaceParallel(const Containers::StridedArrayView2D<char>& view, const std::size_t threadCount) {
+    const std::size_t* size = view.size().begin();
+    const std::ptrdiff_t* stride = view.stride().begin();
+    /* Using ~std::size_t{} for arrayview size as a shortcut -- there it's just
+       for the size assert anyway */
+    return flipSecondToLastDimensionInPlaceParallel(Containers::StridedArrayView4D<char>{
+        {static_cast<char*>(view.data()), ~std::size_t{}},
+        {1, 1, size[0], size[1]},
+        {stride[0], stride[0], stride[0], stride[1]}
+    }, threadCount);
+}
+
+void flipSecondToLastDimensionInPlaceParallel(const Containers::StridedArrayView3D<char>& view, const std::size_t threadCount) {
+    const std::size_t* size = view.size().begin();
+    const std::ptrdiff_t* stride = view.stride().begin();
+    /* Using ~std::size_t{} for arrayview size as a shortcut -- there it's just
+       for the size assert anyway */
+    return flipSecondToLastDimensionInPlaceParallel(Containers::StridedArrayView4D<char>{
+        {static_cast<char*>(view.data()), ~std::size_t{}},
+        {1, size[0], size[1], size[2]},
+        {stride[0], stride[0], stride[1], stride[2]}
+    }, threadCount);
+}
+
+void flipSecondToLastDimensionInPlaceParallel(const Containers::StridedArrayView4D<char>& view, const std::size_t threadCount) {
+    /* Should have been checked by flipInPlaceParallel() already */
+    CORRADE_INTERNAL_ASSERT(view.isContiguous<3>());
+
+    const Containers::StridedDimensions<4, std::size_t> viewSize = view.size();
+    const std::size_t* const size = viewSize.begin();
+    const std::size_t pairCount = size[2]/2;
+
+    /* Split the first of the outer dimensions that has more than one item.
+       If there's none (which is the case for example when flipping an image
+       vertically), split the item pairs in the flipped dimension instead. */
+    std::size_t dimension = 0;
+    while(dimension != 2 && size[dimension] == 1) ++dimension;
+    const std::size_t splitSize = dimension == 2 ? pairCount : size[dimension];
+
+    const std::size_t chunkCount = Implementation::parallelChunkCount(threadCount, splitSize, size[0]*size[1]*size[2]*size[3]);
+    if(chunkCount == 1)
+        return flipSecondToLastDimensionInPlace(view, 0, pairCount);
+
+    if(dimension == 2) Implementation::parallelFor(pairCount, chunkCount, [&view](const std::size_t begin, const std::size_t end) {
+        flipSecondToLastDimensionInPlace(view, begin, end);
+    });
+    else {
+        const Containers::StridedDimensions<4, std::ptrdiff_t> stride = view.stride();
+        char* const ptr = static_cast<char*>(view.data());
+        Implementation::parallelFor(splitSize, chunkCount, [&](const std::size_t begin, const std::size_t end) {
+            Containers::StridedDimensions<4, std::size_t> chunkSize = viewSize;
+            chunkSize[dimension] = end - begin;
+            /* Using ~std::size_t{} for arrayview size as a shortcut -- there
+               it's just for the size assert anyway */
+            flipSecondToLastDimensionInPlace(Containers::StridedArrayView4D<char>{
+                {ptr + std::ptrdiff_t(begin)*stride[dimension], ~std::size_t{}},
+                chunkSize, stride}, 0, pairCount);
+        });
+    }
+}
+
+}
+
+namespace {
+
+template<class U> constexpr U sortSignBit() { return U(U(1) << (sizeof(U)*8 - 1)); }
+
+/* Maps the keys to unsigned integers that sort in the same order and back.
+   For two's complement signed integers it's enough to flip the sign bit,
+   floats are sign-magnitude so for negative values all other bits have to
+   be flipped as well. */
+template<class U, Implementation::SortKeyType> struct SortKeyTraits;
+template<class U> struct SortKeyTraits<U, Implementation::SortKeyType::Unsigned> {
+    static U to(U key) { return key; }
+    static U from(U key) { return key; }
+};
+template<class U> struct SortKeyTraits<U, Implementation::SortKeyType::Signed> {
+    static U to(U key) { return U(key ^ sortSignBit<U>()); }
+    static U from(U key) { return U(key ^ sortSignBit<U>()); }
+};
+template<class U> struct SortKeyTraits<U, Implementation::SortKeyType::Float> {
+    static U to(U key) { return key & sortSignBit<U>() ? U(~key) : U(key | sortSignBit<U>()); }
+    static U from(U key) { return key & sortSignBit<U>() ? U(key ^ sortSignBit<U>()) : U(~key); }
+};
+
+/* LSD radix sort, 8 bits in each pass. If values is not null, they're
+   permuted together with the keys. The scratch arrays are expected to have
+   the same size as the inputs. Returns true if the result ended up in the
+   scratch arrays and false if in the original ones. */
+template<class U> bool radixSort(U* keys, U* keysScratch, std::uint32_t* values, std::uint32_t* valuesScratch, const std::size_t size) {
+    if(!size) return false;
+
+    /* Histograms for all passes are calculated in a single go over the
+       data */
+    constexpr std::size_t Passes = sizeof(U);
+    std::size_t histogram[Passes][256]{};
+    for(std::size_t i = 0; i != size; ++i) {
+        const U key = keys[i];
+        for(std::size_t pass = 0; pass != Passes; ++pass)
+            ++histogram[pass][(key >> pass*8) & 0xff];
+    }
+
+    bool swapped = false;
+    for(std::size_t pass = 0; pass != Passes; ++pass) {
+        std::size_t* const offsets = histogram[pass];
+        const std::size_t shift = pass*8;
+
+        /* If all keys have the same digit, the pass wouldn't change
+           anything */
+        if(offsets[(keys[0] >> shift) & 0xff] == size) continue;
+
+        std::size_t offset = 0;
+        for(std::size_t i = 0; i != 256; ++i) {
+            const std::size_t count = offsets[i];
+            offsets[i] = offset;
+            offset += count;
+        }
+
+        if(values) for(std::size_t i = 0; i != size; ++i) {
+            const U key = keys[i];
+            std::size_t& position = offsets[(key >> shift) & 0xff];
+            keysScratch[position] = key;
+            valuesScratch[position] = values[i];
+            ++position;
+        } else for(std::size_t i = 0; i != size; ++i) {
+            const U key = keys[i];
+            keysScratch[offsets[(key >> shift) & 0xff]++] = key;
+        }
+
+        U* const keysTmp = keys;
+        keys = keysScratch;
+        keysScratch = keysTmp;
+        std::uint32_t* const valuesTmp = values;
+        values = valuesScratch;
+        valuesScratch = valuesTmp;
+        swapped = !swapped;
+    }
+
+    return swapped;
+}
+
+/* Returns how many items of a are among the first count items of a stable
+   merge of a and b, i.e. a co-rank of the two inputs */
+template<class U> std::size_t mergeSplit(const U* const a, const std::size_t aSize, const U* const b, const std::size_t bSize, const std::size_t count) {
+    std::size_t min = count > bSize ? count - bSize : 0;
+    std::size_t max = count < aSize ? count : aSize;
+    while(min < max) {
+        const std::size_t i = min + (max - min)/2;
+        /* Equal items from a go first */
+        if(a[i] <= b[count - i - 1]) min = i + 1;
+        else max = i;
+    }
+    return min;
+}
+
+/* Merges items [begin, end) of a stable merge of a and b into out, which
+   points to the first item of the whole merge output */
+template<class U> void mergeRange(const U* const aKeys, const std::uint32_t* const aValues, const std::size_t aSize, const U* const bKeys, const std::uint32_t* const bValues, const std::size_t bSize, U* const outKeys, std::uint32_t* const outValues, const std::size_t begin, const std::size_t end) {
+    std::size_t i = mergeSplit(aKeys, aSize, bKeys, bSize, begin);
+    std::size_t j = begin - i;
+    const std::size_t iEnd = mergeSplit(aKeys, aSize, bKeys, bSize, end);
+    const std::size_t jEnd = end - iEnd;
+
+    std::size_t out = begin;
+    while(i != iEnd && j != jEnd) {
+        if(bKeys[j] < aKeys[i]) {
+            if(outValues) outValues[out] = bValues[j];
+            outKeys[out++] = bKeys[j++];
+        } else {
+            if(outValues) outValues[out] = aValues[i];
+            outKeys[out++] = aKeys[i++];
+        }
+    }
+    std::memcpy(outKeys + out, aKeys + i, (iEnd - i)*sizeof(U));
+    std::memcpy(outKeys + out + iEnd - i, bKeys + j, (jEnd - j)*sizeof(U));
+    if(outValues) {
+        std::memcpy(outValues + out, aValues + i, (iEnd - i)*sizeof(std::uint32_t));
+        std::memcpy(outValues + out + iEnd - i, bValues + j, (jEnd - j)*sizeof(std::uint32_t));
+    }
+}
+
+/* Radix-sorts chunkCount chunks of the input in parallel and then merges
+   them together, with each merge pass again split into chunkCount pieces.
+   Returns true if the result ended up in the scratch arrays and false if in
+   the original ones. */
+template<class U> bool sortChunked(U* keys, U* keysScratch, std::uint32_t* values, std::uint32_t* valuesScratch, const std::size_t size, const std::size_t chunkCount) {
+    if(chunkCount == 1)
+        return radixSort(keys, keysScratch, values, valuesScratch, size);
+
+    /* Sort the chunks, putting the result always into the original arrays so
+       all chunks are in the same place for the merge */
+    Implementation::parallelFor(size, chunkCount, [&](const std::size_t begin, const std::size_t end) {
+        if(!radixSort(keys + begin, keysScratch + begin, values ? values + begin : nullptr, values ? valuesScratch + begin : nullptr, end - begin))
+            return;
+        std::memcpy(keys + begin, keysScratch + begin, (end - begin)*sizeof(U));
+        if(values)
+            std::memcpy(values + begin, valuesScratch + begin, (end - begin)*sizeof(std::uint32_t));
+    });
+
+    /* Run boundaries, initially the same as the chunks in parallelFor() */
+    Containers::Array<std::size_t> runs{NoInit, chunkCount + 1};
+    for(std::size_t i = 0; i <= chunkCount; ++i)
+        runs[i] = i*size/chunkCount;
+
+    bool swapped = false;
+    for(std::size_t runCount = chunkCount; runCount > 1; runCount = (runCount + 1)/2) {
+        const std::size_t pairCount = runCount/2;
+        const std::size_t piecesPerPair = (chunkCount + pairCount - 1)/pairCount;
+        Implementation::parallelFor(pairCount*piecesPerPair, chunkCount, [&](const std::size_t begin, const std::size_t end) {
+            for(std::size_t i = begin; i != end; ++i) {
+                const std::size_t pair = i/piecesPerPair;
+                const std::size_t piece = i%piecesPerPair;
+                const std::size_t a = runs[pair*2];
+                const std::size_t b = runs[pair*2 + 1];
+                const std::size_t c = runs[pair*2 + 2];
+                mergeRange(keys + a, values ? values + a : nullptr, b - a,
+                           keys + b, values ? values + b : nullptr, c - b,
+                           keysScratch + a, values ? valuesScratch + a : nullptr,
+                           piece*(c - a)/piecesPerPair,
+                           (piece + 1)*(c - a)/piecesPerPair);
+            }
+        });
+
+        /* A run without a pair is just copied over */
+        if(runCount % 2) {
+            const std::size_t a = runs[runCount - 1];
+            std::memcpy(keysScratch + a, keys + a, (size - a)*sizeof(U));
+            if(values)
+                std::memcpy(valuesScratch + a, values + a, (size - a)*sizeof(std::uint32_t));
+        }
+
+        for(std::size_t i = 0, newRunCount = (runCount + 1)/2; i != newRunCount; ++i)
+            runs[i] = runs[i*2];
+        runs[(runCount + 1)/2] = size;
+
+        U* const keysTmp = keys;
+        keys = keysScratch;
+        keysScratch = keysTmp;
+        std::uint32_t* const valuesTmp = values;
+        values = valuesScratch;
+        valuesScratch = valuesTmp;
+        swapped = !swapped;
+    }
+
+    return swapped;
+}
+
+template<class U, Implementation::SortKeyType type> void sortKeys(const Containers::StridedArrayView1D<U>& view, const std::size_t threadCount) {
+    const std::size_t size = view.size();
+    Containers::Array<U> storage{NoInit, size*2};
+    U* const keys = storage;
+    U* const keysScratch = storage + size;
+    for(std::size_t i = 0; i != size; ++i)
+        keys[i] = SortKeyTraits<U, type>::to(view[i]);
+
+    const U* const result = sortChunked<U>(keys, keysScratch, nullptr, nullptr, size, Implementation::parallelChunkCount(threadCount, size, size*sizeof(U))) ? keysScratch : keys;
+
+    for(std::size_t i = 0; i != size; ++i)
+        view[i] = SortKeyTraits<U, type>::from(result[i]);
+}
+
+template<class U, Implementation::SortKeyType type> void sortIndicesKeys(const Containers::StridedArrayView1D<const U>& view, const Containers::StridedArrayView1D<std::uint32_t>& indices, const std::size_t threadCount) {
+    const std::size_t size = view.size();
+    Containers::Array<U> keyStorage{NoInit, size*2};
+    Containers::Array<std::uint32_t> valueStorage{NoInit, size*2};
+    U* const keys = keyStorage;
+    U* const keysScratch = keyStorage + size;
+    std::uint32_t* const values = valueStorage;
+    std::uint32_t* const valuesScratch = valueStorage + size;
+    for(std::size_t i = 0; i != size; ++i) {
+        keys[i] = SortKeyTraits<U, type>::to(view[i]);
+        values[i] = std::uint32_t(i);
+    }
+
+    const std::uint32_t* const result = sortChunked<U>(keys, keysScratch, values, valuesScratch, size, Implementation::parallelChunkCount(threadCount, size, size*(sizeof(U) + sizeof(std::uint32_t)))) ? valuesScratch : values;
+
+    for(std::size_t i = 0; i != size; ++i)
+        indices[i] = result[i];
+}
+
+template<class U> void sortDispatch(const Containers::StridedArrayView2D<char>& keys, const Implementation::SortKeyType type, const std::size_t threadCount) {
+    const Containers::StridedArrayView1D<U> view = Containers::arrayCast<1, U>(keys);
+    switch(type) {
+        case Implementation::SortKeyType::Unsigned:
+            return sortKeys<U, Implementation::SortKeyType::Unsigned>(view, threadCount);
+        case Implementation::SortKeyType::Signed:
+            return sortKeys<U, Implementation::SortKeyType::Signed>(view, threadCount);
+        case Implementation::SortKeyType::Float:
+            return sortKeys<U, Implementation::SortKeyType::Float>(view, threadCount);
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+template<class U> void sortIndicesDispatch(const Containers::StridedArrayView2D<const char>& keys, const Implementation::SortKeyType type, const Containers::StridedArrayView1D<std::uint32_t>& indices, const std::size_t threadCount) {
+    const Containers::StridedArrayView1D<const U> view = Containers::arrayCast<1, const U>(keys);
+    switch(type) {
+        case Implementation::SortKeyType::Unsigned:
+            return sortIndicesKeys<U, Implementation::SortKeyType::Unsigned>(view, indices, threadCount);
+        case Implementation::SortKeyType::Signed:
+            return sortIndicesKeys<U, Implementation::SortKeyType::Signed>(view, indices, threadCount);
+        case Implementation::SortKeyType::Float:
+            return sortIndicesKeys<U, Implementation::SortKeyType::Float>(view, indices, threadCount);
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+}
+
+namespace Implementation {
+
+void sort(const Containers::StridedArrayView2D<char>& keys, const SortKeyType type, const std::size_t threadCount) {
+    switch(keys.size()[1]) {
+        case 1: return sortDispatch<std::uint8_t>(keys, type, threadCount);
+        case 2: return sortDispatch<std::uint16_t>(keys, type, threadCount);
+        case 4: return sortDispatch<std::uint32_t>(keys, type, threadCount);
+        case 8: return sortDispatch<std::uint64_t>(keys, type, threadCount);
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+void sortIndices(const Containers::StridedArrayView2D<const char>& keys, const SortKeyType type, const Containers::StridedArrayView1D<std::uint32_t>& indices, const std::size_t threadCount) {
+    CORRADE_ASSERT(keys.size()[0] == indices.size(),
+        "Utility::sortIndices(): expected" << keys.size()[0] << "indices but got" << indices.size(), );
+    CORRADE_ASSERT(keys.size()[0] <= 0xffffffffull,
+        "Utility::sortIndices(): can't sort more than 2^32-1 keys, got" << keys.size()[0], );
+
+    switch(keys.size()[1]) {
+        case 1: return sortIndicesDispatch<std::uint8_t>(keys, type, indices, threadCount);
+        case 2: return sortIndicesDispatch<std::uint16_t>(keys, type, indices, threadCount);
+        case 4: return sortIndicesDispatch<std::uint32_t>(keys, type, indices, threadCount);
+        case 8: return sortIndicesDispatch<std::uint64_t>(keys, type, indices, threadCount);
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+}
+
 }}
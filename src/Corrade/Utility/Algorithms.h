@@ -27,10 +27,13 @@
 */
 
 /** @file
- * @brief Function @ref Corrade::Utility::copy(), @ref Corrade::Utility::flipInPlace()
+ * @brief Function @ref Corrade::Utility::copy(), @ref Corrade::Utility::copyParallel(), @ref Corrade::Utility::flipInPlace(), @ref Corrade::Utility::flipInPlaceParallel(), @ref Corrade::Utility::transposeInto(), @ref Corrade::Utility::fill(), @ref Corrade::Utility::transform(), @ref Corrade::Utility::reduce(), @ref Corrade::Utility::sum(), @ref Corrade::Utility::minmax(), @ref Corrade::Utility::scan(), @ref Corrade::Utility::sort(), @ref Corrade::Utility::sortParallel(), @ref Corrade::Utility::sortIndices(), @ref Corrade::Utility::sortIndicesParallel()
  * @m_since{2020,06}
  */
 
+#include <cstdint>
+
+#include "Corrade/Containers/Pair.h"
 #include "Corrade/Containers/StridedArrayView.h"
 #include "Corrade/Utility/visibility.h"
 
@@ -160,6 +163,380 @@ second performs it in-place:
 */
 template<unsigned dimension, unsigned dimensions, class T> void flipInPlace(const Containers::StridedArrayView<dimensions, T>& view);
 
+/**
+@brief Copy an array view to another in parallel
+@m_since_latest
+
+Same as @ref copy(const Containers::ArrayView<const void>&, const Containers::ArrayView<void>&),
+but splits the copy into chunks that are processed on @p threadCount threads,
+one of which is the calling thread. If @p threadCount is @cpp 0 @ce,
+@ref std::thread::hardware_concurrency() is used. The function returns only
+after all threads finish.
+
+The chunk count is chosen so each chunk is at least 512 kB large, which means
+views smaller than 1 MB are always copied on the calling thread without
+spawning any threads. Threads are spawned for each call, so the function is
+meant for copying large data, where the overhead of spawning a thread is
+negligible. If Corrade is built without @ref CORRADE_UTILITY_USE_THREADS,
+which is the default, the copy is always done on the calling thread.
+@experimental
+*/
+CORRADE_UTILITY_EXPORT void copyParallel(const Containers::ArrayView<const void>& src, const Containers::ArrayView<void>& dst, std::size_t threadCount = 0);
+
+/**
+@brief Copy an array view to another in parallel
+@m_since_latest
+
+Casts views into a @cpp void @ce type and delegates into
+@ref copyParallel(const Containers::ArrayView<const void>&, const Containers::ArrayView<void>&, std::size_t).
+Expects that both arrays have the same size and @p T is a trivially copyable
+type.
+@experimental
+*/
+template<class T> inline void copyParallel(const Containers::ArrayView<const T>& src, const Containers::ArrayView<T>& dst, std::size_t threadCount = 0) {
+    static_assert(
+        #ifdef CORRADE_STD_IS_TRIVIALLY_TRAITS_SUPPORTED
+        std::is_trivially_copyable<T>::value
+        #else
+        __has_trivial_copy(T) && __has_trivial_destructor(T)
+        #endif
+        , "types must be trivially copyable");
+
+    return copyParallel(Containers::ArrayView<const void>(src), Containers::ArrayView<void>(dst), threadCount);
+}
+
+/**
+@brief Copy a strided array view to another in parallel
+@m_since_latest
+
+Same as @ref copy(const Containers::StridedArrayView<dimensions, const char>&, const Containers::StridedArrayView<dimensions, char>&),
+but splits the first dimension that has more than one item into chunks that
+are processed on @p threadCount threads, one of which is the calling thread.
+The same chunk size and thread count rules as in
+@ref copyParallel(const Containers::ArrayView<const void>&, const Containers::ArrayView<void>&, std::size_t)
+apply. Expects that both arrays have the same size.
+@experimental
+*/
+template<unsigned dimensions> void copyParallel(const Containers::StridedArrayView<dimensions, const char>& src, const Containers::StridedArrayView<dimensions, char>& dst, std::size_t threadCount = 0);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+CORRADE_UTILITY_EXPORT void copyParallel(const Containers::StridedArrayView1D<const char>& src, const Containers::StridedArrayView1D<char>& dst, std::size_t threadCount = 0);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+CORRADE_UTILITY_EXPORT void copyParallel(const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView2D<char>& dst, std::size_t threadCount = 0);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+CORRADE_UTILITY_EXPORT void copyParallel(const Containers::StridedArrayView3D<const char>& src, const Containers::StridedArrayView3D<char>& dst, std::size_t threadCount = 0);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+CORRADE_UTILITY_EXPORT void copyParallel(const Containers::StridedArrayView4D<const char>& src, const Containers::StridedArrayView4D<char>& dst, std::size_t threadCount = 0);
+
+/**
+@brief Copy a strided array view to another in parallel
+@m_since_latest
+
+Casts views into a @cpp char @ce type of one dimension more (where the last
+dimension has a size of @cpp sizeof(T) @ce and delegates into
+@ref copyParallel(const Containers::StridedArrayView<dimensions, const char>&, const Containers::StridedArrayView<dimensions, char>&, std::size_t).
+Expects that both arrays have the same size and @p T is a trivially copyable
+type.
+@experimental
+*/
+template<unsigned dimensions, class T> void copyParallel(const Containers::StridedArrayView<dimensions, const T>& src, const Containers::StridedArrayView<dimensions, T>& dst, std::size_t threadCount = 0);
+
+/**
+@brief Copy a view to another in parallel
+@m_since_latest
+
+Converts @p src and @p dst to a common array view type in the same way as
+@ref copy(From&&, To&&) and then calls either
+@ref copyParallel(const Containers::ArrayView<const T>&, const Containers::ArrayView<T>&, std::size_t)
+or @ref copyParallel(const Containers::StridedArrayView<dimensions, const T>&, const Containers::StridedArrayView<dimensions, T>&, std::size_t).
+@experimental
+*/
+template<class From, class To, class FromView = decltype(Implementation::stridedArrayViewTypeFor(std::declval<From&&>())), class ToView = decltype(Implementation::stridedArrayViewTypeFor(std::declval<To&&>()))> void copyParallel(From&& src, To&& dst, std::size_t threadCount = 0);
+
+/**
+@brief Flip given dimension of a view in-place in parallel
+@m_since_latest
+
+Same as @ref flipInPlace(), but splits the work into chunks that are processed
+on @p threadCount threads, one of which is the calling thread. The first
+dimension before @p dimension that has more than one item is split, if there's
+none, the flipped item pairs are split instead. The same chunk size and thread
+count rules as in @ref copyParallel(const Containers::ArrayView<const void>&, const Containers::ArrayView<void>&, std::size_t)
+apply. Expects that @p T is a trivially copyable type and the view is
+contiguous after @p dimension.
+@experimental
+*/
+template<unsigned dimension, unsigned dimensions, class T> void flipInPlaceParallel(const Containers::StridedArrayView<dimensions, T>& view, std::size_t threadCount = 0);
+
+/**
+@brief Transpose a 2D strided array view into another
+@m_since_latest
+
+Copies @cpp src[i][j] @ce to @cpp dst[j][i] @ce. Equivalent to
+@cpp Utility::copy(src.transposed<0, 1>(), dst) @ce, but instead of walking
+one of the views with a large stride, which for large views means nearly
+every access is a cache miss, the views are processed in square tiles that
+fit into the L1 cache. On @ref CORRADE_TARGET_SSE2 "SSE2", if the items in
+each row of both views are contiguous, the tiles are further split into
+8x8 blocks for 1- and 2-byte items, 4x4 blocks for 4-byte items and 2x2
+blocks for 8-byte items that are transposed in SIMD registers. Other item
+sizes and strides use a scalar loop over the tiles.
+
+The last dimension is the item bytes and is expected to be contiguous, both
+views are expected to have the same size in the last dimension and @p dst is
+expected to have the first two dimensions swapped compared to @p src. The
+views are expected to not overlap.
+@experimental
+*/
+CORRADE_UTILITY_EXPORT void transposeInto(const Containers::StridedArrayView3D<const char>& src, const Containers::StridedArrayView3D<char>& dst);
+
+/**
+@brief Transpose a 2D strided array view into another
+@m_since_latest
+
+Casts views into a @cpp char @ce type of one dimension more (where the last
+dimension has a size of @cpp sizeof(T) @ce and delegates into
+@ref transposeInto(const Containers::StridedArrayView3D<const char>&, const Containers::StridedArrayView3D<char>&).
+Expects that @p T is a trivially copyable type.
+@experimental
+*/
+template<class T> void transposeInto(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<T>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+template<class T> void transposeInto(const Containers::StridedArrayView2D<T>& src, const Containers::StridedArrayView2D<T>& dst) {
+    static_assert(!std::is_const<T>::value, "can't transpose into a const view");
+    return transposeInto(Containers::StridedArrayView2D<const T>{src}, dst);
+}
+
+/**
+@brief Fill a strided array view with a value
+@m_since_latest
+
+Assigns @p value to all items of @p view. Contiguous views, or their
+contiguous sub-dimensions, are processed with a plain loop that the compiler
+can turn into SIMD stores or a @ref std::memset(), other views are processed
+with a loop over the strided items.
+@experimental
+*/
+template<unsigned dimensions, class T> void fill(const Containers::StridedArrayView<dimensions, T>& view, const typename std::common_type<T>::type& value);
+
+/**
+@brief Transform a strided array view into another
+@m_since_latest
+
+Assigns @cpp function(src[i]) @ce to @cpp dst[i] @ce for all items, in the
+order in which they're stored in the view. If both views are contiguous,
+or contiguous in the same sub-dimensions, the items are processed with a
+plain loop that the compiler can vectorize if @p function allows. Expects that
+both views have the same size. The @p src and @p dst can be the same view for
+an in-place transformation.
+@experimental
+*/
+template<unsigned dimensions, class T, class U, class F> void transform(const Containers::StridedArrayView<dimensions, T>& src, const Containers::StridedArrayView<dimensions, U>& dst, F&& function);
+
+/**
+@brief Reduce a strided array view
+@m_since_latest
+
+Returns @cpp function(...function(function(init, view[0]), view[1])..., view[n - 1]) @ce,
+with the items visited in the order in which they're stored in the view. As
+the order is preserved, the loop can't make use of SIMD unless @p function is
+trivial for the compiler to reorder --- use @ref sum() or @ref minmax() for
+the common cases, which are vectorized explicitly.
+@experimental
+*/
+template<unsigned dimensions, class T, class U, class F> U reduce(const Containers::StridedArrayView<dimensions, T>& view, U init, F&& function);
+
+/**
+@brief Sum of all items in a strided array view
+@m_since_latest
+
+For contiguous views, or their contiguous sub-dimensions, the items are summed
+into eight independent accumulators which are then added together, allowing
+the compiler to use SIMD even without reassociation of floating-point
+operations being enabled. Because of that, for floating-point types the result
+may differ slightly from a sum performed in the order in which the items are
+stored. Returns a value-initialized @p T for an empty view.
+@experimental
+*/
+template<unsigned dimensions, class T> typename std::remove_const<T>::type sum(const Containers::StridedArrayView<dimensions, T>& view);
+
+/**
+@brief Minimum and maximum of all items in a strided array view
+@m_since_latest
+
+Uses only @cpp operator<() @ce for comparison. Similarly to @ref sum(),
+contiguous views are processed with eight independent lanes, allowing the
+compiler to use SIMD min/max instructions. Expects that the view is not
+empty. If there are NaNs in a floating-point view, the result is unspecified.
+@experimental
+*/
+template<unsigned dimensions, class T> Containers::Pair<typename std::remove_const<T>::type, typename std::remove_const<T>::type> minmax(const Containers::StridedArrayView<dimensions, T>& view);
+
+/**
+@brief Inclusive scan of a strided array view
+@m_since_latest
+
+Assigns @cpp function(...function(function(src[0], src[1]), src[2])..., src[i]) @ce
+to @cpp dst[i] @ce, with the items visited in the order in which they're
+stored in the view. Contiguous views are processed with a plain loop, however
+as each item depends on the previous one, the loop is inherently serial.
+Expects that both views have the same size. The @p src and @p dst can be the
+same view for an in-place scan.
+@experimental
+*/
+template<unsigned dimensions, class T, class U, class F> void scan(const Containers::StridedArrayView<dimensions, T>& src, const Containers::StridedArrayView<dimensions, U>& dst, F&& function);
+
+/**
+@brief Inclusive prefix sum of a strided array view
+@m_since_latest
+
+Equivalent to calling @ref scan(const Containers::StridedArrayView<dimensions, T>&, const Containers::StridedArrayView<dimensions, U>&, F&&)
+with @cpp operator+() @ce.
+@experimental
+*/
+template<unsigned dimensions, class T, class U> void scan(const Containers::StridedArrayView<dimensions, T>& src, const Containers::StridedArrayView<dimensions, U>& dst);
+
+/**
+@brief Sort a strided array view of integers or floating-point values
+@m_since_latest
+
+Sorts the view in an ascending order using a stable LSD radix sort, with
+8 bits processed in each pass. Unlike a comparison sort, the time is linear
+in the item count, and passes in which all keys have the same digit are
+skipped, so for example 32-bit keys that all fit into 16 bits need just two
+passes. The keys are copied to a contiguous temporary allocation first and
+copied back at the end, so the view can have arbitrary strides. The
+temporary memory is twice the size of the keys.
+
+The @p T is expected to be an 8-, 16-, 32- or 64-bit signed or unsigned
+integer type, or a @cpp float @ce or @cpp double @ce. Floating-point values
+are ordered by their bit pattern, which means @cpp -0.0f @ce is sorted before
+@cpp +0.0f @ce, negative NaNs end up at the front and positive NaNs at the
+end.
+@experimental
+@see @ref sortParallel(), @ref sortIndices()
+*/
+template<class T> void sort(const Containers::StridedArrayView1D<T>& view);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+template<class T> void sort(const Containers::ArrayView<T>& view) {
+    sort(Containers::StridedArrayView1D<T>{view});
+}
+
+/**
+@brief Sort a strided array view in parallel
+@m_since_latest
+
+Splits the view into chunks that are radix-sorted on separate threads and
+then merged together, with each merge pass split across the threads as well.
+Sorting the same view with @ref sort() has the same result. If
+@p threadCount is @cpp 0 @ce, @ref std::thread::hardware_concurrency() is
+used. Views smaller than a few hundred kB are sorted on the calling thread
+only, as the overhead of spawning threads would outweigh the gains. If
+Corrade is built without @ref CORRADE_UTILITY_USE_THREADS, which is the
+default, the view is always sorted on the calling thread.
+@experimental
+*/
+template<class T> void sortParallel(const Containers::StridedArrayView1D<T>& view, std::size_t threadCount = 0);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+template<class T> void sortParallel(const Containers::ArrayView<T>& view, std::size_t threadCount = 0) {
+    sortParallel(Containers::StridedArrayView1D<T>{view}, threadCount);
+}
+
+/**
+@brief Sort indices by a strided array view of keys
+@m_since_latest
+
+Fills @p indices with a permutation of @cpp 0 @ce to @cpp keys.size() - 1 @ce
+such that @cpp keys[indices[i]] @ce is in an ascending order, keeping indices
+of equal keys in their original order. The @p keys are left untouched, which
+is useful for sorting struct-of-arrays data where the keys are just one of
+the arrays and the permutation is then applied to all others. Accepts the
+same key types and uses the same radix sort as @ref sort(), the temporary
+memory is twice the size of the keys and indices together. Expects that
+@p keys and @p indices have the same size and that the size fits into
+32 bits.
+@experimental
+@see @ref sortIndicesParallel()
+*/
+template<class T> void sortIndices(const Containers::StridedArrayView1D<const T>& keys, const Containers::StridedArrayView1D<std::uint32_t>& indices);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+template<class T> void sortIndices(const Containers::StridedArrayView1D<T>& keys, const Containers::StridedArrayView1D<std::uint32_t>& indices) {
+    sortIndices(Containers::StridedArrayView1D<const T>{keys}, indices);
+}
+
+/**
+@brief Sort indices by a strided array view of keys in parallel
+@m_since_latest
+
+A variant of @ref sortIndices() that distributes the work across threads in
+the same way as @ref sortParallel(). The result is the same as with
+@ref sortIndices().
+@experimental
+*/
+template<class T> void sortIndicesParallel(const Containers::StridedArrayView1D<const T>& keys, const Containers::StridedArrayView1D<std::uint32_t>& indices, std::size_t threadCount = 0);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+template<class T> void sortIndicesParallel(const Containers::StridedArrayView1D<T>& keys, const Containers::StridedArrayView1D<std::uint32_t>& indices, std::size_t threadCount = 0) {
+    sortIndicesParallel(Containers::StridedArrayView1D<const T>{keys}, indices, threadCount);
+}
+
+namespace Implementation {
+
+enum class SortKeyType: char {
+    Unsigned, Signed, Float
+};
+
+/* Last dimension is the key bytes, which is expected to be contiguous. The
+   threadCount is passed directly from sortParallel() and
+   sortIndicesParallel(), sort() and sortIndices() pass 1. */
+CORRADE_UTILITY_EXPORT void sort(const Containers::StridedArrayView2D<char>& keys, SortKeyType type, std::size_t threadCount);
+CORRADE_UTILITY_EXPORT void sortIndices(const Containers::StridedArrayView2D<const char>& keys, SortKeyType type, const Containers::StridedArrayView1D<std::uint32_t>& indices, std::size_t threadCount);
+
+template<class T> constexpr SortKeyType sortKeyType() {
+    static_assert(std::is_arithmetic<T>::value && !std::is_same<typename std::remove_const<T>::type, bool>::value,
+        "only integer and floating-point types can be sorted");
+    static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8,
+        "only 8-, 16-, 32- and 64-bit types can be sorted");
+    return std::is_floating_point<T>::value ? SortKeyType::Float :
+        std::is_signed<T>::value ? SortKeyType::Signed : SortKeyType::Unsigned;
+}
+
+}
+
 namespace Implementation {
 
 template<class> struct StridedArrayViewType;
@@ -214,6 +591,44 @@ template<unsigned dimensions, class T> void copy(const Containers::StridedArrayV
                 Containers::arrayCast<dimensions + 1, char>(dst));
 }
 
+template<class From, class To, class FromView, class ToView> void copyParallel(From&& src, To&& dst, const std::size_t threadCount) {
+    static_assert(std::is_same<typename std::remove_const<typename FromView::Type>::type, typename std::remove_const<typename ToView::Type>::type>::value, "can't copy between views of different types");
+    static_assert(!std::is_const<typename ToView::Type>::value, "can't copy to a const view");
+    static_assert(unsigned(Implementation::StridedArrayViewType<FromView>::Dimensions) ==
+        unsigned(Implementation::StridedArrayViewType<ToView>::Dimensions),
+        "can't copy between views of different dimensions");
+    /* We need to pass const& to the copyParallel(), passing temporary
+       instances directly would lead to infinite recursion */
+    const typename std::common_type<
+        typename Implementation::StridedArrayViewType<FromView>::ConstType,
+        typename Implementation::StridedArrayViewType<ToView>::ConstType>::type srcV{src};
+    const typename std::common_type<
+        typename Implementation::StridedArrayViewType<FromView>::Type,
+        typename Implementation::StridedArrayViewType<ToView>::Type>::type dstV{dst};
+    copyParallel(srcV, dstV, threadCount);
+}
+
+template<unsigned dimensions> void copyParallel(const Containers::StridedArrayView<dimensions, const char>& src, const Containers::StridedArrayView<dimensions, char>& dst, const std::size_t threadCount) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Utility::Algorithms::copyParallel(): sizes" << src.size() << "and" << dst.size() << "don't match", );
+
+    for(std::size_t i = 0, max = src.size()[0]; i != max; ++i)
+        copyParallel(src[i], dst[i], threadCount);
+}
+
+template<unsigned dimensions, class T> void copyParallel(const Containers::StridedArrayView<dimensions, const T>& src, const Containers::StridedArrayView<dimensions, T>& dst, const std::size_t threadCount) {
+    static_assert(
+        #ifdef CORRADE_STD_IS_TRIVIALLY_TRAITS_SUPPORTED
+        std::is_trivially_copyable<T>::value
+        #else
+        __has_trivial_copy(T) && __has_trivial_destructor(T)
+        #endif
+        , "types must be trivially copyable");
+
+    return copyParallel(Containers::arrayCast<dimensions + 1, const char>(src),
+                        Containers::arrayCast<dimensions + 1, char>(dst), threadCount);
+}
+
 namespace Implementation {
 
 CORRADE_UTILITY_EXPORT void flipSecondToLastDimensionInPlace(const Containers::StridedArrayView2D<char>& view);
@@ -225,6 +640,15 @@ template<unsigned dimensions> void flipSecondToLastDimensionInPlace(const Contai
         flipSecondToLastDimensionInPlace(i);
 }
 
+CORRADE_UTILITY_EXPORT void flipSecondToLastDimensionInPlaceParallel(const Containers::StridedArrayView2D<char>& view, std::size_t threadCount);
+CORRADE_UTILITY_EXPORT void flipSecondToLastDimensionInPlaceParallel(const Containers::StridedArrayView3D<char>& view, std::size_t threadCount);
+CORRADE_UTILITY_EXPORT void flipSecondToLastDimensionInPlaceParallel(const Containers::StridedArrayView4D<char>& view, std::size_t threadCount);
+
+template<unsigned dimensions> void flipSecondToLastDimensionInPlaceParallel(const Containers::StridedArrayView<dimensions, char>& view, const std::size_t threadCount) {
+    for(const Containers::StridedArrayView<dimensions - 1, char> i: view)
+        flipSecondToLastDimensionInPlaceParallel(i, threadCount);
+}
+
 }
 
 template<unsigned dimension, unsigned dimensions, class T> void flipInPlace(const Containers::StridedArrayView<dimensions, T>& view) {
@@ -244,6 +668,274 @@ template<unsigned dimension, unsigned dimensions, class T> void flipInPlace(cons
     Implementation::flipSecondToLastDimensionInPlace(expanded.template asContiguous<dimension + 1>());
 }
 
+template<unsigned dimension, unsigned dimensions, class T> void flipInPlaceParallel(const Containers::StridedArrayView<dimensions, T>& view, const std::size_t threadCount) {
+    static_assert(dimension < dimensions, "dimension out of range");
+    static_assert(
+        #ifdef CORRADE_STD_IS_TRIVIALLY_TRAITS_SUPPORTED
+        std::is_trivially_copyable<T>::value
+        #else
+        __has_trivial_copy(T) && __has_trivial_destructor(T)
+        #endif
+        , "types must be trivially copyable");
+
+    const Containers::StridedArrayView<dimensions + 1, char> expanded =
+        Containers::arrayCast<dimensions + 1, char>(view);
+    CORRADE_ASSERT(expanded.template isContiguous<dimension + 1>(),
+        "Utility::flipInPlaceParallel(): the view is not contiguous after dimension" << dimension, );
+    Implementation::flipSecondToLastDimensionInPlaceParallel(expanded.template asContiguous<dimension + 1>(), threadCount);
+}
+
+template<class T> void transposeInto(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<T>& dst) {
+    static_assert(
+        #ifdef CORRADE_STD_IS_TRIVIALLY_TRAITS_SUPPORTED
+        std::is_trivially_copyable<T>::value
+        #else
+        __has_trivial_copy(T) && __has_trivial_destructor(T)
+        #endif
+        , "types must be trivially copyable");
+
+    return transposeInto(Containers::arrayCast<3, const char>(src),
+                         Containers::arrayCast<3, char>(dst));
+}
+
+namespace Implementation {
+
+/* Calls function(data, size, stride) for each row of a one-dimensional view,
+   or for all rows of a multi-dimensional view with contiguous rows merged
+   together, in the order in which the items are stored in the view */
+template<class T, class F> void forEachRow(const Containers::StridedArrayView1D<T>& view, F& function) {
+    function(static_cast<T*>(view.data()), view.size(), view.stride());
+}
+
+template<unsigned dimensions, class T, class F> void forEachRow(const Containers::StridedArrayView<dimensions, T>& view, F& function) {
+    if(view.isContiguous()) {
+        std::size_t size = 1;
+        for(std::size_t i: view.size()) size *= i;
+        function(static_cast<T*>(view.data()), size, std::ptrdiff_t(sizeof(T)));
+    } else for(std::size_t i = 0, max = view.size()[0]; i != max; ++i)
+        forEachRow(view[i], function);
+}
+
+/* Same as above, but for two views, calling
+   function(aData, bData, size, aStride, bStride). Rows are merged only if
+   both views are contiguous. */
+template<class T, class U, class F> void forEachRow(const Containers::StridedArrayView1D<T>& a, const Containers::StridedArrayView1D<U>& b, F& function) {
+    function(static_cast<T*>(a.data()), static_cast<U*>(b.data()), a.size(), a.stride(), b.stride());
+}
+
+template<unsigned dimensions, class T, class U, class F> void forEachRow(const Containers::StridedArrayView<dimensions, T>& a, const Containers::StridedArrayView<dimensions, U>& b, F& function) {
+    if(a.isContiguous() && b.isContiguous()) {
+        std::size_t size = 1;
+        for(std::size_t i: a.size()) size *= i;
+        function(static_cast<T*>(a.data()), static_cast<U*>(b.data()), size, std::ptrdiff_t(sizeof(T)), std::ptrdiff_t(sizeof(U)));
+    } else for(std::size_t i = 0, max = a.size()[0]; i != max; ++i)
+        forEachRow(a[i], b[i], function);
+}
+
+/* Item at given index of a strided row. Goes through a char pointer to
+   support strides that aren't a multiple of the type size. */
+template<class T> inline T& stridedItem(T* const data, const std::size_t i, const std::ptrdiff_t stride) {
+    return *reinterpret_cast<T*>(reinterpret_cast<typename std::conditional<std::is_const<T>::value, const char, char>::type*>(data) + std::ptrdiff_t(i)*stride);
+}
+
+template<class T> struct FillKernel {
+    void operator()(T* const data, const std::size_t size, const std::ptrdiff_t stride) const {
+        if(stride == std::ptrdiff_t(sizeof(T))) {
+            for(std::size_t i = 0; i != size; ++i) data[i] = value;
+        } else for(std::size_t i = 0; i != size; ++i)
+            stridedItem(data, i, stride) = value;
+    }
+
+    const T& value;
+};
+
+template<class T, class U, class F> struct TransformKernel {
+    void operator()(T* const src, U* const dst, const std::size_t size, const std::ptrdiff_t srcStride, const std::ptrdiff_t dstStride) const {
+        if(srcStride == std::ptrdiff_t(sizeof(T)) && dstStride == std::ptrdiff_t(sizeof(U))) {
+            for(std::size_t i = 0; i != size; ++i) dst[i] = function(src[i]);
+        } else for(std::size_t i = 0; i != size; ++i)
+            stridedItem(dst, i, dstStride) = function(stridedItem(src, i, srcStride));
+    }
+
+    F& function;
+};
+
+template<class T, class U, class F> struct ReduceKernel {
+    void operator()(T* const data, const std::size_t size, const std::ptrdiff_t stride) {
+        if(stride == std::ptrdiff_t(sizeof(T))) {
+            for(std::size_t i = 0; i != size; ++i) result = function(result, data[i]);
+        } else for(std::size_t i = 0; i != size; ++i)
+            result = function(result, stridedItem(data, i, stride));
+    }
+
+    U result;
+    F& function;
+};
+
+/* Eight lanes is 256 bits for 32-bit types, which is enough to saturate both
+   SSE and AVX units and gives the compiler enough independent operations to
+   hide the latency of floating-point additions */
+enum: std::size_t { ReductionLaneCount = 8 };
+
+template<class T> struct SumKernel {
+    void operator()(const T* const data, const std::size_t size, const std::ptrdiff_t stride) {
+        std::size_t i = 0;
+        if(stride == std::ptrdiff_t(sizeof(T))) {
+            T lanes[ReductionLaneCount]{};
+            for(; i + ReductionLaneCount <= size; i += ReductionLaneCount)
+                for(std::size_t j = 0; j != ReductionLaneCount; ++j)
+                    lanes[j] += data[i + j];
+            for(std::size_t j = 0; j != ReductionLaneCount; ++j)
+                result += lanes[j];
+        }
+        for(; i != size; ++i) result += stridedItem(data, i, stride);
+    }
+
+    T result;
+};
+
+template<class T> struct MinmaxKernel {
+    void operator()(const T* const data, const std::size_t size, const std::ptrdiff_t stride) {
+        std::size_t i = 0;
+        if(stride == std::ptrdiff_t(sizeof(T)) && size >= ReductionLaneCount) {
+            T min[ReductionLaneCount];
+            T max[ReductionLaneCount];
+            for(std::size_t j = 0; j != ReductionLaneCount; ++j)
+                min[j] = max[j] = data[j];
+            for(i = ReductionLaneCount; i + ReductionLaneCount <= size; i += ReductionLaneCount) {
+                for(std::size_t j = 0; j != ReductionLaneCount; ++j) {
+                    const T& value = data[i + j];
+                    min[j] = value < min[j] ? value : min[j];
+                    max[j] = max[j] < value ? value : max[j];
+                }
+            }
+            for(std::size_t j = 0; j != ReductionLaneCount; ++j)
+                add(min[j], max[j]);
+        }
+        for(; i != size; ++i) {
+            const T& value = stridedItem(data, i, stride);
+            add(value, value);
+        }
+    }
+
+    void add(const T& min, const T& max) {
+        if(!initialized) {
+            result.first() = min;
+            result.second() = max;
+            initialized = true;
+            return;
+        }
+        if(min < result.first()) result.first() = min;
+        if(result.second() < max) result.second() = max;
+    }
+
+    Containers::Pair<T, T> result;
+    bool initialized;
+};
+
+template<class T, class U, class F> struct ScanKernel {
+    void operator()(T* const src, U* const dst, const std::size_t size, const std::ptrdiff_t srcStride, const std::ptrdiff_t dstStride) {
+        std::size_t i = 0;
+        /* The very first item is just copied */
+        if(size && !initialized) {
+            *dst = *src;
+            initialized = true;
+            i = 1;
+        } else if(size) {
+            stridedItem(dst, 0, dstStride) = function(*previous, *src);
+            i = 1;
+        }
+
+        if(srcStride == std::ptrdiff_t(sizeof(T)) && dstStride == std::ptrdiff_t(sizeof(U))) {
+            for(; i < size; ++i) dst[i] = function(dst[i - 1], src[i]);
+        } else for(; i < size; ++i)
+            stridedItem(dst, i, dstStride) = function(stridedItem(dst, i - 1, dstStride), stridedItem(src, i, srcStride));
+
+        if(size) previous = &stridedItem(dst, size - 1, dstStride);
+    }
+
+    F& function;
+    const U* previous;
+    bool initialized;
+};
+
+struct ScanPlus {
+    template<class T, class U> auto operator()(const T& a, const U& b) const -> decltype(a + b) {
+        return a + b;
+    }
+};
+
+}
+
+template<unsigned dimensions, class T> void fill(const Containers::StridedArrayView<dimensions, T>& view, const typename std::common_type<T>::type& value) {
+    static_assert(!std::is_const<T>::value, "can't fill a const view");
+    Implementation::FillKernel<T> kernel{value};
+    Implementation::forEachRow(view, kernel);
+}
+
+template<unsigned dimensions, class T, class U, class F> void transform(const Containers::StridedArrayView<dimensions, T>& src, const Containers::StridedArrayView<dimensions, U>& dst, F&& function) {
+    static_assert(!std::is_const<U>::value, "can't transform to a const view");
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Utility::transform(): sizes" << src.size() << "and" << dst.size() << "don't match", );
+    Implementation::TransformKernel<T, U, typename std::remove_reference<F>::type> kernel{function};
+    Implementation::forEachRow(src, dst, kernel);
+}
+
+template<unsigned dimensions, class T, class U, class F> U reduce(const Containers::StridedArrayView<dimensions, T>& view, U init, F&& function) {
+    Implementation::ReduceKernel<T, U, typename std::remove_reference<F>::type> kernel{Utility::move(init), function};
+    Implementation::forEachRow(view, kernel);
+    return kernel.result;
+}
+
+template<unsigned dimensions, class T> typename std::remove_const<T>::type sum(const Containers::StridedArrayView<dimensions, T>& view) {
+    Implementation::SumKernel<typename std::remove_const<T>::type> kernel{};
+    Implementation::forEachRow(Containers::StridedArrayView<dimensions, const T>{view}, kernel);
+    return kernel.result;
+}
+
+template<unsigned dimensions, class T> Containers::Pair<typename std::remove_const<T>::type, typename std::remove_const<T>::type> minmax(const Containers::StridedArrayView<dimensions, T>& view) {
+    #ifndef CORRADE_NO_ASSERT
+    const Containers::StridedDimensions<dimensions, std::size_t> size = view.size();
+    bool empty = false;
+    for(std::size_t i = 0; i != dimensions; ++i) if(!size[i]) empty = true;
+    #endif
+    CORRADE_ASSERT(!empty,
+        "Utility::minmax(): the view is empty", {});
+    Implementation::MinmaxKernel<typename std::remove_const<T>::type> kernel{{}, false};
+    Implementation::forEachRow(Containers::StridedArrayView<dimensions, const T>{view}, kernel);
+    return kernel.result;
+}
+
+template<unsigned dimensions, class T, class U, class F> void scan(const Containers::StridedArrayView<dimensions, T>& src, const Containers::StridedArrayView<dimensions, U>& dst, F&& function) {
+    static_assert(!std::is_const<U>::value, "can't scan to a const view");
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Utility::scan(): sizes" << src.size() << "and" << dst.size() << "don't match", );
+    Implementation::ScanKernel<T, U, typename std::remove_reference<F>::type> kernel{function, nullptr, false};
+    Implementation::forEachRow(src, dst, kernel);
+}
+
+template<unsigned dimensions, class T, class U> void scan(const Containers::StridedArrayView<dimensions, T>& src, const Containers::StridedArrayView<dimensions, U>& dst) {
+    scan(src, dst, Implementation::ScanPlus{});
+}
+
+template<class T> void sort(const Containers::StridedArrayView1D<T>& view) {
+    static_assert(!std::is_const<T>::value, "can't sort a const view");
+    Implementation::sort(Containers::arrayCast<2, char>(view), Implementation::sortKeyType<T>(), 1);
+}
+
+template<class T> void sortParallel(const Containers::StridedArrayView1D<T>& view, const std::size_t threadCount) {
+    static_assert(!std::is_const<T>::value, "can't sort a const view");
+    Implementation::sort(Containers::arrayCast<2, char>(view), Implementation::sortKeyType<T>(), threadCount);
+}
+
+template<class T> void sortIndices(const Containers::StridedArrayView1D<const T>& keys, const Containers::StridedArrayView1D<std::uint32_t>& indices) {
+    Implementation::sortIndices(Containers::arrayCast<2, const char>(keys), Implementation::sortKeyType<T>(), indices, 1);
+}
+
+template<class T> void sortIndicesParallel(const Containers::StridedArrayView1D<const T>& keys, const Containers::StridedArrayView1D<std::uint32_t>& indices, const std::size_t threadCount) {
+    Implementation::sortIndices(Containers::arrayCast<2, const char>(keys), Implementation::sortKeyType<T>(), indices, threadCount);
+}
+
 }}
 
 #endif
@@ -0,0 +1,266 @@
+#ifndef Corrade_Utility_ArrayVirtualAllocator_h
+#define Corrade_Utility_ArrayVirtualAllocator_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Utility::ArrayVirtualAllocator, function @ref Corrade::Utility::reserveVirtual()
+ * @m_since_latest
+ */
+
+/* Not inside Memory.h because there we don't want the GrowableArray include */
+
+#include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/Utility/visibility.h"
+
+namespace Corrade { namespace Utility {
+
+#if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT)) || defined(DOXYGEN_GENERATING_OUTPUT)
+namespace Implementation {
+
+enum: std::size_t {
+    /* Address space is cheap on 64-bit, not so much on 32-bit */
+    VirtualDefaultReservation = sizeof(std::size_t) == 8 ?
+        std::size_t{1} << 30 : std::size_t{1} << 24
+};
+
+/* The header at the front of the reservation is two std::size_t values, the
+   reserved and the committed byte count, both including the header and
+   rounded to whole pages */
+CORRADE_UTILITY_EXPORT std::size_t virtualPageSize();
+CORRADE_UTILITY_EXPORT char* virtualAllocate(std::size_t reserved, std::size_t committed);
+CORRADE_UTILITY_EXPORT bool virtualCommit(char* base, std::size_t committed);
+CORRADE_UTILITY_EXPORT void virtualDeallocate(char* base);
+
+}
+
+/**
+@brief Virtual memory allocator for growable arrays
+@m_since_latest
+
+An @ref Containers::ArrayAllocator that reserves a large range of address
+space upfront and then makes pages inside it usable on demand as the array
+grows. Compared to @ref Containers::ArrayMallocAllocator, growth within the
+reserved range never moves the data, which means there's no copy of the
+existing contents, no temporary doubling of memory use and pointers to
+existing elements stay valid. That's useful mainly for huge append-only
+containers such as logs or recorded event streams, where a copy on
+reallocation would cause a significant stall. Example usage:
+
+@snippet Utility.cpp ArrayVirtualAllocator
+
+When the array is allocated through the allocator without specifying the
+reservation, such as with @ref Containers::arrayAppend(), the reserved range
+is 1 GB on 64-bit platforms and 16 MB on 32-bit, or the initial capacity if
+larger. Use @ref reserveVirtual() to create an empty array with a reservation
+of given size. Reserving address space doesn't consume any physical memory
+and, compared to committing it, doesn't count towards the system commit
+limit, so it's fine to reserve ranges considerably larger than what's likely
+going to be used.
+
+If the array outgrows its reservation, a new one of twice the size is made and
+the contents are moved there the same way as with other allocators. At that
+point the pointers into the array are invalidated.
+
+If reserving the address space or committing the pages fails, a message is
+printed to @ref Error and the application is aborted in all build types, as
+the allocator interface has no way to report the failure to the caller.
+
+Unused pages are not released on @ref Containers::arrayShrink(), the shrink
+copies the contents to a regular @ref Containers::Array as with any other
+allocator. Similarly to @ref Containers::ArrayNewAllocator, the reserved and
+committed size is stored *before* the front of the array. The granularity of
+committed memory is a page, which means even tiny arrays occupy at least one
+page. The allocator is thus not suited for many small arrays.
+
+Implemented using @m_class{m-doc-external} [mmap()](https://man.archlinux.org/man/mmap.2)
+with @cpp PROT_NONE @ce and @m_class{m-doc-external} [mprotect()](https://man.archlinux.org/man/mprotect.2)
+on @ref CORRADE_TARGET_UNIX "UNIX" systems and with @m_class{m-doc-external} [VirtualAlloc()](https://docs.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-virtualalloc)
+with @cpp MEM_RESERVE @ce and @cpp MEM_COMMIT @ce on non-RT
+@ref CORRADE_TARGET_WINDOWS "Windows". Not available on other platforms.
+@see @ref Containers-Array-growable
+@experimental
+*/
+template<class T> struct ArrayVirtualAllocator {
+    typedef T Type; /**< Pointer type */
+
+    enum: std::size_t {
+        /**
+         * Offset at the beginning of the allocation to store the reserved
+         * and committed size. At least as large as two @ref std::size_t. If
+         * the type alignment is larger than that, then it's equal to type
+         * alignment.
+         */
+        AllocationOffset = alignof(T) < 2*sizeof(std::size_t) ?
+            2*sizeof(std::size_t) : alignof(T)
+    };
+
+    /**
+     * @brief Allocate (but not construct) an array of given capacity
+     *
+     * Reserves 1 GB on 64-bit platforms and 16 MB on 32-bit, or
+     * @p capacity if larger, and commits enough pages to fit @p capacity.
+     */
+    static T* allocate(std::size_t capacity) {
+        return allocate(capacity, (Implementation::VirtualDefaultReservation - AllocationOffset)/sizeof(T));
+    }
+
+    /**
+     * @brief Allocate (but not construct) an array of given capacity and reservation
+     *
+     * Reserves enough pages to fit @p reservedCapacity or @p capacity,
+     * whichever is larger, and commits enough pages to fit @p capacity.
+     */
+    static T* allocate(std::size_t capacity, std::size_t reservedCapacity);
+
+    /**
+     * @brief Reallocate an array to given capacity
+     *
+     * If @p newCapacity fits into the reserved range, commits more pages
+     * and leaves @p array unchanged. Otherwise reserves a new range twice
+     * the size, move-constructs @p prevSize elements from @p array into it,
+     * calls destructors on the original elements, calls @ref deallocate()
+     * and updates the @p array reference to point to the new array.
+     */
+    static void reallocate(T*& array, std::size_t prevSize, std::size_t newCapacity);
+
+    /**
+     * @brief Deallocate an array
+     *
+     * Releases the whole reserved range.
+     */
+    static void deallocate(T* data) {
+        if(data) Implementation::virtualDeallocate(reinterpret_cast<char*>(base(data)));
+    }
+
+    /**
+     * @brief Grow the array
+     *
+     * Behaves the same as @ref Containers::ArrayNewAllocator::grow(), with
+     * the result rounded up to fill whole pages. If the grown capacity
+     * wouldn't fit into the reserved range but @p desired would, returns
+     * the reserved capacity instead, to make use of the whole range before
+     * moving to a new one.
+     */
+    static std::size_t grow(T* array, std::size_t desired);
+
+    /**
+     * @brief Array capacity
+     *
+     * Retrieves the committed capacity from the header stored before the
+     * front of the @p array.
+     */
+    static std::size_t capacity(T* array) {
+        return (reinterpret_cast<std::size_t*>(base(array))[1] - AllocationOffset)/sizeof(T);
+    }
+
+    /**
+     * @brief Reserved capacity
+     *
+     * Retrieves the reserved capacity from the header stored before the
+     * front of the @p array. Always at least @ref capacity().
+     */
+    static std::size_t reservedCapacity(T* array) {
+        return (reinterpret_cast<std::size_t*>(base(array))[0] - AllocationOffset)/sizeof(T);
+    }
+
+    /**
+     * @brief Array base address
+     *
+     * Returns the address with @ref AllocationOffset subtracted.
+     */
+    static void* base(T* array) {
+        return reinterpret_cast<char*>(array) - AllocationOffset;
+    }
+
+    /**
+     * @brief Array deleter
+     *
+     * Calls a destructor on @p size elements and then delegates into
+     * @ref deallocate().
+     */
+    static void deleter(T* data, std::size_t size) {
+        Containers::Implementation::arrayDestruct<T>(data, data + size);
+        deallocate(data);
+    }
+};
+
+/**
+@brief Create an empty growable array with given reserved capacity
+@m_since_latest
+
+Reserves enough address space for @p reservedCapacity elements of @p T and
+returns an empty array using @ref ArrayVirtualAllocator, which can be then
+grown using @ref Containers::arrayAppend() and other functions without moving
+the data as long as the size stays within @p reservedCapacity. Only the first
+page is committed at this point. Example usage:
+
+@snippet Utility.cpp reserveVirtual
+
+See the @ref ArrayVirtualAllocator documentation for more information.
+*/
+template<class T> Containers::Array<T> reserveVirtual(std::size_t reservedCapacity) {
+    return Containers::Array<T>{ArrayVirtualAllocator<T>::allocate(0, reservedCapacity), 0, ArrayVirtualAllocator<T>::deleter};
+}
+
+template<class T> T* ArrayVirtualAllocator<T>::allocate(const std::size_t capacity, const std::size_t reservedCapacity) {
+    return reinterpret_cast<T*>(Implementation::virtualAllocate(
+        (reservedCapacity < capacity ? capacity : reservedCapacity)*sizeof(T) + AllocationOffset,
+        capacity*sizeof(T) + AllocationOffset) + AllocationOffset);
+}
+
+template<class T> void ArrayVirtualAllocator<T>::reallocate(T*& array, const std::size_t prevSize, const std::size_t newCapacity) {
+    if(Implementation::virtualCommit(reinterpret_cast<char*>(base(array)), newCapacity*sizeof(T) + AllocationOffset))
+        return;
+
+    const std::size_t reserved = 2*reservedCapacity(array);
+    T* const newArray = allocate(newCapacity, reserved);
+    Containers::Implementation::arrayMoveConstruct<T>(array, newArray, prevSize);
+    Containers::Implementation::arrayDestruct<T>(array, array + prevSize);
+    deallocate(array);
+    array = newArray;
+}
+
+template<class T> std::size_t ArrayVirtualAllocator<T>::grow(T* const array, const std::size_t desired) {
+    const std::size_t current = array ? capacity(array) : 0;
+    const std::size_t pageSize = Implementation::virtualPageSize();
+    const std::size_t bytes = Containers::Implementation::arrayGrowth<T>(current, desired)*sizeof(T) + AllocationOffset;
+    std::size_t grown = ((bytes + pageSize - 1)/pageSize*pageSize - AllocationOffset)/sizeof(T);
+
+    if(array) {
+        const std::size_t reserved = reservedCapacity(array);
+        if(grown > reserved && desired <= reserved) grown = reserved;
+    }
+
+    return grown;
+}
+#else
+#error this header is available only on Unix and non-RT Windows
+#endif
+
+}}
+
+#endif
@@ -92,7 +92,9 @@
 #include "Corrade/Containers/Optional.h"
 #include "Corrade/Utility/Debug.h"
 #include "Corrade/Utility/DebugStl.h"
+#include "Corrade/Utility/Sha1.h"
 #include "Corrade/Utility/String.h"
+#include "Corrade/Utility/Implementation/parallel.h"
 
 /* Unicode helpers for Windows */
 #ifdef CORRADE_TARGET_WINDOWS
@@ -834,6 +836,149 @@ bool copy(const std::string& from, const std::string& to) {
     return true;
 }
 
+namespace {
+
+#if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+/* Maps the file for hashFile() and hashFileChunked() if it has a known
+   non-zero size, as empty and non-seekable files can't be mapped. Some
+   special files report a size but then fail to map, so errors are silenced
+   and nullptr is returned to make the caller fall back to reading instead. */
+Containers::Array<const char, MapDeleter> mapForHashing(std::FILE* const f, const std::string& filename) {
+    const Containers::Optional<std::size_t> size = fileSize(f);
+    if(!size || !*size) return nullptr;
+
+    Containers::Array<const char, MapDeleter> data;
+    {
+        Error silenceError{nullptr};
+        data = mapRead(filename);
+    }
+
+    #if defined(CORRADE_TARGET_UNIX) && defined(MADV_SEQUENTIAL)
+    /* Makes the kernel read ahead more aggressively and drop pages that were
+       already processed sooner, which matters for files larger than RAM */
+    if(data) madvise(const_cast<char*>(data.data()), data.size(), MADV_SEQUENTIAL);
+    #endif
+
+    return data;
+}
+#endif
+
+/* Splits the chunks into consecutive ranges, each hashed with
+   Sha1::digestInto() on its own thread, the first one on the calling
+   thread. Returns once all chunks are hashed. */
+void hashChunks(const Containers::ArrayView<const Containers::ArrayView<const char>> chunks, const Containers::ArrayView<Sha1::Digest> digests, const std::size_t threadCount) {
+    std::size_t byteSize = 0;
+    for(const Containers::ArrayView<const char> chunk: chunks)
+        byteSize += chunk.size();
+
+    const std::size_t chunkCount = Utility::Implementation::parallelChunkCount(threadCount, chunks.size(), byteSize);
+    if(chunkCount == 1) return Sha1::digestInto(chunks, digests);
+
+    Utility::Implementation::parallelFor(chunks.size(), chunkCount, [chunks, digests](const std::size_t begin, const std::size_t end) {
+        Sha1::digestInto(chunks.slice(begin, end), digests.slice(begin, end));
+    });
+}
+
+}
+
+Containers::Optional<HashDigest<20>> hashFile(const std::string& filename) {
+    /* Special case for "Unicode" Windows support */
+    #ifndef CORRADE_TARGET_WINDOWS
+    std::FILE* const f = std::fopen(filename.data(), "rb");
+    #else
+    std::FILE* const f = _wfopen(widen(filename).data(), L"rb");
+    #endif
+    if(!f) {
+        Error{} << "Utility::Directory::hashFile(): can't open" << filename;
+        return {};
+    }
+
+    Containers::ScopeGuard exit{f, std::fclose};
+
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    if(const Containers::Array<const char, MapDeleter> data = mapForHashing(f, filename))
+        return (Sha1{} << Containers::ArrayView<const char>{data}).digest();
+    #endif
+
+    /* Otherwise read the file in 128 kB blocks, same as in copy() */
+    #if defined(_POSIX_C_SOURCE) && _POSIX_C_SOURCE >= 200112L
+    posix_fadvise(fileno(f), 0, 0, POSIX_FADV_SEQUENTIAL);
+    #endif
+    Sha1 sha1;
+    char buffer[128*1024];
+    std::size_t count;
+    while((count = std::fread(buffer, 1, Containers::arraySize(buffer), f)))
+        sha1 << Containers::ArrayView<const char>{buffer, count};
+
+    return sha1.digest();
+}
+
+Containers::Optional<HashDigest<20>> hashFileChunked(const std::string& filename, const std::size_t chunkSize, const std::size_t threadCount) {
+    CORRADE_ASSERT(chunkSize,
+        "Utility::Directory::hashFileChunked(): expected a non-zero chunk size", {});
+
+    /* Special case for "Unicode" Windows support */
+    #ifndef CORRADE_TARGET_WINDOWS
+    std::FILE* const f = std::fopen(filename.data(), "rb");
+    #else
+    std::FILE* const f = _wfopen(widen(filename).data(), L"rb");
+    #endif
+    if(!f) {
+        Error{} << "Utility::Directory::hashFileChunked(): can't open" << filename;
+        return {};
+    }
+
+    Containers::ScopeGuard exit{f, std::fclose};
+
+    /* The result is a digest of all chunk digests */
+    Sha1 sha1;
+
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    if(const Containers::Array<const char, MapDeleter> data = mapForHashing(f, filename)) {
+        /* Written so it doesn't overflow for huge chunk sizes, such as
+           ~std::size_t{} to have the whole file in a single chunk */
+        const std::size_t chunkCount = data.size()/chunkSize + (data.size() % chunkSize ? 1 : 0);
+        Containers::Array<Containers::ArrayView<const char>> chunks{chunkCount};
+        for(std::size_t i = 0; i != chunkCount; ++i)
+            chunks[i] = data.slice(i*chunkSize, i*chunkSize + std::min(data.size() - i*chunkSize, chunkSize));
+
+        Containers::Array<Sha1::Digest> digests{chunkCount};
+        hashChunks(chunks, digests, threadCount);
+        for(const Sha1::Digest& digest: digests)
+            sha1 << Containers::ArrayView<const char>{digest.byteArray(), Sha1::DigestSize};
+
+        return sha1.digest();
+    }
+    #endif
+
+    /* Otherwise read and hash one chunk after another on this thread. The
+       chunk size can be arbitrarily large, so read in at most 128 kB blocks
+       same as in hashFile() and hash each chunk incrementally. */
+    #if defined(_POSIX_C_SOURCE) && _POSIX_C_SOURCE >= 200112L
+    posix_fadvise(fileno(f), 0, 0, POSIX_FADV_SEQUENTIAL);
+    #endif
+    Containers::Array<char> buffer{NoInit, std::min(chunkSize, std::size_t{128*1024})};
+    Sha1 chunkSha1;
+    std::size_t chunkFilled = 0;
+    std::size_t count;
+    while((count = std::fread(buffer, 1, std::min(buffer.size(), chunkSize - chunkFilled), f))) {
+        chunkSha1 << Containers::ArrayView<const char>{buffer, count};
+        chunkFilled += count;
+        if(chunkFilled == chunkSize) {
+            const Sha1::Digest digest = chunkSha1.digest();
+            sha1 << Containers::ArrayView<const char>{digest.byteArray(), Sha1::DigestSize};
+            chunkSha1 = Sha1{};
+            chunkFilled = 0;
+        }
+    }
+    if(chunkFilled) {
+        const Sha1::Digest digest = chunkSha1.digest();
+        sha1 << Containers::ArrayView<const char>{digest.byteArray(), Sha1::DigestSize};
+    }
+
+    return sha1.digest();
+}
+
 #ifdef CORRADE_TARGET_UNIX
 void MapDeleter::operator()(const char* const data, const std::size_t size) {
     if(data && munmap(const_cast<char*>(data), size) == -1)
@@ -36,6 +36,7 @@
 #include "Corrade/Containers/EnumSet.h"
 #include "Corrade/Utility/StlForwardString.h"
 #include "Corrade/Utility/StlForwardVector.h"
+#include "Corrade/Utility/Utility.h"
 #include "Corrade/Utility/visibility.h"
 
 #ifdef CORRADE_BUILD_DEPRECATED
@@ -507,6 +508,57 @@ size:
 */
 CORRADE_UTILITY_EXPORT bool copy(const std::string& from, const std::string& to);
 
+/**
+@brief SHA-1 digest of a file
+@m_since_latest
+
+Gives the same result as @cpp Utility::Sha1::digest(Directory::read(filename)) @ce,
+but without reading the whole file into memory first. On
+@ref CORRADE_TARGET_UNIX "Unix" and non-RT
+@ref CORRADE_TARGET_WINDOWS "Windows" platforms the file is mapped using
+@ref mapRead() and, where supported, the kernel is advised about the
+sequential access pattern to make its readahead more aggressive. Files that
+can't be mapped, such as non-seekable or special files, and files on other
+platforms are read in 128 kB blocks instead. Returns
+@ref Containers::NullOpt and prints a message to @ref Error if the file can't
+be read. Expects that the filename is in UTF-8.
+
+Include @ref Corrade/Utility/AbstractHash.h and
+@ref Corrade/Containers/Optional.h in order to use the returned value.
+@see @ref hashFileChunked(), @ref Sha1
+*/
+CORRADE_UTILITY_EXPORT Containers::Optional<HashDigest<20>> hashFile(const std::string& filename);
+
+/**
+@brief Chunked SHA-1 digest of a file
+@m_since_latest
+
+Splits the file into consecutive chunks of @p chunkSize bytes, with the last
+one possibly shorter, calculates a SHA-1 digest of each and returns a SHA-1
+digest of all chunk digests concatenated together. An empty file has no
+chunks, giving the digest of an empty string. The result is thus different
+from @ref hashFile(), but since the chunks are independent, they're hashed
+using @ref Sha1::digestInto() on up to @p threadCount threads, one of which is
+the calling thread. If @p threadCount is @cpp 0 @ce,
+@ref std::thread::hardware_concurrency() is used. Same as with
+@ref Utility::copyParallel(), the thread count is further limited so each
+thread hashes at least 512 kB. The result doesn't depend on the thread count,
+only on @p chunkSize, which is expected to be non-zero. Passing
+@cpp ~std::size_t{} @ce hashes the whole file as a single chunk.
+
+The file is accessed the same way as in @ref hashFile(). If the file can't be
+mapped, it's read and hashed one chunk after another on the calling thread.
+If Corrade is built without @ref CORRADE_UTILITY_USE_THREADS, which is the
+default, all chunks are hashed on the calling thread. Returns
+@ref Containers::NullOpt and prints a message to @ref Error if the file can't
+be read. Expects that the filename is in UTF-8.
+
+Include @ref Corrade/Utility/AbstractHash.h and
+@ref Corrade/Containers/Optional.h in order to use the returned value.
+@experimental
+*/
+CORRADE_UTILITY_EXPORT Containers::Optional<HashDigest<20>> hashFileChunked(const std::string& filename, std::size_t chunkSize = 1024*1024, std::size_t threadCount = 0);
+
 #if defined(DOXYGEN_GENERATING_OUTPUT) || defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
 /**
 @brief Map file for reading and writing
@@ -137,8 +137,11 @@ Example of formating of CSS colors with correct width:
 
 This function always does exactly one allocation for the output array. See
 @ref formatInto(std::string&, std::size_t, const char*, const Args&... args)
-for an ability to write into an existing string (with at most one reallocation)
-and @ref formatInto(const Containers::ArrayView<char>&, const char*, const Args&... args)
+for an ability to write into an existing string (with at most one reallocation),
+@ref formatInto(Containers::Array<char>&, std::size_t, const char*, const Args&... args)
+for incrementally building a string in a growable array with amortized
+allocations (@cpp #include @ce @ref Corrade/Utility/FormatGrowable.h in
+addition) and @ref formatInto(const Containers::ArrayView<char>&, const char*, const Args&... args)
 for a completely zero-allocation alternative. There is also
 @ref formatInto(std::FILE*, const char*, const Args&... args) for writing to
 files or standard output.
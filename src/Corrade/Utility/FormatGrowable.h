@@ -0,0 +1,97 @@
+#ifndef Corrade_Utility_FormatGrowable_h
+#define Corrade_Utility_FormatGrowable_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Corrade::Utility::formatInto(Containers::Array<char>&, std::size_t, const char*, const Args&... args)
+ * @m_since_latest
+ * @experimental
+ */
+
+#include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/Utility/Format.h"
+
+namespace Corrade { namespace Utility {
+
+/**
+@brief Format a string into a growable array
+@m_since_latest
+
+Takes an existing @p array and writes the formatted content starting at
+@p offset. If the array is not large enough, it's enlarged using
+@ref Containers::arrayAppend(Array<T>&, NoInitT, std::size_t), which means
+the growth is amortized the same way as with any other growable array
+operation and repeatedly appending to the end is done without reallocating
+every time. Returns final written size (which might be less than the array
+size if inserting in the middle). If @p offset is past the end, the gap is
+zero-filled. *Does not* write any terminating @cpp '\0' @ce character.
+Example usage:
+
+@snippet Utility.cpp formatInto-growable
+
+Once the array is filled, it can be turned into a @ref Containers::String
+without copying the data using @ref Containers::String::String(Array<char>&&).
+See @ref format() for more information about usage and templating language.
+
+@experimental
+*/
+template<class ...Args> std::size_t formatInto(Containers::Array<char>& array, std::size_t offset, const char* format, const Args&... args);
+
+template<class ...Args> std::size_t formatInto(Containers::Array<char>& array, const std::size_t offset, const char* format, const Args&... args) {
+    Implementation::BufferFormatter formatters[sizeof...(args) + 1] { Implementation::BufferFormatter{args}..., {} };
+    const std::size_t end = offset + Implementation::formatInto(nullptr, format, formatters, sizeof...(args));
+
+    /* The growing is done here and not inside the library so it's using the
+       same allocator as arrayAppend() calls in user code -- growable arrays
+       are detected based on the deleter pointer, which differs across shared
+       library boundaries. Since printf() always wants to print the null
+       terminator, grow by one more byte to make room for it and then remove
+       it again, keeping the capacity for a subsequent append. */
+    if(end >= array.size()) {
+        const std::size_t prevSize = array.size();
+        Containers::arrayAppend(array, Corrade::NoInit, end + 1 - prevSize);
+        /* Zero-fill the gap if writing past the end, same as std::string's
+           resize() would do */
+        for(char *it = array + prevSize, *gapEnd = array + offset; it < gapEnd; ++it)
+            *it = '\0';
+        Implementation::formatInto(array.suffix(offset), format, formatters, sizeof...(args));
+        Containers::arrayRemoveSuffix(array, 1);
+
+    /* Otherwise we're inserting in the middle, preserve the character that
+       would get overwritten by the null terminator */
+    } else {
+        const char next = array[end];
+        Implementation::formatInto(array.suffix(offset), format, formatters, sizeof...(args));
+        array[end] = next;
+    }
+
+    return end;
+}
+
+}}
+
+#endif
@@ -0,0 +1,137 @@
+#ifndef Corrade_Utility_Implementation_cpu_h
+#define Corrade_Utility_Implementation_cpu_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Runtime CPU feature detection and function attributes for code paths that
+   use instruction sets not enabled for the whole build. The usual pattern is
+
+    #ifdef CORRADE_ENABLE_AVX2
+    CORRADE_ENABLE_AVX2 void fooAvx2() { ... }
+    #endif
+
+   and then picking the implementation based on what cpuFeatures() reports.
+   On MSVC the intrinsics are usable without any attribute so the macros are
+   defined to nothing, on GCC and Clang (including clang-cl) they're a
+   __target__ attribute. GCC before 4.9 doesn't allow using intrinsics from
+   target-attributed functions if the instruction set isn't enabled globally,
+   so nothing is defined there. */
+
+#include "Corrade/configure.h"
+
+#ifdef CORRADE_TARGET_MSVC
+#include <intrin.h>
+#elif defined(CORRADE_TARGET_X86) && defined(CORRADE_TARGET_GCC)
+#include <cpuid.h>
+#endif
+
+#if defined(CORRADE_TARGET_X86) && (defined(CORRADE_TARGET_MSVC) || defined(CORRADE_TARGET_CLANG) || (defined(CORRADE_TARGET_GCC) && __GNUC__*100 + __GNUC_MINOR__ >= 409))
+/* clang-cl needs the attributes same as Clang */
+#if defined(CORRADE_TARGET_MSVC) && !defined(CORRADE_TARGET_CLANG)
+#define CORRADE_ENABLE_SSE2
+#define CORRADE_ENABLE_SSE41
+#define CORRADE_ENABLE_POPCNT
+#define CORRADE_ENABLE_AVX2
+#define CORRADE_ENABLE_SHA
+#else
+#define CORRADE_ENABLE_SSE2 __attribute__((__target__("sse2")))
+#define CORRADE_ENABLE_SSE41 __attribute__((__target__("sse4.1")))
+#define CORRADE_ENABLE_POPCNT __attribute__((__target__("popcnt")))
+#define CORRADE_ENABLE_AVX2 __attribute__((__target__("avx2")))
+/* The SHA instructions are useless without SSE4.1 shuffles and extracts */
+#define CORRADE_ENABLE_SHA __attribute__((__target__("sha,sse4.1")))
+#endif
+#endif
+
+namespace Corrade { namespace Utility { namespace Implementation {
+
+enum: unsigned {
+    CpuSse2 = 1 << 0,
+    CpuSse41 = 1 << 1,
+    CpuPopcnt = 1 << 2,
+    CpuAvx2 = 1 << 3,
+    CpuSha = 1 << 4
+};
+
+#ifdef CORRADE_TARGET_X86
+inline unsigned detectCpuFeatures() {
+    unsigned out = 0;
+
+    /* Leaf 0 gives the max supported leaf, leaf 1 the basic feature bits,
+       leaf 7 the extended ones */
+    int regs[4]{};
+    #ifdef CORRADE_TARGET_MSVC
+    __cpuid(regs, 0);
+    const unsigned maxLeaf = regs[0];
+    __cpuid(regs, 1);
+    #elif defined(CORRADE_TARGET_GCC)
+    const unsigned maxLeaf = __get_cpuid_max(0, nullptr);
+    if(maxLeaf >= 1)
+        __cpuid(1, regs[0], regs[1], regs[2], regs[3]);
+    #endif
+    if(regs[3] & (1 << 26)) out |= CpuSse2;
+    if(regs[2] & (1 << 19)) out |= CpuSse41;
+    if(regs[2] & (1 << 23)) out |= CpuPopcnt;
+
+    /* AVX registers are usable only if the OS saves them on context switch,
+       which is what OSXSAVE + XGETBV tell us */
+    bool osSavesYmm = false;
+    if((regs[2] & (1 << 27)) && (regs[2] & (1 << 28))) {
+        #ifdef CORRADE_TARGET_MSVC
+        const unsigned long long xcr0 = _xgetbv(0);
+        #elif defined(CORRADE_TARGET_GCC)
+        unsigned eax, edx;
+        __asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+        const unsigned long long xcr0 = eax|(static_cast<unsigned long long>(edx) << 32);
+        #endif
+        osSavesYmm = (xcr0 & 0x06) == 0x06;
+    }
+
+    if(maxLeaf >= 7) {
+        #ifdef CORRADE_TARGET_MSVC
+        __cpuidex(regs, 7, 0);
+        #elif defined(CORRADE_TARGET_GCC)
+        __cpuid_count(7, 0, regs[0], regs[1], regs[2], regs[3]);
+        #endif
+        if(osSavesYmm && (regs[1] & (1 << 5))) out |= CpuAvx2;
+        if(regs[1] & (1 << 29)) out |= CpuSha;
+    }
+
+    return out;
+}
+#else
+inline unsigned detectCpuFeatures() { return 0; }
+#endif
+
+/* Detected just once, the result is a combination of the Cpu* values above */
+inline unsigned cpuFeatures() {
+    static const unsigned features = detectCpuFeatures();
+    return features;
+}
+
+}}}
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef Corrade_Utility_Implementation_parallel_h
+#define Corrade_Utility_Implementation_parallel_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Splitting work into chunks processed on multiple threads, shared by
+   Algorithms.cpp and Directory.cpp */
+
+#include "Corrade/configure.h"
+#include "Corrade/Containers/Array.h"
+
+#ifdef CORRADE_UTILITY_USE_THREADS
+#include <thread>
+#endif
+
+namespace Corrade { namespace Utility { namespace Implementation {
+
+/* Chunks smaller than this aren't worth the overhead of spawning a thread.
+   With 512 kB, copying or hashing a chunk takes at least a few tens of
+   microseconds, which is an order of magnitude more than what it takes to
+   spawn and join a thread on common platforms. */
+constexpr std::size_t ParallelMinChunkSize = 512*1024;
+
+/* Decides how many chunks to split given work into, based on the requested
+   thread count, how many items the split dimension has and how many bytes
+   the whole work touches. Returns 1 if the work should be done just on the
+   calling thread. */
+inline std::size_t parallelChunkCount(std::size_t threadCount, const std::size_t splitSize, const std::size_t byteSize) {
+    #ifdef CORRADE_UTILITY_USE_THREADS
+    /* hardware_concurrency() can return 0 if it can't tell */
+    if(!threadCount) threadCount = std::thread::hardware_concurrency();
+    #else
+    threadCount = 1;
+    #endif
+
+    std::size_t count = byteSize/ParallelMinChunkSize;
+    if(count > threadCount) count = threadCount;
+    if(count > splitSize) count = splitSize;
+    return count ? count : 1;
+}
+
+/* Calls function(begin, end) for chunkCount consecutive ranges covering
+   [0, count), all but the first on a newly spawned thread. Returns once all
+   ranges are processed. */
+template<class F> void parallelFor(const std::size_t count, const std::size_t chunkCount, const F& function) {
+    #ifdef CORRADE_UTILITY_USE_THREADS
+    Containers::Array<std::thread> threads{chunkCount - 1};
+    for(std::size_t i = 1; i < chunkCount; ++i)
+        threads[i - 1] = std::thread{function, i*count/chunkCount, (i + 1)*count/chunkCount};
+    function(std::size_t{}, count/chunkCount);
+    for(std::thread& thread: threads) thread.join();
+    #else
+    static_cast<void>(chunkCount);
+    function(std::size_t{}, count);
+    #endif
+}
+
+}}}
+
+#endif
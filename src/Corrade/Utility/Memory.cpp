@@ -0,0 +1,288 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Memory.h"
+
+#if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+#ifdef CORRADE_TARGET_UNIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#else
+#include <cstdio>
+#endif
+#else
+#define WIN32_LEAN_AND_MEAN 1
+#define VC_EXTRALEAN
+#include <windows.h>
+#endif
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+#include "Corrade/Utility/ArrayVirtualAllocator.h"
+#include "Corrade/Utility/Assert.h"
+#include "Corrade/Utility/Debug.h"
+#endif
+
+namespace Corrade { namespace Utility {
+
+#if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+namespace Implementation {
+
+namespace {
+
+std::size_t roundUpToPage(const std::size_t size) {
+    const std::size_t pageSize = virtualPageSize();
+    return (size + pageSize - 1)/pageSize*pageSize;
+}
+
+/* The allocator interface has no way to report a failure, so it's treated
+   the same as running out of memory */
+void virtualFailed(const char* const what, const std::size_t size) {
+    #ifdef CORRADE_TARGET_UNIX
+    Error{} << "Utility::ArrayVirtualAllocator: can't" << what << size << "bytes:" << std::strerror(errno);
+    #else
+    Error{} << "Utility::ArrayVirtualAllocator: can't" << what << size << "bytes:" << GetLastError();
+    #endif
+    std::abort();
+}
+
+}
+
+std::size_t virtualPageSize() {
+    #ifdef CORRADE_TARGET_UNIX
+    static const std::size_t pageSize = sysconf(_SC_PAGESIZE);
+    #else
+    static const std::size_t pageSize = [] {
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return std::size_t(info.dwPageSize);
+    }();
+    #endif
+    return pageSize;
+}
+
+char* virtualAllocate(std::size_t reserved, std::size_t committed) {
+    reserved = roundUpToPage(reserved);
+    committed = roundUpToPage(committed);
+
+    /* Reserve the whole range without any access, so it doesn't count
+       towards the commit limit, and then make the committed prefix usable */
+    #ifdef CORRADE_TARGET_UNIX
+    void* const data = mmap(nullptr, reserved, PROT_NONE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    if(data == MAP_FAILED) virtualFailed("reserve", reserved);
+    if(mprotect(data, committed, PROT_READ|PROT_WRITE) != 0)
+        virtualFailed("commit", committed);
+    #else
+    void* const data = VirtualAlloc(nullptr, reserved, MEM_RESERVE, PAGE_NOACCESS);
+    if(!data) virtualFailed("reserve", reserved);
+    if(!VirtualAlloc(data, committed, MEM_COMMIT, PAGE_READWRITE))
+        virtualFailed("commit", committed);
+    #endif
+
+    std::size_t* const header = static_cast<std::size_t*>(data);
+    header[0] = reserved;
+    header[1] = committed;
+    return static_cast<char*>(data);
+}
+
+bool virtualCommit(char* const base, std::size_t committed) {
+    std::size_t* const header = reinterpret_cast<std::size_t*>(base);
+    committed = roundUpToPage(committed);
+    if(committed > header[0]) return false;
+    if(committed <= header[1]) return true;
+
+    #ifdef CORRADE_TARGET_UNIX
+    if(mprotect(base + header[1], committed - header[1], PROT_READ|PROT_WRITE) != 0)
+    #else
+    if(!VirtualAlloc(base + header[1], committed - header[1], MEM_COMMIT, PAGE_READWRITE))
+    #endif
+        virtualFailed("commit", committed);
+    header[1] = committed;
+    return true;
+}
+
+void virtualDeallocate(char* const base) {
+    #ifdef CORRADE_TARGET_UNIX
+    CORRADE_INTERNAL_ASSERT_OUTPUT(munmap(base, reinterpret_cast<std::size_t*>(base)[0]) == 0);
+    #else
+    CORRADE_INTERNAL_ASSERT_OUTPUT(VirtualFree(base, 0, MEM_RELEASE));
+    #endif
+}
+
+}
+
+namespace {
+
+#ifdef CORRADE_TARGET_UNIX
+/* An unnamed file that lives only as long as there are references to it.
+   Returns -1 on failure, with errno set. */
+int anonymousFile() {
+    #ifdef __linux__
+    /* Not using memfd_create() directly as it's only in glibc 2.27+ and
+       Android API 30+, the syscall is there since Linux 3.17. 1 is
+       MFD_CLOEXEC. */
+    const int fd = syscall(SYS_memfd_create, "corrade-magic-ring-buffer", 1u);
+    #else
+    /* No memfd on Apple or BSDs, use a shared memory object with a unique
+       name that's unlinked right after */
+    static int counter = 0;
+    char name[64];
+    std::snprintf(name, sizeof(name), "/corrade-magic-ring-buffer-%ld-%d", long(getpid()), counter++);
+    const int fd = shm_open(name, O_RDWR|O_CREAT|O_EXCL, 0600);
+    if(fd != -1) shm_unlink(name);
+    #endif
+    return fd;
+}
+#endif
+
+std::size_t mappingGranularity() {
+    #ifdef CORRADE_TARGET_UNIX
+    return Implementation::virtualPageSize();
+    #else
+    static const std::size_t granularity = [] {
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return std::size_t(info.dwAllocationGranularity);
+    }();
+    return granularity;
+    #endif
+}
+
+}
+
+MagicRingBuffer::MagicRingBuffer(std::size_t capacity): _data{}, _capacity{}, _offset{}, _size{} {
+    CORRADE_ASSERT(capacity, "Utility::MagicRingBuffer: expected non-zero capacity", );
+    const std::size_t granularity = mappingGranularity();
+    capacity = (capacity + granularity - 1)/granularity*granularity;
+
+    /* On failure the instance stays in the NoCreate state, so the destructor
+       has nothing to release */
+    #ifdef CORRADE_TARGET_UNIX
+    const int fd = anonymousFile();
+    if(fd == -1) {
+        Error{} << "Utility::MagicRingBuffer: can't create the backing file:" << std::strerror(errno);
+        return;
+    }
+    if(ftruncate(fd, capacity) != 0) {
+        Error{} << "Utility::MagicRingBuffer: can't resize the backing file to" << capacity << "bytes:" << std::strerror(errno);
+        close(fd);
+        return;
+    }
+
+    /* Reserve a range for both copies first so nothing else gets mapped
+       in between, then map the file over each half */
+    char* const data = static_cast<char*>(mmap(nullptr, 2*capacity, PROT_NONE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0));
+    if(data == MAP_FAILED) {
+        Error{} << "Utility::MagicRingBuffer: can't reserve" << 2*capacity << "bytes of address space:" << std::strerror(errno);
+        close(fd);
+        return;
+    }
+    if(mmap(data, capacity, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_FIXED, fd, 0) != data ||
+       mmap(data + capacity, capacity, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_FIXED, fd, 0) != data + capacity) {
+        Error{} << "Utility::MagicRingBuffer: can't map the backing file:" << std::strerror(errno);
+        munmap(data, 2*capacity);
+        close(fd);
+        return;
+    }
+
+    /* The mappings keep the file alive */
+    close(fd);
+    #else
+    HANDLE mapping = CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, DWORD(std::uint64_t(capacity) >> 32), DWORD(capacity & 0xffffffffu), nullptr);
+    if(!mapping) {
+        Error{} << "Utility::MagicRingBuffer: can't create the file mapping:" << GetLastError();
+        return;
+    }
+
+    /* There's no way to map a view into a reserved range without
+       VirtualAlloc2() from Windows 10, so find a free range, release it and
+       map both views there. Another thread may grab the range in the
+       meantime, in which case try again. */
+    char* data = nullptr;
+    for(int attempt = 0; attempt != 16 && !data; ++attempt) {
+        char* const candidate = static_cast<char*>(VirtualAlloc(nullptr, 2*capacity, MEM_RESERVE, PAGE_NOACCESS));
+        if(!candidate) break;
+        VirtualFree(candidate, 0, MEM_RELEASE);
+
+        if(!MapViewOfFileEx(mapping, FILE_MAP_ALL_ACCESS, 0, 0, capacity, candidate))
+            continue;
+        if(!MapViewOfFileEx(mapping, FILE_MAP_ALL_ACCESS, 0, 0, capacity, candidate + capacity)) {
+            UnmapViewOfFile(candidate);
+            continue;
+        }
+
+        data = candidate;
+    }
+
+    if(!data) {
+        Error{} << "Utility::MagicRingBuffer: can't map" << 2*capacity << "bytes of address space:" << GetLastError();
+        CloseHandle(mapping);
+        return;
+    }
+
+    /* The views keep the mapping alive */
+    CloseHandle(mapping);
+    #endif
+
+    _data = data;
+    _capacity = capacity;
+}
+
+MagicRingBuffer::MagicRingBuffer(NoCreateT) noexcept: _data{}, _capacity{}, _offset{}, _size{} {}
+
+MagicRingBuffer::MagicRingBuffer(MagicRingBuffer&& other) noexcept: _data{other._data}, _capacity{other._capacity}, _offset{other._offset}, _size{other._size} {
+    other._data = nullptr;
+    other._capacity = other._offset = other._size = 0;
+}
+
+MagicRingBuffer::~MagicRingBuffer() {
+    if(!_data) return;
+
+    #ifdef CORRADE_TARGET_UNIX
+    munmap(_data, 2*_capacity);
+    #else
+    UnmapViewOfFile(_data);
+    UnmapViewOfFile(_data + _capacity);
+    #endif
+}
+
+MagicRingBuffer& MagicRingBuffer::operator=(MagicRingBuffer&& other) noexcept {
+    using std::swap;
+    swap(_data, other._data);
+    swap(_capacity, other._capacity);
+    swap(_offset, other._offset);
+    swap(_size, other._size);
+    return *this;
+}
+#endif
+
+}}
@@ -27,13 +27,11 @@
 */
 
 /** @file
- * @brief Function @ref Corrade::Utility::allocateAligned()
+ * @brief Function @ref Corrade::Utility::allocateAligned(), class @ref Corrade::Utility::MagicRingBuffer
  * @m_since_latest
  */
 
-/* Not inside System.h because there we don't want the Array include, and
-   this header may grow with utilities for vmem-backed non-reallocating
-   containers or magic ring buffers */
+/* Not inside System.h because there we don't want the Array include */
 
 #include "Corrade/Containers/Array.h"
 #include "Corrade/Containers/initializeHelpers.h"
@@ -291,6 +289,176 @@ template<class T, std::size_t alignment> inline Containers::Array<T> allocateAli
     return allocateAligned<T, alignment>(ValueInit, size);
 }
 
+#if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT)) || defined(DOXYGEN_GENERATING_OUTPUT)
+/**
+@brief Magic ring buffer
+@m_since_latest
+
+A fixed-size byte ring buffer with its storage mapped twice, back to back, in
+virtual memory. Thanks to that, the filled part and the free part of the
+buffer are always accessible as a single contiguous view even if they wrap
+around the end, and neither the producer nor the consumer has to split its
+accesses or copy the data at the wrap boundary.
+
+@snippet Utility.cpp MagicRingBuffer-usage
+
+The producer asks for @ref writeView(), fills a prefix of it and then marks
+the filled part as available with @ref produce(). The consumer takes the
+@ref readView(), processes a prefix of it and then releases the processed
+part with @ref consume(). As the views are plain @ref Containers::ArrayView
+instances, they can be passed directly to APIs such as
+@ref Directory::append() or to parsers expecting contiguous input:
+
+@snippet Utility.cpp MagicRingBuffer-file
+
+The class doesn't do any synchronization, in case the producer and consumer
+live in different threads, access to it has to be guarded externally.
+
+@section Utility-MagicRingBuffer-capacity Buffer capacity
+
+Because the mapping is done with page granularity, the capacity is rounded
+up to a multiple of the page size on @ref CORRADE_TARGET_UNIX "UNIX" systems
+and of the allocation granularity (64 kB) on
+@ref CORRADE_TARGET_WINDOWS "Windows". The buffer occupies twice the capacity
+in address space but only once in physical memory.
+
+@section Utility-MagicRingBuffer-implementation Implementation details
+
+On Linux and Android the storage is an anonymous file created with
+@m_class{m-doc-external} [memfd_create()](https://man.archlinux.org/man/memfd_create.2),
+on other @ref CORRADE_TARGET_UNIX "UNIX" systems a
+@m_class{m-doc-external} [shm_open()](https://man.archlinux.org/man/shm_open.3)
+object that's unlinked right after creation. It's then mapped twice into a
+range of address space reserved with @m_class{m-doc-external} [mmap()](https://man.archlinux.org/man/mmap.2).
+On non-RT @ref CORRADE_TARGET_WINDOWS "Windows" a page-file-backed
+@m_class{m-doc-external} [CreateFileMapping()](https://docs.microsoft.com/en-us/windows/win32/api/winbase/nf-winbase-createfilemappinga)
+is mapped twice using @m_class{m-doc-external} [MapViewOfFileEx()](https://docs.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-mapviewoffileex).
+Not available on other platforms.
+@experimental
+*/
+class CORRADE_UTILITY_EXPORT MagicRingBuffer {
+    public:
+        /**
+         * @brief Constructor
+         * @param capacity  Minimal buffer capacity in bytes. Expected to be
+         *      non-zero, rounded up to a multiple of the page size or
+         *      allocation granularity.
+         *
+         * If the storage can't be created, a message is printed to
+         * @ref Error and the instance is left in the same state as
+         * @ref MagicRingBuffer(NoCreateT), with zero @ref capacity().
+         */
+        explicit MagicRingBuffer(std::size_t capacity);
+
+        /**
+         * @brief Construct without creating the buffer
+         *
+         * The instance is equivalent to a moved-from state. Useful in cases
+         * where you will overwrite the instance later anyway. Move another
+         * object over it to make it useful.
+         */
+        explicit MagicRingBuffer(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        MagicRingBuffer(const MagicRingBuffer&) = delete;
+
+        /** @brief Move constructor */
+        MagicRingBuffer(MagicRingBuffer&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Unmaps the storage.
+         */
+        ~MagicRingBuffer();
+
+        /** @brief Copying is not allowed */
+        MagicRingBuffer& operator=(const MagicRingBuffer&) = delete;
+
+        /** @brief Move assignment */
+        MagicRingBuffer& operator=(MagicRingBuffer&& other) noexcept;
+
+        /** @brief Capacity in bytes */
+        std::size_t capacity() const { return _capacity; }
+
+        /** @brief Count of bytes available for reading */
+        std::size_t size() const { return _size; }
+
+        /** @brief Whether the buffer is empty */
+        bool isEmpty() const { return !_size; }
+
+        /** @brief Whether the buffer is full */
+        bool isFull() const { return _size == _capacity; }
+
+        /**
+         * @brief View on the data available for reading
+         *
+         * The view has @ref size() bytes and is contiguous even if the data
+         * wrap around the end of the buffer. It's valid until the next call
+         * to @ref consume() or @ref clear().
+         * @see @ref writeView()
+         */
+        Containers::ArrayView<char> readView() {
+            return {_data + _offset, _size};
+        }
+        Containers::ArrayView<const char> readView() const {
+            return {_data + _offset, _size};
+        } /**< @overload */
+
+        /**
+         * @brief View on the free space available for writing
+         *
+         * The view has @ref capacity() minus @ref size() bytes and is
+         * contiguous even if the free space wraps around the end of the
+         * buffer. It's valid until the next call to @ref produce(),
+         * @ref consume() or @ref clear().
+         * @see @ref readView()
+         */
+        Containers::ArrayView<char> writeView() {
+            return {_data + _offset + _size, _capacity - _size};
+        }
+
+        /**
+         * @brief Make written data available for reading
+         *
+         * Marks first @p size bytes of @ref writeView() as filled. Expects
+         * that @p size is not larger than the free space.
+         */
+        void produce(std::size_t size) {
+            CORRADE_ASSERT(size <= _capacity - _size,
+                "Utility::MagicRingBuffer::produce(): can't produce" << size << "bytes with only" << _capacity - _size << "bytes free", );
+            _size += size;
+        }
+
+        /**
+         * @brief Release read data
+         *
+         * Marks first @p size bytes of @ref readView() as free again.
+         * Expects that @p size is not larger than @ref size().
+         */
+        void consume(std::size_t size) {
+            CORRADE_ASSERT(size <= _size,
+                "Utility::MagicRingBuffer::consume(): can't consume" << size << "bytes with only" << _size << "bytes available", );
+            _offset += size;
+            if(_offset >= _capacity) _offset -= _capacity;
+            _size -= size;
+        }
+
+        /** @brief Release all data */
+        void clear() {
+            _offset = 0;
+            _size = 0;
+        }
+
+    private:
+        char* _data;
+        std::size_t _capacity;
+        /* Start of the readable data, always less than _capacity */
+        std::size_t _offset;
+        std::size_t _size;
+};
+#endif
+
 }}
 
 #endif
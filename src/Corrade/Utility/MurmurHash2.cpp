@@ -26,7 +26,11 @@
 
 #include "MurmurHash2.h"
 
-namespace Corrade { namespace Utility { namespace Implementation {
+#include "Corrade/Containers/ArrayView.h"
+
+namespace Corrade { namespace Utility {
+
+namespace Implementation {
 
 unsigned int MurmurHash2<4>::operator()(const unsigned int seed, const char* const signedData, unsigned int size) const {
     const unsigned char* const data = reinterpret_cast<const unsigned char*>(signedData);
@@ -122,4 +126,124 @@ unsigned long long MurmurHash2<8>::operator()(const unsigned long long seed, con
     return h;
 }
 
-}}}
+}
+
+namespace {
+
+/* Block operations of MurmurHash2A, a Merkle-Damgard variant of the above
+   with the size mixed in at the end. The 32-bit version matches CMurmurHash2A
+   from SMHasher, the 64-bit version is derived from it the same way
+   MurmurHash64A is derived from MurmurHash2. */
+template<std::size_t> struct MurmurHash2ABlock;
+template<> struct MurmurHash2ABlock<4> {
+    static unsigned int read(const unsigned char* const data) {
+        return data[3] << 24 |
+               data[2] << 16 |
+               data[1] <<  8 |
+               data[0];
+    }
+
+    static void mix(unsigned int& h, unsigned int k) {
+        const unsigned int m = 0x5bd1e995;
+        k *= m;
+        k ^= k >> 24;
+        k *= m;
+        h *= m;
+        h ^= k;
+    }
+
+    static unsigned int finalize(unsigned int h) {
+        h ^= h >> 13;
+        h *= 0x5bd1e995;
+        h ^= h >> 15;
+        return h;
+    }
+};
+template<> struct MurmurHash2ABlock<8> {
+    static unsigned long long read(const unsigned char* const data) {
+        return static_cast<unsigned long long>(data[7]) << 56 |
+               static_cast<unsigned long long>(data[6]) << 48 |
+               static_cast<unsigned long long>(data[5]) << 40 |
+               static_cast<unsigned long long>(data[4]) << 32 |
+               static_cast<unsigned long long>(data[3]) << 24 |
+               static_cast<unsigned long long>(data[2]) << 16 |
+               static_cast<unsigned long long>(data[1]) <<  8 |
+               static_cast<unsigned long long>(data[0]);
+    }
+
+    static void mix(unsigned long long& h, unsigned long long k) {
+        const unsigned long long m = 0xc6a4a7935bd1e995ull;
+        k *= m;
+        k ^= k >> 47;
+        k *= m;
+        h ^= k;
+        h *= m;
+    }
+
+    static unsigned long long finalize(unsigned long long h) {
+        h ^= h >> 47;
+        h *= 0xc6a4a7935bd1e995ull;
+        h ^= h >> 47;
+        return h;
+    }
+};
+
+template<std::size_t size> void mix(std::size_t& h, const std::size_t k) {
+    /* std::size_t can be either unsigned long or unsigned long long, go
+       through a temporary to not need to care */
+    auto hash = decltype(MurmurHash2ABlock<size>::finalize(0))(h);
+    MurmurHash2ABlock<size>::mix(hash, k);
+    h = std::size_t(hash);
+}
+
+}
+
+MurmurHash2A& MurmurHash2A::operator<<(const Containers::ArrayView<const char> data) {
+    constexpr std::size_t BlockSize = sizeof(std::size_t);
+
+    const unsigned char* i = reinterpret_cast<const unsigned char*>(data.data());
+    const unsigned char* const end = i + data.size();
+    _size += data.size();
+
+    /* Complete a block that was left incomplete from the previous call */
+    for(; _tailSize && i != end; ++i) {
+        _tail |= std::size_t(*i) << 8*_tailSize;
+        if(++_tailSize == BlockSize) {
+            mix<BlockSize>(_hash, _tail);
+            _tail = 0;
+            _tailSize = 0;
+        }
+    }
+
+    /* Mix whole blocks */
+    for(; std::size_t(end - i) >= BlockSize; i += BlockSize)
+        mix<BlockSize>(_hash, std::size_t(MurmurHash2ABlock<BlockSize>::read(i)));
+
+    /* Save the rest for later */
+    for(; i != end; ++i)
+        _tail |= std::size_t(*i) << 8*_tailSize++;
+
+    return *this;
+}
+
+MurmurHash2A& MurmurHash2A::operator<<(const std::string& data) {
+    return *this << Containers::ArrayView<const char>{data.data(), data.size()};
+}
+
+MurmurHash2A::Digest MurmurHash2A::digest() {
+    /* Mix in the incomplete block and the size */
+    std::size_t h = _hash;
+    mix<sizeof(std::size_t)>(h, _tail);
+    mix<sizeof(std::size_t)>(h, _size);
+    h = std::size_t(MurmurHash2ABlock<sizeof(std::size_t)>::finalize(h));
+
+    /* Reset the state for reuse */
+    _hash = _seed;
+    _tail = 0;
+    _size = 0;
+    _tailSize = 0;
+
+    return Digest::fromByteArray(reinterpret_cast<const char*>(&h));
+}
+
+}}
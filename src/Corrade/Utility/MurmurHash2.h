@@ -27,12 +27,13 @@
 */
 
 /** @file
- * @brief Class @ref Corrade::Utility::MurmurHash2
+ * @brief Class @ref Corrade::Utility::MurmurHash2, @ref Corrade::Utility::MurmurHash2A
  */
 
 #include <cstddef>
 #include <string>
 
+#include "Corrade/Containers/Containers.h"
 #include "Corrade/Utility/AbstractHash.h"
 #include "Corrade/Utility/visibility.h"
 
@@ -46,6 +47,61 @@ namespace Implementation {
     template<> struct CORRADE_UTILITY_EXPORT MurmurHash2<8> {
         unsigned long long operator()(unsigned long long seed, const char* data, unsigned long long size) const;
     };
+
+    /* Same as above, but usable in a constant expression. C++11 constexpr
+       functions can only consist of a single return statement, so the loops
+       are expressed via recursion. */
+    template<std::size_t> struct MurmurHash2Constexpr;
+    template<> struct MurmurHash2Constexpr<4> {
+        static constexpr unsigned int read(const char* data) {
+            return static_cast<unsigned int>(static_cast<unsigned char>(data[3])) << 24 |
+                   static_cast<unsigned int>(static_cast<unsigned char>(data[2])) << 16 |
+                   static_cast<unsigned int>(static_cast<unsigned char>(data[1])) << 8 |
+                   static_cast<unsigned int>(static_cast<unsigned char>(data[0]));
+        }
+        static constexpr unsigned int shift(unsigned int value, int r) {
+            return value ^ value >> r;
+        }
+        static constexpr unsigned int blocks(unsigned int h, const char* data, std::size_t count) {
+            return count ? blocks(h*0x5bd1e995u ^ shift(read(data)*0x5bd1e995u, 24)*0x5bd1e995u, data + 4, count - 1) : h;
+        }
+        static constexpr unsigned int tailBytes(unsigned int h, const char* data, std::size_t count) {
+            return count ? tailBytes(h ^ static_cast<unsigned int>(static_cast<unsigned char>(data[count - 1])) << 8*(count - 1), data, count - 1) : h;
+        }
+        static constexpr unsigned int tail(unsigned int h, const char* data, std::size_t count) {
+            return count ? tailBytes(h, data, count)*0x5bd1e995u : h;
+        }
+        static constexpr unsigned int hash(unsigned int seed, const char* data, std::size_t size) {
+            return shift(shift(tail(blocks(seed^static_cast<unsigned int>(size), data, size/4), data + size/4*4, size%4), 13)*0x5bd1e995u, 15);
+        }
+    };
+    template<> struct MurmurHash2Constexpr<8> {
+        static constexpr unsigned long long read(const char* data) {
+            return static_cast<unsigned long long>(static_cast<unsigned char>(data[7])) << 56 |
+                   static_cast<unsigned long long>(static_cast<unsigned char>(data[6])) << 48 |
+                   static_cast<unsigned long long>(static_cast<unsigned char>(data[5])) << 40 |
+                   static_cast<unsigned long long>(static_cast<unsigned char>(data[4])) << 32 |
+                   static_cast<unsigned long long>(static_cast<unsigned char>(data[3])) << 24 |
+                   static_cast<unsigned long long>(static_cast<unsigned char>(data[2])) << 16 |
+                   static_cast<unsigned long long>(static_cast<unsigned char>(data[1])) << 8 |
+                   static_cast<unsigned long long>(static_cast<unsigned char>(data[0]));
+        }
+        static constexpr unsigned long long shift(unsigned long long value) {
+            return value ^ value >> 47;
+        }
+        static constexpr unsigned long long blocks(unsigned long long h, const char* data, std::size_t count) {
+            return count ? blocks((h ^ shift(read(data)*0xc6a4a7935bd1e995ull)*0xc6a4a7935bd1e995ull)*0xc6a4a7935bd1e995ull, data + 8, count - 1) : h;
+        }
+        static constexpr unsigned long long tailBytes(unsigned long long h, const char* data, std::size_t count) {
+            return count ? tailBytes(h ^ static_cast<unsigned long long>(static_cast<unsigned char>(data[count - 1])) << 8*(count - 1), data, count - 1) : h;
+        }
+        static constexpr unsigned long long tail(unsigned long long h, const char* data, std::size_t count) {
+            return count ? tailBytes(h, data, count)*0xc6a4a7935bd1e995ull : h;
+        }
+        static constexpr unsigned long long hash(unsigned long long seed, const char* data, std::size_t size) {
+            return shift(shift(tail(blocks(seed^(size*0xc6a4a7935bd1e995ull), data, size/8), data + size/8*8, size%8))*0xc6a4a7935bd1e995ull);
+        }
+    };
 }
 
 /**
@@ -55,7 +111,18 @@ Based on algorithm copyright Austin Appleby, http://code.google.com/p/smhasher/
 The digest is 32bit or 64bit, depending on @cpp sizeof(std::size_t) @ce and
 thus usable for hashing in e.g. @ref std::unordered_map.
 
-@todo constexpr algorithm
+The algorithm mixes the total data size into the initial state, so it can only
+hash a single contiguous buffer. For hashing data piece by piece use
+@ref MurmurHash2A instead.
+
+@section Utility-MurmurHash2-constexpr Compile-time hashing
+
+The @ref hash() function is @cpp constexpr @ce and gives the same value as
+@ref operator()() as a @ref std::size_t, which makes it possible to hash
+string literals at compile time, for example to use them as @cpp case @ce
+labels:
+
+@snippet Utility.cpp MurmurHash2-constexpr
 */
 class CORRADE_UTILITY_EXPORT MurmurHash2: public AbstractHash<sizeof(std::size_t)> {
     public:
@@ -73,7 +140,7 @@ class CORRADE_UTILITY_EXPORT MurmurHash2: public AbstractHash<sizeof(std::size_t
          * @brief Constructor
          * @param seed      Seed to initialize the hash
          */
-        constexpr explicit MurmurHash2(std::size_t seed = 0): _seed(seed) {}
+        constexpr explicit MurmurHash2(std::size_t seed = 0): _seed{seed} {}
 
         /** @brief Compute digest of given data */
         Digest operator()(const std::string& data) const {
@@ -92,8 +159,106 @@ class CORRADE_UTILITY_EXPORT MurmurHash2: public AbstractHash<sizeof(std::size_t
             return Digest::fromByteArray(reinterpret_cast<const char*>(&d));
         }
 
+        /**
+         * @brief Compile-time digest of given data
+         * @m_since_latest
+         *
+         * Returns the same value as @ref operator()(), but as a
+         * @ref std::size_t instead of a @ref Digest and usable in a constant
+         * expression. Treats the literal as a string, i.e. without the null
+         * terminator. The calculation is recursive due to C++11
+         * @cpp constexpr @ce restrictions, with one nested call for every 4
+         * or 8 bytes of input on 32- and 64-bit platforms, respectively. With
+         * the default limit of 512 nested calls in GCC and Clang
+         * (@cb{.sh} -fconstexpr-depth @ce), that's at most about 2 kB of
+         * input on 32-bit and 4 kB on 64-bit platforms when evaluated at
+         * compile time. Longer inputs fail to compile in a constant
+         * expression context.
+         * @see @ref Utility-MurmurHash2-constexpr
+         */
+        template<std::size_t size> constexpr std::size_t hash(const char(&data)[size]) const {
+            return Implementation::MurmurHash2Constexpr<sizeof(std::size_t)>::hash(_seed, data, size - 1);
+        }
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        constexpr std::size_t hash(const char* data, std::size_t size) const {
+            return Implementation::MurmurHash2Constexpr<sizeof(std::size_t)>::hash(_seed, data, size);
+        }
+
+    private:
+        std::size_t _seed;
+};
+
+/**
+@brief MurmurHash 2A
+@m_since_latest
+
+Incremental variant of @ref MurmurHash2 by the same author, matching
+@cpp CMurmurHash2A @ce from SMHasher on 32-bit platforms. The original
+algorithm mixes the total data size into the initial state, which isn't known
+upfront when hashing incrementally, this variant mixes it in at the end
+instead. The 64-bit digest is derived from it the same way as
+@cpp MurmurHash64A @ce is derived from @cpp MurmurHash2 @ce. Data is added
+piece by piece using @ref operator<<() and the result retrieved with
+@ref digest(), the same as with @ref Sha1 :
+
+@snippet Utility.cpp MurmurHash2A-incremental
+
+Since the size is mixed in differently, the digest is not the same as the
+@ref MurmurHash2 digest of the same data, so the two shouldn't be mixed for
+the same purpose. The result doesn't depend on how the input is split into
+pieces.
+*/
+class CORRADE_UTILITY_EXPORT MurmurHash2A: public AbstractHash<sizeof(std::size_t)> {
+    public:
+        /**
+         * @brief Digest of given data
+         *
+         * Convenience function for
+         * @cpp (Utility::MurmurHash2A{} << data).digest() @ce.
+         */
+        static Digest digest(const std::string& data) {
+            return (MurmurHash2A{} << data).digest();
+        }
+
+        /**
+         * @brief Constructor
+         * @param seed      Seed to initialize the hash
+         */
+        explicit MurmurHash2A(std::size_t seed = 0): _seed{seed}, _hash{seed}, _tail{}, _size{}, _tailSize{} {}
+
+        /** @brief Add data for digesting */
+        MurmurHash2A& operator<<(Containers::ArrayView<const char> data);
+
+        /** @overload */
+        MurmurHash2A& operator<<(const std::string& data);
+
+        /**
+         * @brief @cpp operator<< @ce with C strings is not allowed
+         *
+         * To clarify your intent with handling the @cpp '\0' @ce delimiter,
+         * cast to @ref Containers::ArrayView or @ref std::string instead.
+         */
+        MurmurHash2A& operator<<(const char*) = delete;
+
+        /**
+         * @brief Digest of all added data
+         *
+         * Mixes in the remaining incomplete block and the total size of all
+         * data added so far. Resets the internal state afterwards, keeping
+         * the seed, so the instance can be reused for another input.
+         */
+        Digest digest();
+
     private:
         std::size_t _seed;
+        std::size_t _hash;
+        std::size_t _tail;
+        std::size_t _size;
+        std::size_t _tailSize;
 };
 
 }}
@@ -30,8 +30,21 @@
 #include <cstddef>
 #include <string>
 
-#include "Corrade/Containers/ArrayView.h"
+#include "Corrade/Containers/Array.h"
 #include "Corrade/Utility/Endianness.h"
+#include "Corrade/Utility/Implementation/cpu.h"
+
+#if defined(CORRADE_ENABLE_SHA) || defined(CORRADE_ENABLE_AVX2)
+#include <immintrin.h>
+#endif
+
+/* Unlike on x86, there's no portable way to detect the ARMv8 crypto extension
+   at runtime, so it's used only if the whole build targets it */
+#if defined(CORRADE_TARGET_ARM) && (defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO))
+#define CORRADE_SHA1_NEON
+#include <cstdint>
+#include <arm_neon.h>
+#endif
 
 namespace Corrade { namespace Utility {
 
@@ -52,6 +65,434 @@ unsigned int leftrotate(unsigned int data, unsigned int shift) {
     return data << shift | data >> (32 - shift);
 }
 
+#ifndef CORRADE_SHA1_NEON
+void processChunksScalar(unsigned int* const digest, const char* data, std::size_t count) {
+    for(; count; --count, data += 64) {
+        /* Extend the data to 80 bytes, make it big endian */
+        unsigned int extended[80];
+        /* Some memory juggling to avoid unaligned reads on platforms that
+           don't like it (Emscripten). The data don't have any endianness, so
+           take the first byte first, as usual. */
+        for(int i = 0; i != 16; ++i)
+            extended[i] =
+                (static_cast<unsigned int>(static_cast<unsigned char>(data[i*4 + 0])) << 24) |
+                (static_cast<unsigned int>(static_cast<unsigned char>(data[i*4 + 1])) << 16) |
+                (static_cast<unsigned int>(static_cast<unsigned char>(data[i*4 + 2])) <<  8) |
+                (static_cast<unsigned int>(static_cast<unsigned char>(data[i*4 + 3])) <<  0);
+        for(int i = 16; i != 80; ++i)
+            extended[i] = leftrotate((extended[i-3] ^ extended[i-8] ^ extended[i-14] ^ extended[i-16]), 1);
+
+        /* Initialize value for this chunk */
+        unsigned int d[5];
+        unsigned int f, constant, temp;
+        std::copy(digest, digest + 5, d);
+
+        /* Main loop */
+        for(int i = 0; i != 80; ++i) {
+            if(i < 20) {
+                f = d[3] ^ (d[1] & (d[2] ^ d[3]));
+                constant = Constants[0];
+            } else if(i < 40) {
+                f = d[1] ^ d[2] ^ d[3];
+                constant = Constants[1];
+            } else if(i < 60) {
+                f = (d[1] & d[2]) | (d[3] & (d[1] | d[2]));
+                constant = Constants[2];
+            } else {
+                f = d[1] ^ d[2] ^ d[3];
+                constant = Constants[3];
+            }
+
+            temp =
+                leftrotate(d[0], 5) + f + d[4] + constant + extended[i];
+            d[4] = d[3];
+            d[3] = d[2];
+            d[2] = leftrotate(d[1], 30);
+            d[1] = d[0];
+            d[0] = temp;
+        }
+
+        /* Add the values to digest */
+        for(int i = 0; i != 5; ++i)
+            digest[i] += d[i];
+    }
+}
+#endif
+
+#ifdef CORRADE_ENABLE_SHA
+/* Four rounds per SHA1RNDS4, the message schedule for the next groups is
+   calculated in parallel with SHA1MSG1 / SHA1MSG2. Each SHA1NEXTE calculates
+   E for the next group from the A of the previous one and adds the message
+   words to it. Only the first group adds the message words to E directly as
+   there's no previous A. */
+CORRADE_ENABLE_SHA void processChunksSha(unsigned int* const digest, const char* data, std::size_t count) {
+    /* The SHA instructions expect the words in big endian and the first word
+       in the highest lane */
+    const __m128i mask = _mm_set_epi64x(0x0001020304050607ll, 0x08090a0b0c0d0e0fll);
+
+    /* ABCD with A in the highest lane, E in the highest lane as well */
+    __m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(digest)), 0x1b);
+    __m128i e0 = _mm_set_epi32(int(digest[4]), 0, 0, 0);
+    __m128i e1;
+
+    for(; count; --count, data += 64) {
+        const __m128i abcdPrevious = abcd;
+        const __m128i ePrevious = e0;
+
+        /* Rounds 0-3 */
+        __m128i msg0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0)), mask);
+        e0 = _mm_add_epi32(e0, msg0);
+        e1 = abcd;
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+
+        /* Rounds 4-7 */
+        __m128i msg1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16)), mask);
+        e1 = _mm_sha1nexte_epu32(e1, msg1);
+        e0 = abcd;
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+        msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+
+        /* Rounds 8-11 */
+        __m128i msg2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32)), mask);
+        e0 = _mm_sha1nexte_epu32(e0, msg2);
+        e1 = abcd;
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+        msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+        msg0 = _mm_xor_si128(msg0, msg2);
+
+        /* Rounds 12-15 */
+        __m128i msg3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 48)), mask);
+        e1 = _mm_sha1nexte_epu32(e1, msg3);
+        e0 = abcd;
+        msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+        msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+        msg1 = _mm_xor_si128(msg1, msg3);
+
+        /* Rounds 16-19 */
+        e0 = _mm_sha1nexte_epu32(e0, msg0);
+        e1 = abcd;
+        msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+        msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+        msg2 = _mm_xor_si128(msg2, msg0);
+
+        /* Rounds 20-23 */
+        e1 = _mm_sha1nexte_epu32(e1, msg1);
+        e0 = abcd;
+        msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+        msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+        msg3 = _mm_xor_si128(msg3, msg1);
+
+        /* Rounds 24-27 */
+        e0 = _mm_sha1nexte_epu32(e0, msg2);
+        e1 = abcd;
+        msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 1);
+        msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+        msg0 = _mm_xor_si128(msg0, msg2);
+
+        /* Rounds 28-31 */
+        e1 = _mm_sha1nexte_epu32(e1, msg3);
+        e0 = abcd;
+        msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+        msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+        msg1 = _mm_xor_si128(msg1, msg3);
+
+        /* Rounds 32-35 */
+        e0 = _mm_sha1nexte_epu32(e0, msg0);
+        e1 = abcd;
+        msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 1);
+        msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+        msg2 = _mm_xor_si128(msg2, msg0);
+
+        /* Rounds 36-39 */
+        e1 = _mm_sha1nexte_epu32(e1, msg1);
+        e0 = abcd;
+        msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+        msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+        msg3 = _mm_xor_si128(msg3, msg1);
+
+        /* Rounds 40-43 */
+        e0 = _mm_sha1nexte_epu32(e0, msg2);
+        e1 = abcd;
+        msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+        msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+        msg0 = _mm_xor_si128(msg0, msg2);
+
+        /* Rounds 44-47 */
+        e1 = _mm_sha1nexte_epu32(e1, msg3);
+        e0 = abcd;
+        msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, 2);
+        msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+        msg1 = _mm_xor_si128(msg1, msg3);
+
+        /* Rounds 48-51 */
+        e0 = _mm_sha1nexte_epu32(e0, msg0);
+        e1 = abcd;
+        msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+        msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+        msg2 = _mm_xor_si128(msg2, msg0);
+
+        /* Rounds 52-55 */
+        e1 = _mm_sha1nexte_epu32(e1, msg1);
+        e0 = abcd;
+        msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, 2);
+        msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+        msg3 = _mm_xor_si128(msg3, msg1);
+
+        /* Rounds 56-59 */
+        e0 = _mm_sha1nexte_epu32(e0, msg2);
+        e1 = abcd;
+        msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+        msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+        msg0 = _mm_xor_si128(msg0, msg2);
+
+        /* Rounds 60-63 */
+        e1 = _mm_sha1nexte_epu32(e1, msg3);
+        e0 = abcd;
+        msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+        msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+        msg1 = _mm_xor_si128(msg1, msg3);
+
+        /* Rounds 64-67 */
+        e0 = _mm_sha1nexte_epu32(e0, msg0);
+        e1 = abcd;
+        msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 3);
+        msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+        msg2 = _mm_xor_si128(msg2, msg0);
+
+        /* Rounds 68-71 */
+        e1 = _mm_sha1nexte_epu32(e1, msg1);
+        e0 = abcd;
+        msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+        msg3 = _mm_xor_si128(msg3, msg1);
+
+        /* Rounds 72-75 */
+        e0 = _mm_sha1nexte_epu32(e0, msg2);
+        e1 = abcd;
+        msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 3);
+
+        /* Rounds 76-79 */
+        e1 = _mm_sha1nexte_epu32(e1, msg3);
+        e0 = abcd;
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+
+        /* Add the values to digest */
+        e0 = _mm_sha1nexte_epu32(e0, ePrevious);
+        abcd = _mm_add_epi32(abcd, abcdPrevious);
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(digest), _mm_shuffle_epi32(abcd, 0x1b));
+    digest[4] = _mm_extract_epi32(e0, 3);
+}
+#endif
+
+#ifdef CORRADE_SHA1_NEON
+/* Four rounds per SHA1C / SHA1P / SHA1M, the E for the next group is
+   calculated from A of the current one by SHA1H. The message schedule for the
+   next groups is calculated in parallel with SHA1SU0 / SHA1SU1 and the round
+   constants are added to the message words two groups ahead. */
+void processChunksNeon(unsigned int* const digest, const char* data, std::size_t count) {
+    const uint32x4_t constants0 = vdupq_n_u32(Constants[0]);
+    const uint32x4_t constants1 = vdupq_n_u32(Constants[1]);
+    const uint32x4_t constants2 = vdupq_n_u32(Constants[2]);
+    const uint32x4_t constants3 = vdupq_n_u32(Constants[3]);
+
+    uint32x4_t abcd = vld1q_u32(digest);
+    std::uint32_t e0 = digest[4];
+    std::uint32_t e1;
+
+    for(; count; --count, data += 64) {
+        const uint32x4_t abcdPrevious = abcd;
+        const std::uint32_t ePrevious = e0;
+
+        /* Load the words and make them big endian */
+        const std::uint8_t* const bytes = reinterpret_cast<const std::uint8_t*>(data);
+        uint32x4_t msg0 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(bytes + 0)));
+        uint32x4_t msg1 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(bytes + 16)));
+        uint32x4_t msg2 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(bytes + 32)));
+        uint32x4_t msg3 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(bytes + 48)));
+
+        uint32x4_t tmp0 = vaddq_u32(msg0, constants0);
+        uint32x4_t tmp1 = vaddq_u32(msg1, constants0);
+
+        /* Rounds 0-3 */
+        e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+        abcd = vsha1cq_u32(abcd, e0, tmp0);
+        tmp0 = vaddq_u32(msg2, constants0);
+        msg0 = vsha1su0q_u32(msg0, msg1, msg2);
+
+        /* Rounds 4-7 */
+        e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+        abcd = vsha1cq_u32(abcd, e1, tmp1);
+        tmp1 = vaddq_u32(msg3, constants0);
+        msg0 = vsha1su1q_u32(msg0, msg3);
+        msg1 = vsha1su0q_u32(msg1, msg2, msg3);
+
+        /* Rounds 8-11 */
+        e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+        abcd = vsha1cq_u32(abcd, e0, tmp0);
+        tmp0 = vaddq_u32(msg0, constants0);
+        msg1 = vsha1su1q_u32(msg1, msg0);
+        msg2 = vsha1su0q_u32(msg2, msg3, msg0);
+
+        /* Rounds 12-15 */
+        e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+        abcd = vsha1cq_u32(abcd, e1, tmp1);
+        tmp1 = vaddq_u32(msg1, constants1);
+        msg2 = vsha1su1q_u32(msg2, msg1);
+        msg3 = vsha1su0q_u32(msg3, msg0, msg1);
+
+        /* Rounds 16-19 */
+        e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+        abcd = vsha1cq_u32(abcd, e0, tmp0);
+        tmp0 = vaddq_u32(msg2, constants1);
+        msg3 = vsha1su1q_u32(msg3, msg2);
+        msg0 = vsha1su0q_u32(msg0, msg1, msg2);
+
+        /* Rounds 20-23 */
+        e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+        abcd = vsha1pq_u32(abcd, e1, tmp1);
+        tmp1 = vaddq_u32(msg3, constants1);
+        msg0 = vsha1su1q_u32(msg0, msg3);
+        msg1 = vsha1su0q_u32(msg1, msg2, msg3);
+
+        /* Rounds 24-27 */
+        e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+        abcd = vsha1pq_u32(abcd, e0, tmp0);
+        tmp0 = vaddq_u32(msg0, constants1);
+        msg1 = vsha1su1q_u32(msg1, msg0);
+        msg2 = vsha1su0q_u32(msg2, msg3, msg0);
+
+        /* Rounds 28-31 */
+        e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+        abcd = vsha1pq_u32(abcd, e1, tmp1);
+        tmp1 = vaddq_u32(msg1, constants1);
+        msg2 = vsha1su1q_u32(msg2, msg1);
+        msg3 = vsha1su0q_u32(msg3, msg0, msg1);
+
+        /* Rounds 32-35 */
+        e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+        abcd = vsha1pq_u32(abcd, e0, tmp0);
+        tmp0 = vaddq_u32(msg2, constants2);
+        msg3 = vsha1su1q_u32(msg3, msg2);
+        msg0 = vsha1su0q_u32(msg0, msg1, msg2);
+
+        /* Rounds 36-39 */
+        e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+        abcd = vsha1pq_u32(abcd, e1, tmp1);
+        tmp1 = vaddq_u32(msg3, constants2);
+        msg0 = vsha1su1q_u32(msg0, msg3);
+        msg1 = vsha1su0q_u32(msg1, msg2, msg3);
+
+        /* Rounds 40-43 */
+        e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+        abcd = vsha1mq_u32(abcd, e0, tmp0);
+        tmp0 = vaddq_u32(msg0, constants2);
+        msg1 = vsha1su1q_u32(msg1, msg0);
+        msg2 = vsha1su0q_u32(msg2, msg3, msg0);
+
+        /* Rounds 44-47 */
+        e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+        abcd = vsha1mq_u32(abcd, e1, tmp1);
+        tmp1 = vaddq_u32(msg1, constants2);
+        msg2 = vsha1su1q_u32(msg2, msg1);
+        msg3 = vsha1su0q_u32(msg3, msg0, msg1);
+
+        /* Rounds 48-51 */
+        e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+        abcd = vsha1mq_u32(abcd, e0, tmp0);
+        tmp0 = vaddq_u32(msg2, constants2);
+        msg3 = vsha1su1q_u32(msg3, msg2);
+        msg0 = vsha1su0q_u32(msg0, msg1, msg2);
+
+        /* Rounds 52-55 */
+        e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+        abcd = vsha1mq_u32(abcd, e1, tmp1);
+        tmp1 = vaddq_u32(msg3, constants3);
+        msg0 = vsha1su1q_u32(msg0, msg3);
+        msg1 = vsha1su0q_u32(msg1, msg2, msg3);
+
+        /* Rounds 56-59 */
+        e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+        abcd = vsha1mq_u32(abcd, e0, tmp0);
+        tmp0 = vaddq_u32(msg0, constants3);
+        msg1 = vsha1su1q_u32(msg1, msg0);
+        msg2 = vsha1su0q_u32(msg2, msg3, msg0);
+
+        /* Rounds 60-63 */
+        e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+        abcd = vsha1pq_u32(abcd, e1, tmp1);
+        tmp1 = vaddq_u32(msg1, constants3);
+        msg2 = vsha1su1q_u32(msg2, msg1);
+        msg3 = vsha1su0q_u32(msg3, msg0, msg1);
+
+        /* Rounds 64-67 */
+        e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+        abcd = vsha1pq_u32(abcd, e0, tmp0);
+        tmp0 = vaddq_u32(msg2, constants3);
+        msg3 = vsha1su1q_u32(msg3, msg2);
+
+        /* Rounds 68-71 */
+        e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+        abcd = vsha1pq_u32(abcd, e1, tmp1);
+        tmp1 = vaddq_u32(msg3, constants3);
+
+        /* Rounds 72-75 */
+        e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+        abcd = vsha1pq_u32(abcd, e0, tmp0);
+
+        /* Rounds 76-79 */
+        e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+        abcd = vsha1pq_u32(abcd, e1, tmp1);
+
+        /* Add the values to digest */
+        e0 += ePrevious;
+        abcd = vaddq_u32(abcd, abcdPrevious);
+    }
+
+    vst1q_u32(digest, abcd);
+    digest[4] = e0;
+}
+#endif
+
+typedef void(*ProcessChunksImplementation)(unsigned int*, const char*, std::size_t);
+
+ProcessChunksImplementation processChunksImplementation() {
+    #ifdef CORRADE_ENABLE_SHA
+    const unsigned features = Implementation::cpuFeatures();
+    if((features & Implementation::CpuSha) && (features & Implementation::CpuSse41))
+        return processChunksSha;
+    #endif
+
+    #ifdef CORRADE_SHA1_NEON
+    return processChunksNeon;
+    #else
+    return processChunksScalar;
+    #endif
+}
+
+/* Processes given count of 64-byte chunks, picking the best implementation
+   for the current CPU on the first call */
+void processChunks(unsigned int* const digest, const char* const data, const std::size_t count) {
+    static const ProcessChunksImplementation implementation = processChunksImplementation();
+    implementation(digest, data, count);
+}
+
 }
 
 Sha1::Sha1(): _digest{InitialDigest[0], InitialDigest[1], InitialDigest[2], InitialDigest[3], InitialDigest[4]} {}
@@ -74,11 +515,11 @@ Sha1& Sha1::operator<<(Containers::ArrayView<const char> data) {
         /* Append few last bytes to have the buffer at 64 bytes */
         std::memcpy(_buffer + _bufferSize, data.data(), dataOffset);
         _bufferSize += dataOffset;
-        processChunk(_buffer);
+        processChunks(_digest, _buffer, 1);
     }
 
-    for(std::size_t i = dataOffset; i + 64 <= data.size(); i += 64)
-        processChunk(data.data() + i);
+    /* Process all remaining full chunks at once */
+    processChunks(_digest, data.data() + dataOffset, (data.size() - dataOffset)/64);
 
     /* Save last unfinished 512-bit chunk of data */
     auto leftOver = data.suffix(dataOffset + ((data.size() - dataOffset)/64)*64);
@@ -104,31 +545,43 @@ Sha1& Sha1::operator<<(const std::string& data) {
 #pragma GCC push_options
 #pragma GCC optimize ("O2")
 #endif
-Sha1::Digest Sha1::digest() {
+namespace {
+
+/* Appends the '1' bit, zero padding and size of all data in bits to the
+   leftovers in the buffer, returning size of the padded data, which is
+   either 64 or 128 bytes. The buffer is expected to be at least 128 bytes. */
+std::size_t pad(char* const buffer, std::size_t bufferSize, const unsigned long long dataSize) {
     /* Add '1' bit to the leftovers */
-    _buffer[_bufferSize++] = '\x80';
+    buffer[bufferSize++] = '\x80';
 
     /* Pad to (n*64)+56 bytes */
-    const size_t padding = (_bufferSize > 56 ? 120 : 56) - _bufferSize;
-    CORRADE_INTERNAL_ASSERT(_bufferSize + padding + 8 <= sizeof(_buffer));
-    std::memset(_buffer + _bufferSize, 0, padding);
-    _bufferSize += padding;
+    const std::size_t padding = (bufferSize > 56 ? 120 : 56) - bufferSize;
+    CORRADE_INTERNAL_ASSERT(bufferSize + padding + 8 <= 128);
+    std::memset(buffer + bufferSize, 0, padding);
+    bufferSize += padding;
 
     /* Add size of data in bits in big endian */
-    unsigned long long dataSizeBigEndian = Endianness::bigEndian<unsigned long long>(_dataSize*8);
-    std::memcpy(_buffer + _bufferSize, reinterpret_cast<const char*>(&dataSizeBigEndian), 8);
-    _bufferSize += 8;
-
-    /* Process remaining chunks */
-    for(std::size_t i = 0; i != _bufferSize/64; ++i) {
-        processChunk(_buffer+i*64);
-    }
+    unsigned long long dataSizeBigEndian = Endianness::bigEndian<unsigned long long>(dataSize*8);
+    std::memcpy(buffer + bufferSize, reinterpret_cast<const char*>(&dataSizeBigEndian), 8);
+    return bufferSize + 8;
+}
 
-    /* Convert digest from big endian */
+/* Converts the digest state from big endian */
+Sha1::Digest digestFromState(const unsigned int* const state) {
     unsigned int digest[5];
     for(int i = 0; i != 5; ++i)
-        digest[i] = Endianness::bigEndian<unsigned int>(_digest[i]);
-    const Digest d = Digest::fromByteArray(reinterpret_cast<const char*>(digest));
+        digest[i] = Endianness::bigEndian<unsigned int>(state[i]);
+    return Sha1::Digest::fromByteArray(reinterpret_cast<const char*>(digest));
+}
+
+}
+
+Sha1::Digest Sha1::digest() {
+    /* Pad the leftovers and process remaining chunks */
+    _bufferSize = pad(_buffer, _bufferSize, _dataSize);
+    processChunks(_digest, _buffer, _bufferSize/64);
+
+    const Digest d = digestFromState(_digest);
 
     /* Clear data and return */
     std::copy(InitialDigest, InitialDigest+5, _digest);
@@ -140,54 +593,263 @@ Sha1::Digest Sha1::digest() {
 #pragma GCC pop_options
 #endif
 
-void Sha1::processChunk(const char* data) {
-    /* Extend the data to 80 bytes, make it big endian */
-    unsigned int extended[80];
-    /* Some memory juggling to avoid unaligned reads on platforms that don't
-       like it (Emscripten). The data don't have any endianness, so take the
-       first byte first, as usual. */
-    for(int i = 0; i != 16; ++i)
-        extended[i] =
-            (static_cast<unsigned int>(static_cast<unsigned char>(data[i*4 + 0])) << 24) |
-            (static_cast<unsigned int>(static_cast<unsigned char>(data[i*4 + 1])) << 16) |
-            (static_cast<unsigned int>(static_cast<unsigned char>(data[i*4 + 2])) <<  8) |
-            (static_cast<unsigned int>(static_cast<unsigned char>(data[i*4 + 3])) <<  0);
-    for(int i = 16; i != 80; ++i)
-        extended[i] = leftrotate((extended[i-3] ^ extended[i-8] ^ extended[i-14] ^ extended[i-16]), 1);
-
-    /* Initialize value for this chunk */
-    unsigned int d[5];
-    unsigned int f, constant, temp;
-    std::copy(_digest, _digest+5, d);
-
-    /* Main loop */
-    for(int i = 0; i != 80; ++i) {
-        if(i < 20) {
-            f = d[3] ^ (d[1] & (d[2] ^ d[3]));
-            constant = Constants[0];
-        } else if(i < 40) {
-            f = d[1] ^ d[2] ^ d[3];
-            constant = Constants[1];
-        } else if(i < 60) {
-            f = (d[1] & d[2]) | (d[3] & (d[1] | d[2]));
-            constant = Constants[2];
-        } else {
-            f = d[1] ^ d[2] ^ d[3];
-            constant = Constants[3];
-        }
+namespace {
+
+Sha1::Digest digestSingle(const Containers::ArrayView<const char> data) {
+    unsigned int state[5];
+    std::copy(InitialDigest, InitialDigest + 5, state);
+
+    /* Whole chunks directly from the input, the rest through a buffer */
+    const std::size_t chunks = data.size()/64;
+    processChunks(state, data.data(), chunks);
+    char buffer[128];
+    const std::size_t leftover = data.size() - chunks*64;
+    if(leftover) std::memcpy(buffer, data.data() + chunks*64, leftover);
+    processChunks(state, buffer, pad(buffer, leftover, data.size())/64);
+
+    return digestFromState(state);
+}
+
+void digestIntoSingle(const Containers::ArrayView<const Containers::ArrayView<const char>> data, const Containers::ArrayView<Sha1::Digest> out) {
+    for(std::size_t i = 0; i != data.size(); ++i)
+        out[i] = digestSingle(data[i]);
+}
+
+#ifdef CORRADE_ENABLE_AVX2
+template<int shift> CORRADE_ENABLE_AVX2 inline __m256i rotateLeftAvx2(const __m256i a) {
+    return _mm256_or_si256(_mm256_slli_epi32(a, shift), _mm256_srli_epi32(a, 32 - shift));
+}
+
+/* Transposes an 8x8 matrix of 32-bit values */
+CORRADE_ENABLE_AVX2 inline void transposeAvx2(__m256i* const rows) {
+    const __m256i t0 = _mm256_unpacklo_epi32(rows[0], rows[1]);
+    const __m256i t1 = _mm256_unpackhi_epi32(rows[0], rows[1]);
+    const __m256i t2 = _mm256_unpacklo_epi32(rows[2], rows[3]);
+    const __m256i t3 = _mm256_unpackhi_epi32(rows[2], rows[3]);
+    const __m256i t4 = _mm256_unpacklo_epi32(rows[4], rows[5]);
+    const __m256i t5 = _mm256_unpackhi_epi32(rows[4], rows[5]);
+    const __m256i t6 = _mm256_unpacklo_epi32(rows[6], rows[7]);
+    const __m256i t7 = _mm256_unpackhi_epi32(rows[6], rows[7]);
+    const __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+    const __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+    const __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+    const __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+    const __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+    const __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+    const __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+    const __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+    rows[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+    rows[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+    rows[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+    rows[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+    rows[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+    rows[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+    rows[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+    rows[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+CORRADE_ENABLE_AVX2 inline void roundAvx2(__m256i(&d)[5], __m256i(&w)[16], const int i, const __m256i f, const unsigned int constant) {
+    if(i >= 16)
+        w[i & 15] = rotateLeftAvx2<1>(_mm256_xor_si256(
+            _mm256_xor_si256(w[(i - 3) & 15], w[(i - 8) & 15]),
+            _mm256_xor_si256(w[(i - 14) & 15], w[i & 15])));
+
+    const __m256i temp = _mm256_add_epi32(
+        _mm256_add_epi32(rotateLeftAvx2<5>(d[0]), f),
+        _mm256_add_epi32(_mm256_add_epi32(d[4], _mm256_set1_epi32(int(constant))), w[i & 15]));
+    d[4] = d[3];
+    d[3] = d[2];
+    d[2] = rotateLeftAvx2<30>(d[1]);
+    d[1] = d[0];
+    d[0] = temp;
+}
+
+/* Processes one 64-byte chunk in each of the eight lanes, with the state
+   stored as five words for all lanes */
+CORRADE_ENABLE_AVX2 void processChunksAvx2(unsigned int(&state)[5][8], const char* const(&chunks)[8]) {
+    /* Load words of each lane, make them big endian and transpose so each
+       vector contains one word for all lanes */
+    const __m256i mask = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                          3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    __m256i w[16];
+    for(std::size_t half = 0; half != 2; ++half) {
+        for(std::size_t lane = 0; lane != 8; ++lane)
+            w[half*8 + lane] = _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(chunks[lane] + half*32)), mask);
+        transposeAvx2(w + half*8);
+    }
 
-        temp =
-            leftrotate(d[0], 5) + f + d[4] + constant + extended[i];
-        d[4] = d[3];
-        d[3] = d[2];
-        d[2] = leftrotate(d[1], 30);
-        d[1] = d[0];
-        d[0] = temp;
+    __m256i d[5];
+    for(std::size_t i = 0; i != 5; ++i)
+        d[i] = _mm256_load_si256(reinterpret_cast<const __m256i*>(state[i]));
+
+    /* Same as in processChunksScalar(), except that the extended words are
+       calculated on the fly in a 16-word window and the loop is split by
+       the round function */
+    for(int i = 0; i != 20; ++i) {
+        const __m256i f = _mm256_xor_si256(d[3], _mm256_and_si256(d[1], _mm256_xor_si256(d[2], d[3])));
+        roundAvx2(d, w, i, f, Constants[0]);
+    }
+    for(int i = 20; i != 40; ++i) {
+        const __m256i f = _mm256_xor_si256(_mm256_xor_si256(d[1], d[2]), d[3]);
+        roundAvx2(d, w, i, f, Constants[1]);
+    }
+    for(int i = 40; i != 60; ++i) {
+        const __m256i f = _mm256_or_si256(_mm256_and_si256(d[1], d[2]), _mm256_and_si256(d[3], _mm256_or_si256(d[1], d[2])));
+        roundAvx2(d, w, i, f, Constants[2]);
+    }
+    for(int i = 60; i != 80; ++i) {
+        const __m256i f = _mm256_xor_si256(_mm256_xor_si256(d[1], d[2]), d[3]);
+        roundAvx2(d, w, i, f, Constants[3]);
     }
 
     /* Add the values to digest */
-    for(int i = 0; i != 5; ++i)
-        _digest[i] += d[i];
+    for(std::size_t i = 0; i != 5; ++i)
+        _mm256_store_si256(reinterpret_cast<__m256i*>(state[i]), _mm256_add_epi32(d[i], _mm256_load_si256(reinterpret_cast<const __m256i*>(state[i]))));
+}
+
+/* A single message being processed in one of the lanes */
+struct Lane {
+    /* Next chunk to process and how many of them is left in the input, after
+       that it continues with the padded leftovers in the buffer */
+    const char* data;
+    std::size_t chunks;
+    std::size_t bufferChunks;
+    /* Index of the input, ~std::size_t{} if the lane is idle */
+    std::size_t index;
+    char buffer[128];
+};
+
+void startLane(Lane& lane, unsigned int(&state)[5][8], const std::size_t laneIndex, const Containers::ArrayView<const char> data, const std::size_t index) {
+    for(std::size_t i = 0; i != 5; ++i)
+        state[i][laneIndex] = InitialDigest[i];
+
+    lane.index = index;
+    lane.chunks = data.size()/64;
+    const std::size_t leftover = data.size() - lane.chunks*64;
+    if(leftover) std::memcpy(lane.buffer, data.data() + lane.chunks*64, leftover);
+    lane.bufferChunks = pad(lane.buffer, leftover, data.size())/64;
+
+    /* If there are no whole chunks, continue directly with the buffer */
+    if(lane.chunks) {
+        lane.data = data.data();
+    } else {
+        lane.data = lane.buffer;
+        lane.chunks = lane.bufferChunks;
+        lane.bufferChunks = 0;
+    }
+}
+
+/* Picks the next input to be hashed in a lane. Inputs larger than
+   maxLaneSize are hashed directly instead. */
+std::size_t nextLaneInput(const Containers::ArrayView<const Containers::ArrayView<const char>> data, const Containers::ArrayView<Sha1::Digest> out, std::size_t next, const std::size_t maxLaneSize) {
+    for(; next < data.size() && data[next].size() > maxLaneSize; ++next)
+        out[next] = digestSingle(data[next]);
+    return next;
+}
+
+/* Hashes eight inputs at a time, each lane picking the next input once the
+   previous finishes so differently sized inputs don't leave lanes idle */
+CORRADE_ENABLE_AVX2 void digestIntoAvx2(const Containers::ArrayView<const Containers::ArrayView<const char>> data, const Containers::ArrayView<Sha1::Digest> out, const std::size_t maxLaneSize) {
+    /* Idle lanes hash this, the result is discarded */
+    alignas(32) static const char Zeros[64]{};
+
+    alignas(32) unsigned int state[5][8];
+    Lane lanes[8];
+    std::size_t next = 0;
+    std::size_t active = 0;
+    for(std::size_t i = 0; i != 8; ++i) {
+        next = nextLaneInput(data, out, next, maxLaneSize);
+        if(next < data.size()) {
+            startLane(lanes[i], state, i, data[next], next);
+            ++next;
+            ++active;
+        } else lanes[i].index = ~std::size_t{};
+    }
+
+    while(active) {
+        const char* chunks[8];
+        for(std::size_t i = 0; i != 8; ++i)
+            chunks[i] = lanes[i].index == ~std::size_t{} ? Zeros : lanes[i].data;
+
+        processChunksAvx2(state, chunks);
+
+        for(std::size_t i = 0; i != 8; ++i) {
+            Lane& lane = lanes[i];
+            if(lane.index == ~std::size_t{}) continue;
+
+            lane.data += 64;
+            if(--lane.chunks) continue;
+
+            /* Input finished, continue with the padded leftovers */
+            if(lane.bufferChunks) {
+                lane.data = lane.buffer;
+                lane.chunks = lane.bufferChunks;
+                lane.bufferChunks = 0;
+                continue;
+            }
+
+            /* Everything finished, save the digest and pick the next input */
+            unsigned int digest[5];
+            for(std::size_t j = 0; j != 5; ++j)
+                digest[j] = state[j][i];
+            out[lane.index] = digestFromState(digest);
+            next = nextLaneInput(data, out, next, maxLaneSize);
+            if(next < data.size()) {
+                startLane(lane, state, i, data[next], next);
+                ++next;
+            } else {
+                lane.index = ~std::size_t{};
+                --active;
+            }
+        }
+    }
+}
+
+CORRADE_ENABLE_AVX2 void digestIntoAvx2(const Containers::ArrayView<const Containers::ArrayView<const char>> data, const Containers::ArrayView<Sha1::Digest> out) {
+    digestIntoAvx2(data, out, ~std::size_t{});
+}
+
+#ifdef CORRADE_ENABLE_SHA
+CORRADE_ENABLE_AVX2 void digestIntoAvx2Sha(const Containers::ArrayView<const Containers::ArrayView<const char>> data, const Containers::ArrayView<Sha1::Digest> out) {
+    digestIntoAvx2(data, out, 4096);
+}
+#endif
+#endif
+
+typedef void(*DigestIntoImplementation)(Containers::ArrayView<const Containers::ArrayView<const char>>, Containers::ArrayView<Sha1::Digest>);
+
+DigestIntoImplementation digestIntoImplementation() {
+    #ifdef CORRADE_ENABLE_AVX2
+    const unsigned features = Implementation::cpuFeatures();
+    if(features & Implementation::CpuAvx2) {
+        /* With small inputs, eight AVX2 lanes are faster than the SHA
+           extensions hashing one input at a time, while for large inputs
+           they're about the same. Hash those directly to avoid a single large
+           input occupying one lane while the others are idle. */
+        #ifdef CORRADE_ENABLE_SHA
+        if((features & Implementation::CpuSha) && (features & Implementation::CpuSse41))
+            return digestIntoAvx2Sha;
+        #endif
+        return digestIntoAvx2;
+    }
+    #endif
+    return digestIntoSingle;
+}
+
+}
+
+void Sha1::digestInto(const Containers::ArrayView<const Containers::ArrayView<const char>> data, const Containers::ArrayView<Digest> out) {
+    CORRADE_ASSERT(out.size() == data.size(),
+        "Utility::Sha1::digestInto(): expected output view size to be" << data.size() << "but got" << out.size(), );
+
+    static const DigestIntoImplementation implementation = digestIntoImplementation();
+    implementation(data, out);
+}
+
+Containers::Array<Sha1::Digest> Sha1::digest(const Containers::ArrayView<const Containers::ArrayView<const char>> data) {
+    Containers::Array<Digest> out{NoInit, data.size()};
+    digestInto(data, out);
+    return out;
 }
 
 }}
@@ -57,6 +57,32 @@ class CORRADE_UTILITY_EXPORT Sha1: public AbstractHash<20> {
             return (Sha1() << data).digest();
         }
 
+        /**
+         * @brief Digests of multiple independent inputs
+         * @m_since_latest
+         *
+         * Equivalent to calculating a digest of each item of @p data
+         * separately, but if the CPU supports AVX2, up to eight inputs are
+         * hashed in parallel. That's significantly faster especially for
+         * large amounts of small inputs. The @p out view is expected to have
+         * the same size as @p data. Example usage:
+         *
+         * @snippet Utility.cpp Sha1-usage-batch
+         *
+         * @see @ref digest(Containers::ArrayView<const Containers::ArrayView<const char>>)
+         */
+        static void digestInto(Containers::ArrayView<const Containers::ArrayView<const char>> data, Containers::ArrayView<Digest> out);
+
+        /**
+         * @brief Digests of multiple independent inputs
+         * @m_since_latest
+         *
+         * Allocates an array of the same size as @p data and delegates to
+         * @ref digestInto(). Include @ref Corrade/Containers/Array.h in
+         * order to use the returned array.
+         */
+        static Containers::Array<Digest> digest(Containers::ArrayView<const Containers::ArrayView<const char>> data);
+
         explicit Sha1();
 
         /** @brief Add data for digesting */
@@ -77,8 +103,6 @@ class CORRADE_UTILITY_EXPORT Sha1: public AbstractHash<20> {
         Digest digest();
 
     private:
-        CORRADE_UTILITY_LOCAL void processChunk(const char* data);
-
         char _buffer[128];
         std::size_t _bufferSize = 0;
         unsigned long long _dataSize = 0;
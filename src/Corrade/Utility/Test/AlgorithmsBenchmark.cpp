@@ -0,0 +1,199 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/StridedArrayView.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/Algorithms.h"
+
+namespace Corrade { namespace Utility { namespace Test { namespace {
+
+struct AlgorithmsBenchmark: TestSuite::Tester {
+    explicit AlgorithmsBenchmark();
+
+    template<class T> void transposeIntoCopy();
+    template<class T> void transposeInto();
+
+    void sortStdSort();
+    void sort();
+    void sortParallel();
+    void sortIndicesStdStableSort();
+    void sortIndices();
+};
+
+template<class> struct TypeName;
+template<> struct TypeName<std::uint8_t> {
+    static const char* name() { return "1B"; }
+};
+template<> struct TypeName<std::uint16_t> {
+    static const char* name() { return "2B"; }
+};
+template<> struct TypeName<std::uint32_t> {
+    static const char* name() { return "4B"; }
+};
+template<> struct TypeName<std::uint64_t> {
+    static const char* name() { return "8B"; }
+};
+
+AlgorithmsBenchmark::AlgorithmsBenchmark() {
+    addBenchmarks<AlgorithmsBenchmark>({
+        &AlgorithmsBenchmark::transposeIntoCopy<std::uint8_t>,
+        &AlgorithmsBenchmark::transposeInto<std::uint8_t>,
+        &AlgorithmsBenchmark::transposeIntoCopy<std::uint16_t>,
+        &AlgorithmsBenchmark::transposeInto<std::uint16_t>,
+        &AlgorithmsBenchmark::transposeIntoCopy<std::uint32_t>,
+        &AlgorithmsBenchmark::transposeInto<std::uint32_t>,
+        &AlgorithmsBenchmark::transposeIntoCopy<std::uint64_t>,
+        &AlgorithmsBenchmark::transposeInto<std::uint64_t>}, 5);
+
+    addBenchmarks({&AlgorithmsBenchmark::sortStdSort,
+                   &AlgorithmsBenchmark::sort,
+                   &AlgorithmsBenchmark::sortParallel,
+                   &AlgorithmsBenchmark::sortIndicesStdStableSort,
+                   &AlgorithmsBenchmark::sortIndices}, 5);
+}
+
+/* Large enough that a naive transposition thrashes the cache and the TLB, 32
+   MB for each of the two 8-byte views */
+constexpr std::size_t TransposeSize = 2048;
+
+template<class T> void AlgorithmsBenchmark::transposeIntoCopy() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    Containers::Array<T> srcData{ValueInit, TransposeSize*TransposeSize};
+    Containers::Array<T> dstData{ValueInit, TransposeSize*TransposeSize};
+    Containers::StridedArrayView2D<const T> src{srcData, {TransposeSize, TransposeSize}};
+    Containers::StridedArrayView2D<T> dst{dstData, {TransposeSize, TransposeSize}};
+    srcData[1] = 1;
+
+    CORRADE_BENCHMARK(1)
+        Utility::copy(src.template transposed<0, 1>(), dst);
+
+    CORRADE_COMPARE(dst[1][0], T{1});
+}
+
+template<class T> void AlgorithmsBenchmark::transposeInto() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    Containers::Array<T> srcData{ValueInit, TransposeSize*TransposeSize};
+    Containers::Array<T> dstData{ValueInit, TransposeSize*TransposeSize};
+    Containers::StridedArrayView2D<const T> src{srcData, {TransposeSize, TransposeSize}};
+    Containers::StridedArrayView2D<T> dst{dstData, {TransposeSize, TransposeSize}};
+    srcData[1] = 1;
+
+    CORRADE_BENCHMARK(1)
+        Utility::transposeInto(src, dst);
+
+    CORRADE_COMPARE(dst[1][0], T{1});
+}
+
+/* 4 MB of keys, which doesn't fit into L2 */
+constexpr std::size_t SortSize = 1 << 20;
+
+/* All benchmarks copy unsorted input first as std::sort() is considerably
+   faster on already sorted data while radix sort isn't. The copy is a small
+   fraction of the total time. */
+
+Containers::Array<std::uint32_t> sortData() {
+    Containers::Array<std::uint32_t> out{NoInit, SortSize};
+    /* Xorshift, same as in AlgorithmsTest */
+    std::uint64_t state = 0x2545f4914f6cdd1dull;
+    for(std::uint32_t& i: out) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        i = std::uint32_t(state);
+    }
+    return out;
+}
+
+void AlgorithmsBenchmark::sortStdSort() {
+    Containers::Array<std::uint32_t> source = sortData();
+    Containers::Array<std::uint32_t> data{NoInit, SortSize};
+
+    CORRADE_BENCHMARK(1) {
+        Utility::copy(source, data);
+        std::sort(data.begin(), data.end());
+    }
+
+    CORRADE_VERIFY(std::is_sorted(data.begin(), data.end()));
+}
+
+void AlgorithmsBenchmark::sort() {
+    Containers::Array<std::uint32_t> source = sortData();
+    Containers::Array<std::uint32_t> data{NoInit, SortSize};
+
+    CORRADE_BENCHMARK(1) {
+        Utility::copy(source, data);
+        Utility::sort(Containers::arrayView(data));
+    }
+
+    CORRADE_VERIFY(std::is_sorted(data.begin(), data.end()));
+}
+
+void AlgorithmsBenchmark::sortParallel() {
+    Containers::Array<std::uint32_t> source = sortData();
+    Containers::Array<std::uint32_t> data{NoInit, SortSize};
+
+    CORRADE_BENCHMARK(1) {
+        Utility::copy(source, data);
+        Utility::sortParallel(Containers::arrayView(data));
+    }
+
+    CORRADE_VERIFY(std::is_sorted(data.begin(), data.end()));
+}
+
+void AlgorithmsBenchmark::sortIndicesStdStableSort() {
+    Containers::Array<std::uint32_t> keys = sortData();
+    Containers::Array<std::uint32_t> indices{NoInit, SortSize};
+
+    CORRADE_BENCHMARK(1) {
+        std::iota(indices.begin(), indices.end(), 0);
+        std::stable_sort(indices.begin(), indices.end(), [&keys](std::uint32_t a, std::uint32_t b) {
+            return keys[a] < keys[b];
+        });
+    }
+
+    CORRADE_VERIFY(keys[indices[0]] <= keys[indices[1]]);
+}
+
+void AlgorithmsBenchmark::sortIndices() {
+    Containers::Array<std::uint32_t> keys = sortData();
+    Containers::Array<std::uint32_t> indices{NoInit, SortSize};
+
+    CORRADE_BENCHMARK(1)
+        Utility::sortIndices(Containers::stridedArrayView(keys), Containers::stridedArrayView(indices));
+
+    CORRADE_VERIFY(keys[indices[0]] <= keys[indices[1]]);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Utility::Test::AlgorithmsBenchmark)
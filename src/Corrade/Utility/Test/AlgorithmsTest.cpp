@@ -25,7 +25,12 @@
 */
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
 #include <sstream>
+#include <string>
+#include <vector>
 
 #include "Corrade/Containers/Array.h"
 #include "Corrade/Containers/ArrayViewStl.h"
@@ -69,11 +74,62 @@ struct AlgorithmsTest: TestSuite::Tester {
     void copyBenchmark2DNonContiguous();
     template<class T> void copyBenchmark3DNonContiguous();
 
+    void copyParallel();
+    void copyParallelStrided();
+    void copyParallelSmall();
+    void copyParallelNonMatchingSizes();
+
+    void copyParallelBenchmarkSerial();
+    void copyParallelBenchmark();
+
     template<class T> void flipInPlaceFirstDimension();
     template<class T> void flipInPlaceSecondDimension();
     template<class T> void flipInPlaceThirdDimension();
     void flipInPlaceZeroSize();
     void flipInPlaceNonContigous();
+
+    void flipInPlaceParallel();
+    void flipInPlaceParallelOuterDimension();
+    void flipInPlaceParallelNonContigous();
+
+    void flipInPlaceParallelBenchmarkSerial();
+    void flipInPlaceParallelBenchmark();
+
+    template<class T> void transposeInto();
+    void transposeIntoMutableSource();
+    void transposeIntoZeroSize();
+    void transposeIntoNonMatchingSizes();
+    void transposeIntoNonContiguous();
+
+
+    void fill();
+    void fill3D();
+    void transform();
+    void transformInPlace();
+    void transformNonMatchingSizes();
+    void reduce();
+    template<class T> void sum();
+    void sumEmpty();
+    template<class T> void minmax();
+    void minmaxEmpty();
+    void scan();
+    void scanCustomFunction();
+    void scanNonMatchingSizes();
+
+    void sumBenchmarkLoop();
+    void sumBenchmark();
+    void minmaxBenchmarkLoop();
+    void minmaxBenchmark();
+
+    template<class T> void sort();
+    void sortArrayView();
+    void sortFloatSpecialValues();
+    void sortEmpty();
+    template<class T> void sortParallel();
+    template<class T> void sortIndices();
+    void sortIndicesMutableKeys();
+    void sortIndicesParallel();
+    void sortIndicesNonMatchingSizes();
 };
 
 const struct {
@@ -135,9 +191,62 @@ const struct {
     {"contiguous transposed", {105, 15, 5, 1}, {105, 15, 5, 1}, false, true}
 };
 
+const struct {
+    const char* name;
+    std::size_t threadCount;
+} ParallelData[]{
+    {"single thread", 1},
+    {"3 threads", 3},
+    {"8 threads", 8},
+    {"hardware concurrency", 0}
+};
+
+/* The sizes are chosen to be neither a multiple of the 32x32 tile nor of the
+   SIMD block sizes */
+const struct {
+    const char* name;
+    std::size_t rows, cols;
+    std::ptrdiff_t srcRowPadding, srcItemStride, dstItemStride;
+    bool flipped;
+} TransposeData[]{
+    {"contiguous, single tile", 7, 5, 0, 1, 1, false},
+    {"contiguous", 67, 35, 0, 1, 1, false},
+    {"contiguous, square", 64, 64, 0, 1, 1, false},
+    {"contiguous rows", 67, 35, 3, 1, 1, false},
+    {"sparse src", 67, 35, 0, 2, 1, false},
+    {"sparse dst", 67, 35, 0, 1, 2, false},
+    {"flipped", 67, 35, 0, 1, 1, true}
+};
+
+/* The views are 2D with 5x19 items, which means the contiguous variant
+   processes 95 items at once (more than one SIMD lane block and with a
+   remainder), while the others process 19 items per row */
+const struct {
+    const char* name;
+    std::ptrdiff_t rowStride, itemStride;
+    bool flipped;
+} AlgorithmData[]{
+    {"contiguous", 19, 1, false},
+    {"contiguous rows", 23, 1, false},
+    {"sparse", 2*19, 2, false},
+    {"flipped", 19, 1, true}
+};
+
+const struct {
+    const char* name;
+    std::ptrdiff_t stride;
+    bool flipped, narrowRange;
+} SortData[]{
+    {"contiguous", 1, false, false},
+    {"contiguous, narrow range", 1, false, true},
+    {"sparse", 3, false, false},
+    {"flipped", 1, true, false}
+};
+
 /* For testing large types (and the Duff's device branch, which is 8 bytes and
-   above right now). The class explicitly fills all the data to catch potential
-   errors where just a part gets copied. */
+   above right now) and the fixed-size item kernels for 1, 2, 4, 8, 12 and 16
+   bytes. The class explicitly fills all the data to catch potential errors
+   where just a part gets copied. */
 template<std::size_t size> struct Data {
     /*implicit*/ Data() = default;
     /*implicit*/ Data(unsigned char value) {
@@ -173,12 +282,21 @@ template<> struct TypeName<int> {
 template<> struct TypeName<Data<1>> {
     static const char* name() { return "1B"; }
 };
+template<> struct TypeName<Data<2>> {
+    static const char* name() { return "2B"; }
+};
+template<> struct TypeName<Data<3>> {
+    static const char* name() { return "3B"; }
+};
 template<> struct TypeName<Data<4>> {
     static const char* name() { return "4B"; }
 };
 template<> struct TypeName<Data<8>> {
     static const char* name() { return "8B"; }
 };
+template<> struct TypeName<Data<12>> {
+    static const char* name() { return "12B"; }
+};
 template<> struct TypeName<Data<16>> {
     static const char* name() { return "16B"; }
 };
@@ -193,14 +311,26 @@ AlgorithmsTest::AlgorithmsTest() {
     addInstancedTests<AlgorithmsTest>({
         &AlgorithmsTest::copyStrided1D<char>,
         &AlgorithmsTest::copyStrided1D<int>,
+        &AlgorithmsTest::copyStrided1D<Data<2>>,
+        &AlgorithmsTest::copyStrided1D<Data<8>>,
+        &AlgorithmsTest::copyStrided1D<Data<12>>,
+        &AlgorithmsTest::copyStrided1D<Data<16>>,
         }, Containers::arraySize(Copy1DData));
     addInstancedTests<AlgorithmsTest>({
         &AlgorithmsTest::copyStrided2D<char>,
         &AlgorithmsTest::copyStrided2D<int>,
+        &AlgorithmsTest::copyStrided2D<Data<2>>,
+        &AlgorithmsTest::copyStrided2D<Data<8>>,
+        &AlgorithmsTest::copyStrided2D<Data<12>>,
+        &AlgorithmsTest::copyStrided2D<Data<16>>,
         }, Containers::arraySize(Copy2DData));
     addInstancedTests<AlgorithmsTest>({
         &AlgorithmsTest::copyStrided3D<char>,
         &AlgorithmsTest::copyStrided3D<int>,
+        &AlgorithmsTest::copyStrided3D<Data<2>>,
+        &AlgorithmsTest::copyStrided3D<Data<8>>,
+        &AlgorithmsTest::copyStrided3D<Data<12>>,
+        &AlgorithmsTest::copyStrided3D<Data<16>>,
         }, Containers::arraySize(Copy3DData));
     addInstancedTests<AlgorithmsTest>({
         &AlgorithmsTest::copyStrided4D<char>,
@@ -236,6 +366,16 @@ AlgorithmsTest::AlgorithmsTest() {
                    &AlgorithmsTest::copyBenchmark3DNonContiguous<Data<16>>,
                    &AlgorithmsTest::copyBenchmark3DNonContiguous<Data<32>>}, 100);
 
+    addInstancedTests({&AlgorithmsTest::copyParallel,
+                       &AlgorithmsTest::copyParallelStrided},
+        Containers::arraySize(ParallelData));
+
+    addTests({&AlgorithmsTest::copyParallelSmall,
+              &AlgorithmsTest::copyParallelNonMatchingSizes});
+
+    addBenchmarks({&AlgorithmsTest::copyParallelBenchmarkSerial,
+                   &AlgorithmsTest::copyParallelBenchmark}, 10);
+
     addTests({&AlgorithmsTest::flipInPlaceFirstDimension<Data<1>>,
               &AlgorithmsTest::flipInPlaceFirstDimension<Data<8>>,
               &AlgorithmsTest::flipInPlaceFirstDimension<Data<32>>,
@@ -250,6 +390,98 @@ AlgorithmsTest::AlgorithmsTest() {
 
               &AlgorithmsTest::flipInPlaceZeroSize,
               &AlgorithmsTest::flipInPlaceNonContigous});
+
+    addInstancedTests({&AlgorithmsTest::flipInPlaceParallel,
+                       &AlgorithmsTest::flipInPlaceParallelOuterDimension},
+        Containers::arraySize(ParallelData));
+
+    addTests({&AlgorithmsTest::flipInPlaceParallelNonContigous});
+
+    addBenchmarks({&AlgorithmsTest::flipInPlaceParallelBenchmarkSerial,
+                   &AlgorithmsTest::flipInPlaceParallelBenchmark}, 10);
+
+    addInstancedTests<AlgorithmsTest>({&AlgorithmsTest::transposeInto<Data<1>>,
+                                       &AlgorithmsTest::transposeInto<Data<2>>,
+                                       &AlgorithmsTest::transposeInto<Data<3>>,
+                                       &AlgorithmsTest::transposeInto<Data<4>>,
+                                       &AlgorithmsTest::transposeInto<Data<8>>,
+                                       &AlgorithmsTest::transposeInto<Data<12>>,
+                                       &AlgorithmsTest::transposeInto<Data<16>>},
+        Containers::arraySize(TransposeData));
+
+    addTests({&AlgorithmsTest::transposeIntoMutableSource,
+              &AlgorithmsTest::transposeIntoZeroSize,
+              &AlgorithmsTest::transposeIntoNonMatchingSizes,
+              &AlgorithmsTest::transposeIntoNonContiguous});
+
+    addInstancedTests({&AlgorithmsTest::fill},
+        Containers::arraySize(AlgorithmData));
+
+    addTests({&AlgorithmsTest::fill3D});
+
+    addInstancedTests({&AlgorithmsTest::transform},
+        Containers::arraySize(AlgorithmData));
+
+    addTests({&AlgorithmsTest::transformInPlace,
+              &AlgorithmsTest::transformNonMatchingSizes});
+
+    addInstancedTests({&AlgorithmsTest::reduce,
+                       &AlgorithmsTest::sum<int>,
+                       &AlgorithmsTest::sum<float>},
+        Containers::arraySize(AlgorithmData));
+
+    addTests({&AlgorithmsTest::sumEmpty});
+
+    addInstancedTests<AlgorithmsTest>({&AlgorithmsTest::minmax<int>,
+                                       &AlgorithmsTest::minmax<float>},
+        Containers::arraySize(AlgorithmData));
+
+    addTests({&AlgorithmsTest::minmaxEmpty});
+
+    addInstancedTests({&AlgorithmsTest::scan},
+        Containers::arraySize(AlgorithmData));
+
+    addTests({&AlgorithmsTest::scanCustomFunction,
+              &AlgorithmsTest::scanNonMatchingSizes});
+
+    addBenchmarks({&AlgorithmsTest::sumBenchmarkLoop,
+                   &AlgorithmsTest::sumBenchmark,
+                   &AlgorithmsTest::minmaxBenchmarkLoop,
+                   &AlgorithmsTest::minmaxBenchmark}, 100);
+
+    addInstancedTests<AlgorithmsTest>({&AlgorithmsTest::sort<std::uint8_t>,
+                                       &AlgorithmsTest::sort<std::int8_t>,
+                                       &AlgorithmsTest::sort<std::uint16_t>,
+                                       &AlgorithmsTest::sort<std::int16_t>,
+                                       &AlgorithmsTest::sort<std::uint32_t>,
+                                       &AlgorithmsTest::sort<std::int32_t>,
+                                       &AlgorithmsTest::sort<std::uint64_t>,
+                                       &AlgorithmsTest::sort<std::int64_t>,
+                                       &AlgorithmsTest::sort<float>,
+                                       &AlgorithmsTest::sort<double>},
+        Containers::arraySize(SortData));
+
+    addTests({&AlgorithmsTest::sortArrayView,
+              &AlgorithmsTest::sortFloatSpecialValues,
+              &AlgorithmsTest::sortEmpty});
+
+    addInstancedTests<AlgorithmsTest>({&AlgorithmsTest::sortParallel<std::int32_t>,
+                                       &AlgorithmsTest::sortParallel<double>},
+        Containers::arraySize(ParallelData));
+
+    addInstancedTests<AlgorithmsTest>({&AlgorithmsTest::sortIndices<std::uint8_t>,
+                                       &AlgorithmsTest::sortIndices<std::int16_t>,
+                                       &AlgorithmsTest::sortIndices<std::uint32_t>,
+                                       &AlgorithmsTest::sortIndices<float>,
+                                       &AlgorithmsTest::sortIndices<std::int64_t>},
+        Containers::arraySize(SortData));
+
+    addTests({&AlgorithmsTest::sortIndicesMutableKeys});
+
+    addInstancedTests({&AlgorithmsTest::sortIndicesParallel},
+        Containers::arraySize(ParallelData));
+
+    addTests({&AlgorithmsTest::sortIndicesNonMatchingSizes});
 }
 
 void AlgorithmsTest::copy() {
@@ -804,6 +1036,121 @@ template<class T> void AlgorithmsTest::copyBenchmark3DNonContiguous() {
     CORRADE_COMPARE(dstData[Size*Size*Size*4/sizeof(T) - 2].data[0], (Size*Size*Size*4/sizeof(T) + 10 - 2)%256);
 }
 
+/* Large enough to be split into several chunks, and not a multiple of the
+   chunk count */
+constexpr std::size_t ParallelWidth = 1023;
+constexpr std::size_t ParallelHeight = 2049;
+
+void AlgorithmsTest::copyParallel() {
+    auto&& data = ParallelData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<int> src{NoInit, ParallelWidth*ParallelHeight};
+    for(std::size_t i = 0; i != src.size(); ++i) src[i] = i;
+    Containers::Array<int> dst{ValueInit, src.size()};
+
+    Utility::copyParallel(src, dst, data.threadCount);
+    CORRADE_COMPARE_AS(dst, src, TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::copyParallelStrided() {
+    auto&& data = ParallelData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<int> srcData{NoInit, ParallelWidth*ParallelHeight};
+    for(std::size_t i = 0; i != srcData.size(); ++i) srcData[i] = i;
+    Containers::Array<int> dstData{ValueInit, ParallelWidth*ParallelHeight*2};
+
+    /* Flipped source and a sparse destination */
+    Containers::StridedArrayView2D<const int> src{srcData, {ParallelHeight, ParallelWidth}};
+    Containers::StridedArrayView2D<int> dst{dstData, {ParallelHeight, ParallelWidth}, {std::ptrdiff_t(ParallelWidth*2*4), 4}};
+    Utility::copyParallel(src.flipped<0>(), dst, data.threadCount);
+
+    for(std::size_t i = 0; i != ParallelHeight; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_AS(dst[i], src[ParallelHeight - i - 1], TestSuite::Compare::Container);
+    }
+
+    /* 1D views have just one dimension to split */
+    Containers::StridedArrayView1D<const int> src1D = srcData;
+    Containers::StridedArrayView1D<int> dst1D{dstData, ParallelWidth*ParallelHeight, 8};
+    Utility::copyParallel(src1D, dst1D, data.threadCount);
+    CORRADE_COMPARE_AS(dst1D, src1D, TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::copyParallelSmall() {
+    int src[]{1, 2, 3, 4, 5};
+    int dst[5]{};
+
+    /* Shouldn't spawn any threads, but the result should be the same */
+    Utility::copyParallel(Containers::stridedArrayView(src), Containers::stridedArrayView(dst), 8);
+    CORRADE_COMPARE_AS(Containers::arrayView(dst), Containers::arrayView(src), TestSuite::Compare::Container);
+
+    /* Zero size shouldn't crash either */
+    Utility::copyParallel(Containers::StridedArrayView2D<const char>{nullptr, {0, 16}, {16, 1}}, Containers::StridedArrayView2D<char>{nullptr, {0, 16}, {16, 1}}, 8);
+}
+
+void AlgorithmsTest::copyParallelNonMatchingSizes() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    char a[2*3*5*7]{};
+    int b[2*3*5*7]{};
+
+    Utility::copyParallel(Containers::ArrayView<const char>{a, 2},
+                          Containers::ArrayView<char>{a, 3});
+    Utility::copyParallel(Containers::StridedArrayView1D<const char>{a, 2},
+                          Containers::StridedArrayView1D<char>{a, 3});
+    Utility::copyParallel(Containers::StridedArrayView2D<const char>{a, {2, 3}},
+                          Containers::StridedArrayView2D<char>{a, {2, 4}});
+    Utility::copyParallel(Containers::StridedArrayView3D<const char>{a, {2, 3, 5}},
+                          Containers::StridedArrayView3D<char>{a, {2, 4, 5}});
+    Utility::copyParallel(Containers::StridedArrayView4D<const char>{a, {2, 3, 5, 7}},
+                          Containers::StridedArrayView4D<char>{a, {2, 3, 5, 6}});
+    Utility::copyParallel(Containers::StridedArrayView3D<const int>{b, {2, 3, 5}},
+                          Containers::StridedArrayView3D<int>{b, {2, 3, 4}});
+
+    CORRADE_COMPARE(out.str(),
+        "Utility::Algorithms::copyParallel(): sizes 2 and 3 don't match\n"
+        "Utility::Algorithms::copyParallel(): sizes 2 and 3 don't match\n"
+        "Utility::Algorithms::copyParallel(): sizes {2, 3} and {2, 4} don't match\n"
+        "Utility::Algorithms::copyParallel(): sizes {2, 3, 5} and {2, 4, 5} don't match\n"
+        "Utility::Algorithms::copyParallel(): sizes {2, 3, 5, 7} and {2, 3, 5, 6} don't match\n"
+        "Utility::Algorithms::copyParallel(): sizes {2, 3, 5, 4} and {2, 3, 4, 4} don't match\n");
+}
+
+/* A 4K RGBA8 image */
+constexpr std::size_t BenchmarkImageWidth = 3840;
+constexpr std::size_t BenchmarkImageHeight = 2160;
+
+void AlgorithmsTest::copyParallelBenchmarkSerial() {
+    Containers::Array<std::uint32_t> src{ValueInit, BenchmarkImageWidth*BenchmarkImageHeight};
+    Containers::Array<std::uint32_t> dst{NoInit, BenchmarkImageWidth*BenchmarkImageHeight*2};
+    Containers::StridedArrayView2D<const std::uint32_t> srcView{src, {BenchmarkImageHeight, BenchmarkImageWidth}};
+    Containers::StridedArrayView2D<std::uint32_t> dstView{dst, {BenchmarkImageHeight, BenchmarkImageWidth}, {BenchmarkImageWidth*4, 8}};
+
+    CORRADE_BENCHMARK(1)
+        Utility::copy(srcView, dstView);
+
+    CORRADE_COMPARE(dstView[BenchmarkImageHeight - 1][BenchmarkImageWidth - 1], 0);
+}
+
+void AlgorithmsTest::copyParallelBenchmark() {
+    Containers::Array<std::uint32_t> src{ValueInit, BenchmarkImageWidth*BenchmarkImageHeight};
+    Containers::Array<std::uint32_t> dst{NoInit, BenchmarkImageWidth*BenchmarkImageHeight*2};
+    Containers::StridedArrayView2D<const std::uint32_t> srcView{src, {BenchmarkImageHeight, BenchmarkImageWidth}};
+    Containers::StridedArrayView2D<std::uint32_t> dstView{dst, {BenchmarkImageHeight, BenchmarkImageWidth}, {BenchmarkImageWidth*4, 8}};
+
+    CORRADE_BENCHMARK(1)
+        Utility::copyParallel(srcView, dstView);
+
+    CORRADE_COMPARE(dstView[BenchmarkImageHeight - 1][BenchmarkImageWidth - 1], 0);
+}
+
 template<class T> void AlgorithmsTest::flipInPlaceFirstDimension() {
     setTestCaseTemplateName(TypeName<T>::name());
 
@@ -1006,6 +1353,747 @@ void AlgorithmsTest::flipInPlaceNonContigous() {
         "Utility::flipInPlace(): the view is not contiguous after dimension 1\n");
 }
 
+void AlgorithmsTest::flipInPlaceParallel() {
+    auto&& data = ParallelData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<int> array{NoInit, ParallelWidth*ParallelHeight};
+    for(std::size_t i = 0; i != array.size(); ++i) array[i] = i;
+    Containers::Array<int> expected{NoInit, array.size()};
+    Utility::copy(array, expected);
+
+    /* A single outer dimension, so the item pairs get split */
+    Containers::StridedArrayView2D<int> view{array, {ParallelHeight, ParallelWidth}};
+    Utility::flipInPlaceParallel<0>(view, data.threadCount);
+    for(std::size_t i: {std::size_t{0}, ParallelHeight/2 - 1, ParallelHeight/2, ParallelHeight/2 + 1, ParallelHeight - 1}) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(view[i][0], int((ParallelHeight - i - 1)*ParallelWidth));
+        CORRADE_COMPARE(view[i][ParallelWidth - 1], int((ParallelHeight - i)*ParallelWidth - 1));
+    }
+
+    /* Flipping back gives the original */
+    Utility::flipInPlaceParallel<0>(view, data.threadCount);
+    CORRADE_COMPARE_AS(array, expected, TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::flipInPlaceParallelOuterDimension() {
+    auto&& data = ParallelData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<int> array{NoInit, ParallelWidth*ParallelHeight};
+    for(std::size_t i = 0; i != array.size(); ++i) array[i] = i;
+    Containers::Array<int> expected{NoInit, array.size()};
+    Utility::copy(array, expected);
+
+    /* The first dimension gets split, each chunk flips its whole rows */
+    Containers::StridedArrayView2D<int> view{array, {ParallelHeight, ParallelWidth}};
+    Utility::flipInPlaceParallel<1>(view, data.threadCount);
+    for(std::size_t i: {std::size_t{0}, ParallelHeight/2, ParallelHeight - 1}) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(view[i][0], int((i + 1)*ParallelWidth - 1));
+        CORRADE_COMPARE(view[i][ParallelWidth/2], int(i*ParallelWidth + ParallelWidth/2));
+        CORRADE_COMPARE(view[i][ParallelWidth - 1], int(i*ParallelWidth));
+    }
+
+    /* Same result as with the serial variant */
+    Utility::flipInPlace<1>(view);
+    CORRADE_COMPARE_AS(array, expected, TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::flipInPlaceParallelNonContigous() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    int a[2*3*7];
+    Containers::StridedArrayView3D<int> c{a, {2, 1, 7}, {3*7*4, 2*7*4, 4}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Utility::flipInPlaceParallel<0>(c);
+    CORRADE_COMPARE(out.str(),
+        "Utility::flipInPlaceParallel(): the view is not contiguous after dimension 0\n");
+}
+
+void AlgorithmsTest::flipInPlaceParallelBenchmarkSerial() {
+    Containers::Array<std::uint32_t> array{ValueInit, BenchmarkImageWidth*BenchmarkImageHeight};
+    Containers::StridedArrayView2D<std::uint32_t> view{array, {BenchmarkImageHeight, BenchmarkImageWidth}};
+    view[0][0] = 1;
+
+    CORRADE_BENCHMARK(1)
+        Utility::flipInPlace<0>(view);
+
+    CORRADE_COMPARE(view[BenchmarkImageHeight - 1][0], 1);
+}
+
+void AlgorithmsTest::flipInPlaceParallelBenchmark() {
+    Containers::Array<std::uint32_t> array{ValueInit, BenchmarkImageWidth*BenchmarkImageHeight};
+    Containers::StridedArrayView2D<std::uint32_t> view{array, {BenchmarkImageHeight, BenchmarkImageWidth}};
+    view[0][0] = 1;
+
+    CORRADE_BENCHMARK(1)
+        Utility::flipInPlaceParallel<0>(view);
+
+    CORRADE_COMPARE(view[BenchmarkImageHeight - 1][0], 1);
+}
+
+template<class T> void AlgorithmsTest::transposeInto() {
+    auto&& data = TransposeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    /* Enough so even sparse variants fit */
+    const std::size_t srcRowItems = data.cols*data.srcItemStride + data.srcRowPadding;
+    const std::size_t dstRowItems = data.rows*data.dstItemStride;
+    Containers::Array<T> srcData{NoInit, data.rows*srcRowItems};
+    Containers::Array<T> dstData{ValueInit, data.cols*dstRowItems};
+
+    Containers::StridedArrayView2D<T> src{srcData, {data.rows, data.cols},
+        {std::ptrdiff_t(srcRowItems*sizeof(T)),
+         std::ptrdiff_t(data.srcItemStride*sizeof(T))}};
+    Containers::StridedArrayView2D<T> dst{dstData, {data.cols, data.rows},
+        {std::ptrdiff_t(dstRowItems*sizeof(T)),
+         std::ptrdiff_t(data.dstItemStride*sizeof(T))}};
+    if(data.flipped) {
+        src = src.template flipped<0>().template flipped<1>();
+        dst = dst.template flipped<0>();
+    }
+
+    /* Data<N> wraps around at 256, so make the values depend on both the row
+       and the column to catch transposition errors */
+    for(std::size_t i = 0; i != data.rows; ++i)
+        for(std::size_t j = 0; j != data.cols; ++j)
+            src[i][j] = static_cast<unsigned char>(i*7 + j*3 + 1);
+
+    Utility::transposeInto(Containers::StridedArrayView2D<const T>{src}, dst);
+
+    /* Compare::Container can't handle multi-dimensional views, so compare
+       contiguous copies */
+    Containers::Array<T> actual{NoInit, data.rows*data.cols};
+    Containers::Array<T> expected{NoInit, data.rows*data.cols};
+    Utility::copy(dst, Containers::StridedArrayView2D<T>{actual, {data.cols, data.rows}});
+    Utility::copy(src.template transposed<0, 1>(), Containers::StridedArrayView2D<T>{expected, {data.cols, data.rows}});
+    CORRADE_COMPARE_AS(actual, expected, TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::transposeIntoMutableSource() {
+    int src[]{
+        1, 2, 3,
+        4, 5, 6
+    };
+    int dst[6];
+    Containers::StridedArrayView2D<int> srcView{src, {2, 3}};
+    Containers::StridedArrayView2D<int> dstView{dst, {3, 2}};
+
+    /* Should pick the non-const overload and not be ambiguous */
+    Utility::transposeInto(srcView, dstView);
+
+    int expected[]{
+        1, 4,
+        2, 5,
+        3, 6
+    };
+    CORRADE_COMPARE_AS(Containers::arrayView(dst),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::transposeIntoZeroSize() {
+    int src[1]{};
+    int dst[1]{};
+    Containers::StridedArrayView2D<int> srcView{src, {0, 1}};
+    Containers::StridedArrayView2D<int> dstView{dst, {1, 0}};
+
+    /* Shouldn't crash or anything */
+    Utility::transposeInto(srcView, dstView);
+    CORRADE_VERIFY(true);
+}
+
+void AlgorithmsTest::transposeIntoNonMatchingSizes() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    int data[3*4]{};
+    Containers::StridedArrayView2D<int> src{data, {3, 4}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Utility::transposeInto(src, Containers::StridedArrayView2D<int>{data, {3, 4}});
+    Utility::transposeInto(src, Containers::StridedArrayView2D<int>{data, {4, 2}});
+    Utility::transposeInto(Containers::arrayCast<3, const char>(src),
+        Containers::StridedArrayView3D<char>{Containers::arrayCast<char>(Containers::arrayView(data)), {4, 3, 2}});
+    CORRADE_COMPARE(out.str(),
+        "Utility::transposeInto(): can't transpose {3, 4, 4} into {3, 4, 4}\n"
+        "Utility::transposeInto(): can't transpose {3, 4, 4} into {4, 2, 4}\n"
+        "Utility::transposeInto(): can't transpose {3, 4, 4} into {4, 3, 2}\n");
+}
+
+void AlgorithmsTest::transposeIntoNonContiguous() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    char data[3*4*4]{};
+    Containers::StridedArrayView3D<char> a{data, {3, 4, 2}, {16, 4, 1}};
+    Containers::StridedArrayView3D<char> b{data, {4, 3, 2}, {12, 4, 1}};
+    Containers::StridedArrayView3D<char> aSparse{data, {3, 4, 2}, {16, 4, 2}};
+    Containers::StridedArrayView3D<char> bSparse{data, {4, 3, 2}, {12, 4, 2}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Utility::transposeInto(aSparse, b);
+    Utility::transposeInto(a, bSparse);
+    CORRADE_COMPARE(out.str(),
+        "Utility::transposeInto(): last view dimension is not contiguous\n"
+        "Utility::transposeInto(): last view dimension is not contiguous\n");
+}
+
+template<class T> Containers::StridedArrayView2D<T> algorithmView(Containers::ArrayView<T> data, const std::size_t instanceId) {
+    auto&& instance = AlgorithmData[instanceId];
+    Containers::StridedArrayView2D<T> view{data, {5, 19},
+        {std::ptrdiff_t(instance.rowStride*sizeof(T)),
+         std::ptrdiff_t(instance.itemStride*sizeof(T))}};
+    return instance.flipped ? view.template flipped<0>().template flipped<1>() : view;
+}
+
+void AlgorithmsTest::fill() {
+    auto&& data = AlgorithmData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<int> array{ValueInit, std::size_t(5*data.rowStride)};
+    Containers::StridedArrayView2D<int> view = algorithmView(arrayView(array), testCaseInstanceId());
+
+    Utility::fill(view, 1337);
+
+    std::size_t count = 0;
+    for(Containers::StridedArrayView1D<int> row: view)
+        for(int i: row) {
+            CORRADE_COMPARE(i, 1337);
+            ++count;
+        }
+    CORRADE_COMPARE(count, 5*19);
+
+    /* Items outside of the view are untouched */
+    std::size_t filled = 0;
+    for(int i: array) if(i == 1337) ++filled;
+    CORRADE_COMPARE(filled, 5*19);
+}
+
+void AlgorithmsTest::fill3D() {
+    float data[2*3*4]{};
+    Containers::StridedArrayView3D<float> view{data, {2, 3, 4}};
+
+    /* Just the middle item of each row, which makes it non-contiguous */
+    Utility::fill(view.slice({0, 0, 1}, {2, 3, 3}), 2.5f);
+    CORRADE_COMPARE_AS(Containers::arrayView(data), Containers::arrayView({
+        0.0f, 2.5f, 2.5f, 0.0f,
+        0.0f, 2.5f, 2.5f, 0.0f,
+        0.0f, 2.5f, 2.5f, 0.0f,
+
+        0.0f, 2.5f, 2.5f, 0.0f,
+        0.0f, 2.5f, 2.5f, 0.0f,
+        0.0f, 2.5f, 2.5f, 0.0f
+    }), TestSuite::Compare::Container);
+
+    /* The whole view is contiguous */
+    Utility::fill(view, 1.0f);
+    for(float i: data) CORRADE_COMPARE(i, 1.0f);
+}
+
+void AlgorithmsTest::transform() {
+    auto&& data = AlgorithmData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<int> srcData{ValueInit, std::size_t(5*data.rowStride)};
+    Containers::StridedArrayView2D<int> src = algorithmView(arrayView(srcData), testCaseInstanceId());
+    int n = 0;
+    for(Containers::StridedArrayView1D<int> row: src)
+        for(int& i: row) i = n++;
+
+    /* Destination is always contiguous, so the source is merged into rows
+       only if it's contiguous as well */
+    float dstData[5*19]{};
+    Containers::StridedArrayView2D<float> dst{dstData, {5, 19}};
+
+    Utility::transform(Containers::StridedArrayView2D<const int>{src}, dst, [](int a) {
+        return a*0.5f;
+    });
+
+    for(std::size_t i = 0; i != 5*19; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(dstData[i], i*0.5f);
+    }
+}
+
+void AlgorithmsTest::transformInPlace() {
+    int data[]{1, 2, 3, 4, 5, 6};
+    Containers::StridedArrayView1D<int> view = data;
+
+    /* Every other item */
+    Utility::transform(view.every(2), view.every(2), [](int a) { return -a; });
+    CORRADE_COMPARE_AS(Containers::arrayView(data),
+        Containers::arrayView({-1, 2, -3, 4, -5, 6}),
+        TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::transformNonMatchingSizes() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    int a[2*3]{};
+    float b[2*4]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Utility::transform(Containers::StridedArrayView2D<const int>{a, {2, 3}},
+                       Containers::StridedArrayView2D<float>{b, {2, 4}},
+                       [](int a) { return float(a); });
+    CORRADE_COMPARE(out.str(),
+        "Utility::transform(): sizes {2, 3} and {2, 4} don't match\n");
+}
+
+void AlgorithmsTest::reduce() {
+    auto&& data = AlgorithmData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<int> array{ValueInit, std::size_t(5*data.rowStride)};
+    Containers::StridedArrayView2D<int> view = algorithmView(arrayView(array), testCaseInstanceId());
+    int n = 0;
+    for(Containers::StridedArrayView1D<int> row: view)
+        for(int& i: row) i = n++ % 10;
+
+    /* The order is preserved, so this gives the digits in storage order */
+    std::string out = Utility::reduce(view, std::string{"#"}, [](const std::string& a, int b) {
+        return a + char('0' + b);
+    });
+    CORRADE_COMPARE(out.size(), 5*19 + 1);
+    CORRADE_COMPARE(out.substr(0, 13), "#012345678901");
+    CORRADE_COMPARE(out.substr(out.size() - 5), "01234");
+}
+
+template<class> struct SumType;
+template<> struct SumType<int> {
+    static const char* name() { return "int"; }
+};
+template<> struct SumType<float> {
+    static const char* name() { return "float"; }
+};
+
+template<class T> void AlgorithmsTest::sum() {
+    auto&& data = AlgorithmData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+    setTestCaseTemplateName(SumType<T>::name());
+
+    Containers::Array<T> array{ValueInit, std::size_t(5*data.rowStride)};
+    Containers::StridedArrayView2D<T> view = algorithmView(arrayView(array), testCaseInstanceId());
+    int n = 0;
+    for(Containers::StridedArrayView1D<T> row: view)
+        for(T& i: row) i = T(n++);
+
+    /* Exactly representable even for floats. Both const and mutable views
+       are accepted. */
+    CORRADE_COMPARE(Utility::sum(view), T(5*19*(5*19 - 1)/2));
+    CORRADE_COMPARE(Utility::sum(Containers::StridedArrayView2D<const T>{view}), T(5*19*(5*19 - 1)/2));
+}
+
+void AlgorithmsTest::sumEmpty() {
+    CORRADE_COMPARE(Utility::sum(Containers::StridedArrayView1D<const int>{}), 0);
+    CORRADE_COMPARE(Utility::sum(Containers::StridedArrayView2D<const float>{nullptr, {0, 3}, {12, 4}}), 0.0f);
+}
+
+template<class T> void AlgorithmsTest::minmax() {
+    auto&& data = AlgorithmData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+    setTestCaseTemplateName(SumType<T>::name());
+
+    Containers::Array<T> array{ValueInit, std::size_t(5*data.rowStride)};
+    Containers::StridedArrayView2D<T> view = algorithmView(arrayView(array), testCaseInstanceId());
+    int n = 0;
+    for(Containers::StridedArrayView1D<T> row: view)
+        for(T& i: row) i = T((n++*37) % 95 - 40);
+
+    /* Put the extremes into the remainder of the contiguous variant and
+       somewhere in the middle of a row */
+    view[4][18] = T(-1000);
+    view[2][7] = T(1000);
+
+    Containers::Pair<T, T> out = Utility::minmax(view);
+    CORRADE_COMPARE(out.first(), T(-1000));
+    CORRADE_COMPARE(out.second(), T(1000));
+
+    /* Single item */
+    out = Utility::minmax(view.slice({1, 3}, {2, 4}));
+    CORRADE_COMPARE(out.first(), view[1][3]);
+    CORRADE_COMPARE(out.second(), view[1][3]);
+}
+
+void AlgorithmsTest::minmaxEmpty() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Utility::minmax(Containers::StridedArrayView2D<const float>{nullptr, {3, 0}, {0, 4}});
+    CORRADE_COMPARE(out.str(),
+        "Utility::minmax(): the view is empty\n");
+}
+
+void AlgorithmsTest::scan() {
+    auto&& data = AlgorithmData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<int> array{ValueInit, std::size_t(5*data.rowStride)};
+    Containers::StridedArrayView2D<int> view = algorithmView(arrayView(array), testCaseInstanceId());
+    for(Containers::StridedArrayView1D<int> row: view)
+        for(int& i: row) i = 1;
+
+    int out[5*19];
+    Utility::scan(view, Containers::StridedArrayView2D<int>{out, {5, 19}});
+    for(std::size_t i = 0; i != 5*19; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out[i], int(i + 1));
+    }
+
+    /* In-place */
+    Utility::scan(view, view);
+    CORRADE_COMPARE(view[0][0], 1);
+    CORRADE_COMPARE(view[1][0], 20);
+    CORRADE_COMPARE(view[4][18], 5*19);
+}
+
+void AlgorithmsTest::scanCustomFunction() {
+    const int src[]{3, 1, 4, 1, 5, 9, 2, 6};
+    int dst[8];
+    Utility::scan(Containers::stridedArrayView(src), Containers::stridedArrayView(dst), [](int a, int b) {
+        return a > b ? a : b;
+    });
+    CORRADE_COMPARE_AS(Containers::arrayView(dst),
+        Containers::arrayView({3, 3, 4, 4, 5, 9, 9, 9}),
+        TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::scanNonMatchingSizes() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    int a[3]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Utility::scan(Containers::StridedArrayView1D<const int>{a, 3},
+                  Containers::StridedArrayView1D<int>{a, 2});
+    CORRADE_COMPARE(out.str(),
+        "Utility::scan(): sizes 3 and 2 don't match\n");
+}
+
+constexpr std::size_t ReductionBenchmarkSize = 65536;
+
+void AlgorithmsTest::sumBenchmarkLoop() {
+    Containers::Array<float> data{NoInit, ReductionBenchmarkSize};
+    for(std::size_t i = 0; i != data.size(); ++i) data[i] = float(i % 3);
+    Containers::StridedArrayView1D<const float> view = data;
+
+    float sum = 0.0f;
+    CORRADE_BENCHMARK(10)
+        for(float i: view) sum += i;
+
+    CORRADE_COMPARE(sum, 10.0f*(ReductionBenchmarkSize - 1));
+}
+
+void AlgorithmsTest::sumBenchmark() {
+    Containers::Array<float> data{NoInit, ReductionBenchmarkSize};
+    for(std::size_t i = 0; i != data.size(); ++i) data[i] = float(i % 3);
+    Containers::StridedArrayView1D<const float> view = data;
+
+    float sum = 0.0f;
+    CORRADE_BENCHMARK(10)
+        sum += Utility::sum(view);
+
+    CORRADE_COMPARE(sum, 10.0f*(ReductionBenchmarkSize - 1));
+}
+
+void AlgorithmsTest::minmaxBenchmarkLoop() {
+    Containers::Array<float> data{NoInit, ReductionBenchmarkSize};
+    for(std::size_t i = 0; i != data.size(); ++i) data[i] = float(i % 1000);
+    Containers::StridedArrayView1D<const float> view = data;
+
+    float min = 0.0f, max = 0.0f;
+    CORRADE_BENCHMARK(10) {
+        float localMin = view[0], localMax = view[0];
+        for(float i: view) {
+            if(i < localMin) localMin = i;
+            if(localMax < i) localMax = i;
+        }
+        min += localMin;
+        max += localMax;
+    }
+
+    CORRADE_COMPARE(min, 0.0f);
+    CORRADE_COMPARE(max, 9990.0f);
+}
+
+void AlgorithmsTest::minmaxBenchmark() {
+    Containers::Array<float> data{NoInit, ReductionBenchmarkSize};
+    for(std::size_t i = 0; i != data.size(); ++i) data[i] = float(i % 1000);
+    Containers::StridedArrayView1D<const float> view = data;
+
+    float min = 0.0f, max = 0.0f;
+    CORRADE_BENCHMARK(10) {
+        Containers::Pair<float, float> minmax = Utility::minmax(view);
+        min += minmax.first();
+        max += minmax.second();
+    }
+
+    CORRADE_COMPARE(min, 0.0f);
+    CORRADE_COMPARE(max, 9990.0f);
+}
+
+template<class> struct SortType;
+template<> struct SortType<std::uint8_t> {
+    static const char* name() { return "UnsignedByte"; }
+};
+template<> struct SortType<std::int8_t> {
+    static const char* name() { return "Byte"; }
+};
+template<> struct SortType<std::uint16_t> {
+    static const char* name() { return "UnsignedShort"; }
+};
+template<> struct SortType<std::int16_t> {
+    static const char* name() { return "Short"; }
+};
+template<> struct SortType<std::uint32_t> {
+    static const char* name() { return "UnsignedInt"; }
+};
+template<> struct SortType<std::int32_t> {
+    static const char* name() { return "Int"; }
+};
+template<> struct SortType<std::uint64_t> {
+    static const char* name() { return "UnsignedLong"; }
+};
+template<> struct SortType<std::int64_t> {
+    static const char* name() { return "Long"; }
+};
+template<> struct SortType<float> {
+    static const char* name() { return "Float"; }
+};
+template<> struct SortType<double> {
+    static const char* name() { return "Double"; }
+};
+
+/* A xorshift generator to have the test data deterministic across platforms
+   and standard library implementations */
+struct SortRandom {
+    std::uint64_t state = 0x2545f4914f6cdd1dull;
+
+    std::uint64_t operator()() {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+};
+
+template<class T> T sortValue(std::uint64_t random, bool narrowRange, typename std::enable_if<std::is_integral<T>::value>::type* = nullptr) {
+    /* Narrow range makes the radix sort skip the passes for the upper
+       bytes. For signed types it's around zero, so the sign bit still
+       differs. */
+    if(narrowRange) return T(std::int64_t(random % 100) - (std::is_signed<T>::value ? 50 : 0));
+    return T(random);
+}
+
+template<class T> T sortValue(std::uint64_t random, bool narrowRange, typename std::enable_if<std::is_floating_point<T>::value>::type* = nullptr) {
+    if(narrowRange) return T(std::int64_t(random % 100) - 50);
+    return T(std::int32_t(random))/T(1000.0);
+}
+
+constexpr std::size_t SortSize = 1537;
+
+template<class T> void AlgorithmsTest::sort() {
+    auto&& data = SortData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+    setTestCaseTemplateName(SortType<T>::name());
+
+    Containers::Array<T> array{ValueInit, SortSize*data.stride};
+    Containers::StridedArrayView1D<T> view{array, SortSize, std::ptrdiff_t(data.stride*sizeof(T))};
+    if(data.flipped) view = view.template flipped<0>();
+
+    SortRandom random;
+    std::vector<T> expected;
+    for(T& i: view) {
+        i = sortValue<T>(random(), data.narrowRange);
+        expected.push_back(i);
+    }
+    std::sort(expected.begin(), expected.end());
+
+    Utility::sort(view);
+
+    CORRADE_COMPARE_AS(view, Containers::StridedArrayView1D<T>{Containers::arrayView(expected)},
+        TestSuite::Compare::Container);
+
+    /* The gaps in the sparse view shouldn't be touched */
+    if(data.stride != 1) for(std::size_t i = 0; i != SortSize; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(array[i*data.stride + 1], T{});
+    }
+}
+
+void AlgorithmsTest::sortArrayView() {
+    int data[]{5, -3, 17, 0, -3, 2};
+
+    Utility::sort(Containers::arrayView(data));
+
+    int expected[]{-3, -3, 0, 2, 5, 17};
+    CORRADE_COMPARE_AS(Containers::arrayView(data),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::sortFloatSpecialValues() {
+    const float denormal = std::numeric_limits<float>::denorm_min();
+    const float inf = std::numeric_limits<float>::infinity();
+    float data[]{
+        1.5f, -0.0f, inf, denormal, -1.5f,
+        std::numeric_limits<float>::lowest(), 0.0f, -inf, -denormal,
+        std::numeric_limits<float>::max()
+    };
+
+    Utility::sort(Containers::arrayView(data));
+
+    float expected[]{
+        -inf, std::numeric_limits<float>::lowest(), -1.5f, -denormal, -0.0f,
+        0.0f, denormal, 1.5f, std::numeric_limits<float>::max(), inf
+    };
+    CORRADE_COMPARE_AS(Containers::arrayView(data),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+
+    /* Negative zero is sorted before positive */
+    CORRADE_VERIFY(std::signbit(data[4]));
+    CORRADE_VERIFY(!std::signbit(data[5]));
+}
+
+void AlgorithmsTest::sortEmpty() {
+    Containers::StridedArrayView1D<int> view;
+    Containers::StridedArrayView1D<std::uint32_t> indices;
+
+    /* Shouldn't crash or anything */
+    Utility::sort(view);
+    Utility::sortParallel(view);
+    Utility::sortIndices(view, indices);
+    Utility::sortIndicesParallel(view, indices);
+    CORRADE_VERIFY(true);
+}
+
+/* Big enough to be split across 8 threads, and not divisible by any of the
+   thread counts so the chunks and merged runs have different sizes */
+constexpr std::size_t SortParallelSize = 1000003;
+
+template<class T> void AlgorithmsTest::sortParallel() {
+    auto&& data = ParallelData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+    setTestCaseTemplateName(SortType<T>::name());
+
+    Containers::Array<T> array{NoInit, SortParallelSize};
+    Containers::Array<T> expected{NoInit, SortParallelSize};
+    SortRandom random;
+    for(std::size_t i = 0; i != array.size(); ++i)
+        array[i] = expected[i] = sortValue<T>(random(), false);
+
+    Utility::sort(Containers::arrayView(expected));
+    Utility::sortParallel(Containers::arrayView(array), data.threadCount);
+
+    CORRADE_COMPARE_AS(array, expected, TestSuite::Compare::Container);
+}
+
+template<class T> void AlgorithmsTest::sortIndices() {
+    auto&& data = SortData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+    setTestCaseTemplateName(SortType<T>::name());
+
+    Containers::Array<T> keyArray{ValueInit, SortSize*data.stride};
+    Containers::Array<std::uint32_t> indexArray{ValueInit, SortSize*data.stride};
+    Containers::StridedArrayView1D<const T> keys{keyArray, SortSize, std::ptrdiff_t(data.stride*sizeof(T))};
+    Containers::StridedArrayView1D<std::uint32_t> indices{indexArray, SortSize, std::ptrdiff_t(data.stride*sizeof(std::uint32_t))};
+    if(data.flipped) {
+        keys = keys.template flipped<0>();
+        indices = indices.flipped<0>();
+    }
+
+    SortRandom random;
+    for(std::size_t i = 0; i != SortSize; ++i)
+        keyArray[i*data.stride] = sortValue<T>(random(), data.narrowRange);
+    Containers::Array<T> keysCopy{NoInit, SortSize};
+    Utility::copy(keys, Containers::StridedArrayView1D<T>{keysCopy});
+
+    std::vector<std::uint32_t> expected(SortSize);
+    std::iota(expected.begin(), expected.end(), 0);
+    std::stable_sort(expected.begin(), expected.end(), [&keys](std::uint32_t a, std::uint32_t b) {
+        return keys[a] < keys[b];
+    });
+
+    Utility::sortIndices(keys, indices);
+
+    CORRADE_COMPARE_AS(indices, Containers::StridedArrayView1D<std::uint32_t>{Containers::arrayView(expected)},
+        TestSuite::Compare::Container);
+
+    /* The keys stay untouched */
+    CORRADE_COMPARE_AS(keys, Containers::StridedArrayView1D<const T>{keysCopy},
+        TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::sortIndicesMutableKeys() {
+    float keys[]{2.5f, -1.0f, 2.5f, 0.0f};
+    std::uint32_t indices[4];
+
+    /* Should pick the non-const overload and not be ambiguous */
+    Utility::sortIndices(Containers::stridedArrayView(keys), Containers::stridedArrayView(indices));
+
+    std::uint32_t expected[]{1, 3, 0, 2};
+    CORRADE_COMPARE_AS(Containers::arrayView(indices),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::sortIndicesParallel() {
+    auto&& data = ParallelData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Narrow range so there are many equal keys and the merge has to keep
+       them in a stable order as well */
+    Containers::Array<std::uint16_t> keys{NoInit, SortParallelSize};
+    SortRandom random;
+    for(std::uint16_t& i: keys)
+        i = sortValue<std::uint16_t>(random(), true);
+
+    Containers::Array<std::uint32_t> expected{NoInit, SortParallelSize};
+    Containers::Array<std::uint32_t> actual{NoInit, SortParallelSize};
+    Utility::sortIndices(Containers::stridedArrayView(keys), Containers::stridedArrayView(expected));
+    Utility::sortIndicesParallel(Containers::stridedArrayView(keys), Containers::stridedArrayView(actual), data.threadCount);
+
+    CORRADE_COMPARE_AS(actual, expected, TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::sortIndicesNonMatchingSizes() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    int keys[3]{};
+    std::uint32_t indices[2]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Utility::sortIndices(Containers::stridedArrayView(keys), Containers::stridedArrayView(indices));
+    Utility::sortIndicesParallel(Containers::stridedArrayView(keys), Containers::stridedArrayView(indices));
+    CORRADE_COMPARE(out.str(),
+        "Utility::sortIndices(): expected 3 indices but got 2\n"
+        "Utility::sortIndices(): expected 3 indices but got 2\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Corrade::Utility::Test::AlgorithmsTest)
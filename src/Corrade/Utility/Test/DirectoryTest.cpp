@@ -24,6 +24,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <fstream>
+#include <iterator>
 #include <sstream>
 #include <vector>
 
@@ -38,6 +40,7 @@
 #include "Corrade/TestSuite/Compare/SortedContainer.h"
 #include "Corrade/Utility/DebugStl.h"
 #include "Corrade/Utility/Directory.h"
+#include "Corrade/Utility/Sha1.h"
 
 #include <clocale>
 
@@ -150,6 +153,19 @@ struct DirectoryTest: TestSuite::Tester {
     void copyNoPermission();
     void copyUtf8();
 
+    void hashFile();
+    void hashFileEmpty();
+    void hashFileNonSeekable();
+    void hashFileEarlyEof();
+    void hashFileNonexistent();
+    void hashFileUtf8();
+
+    void hashFileChunked();
+    void hashFileChunkedEmpty();
+    void hashFileChunkedNonSeekable();
+    void hashFileChunkedEarlyEof();
+    void hashFileChunkedNonexistent();
+
     #ifndef CORRADE_TARGET_EMSCRIPTEN
     void prepareFileToBenchmarkCopy();
     void copy100MReadWrite();
@@ -157,6 +173,9 @@ struct DirectoryTest: TestSuite::Tester {
     #if defined(DOXYGEN_GENERATING_OUTPUT) || defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
     void copy100MMap();
     #endif
+    void hash100MRead();
+    void hash100MHashFile();
+    void hash100MHashFileChunked();
     #endif
 
     void map();
@@ -177,6 +196,24 @@ struct DirectoryTest: TestSuite::Tester {
         _writeTestDir;
 };
 
+/* Each thread gets at least 512 kB of work, so the file has to be several MB
+   large for the hashing to get split across multiple threads at all */
+constexpr std::size_t HashFileChunkedSize = 3*1024*1024 + 17;
+
+constexpr struct {
+    const char* name;
+    std::size_t chunkSize;
+    std::size_t threadCount;
+} HashFileChunkedData[]{
+    {"single chunk", 4*1024*1024, 0},
+    {"single chunk, exact size", HashFileChunkedSize, 0},
+    {"single chunk, chunk size near overflow", ~std::size_t{}, 0},
+    {"4 kB chunks, single thread", 4096, 1},
+    {"4 kB chunks, three threads", 4096, 3},
+    {"4 kB chunks, default thread count", 4096, 0},
+    {"uneven chunks, more threads than chunks", 1000001, 16}
+};
+
 DirectoryTest::DirectoryTest() {
     addTests({&DirectoryTest::fromNativeSeparators,
               &DirectoryTest::toNativeSeparators,
@@ -275,15 +312,35 @@ DirectoryTest::DirectoryTest() {
     addTests({&DirectoryTest::copyEmpty,
               &DirectoryTest::copyNonexistent,
               &DirectoryTest::copyNoPermission,
-              &DirectoryTest::copyUtf8});
+              &DirectoryTest::copyUtf8,
+
+              &DirectoryTest::hashFile,
+              &DirectoryTest::hashFileEmpty,
+              &DirectoryTest::hashFileNonSeekable,
+              &DirectoryTest::hashFileEarlyEof,
+              &DirectoryTest::hashFileNonexistent,
+              &DirectoryTest::hashFileUtf8});
+
+    addInstancedTests({&DirectoryTest::hashFileChunked},
+        Containers::arraySize(HashFileChunkedData),
+        &DirectoryTest::prepareFileToCopy,
+        &DirectoryTest::prepareFileToCopy);
+
+    addTests({&DirectoryTest::hashFileChunkedEmpty,
+              &DirectoryTest::hashFileChunkedNonSeekable,
+              &DirectoryTest::hashFileChunkedEarlyEof,
+              &DirectoryTest::hashFileChunkedNonexistent});
 
     #ifndef CORRADE_TARGET_EMSCRIPTEN
     addBenchmarks({
         &DirectoryTest::copy100MReadWrite,
         &DirectoryTest::copy100MCopy,
         #if defined(DOXYGEN_GENERATING_OUTPUT) || defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
-        &DirectoryTest::copy100MMap
+        &DirectoryTest::copy100MMap,
         #endif
+        &DirectoryTest::hash100MRead,
+        &DirectoryTest::hash100MHashFile,
+        &DirectoryTest::hash100MHashFileChunked
         }, 5,
         &DirectoryTest::prepareFileToBenchmarkCopy,
         &DirectoryTest::prepareFileToBenchmarkCopy);
@@ -1415,6 +1472,146 @@ void DirectoryTest::copyUtf8() {
         TestSuite::Compare::File);
 }
 
+void DirectoryTest::hashFile() {
+    CORRADE_COMPARE(Directory::hashFile(Directory::join(_testDir, "file")),
+        Sha1::digest(std::string{Data, Containers::arraySize(Data)}));
+}
+
+void DirectoryTest::hashFileEmpty() {
+    const std::string empty = Directory::join(_testDir, "dir/dummy");
+    CORRADE_VERIFY(Directory::exists(empty));
+    CORRADE_COMPARE(Directory::hashFile(empty),
+        Sha1::Digest::fromHexString("da39a3ee5e6b4b0d3255bfef95601890afd80709"));
+}
+
+/* Files in /proc report zero size, which Directory::read() trusts, so this
+   is used to get the expected contents instead */
+std::string readWithStreams(const std::string& filename) {
+    std::ifstream in{filename, std::ios::binary};
+    return {std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+}
+
+void DirectoryTest::hashFileNonSeekable() {
+    /* macOS or BSD doesn't have /proc */
+    #if defined(__unix__) && !defined(CORRADE_TARGET_EMSCRIPTEN) && \
+        !defined(__FreeBSD__) && !defined(__OpenBSD__) && !defined(__bsdi__) && \
+        !defined(__NetBSD__) && !defined(__DragonFly__)
+    /* Unlike /proc/loadavg used in readNonSeekable(), the contents don't
+       change between reads */
+    const std::string contents = readWithStreams("/proc/version");
+    CORRADE_VERIFY(!contents.empty());
+    CORRADE_COMPARE(Directory::hashFile("/proc/version"),
+        Sha1::digest(contents));
+    #else
+    CORRADE_SKIP("Not implemented on this platform.");
+    #endif
+}
+
+void DirectoryTest::hashFileEarlyEof() {
+    #ifdef __linux__
+    if(!Directory::exists("/sys/devices/system/cpu/cpu0/cpufreq/scaling_governor"))
+        CORRADE_SKIP("/sys/devices/system/cpu/cpu0/cpufreq/scaling_governor doesn't exist, can't test");
+    /* The file reports more bytes than it has and can't be mapped, it should
+       silently fall back to reading */
+    std::ostringstream out;
+    Containers::Optional<Sha1::Digest> digest;
+    {
+        Error redirectError{&out};
+        digest = Directory::hashFile("/sys/devices/system/cpu/cpu0/cpufreq/scaling_governor");
+    }
+    CORRADE_COMPARE(digest, Sha1::digest(Directory::readString("/sys/devices/system/cpu/cpu0/cpufreq/scaling_governor")));
+    CORRADE_COMPARE(out.str(), "");
+    #else
+    CORRADE_SKIP("Not sure how to test on this platform.");
+    #endif
+}
+
+void DirectoryTest::hashFileNonexistent() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!Directory::hashFile("nonexistent"));
+    CORRADE_COMPARE(out.str(), "Utility::Directory::hashFile(): can't open nonexistent\n");
+}
+
+void DirectoryTest::hashFileUtf8() {
+    CORRADE_COMPARE(Directory::hashFile(Directory::join(_testDirUtf8, "hýždě")),
+        Sha1::digest(std::string{Data, Containers::arraySize(Data)}));
+}
+
+Sha1::Digest chunkedDigest(const Containers::ArrayView<const char> data, const std::size_t chunkSize) {
+    Sha1 sha1;
+    for(std::size_t offset = 0; offset < data.size(); ) {
+        const std::size_t size = std::min(data.size() - offset, chunkSize);
+        const Sha1::Digest digest = (Sha1{} << data.slice(offset, offset + size)).digest();
+        sha1 << Containers::ArrayView<const char>{digest.byteArray(), Sha1::DigestSize};
+        offset += size;
+    }
+    return sha1.digest();
+}
+
+void DirectoryTest::hashFileChunked() {
+    auto&& data = HashFileChunkedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<char> contents{NoInit, HashFileChunkedSize};
+    for(std::size_t i = 0; i != contents.size(); ++i)
+        contents[i] = char(i*37 + i/4096);
+
+    const std::string file = Directory::join(_writeTestDir, "hashFileChunked.dat");
+    CORRADE_VERIFY(Directory::write(file, contents));
+
+    CORRADE_COMPARE(Directory::hashFileChunked(file, data.chunkSize, data.threadCount),
+        chunkedDigest(contents, data.chunkSize));
+}
+
+void DirectoryTest::hashFileChunkedEmpty() {
+    const std::string empty = Directory::join(_testDir, "dir/dummy");
+    CORRADE_VERIFY(Directory::exists(empty));
+
+    /* No chunks, so it's a digest of nothing */
+    CORRADE_COMPARE(Directory::hashFileChunked(empty),
+        Sha1::Digest::fromHexString("da39a3ee5e6b4b0d3255bfef95601890afd80709"));
+}
+
+void DirectoryTest::hashFileChunkedNonSeekable() {
+    /* macOS or BSD doesn't have /proc */
+    #if defined(__unix__) && !defined(CORRADE_TARGET_EMSCRIPTEN) && \
+        !defined(__FreeBSD__) && !defined(__OpenBSD__) && !defined(__bsdi__) && \
+        !defined(__NetBSD__) && !defined(__DragonFly__)
+    /* Goes through the fallback that reads one chunk after another */
+    const std::string contents = readWithStreams("/proc/version");
+    CORRADE_VERIFY(!contents.empty());
+    CORRADE_COMPARE(Directory::hashFileChunked("/proc/version", 5),
+        chunkedDigest({contents.data(), contents.size()}, 5));
+
+    /* The read buffer shouldn't be sized to the chunk size */
+    CORRADE_COMPARE(Directory::hashFileChunked("/proc/version", ~std::size_t{}),
+        chunkedDigest({contents.data(), contents.size()}, ~std::size_t{}));
+    #else
+    CORRADE_SKIP("Not implemented on this platform.");
+    #endif
+}
+
+void DirectoryTest::hashFileChunkedEarlyEof() {
+    #ifdef __linux__
+    if(!Directory::exists("/sys/devices/system/cpu/cpu0/cpufreq/scaling_governor"))
+        CORRADE_SKIP("/sys/devices/system/cpu/cpu0/cpufreq/scaling_governor doesn't exist, can't test");
+    /* Goes through the fallback that reads one chunk after another */
+    const Containers::Array<char> contents = Directory::read("/sys/devices/system/cpu/cpu0/cpufreq/scaling_governor");
+    CORRADE_COMPARE(Directory::hashFileChunked("/sys/devices/system/cpu/cpu0/cpufreq/scaling_governor", 3),
+        chunkedDigest(contents, 3));
+    #else
+    CORRADE_SKIP("Not sure how to test on this platform.");
+    #endif
+}
+
+void DirectoryTest::hashFileChunkedNonexistent() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!Directory::hashFileChunked("nonexistent"));
+    CORRADE_COMPARE(out.str(), "Utility::Directory::hashFileChunked(): can't open nonexistent\n");
+}
+
 #ifndef CORRADE_TARGET_EMSCRIPTEN
 void DirectoryTest::prepareFileToBenchmarkCopy() {
     if(Directory::exists(Directory::join(_writeTestDir, "copyBenchmarkSource.dat")))
@@ -1459,6 +1656,39 @@ void DirectoryTest::copy100MMap() {
         Directory::write(output, Directory::mapRead(input));
 }
 #endif
+
+void DirectoryTest::hash100MRead() {
+    std::string input = Directory::join(_writeTestDir, "copyBenchmarkSource.dat");
+    CORRADE_VERIFY(Directory::exists(input));
+
+    Sha1::Digest digest;
+    CORRADE_BENCHMARK(1)
+        digest = (Sha1{} << Containers::ArrayView<const char>{Directory::read(input)}).digest();
+
+    CORRADE_VERIFY(digest != Sha1::Digest{});
+}
+
+void DirectoryTest::hash100MHashFile() {
+    std::string input = Directory::join(_writeTestDir, "copyBenchmarkSource.dat");
+    CORRADE_VERIFY(Directory::exists(input));
+
+    Containers::Optional<Sha1::Digest> digest;
+    CORRADE_BENCHMARK(1)
+        digest = Directory::hashFile(input);
+
+    CORRADE_VERIFY(digest);
+}
+
+void DirectoryTest::hash100MHashFileChunked() {
+    std::string input = Directory::join(_writeTestDir, "copyBenchmarkSource.dat");
+    CORRADE_VERIFY(Directory::exists(input));
+
+    Containers::Optional<Sha1::Digest> digest;
+    CORRADE_BENCHMARK(1)
+        digest = Directory::hashFileChunked(input);
+
+    CORRADE_VERIFY(digest);
+}
 #endif
 
 void DirectoryTest::map() {
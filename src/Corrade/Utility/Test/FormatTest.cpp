@@ -27,14 +27,16 @@
 #include <limits>
 #include <sstream>
 
-#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/GrowableArray.h"
 #include "Corrade/Containers/String.h"
 #include "Corrade/Containers/ScopeGuard.h"
 #include "Corrade/TestSuite/Tester.h"
 #include "Corrade/TestSuite/Compare/FileToString.h"
+#include "Corrade/TestSuite/Compare/Numeric.h"
 #include "Corrade/Utility/DebugStl.h"
 #include "Corrade/Utility/Directory.h"
 #include "Corrade/Utility/Format.h"
+#include "Corrade/Utility/FormatGrowable.h"
 #include "Corrade/Utility/FormatStl.h"
 
 #include "configure.h"
@@ -101,6 +103,10 @@ struct FormatTest: TestSuite::Tester {
     void arrayNullTerminatorFromSnprintfAtTheEnd();
     void appendToString();
     void insertToString();
+    void appendToGrowableArray();
+    void appendToGrowableArrayAmortized();
+    void appendToGrowableArrayPastEnd();
+    void insertToGrowableArray();
     void file();
     void fileLongDouble();
 
@@ -186,6 +192,10 @@ FormatTest::FormatTest() {
               &FormatTest::arrayNullTerminatorFromSnprintfAtTheEnd,
               &FormatTest::appendToString,
               &FormatTest::insertToString,
+              &FormatTest::appendToGrowableArray,
+              &FormatTest::appendToGrowableArrayAmortized,
+              &FormatTest::appendToGrowableArrayPastEnd,
+              &FormatTest::insertToGrowableArray,
               &FormatTest::file,
               &FormatTest::fileLongDouble,
 
@@ -710,6 +720,64 @@ void FormatTest::insertToString() {
     CORRADE_COMPARE(hello.size(), 36);
 }
 
+void FormatTest::appendToGrowableArray() {
+    /* Returned size should be including start offset */
+    Containers::Array<char> hello;
+    Containers::arrayAppend(hello, {'h', 'e', 'l', 'l', 'o'});
+    CORRADE_COMPARE(formatInto(hello, hello.size(), ", {}!", "world"), 13);
+    CORRADE_COMPARE((Containers::StringView{hello.data(), hello.size()}), "hello, world!");
+    CORRADE_VERIFY(Containers::arrayIsGrowable(hello));
+
+    /* The null terminator printed by snprintf() shouldn't be included in the
+       size but there should be capacity left for it */
+    CORRADE_COMPARE(formatInto(hello, hello.size(), " {}", 42), 16);
+    CORRADE_COMPARE((Containers::StringView{hello.data(), hello.size()}), "hello, world! 42");
+    CORRADE_COMPARE_AS(Containers::arrayCapacity(hello), 17,
+        TestSuite::Compare::GreaterOrEqual);
+}
+
+void FormatTest::appendToGrowableArrayAmortized() {
+    Containers::Array<char> out;
+    std::size_t reallocations = 0;
+    const char* prev = nullptr;
+    for(std::size_t i = 0; i != 1000; ++i) {
+        formatInto(out, out.size(), "{:.3}", i/1000.0f);
+        if(out.data() != prev) {
+            prev = out.data();
+            ++reallocations;
+        }
+    }
+
+    Containers::StringView view{out.data(), out.size()};
+    CORRADE_COMPARE(view.prefix(14), "00.0010.0020.0");
+    CORRADE_COMPARE(view.suffix(view.size() - 15), "0.9970.9980.999");
+    /* A capacity grow factor of 1.5 needs roughly 20 reallocations to get to
+       6 kB, doing a reallocation on every append would be 1000 */
+    CORRADE_COMPARE_AS(reallocations, 30,
+        TestSuite::Compare::Less);
+}
+
+void FormatTest::appendToGrowableArrayPastEnd() {
+    using namespace Containers::Literals;
+
+    Containers::Array<char> hello;
+    Containers::arrayAppend(hello, {'h', 'i'});
+    CORRADE_COMPARE(formatInto(hello, 4, "{}", 42), 6);
+    CORRADE_COMPARE((Containers::StringView{hello.data(), hello.size()}), "hi\0\0" "42"_s);
+}
+
+void FormatTest::insertToGrowableArray() {
+    /* Returned size should be including start offset but be less than array
+       size. The null terminator printed by snprintf() shouldn't overwrite the
+       character right after. */
+    Containers::String input = "hello, __________! Happy to see you!";
+    Containers::Array<char> hello;
+    Containers::arrayAppend(hello, Containers::ArrayView<const char>{input.data(), input.size()});
+    CORRADE_COMPARE(formatInto(hello, 8, "{}", 12345), 13);
+    CORRADE_COMPARE((Containers::StringView{hello.data(), hello.size()}), "hello, _12345____! Happy to see you!");
+    CORRADE_COMPARE(hello.size(), 36);
+}
+
 void FormatTest::file() {
     const std::string filename = Directory::join(FORMAT_WRITE_TEST_DIR, "format.txt");
     if(!Directory::exists(FORMAT_WRITE_TEST_DIR))
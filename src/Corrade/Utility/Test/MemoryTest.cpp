@@ -24,14 +24,22 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstring>
 #include <sstream>
 
+#include "Corrade/Containers/StringView.h"
 #include "Corrade/TestSuite/Tester.h"
 #include "Corrade/TestSuite/Compare/Container.h"
 #include "Corrade/TestSuite/Compare/Numeric.h"
+#include "Corrade/Utility/ArrayVirtualAllocator.h"
 #include "Corrade/Utility/DebugStl.h"
 #include "Corrade/Utility/Memory.h"
 
+#ifdef CORRADE_TARGET_UNIX
+#include <cerrno>
+#include <sys/resource.h>
+#endif
+
 namespace Corrade { namespace Utility { namespace Test { namespace {
 
 struct MemoryTest: TestSuite::Tester {
@@ -55,6 +63,29 @@ struct MemoryTest: TestSuite::Tester {
 
     void allocateNotMultipleOfAlignment();
 
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    void virtualAllocate();
+    void virtualAllocateAligned();
+    void virtualGrow();
+    void virtualGrowToReserved();
+    void virtualAppendStablePointers();
+    void virtualReserve();
+    void virtualOutgrowReservation();
+    void virtualNontrivial();
+
+    void ringBufferConstruct();
+    void ringBufferConstructZeroCapacity();
+    void ringBufferConstructFailed();
+    void ringBufferConstructNoCreate();
+    void ringBufferConstructMove();
+    void ringBufferMirrored();
+    void ringBufferProduceConsume();
+    void ringBufferWrapAround();
+    void ringBufferClear();
+    void ringBufferProduceTooMuch();
+    void ringBufferConsumeTooMuch();
+    #endif
+
     void resetCounters();
 };
 
@@ -93,6 +124,31 @@ MemoryTest::MemoryTest() {
         &MemoryTest::allocateExplicitAlignmentValueInit}, 100);
 
     addTests({&MemoryTest::allocateNotMultipleOfAlignment});
+
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    addTests({&MemoryTest::virtualAllocate,
+              &MemoryTest::virtualAllocateAligned,
+              &MemoryTest::virtualGrow,
+              &MemoryTest::virtualGrowToReserved,
+              &MemoryTest::virtualAppendStablePointers,
+              &MemoryTest::virtualReserve,
+              &MemoryTest::virtualOutgrowReservation});
+
+    addTests({&MemoryTest::virtualNontrivial},
+        &MemoryTest::resetCounters, &MemoryTest::resetCounters);
+
+    addTests({&MemoryTest::ringBufferConstruct,
+              &MemoryTest::ringBufferConstructZeroCapacity,
+              &MemoryTest::ringBufferConstructFailed,
+              &MemoryTest::ringBufferConstructNoCreate,
+              &MemoryTest::ringBufferConstructMove,
+              &MemoryTest::ringBufferMirrored,
+              &MemoryTest::ringBufferProduceConsume,
+              &MemoryTest::ringBufferWrapAround,
+              &MemoryTest::ringBufferClear,
+              &MemoryTest::ringBufferProduceTooMuch,
+              &MemoryTest::ringBufferConsumeTooMuch});
+    #endif
 }
 
 template<std::size_t alignment> struct alignas(alignment) Aligned {
@@ -263,6 +319,374 @@ void MemoryTest::allocateNotMultipleOfAlignment() {
     CORRADE_COMPARE(out.str(), "Utility::allocateAligned(): total byte size 34 not a multiple of a 32-byte alignment\n");
 }
 
+#if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+void MemoryTest::virtualAllocate() {
+    const std::size_t pageSize = Implementation::virtualPageSize();
+    CORRADE_COMPARE_AS(pageSize, 4096, TestSuite::Compare::GreaterOrEqual);
+
+    int* data = ArrayVirtualAllocator<int>::allocate(5);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(ArrayVirtualAllocator<int>::base(data)) % pageSize, 0);
+
+    /* The capacity is rounded up to whole pages, the reservation is the
+       default */
+    CORRADE_COMPARE(ArrayVirtualAllocator<int>::capacity(data), (pageSize - ArrayVirtualAllocator<int>::AllocationOffset)/sizeof(int));
+    CORRADE_COMPARE(ArrayVirtualAllocator<int>::reservedCapacity(data), (Implementation::VirtualDefaultReservation - ArrayVirtualAllocator<int>::AllocationOffset)/sizeof(int));
+
+    /* The whole committed range is writable */
+    const std::size_t capacity = ArrayVirtualAllocator<int>::capacity(data);
+    for(std::size_t i = 0; i != capacity; ++i) data[i] = int(i);
+    CORRADE_COMPARE(data[capacity - 1], int(capacity - 1));
+
+    ArrayVirtualAllocator<int>::deallocate(data);
+}
+
+void MemoryTest::virtualAllocateAligned() {
+    FourLongs* data = ArrayVirtualAllocator<FourLongs>::allocate(3);
+    CORRADE_COMPARE(ArrayVirtualAllocator<FourLongs>::AllocationOffset, 32);
+    CORRADE_COMPARE_AS(reinterpret_cast<std::uintptr_t>(data), 32,
+        TestSuite::Compare::Divisible);
+    ArrayVirtualAllocator<FourLongs>::deallocate(data);
+}
+
+void MemoryTest::virtualGrow() {
+    const std::size_t pageSize = Implementation::virtualPageSize();
+    const std::size_t perPage = pageSize/sizeof(int);
+
+    int* data = ArrayVirtualAllocator<int>::allocate(5);
+    int* const prev = data;
+    data[0] = 1337;
+
+    /* Growing to a larger capacity gives back whole pages */
+    const std::size_t grown = ArrayVirtualAllocator<int>::grow(data, 3*perPage);
+    CORRADE_COMPARE((grown*sizeof(int) + ArrayVirtualAllocator<int>::AllocationOffset) % pageSize, 0);
+    CORRADE_COMPARE_AS(grown, 3*perPage, TestSuite::Compare::GreaterOrEqual);
+
+    /* Committing more doesn't move anything */
+    ArrayVirtualAllocator<int>::reallocate(data, 1, grown);
+    CORRADE_COMPARE(data, prev);
+    CORRADE_COMPARE(data[0], 1337);
+    CORRADE_COMPARE(ArrayVirtualAllocator<int>::capacity(data), grown);
+    data[grown - 1] = 42;
+    CORRADE_COMPARE(data[grown - 1], 42);
+
+    ArrayVirtualAllocator<int>::deallocate(data);
+}
+
+void MemoryTest::virtualGrowToReserved() {
+    const std::size_t pageSize = Implementation::virtualPageSize();
+    const std::size_t perPage = pageSize/sizeof(int);
+
+    int* data = ArrayVirtualAllocator<int>::allocate(perPage*3, perPage*4);
+    const std::size_t reserved = ArrayVirtualAllocator<int>::reservedCapacity(data);
+    CORRADE_COMPARE(reserved, perPage*5 - ArrayVirtualAllocator<int>::AllocationOffset/sizeof(int));
+
+    /* Growth by half would go over the reservation, but the desired
+       capacity fits, so it's clamped to make use of the whole range */
+    CORRADE_COMPARE(ArrayVirtualAllocator<int>::grow(data, reserved), reserved);
+
+    /* If the desired capacity doesn't fit, the result is not clamped */
+    CORRADE_COMPARE_AS(ArrayVirtualAllocator<int>::grow(data, reserved + 1), reserved + 1,
+        TestSuite::Compare::GreaterOrEqual);
+
+    ArrayVirtualAllocator<int>::deallocate(data);
+}
+
+void MemoryTest::virtualAppendStablePointers() {
+    Containers::Array<int> a;
+    Containers::arrayAppend<ArrayVirtualAllocator>(a, 0);
+    const int* const front = a.data();
+    CORRADE_VERIFY(Containers::arrayIsGrowable<ArrayVirtualAllocator>(a));
+
+    /* Append enough to go through many growth steps, the data should never
+       move */
+    for(int i = 1; i != 1000000; ++i)
+        Containers::arrayAppend<ArrayVirtualAllocator>(a, i);
+    CORRADE_COMPARE(a.size(), 1000000);
+    CORRADE_COMPARE(a.data(), front);
+    CORRADE_COMPARE(a[0], 0);
+    CORRADE_COMPARE(a[499999], 499999);
+    CORRADE_COMPARE(a[999999], 999999);
+    CORRADE_COMPARE_AS(Containers::arrayCapacity<ArrayVirtualAllocator>(a), 1000000,
+        TestSuite::Compare::GreaterOrEqual);
+}
+
+void MemoryTest::virtualReserve() {
+    Containers::Array<int> a = reserveVirtual<int>(1 << 20);
+    CORRADE_VERIFY(a.data());
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_VERIFY(a.deleter() == ArrayVirtualAllocator<int>::deleter);
+    CORRADE_COMPARE_AS(ArrayVirtualAllocator<int>::reservedCapacity(a.data()), 1 << 20,
+        TestSuite::Compare::GreaterOrEqual);
+    const int* const front = a.data();
+
+    Containers::arrayResize<ArrayVirtualAllocator>(a, NoInit, 1 << 20);
+    a[(1 << 20) - 1] = 1337;
+    CORRADE_COMPARE(a.data(), front);
+    CORRADE_COMPARE(a.back(), 1337);
+}
+
+void MemoryTest::virtualOutgrowReservation() {
+    const std::size_t perPage = Implementation::virtualPageSize()/sizeof(int);
+
+    Containers::Array<int> a = reserveVirtual<int>(perPage);
+    const std::size_t reserved = ArrayVirtualAllocator<int>::reservedCapacity(a.data());
+    for(std::size_t i = 0; i != reserved; ++i)
+        Containers::arrayAppend<ArrayVirtualAllocator>(a, int(i));
+    const int* const front = a.data();
+
+    /* Going over the reservation moves the data to a new range twice the
+       size */
+    Containers::arrayAppend<ArrayVirtualAllocator>(a, 1337);
+    CORRADE_VERIFY(a.data() != front);
+    CORRADE_COMPARE_AS(ArrayVirtualAllocator<int>::reservedCapacity(a.data()), 2*reserved,
+        TestSuite::Compare::GreaterOrEqual);
+    CORRADE_COMPARE(a.size(), reserved + 1);
+    CORRADE_COMPARE(a[0], 0);
+    CORRADE_COMPARE(a[reserved - 1], int(reserved - 1));
+    CORRADE_COMPARE(a.back(), 1337);
+}
+
+struct Movable {
+    static int constructed;
+    static int destructed;
+
+    explicit Movable(int a): a{a} { ++constructed; }
+    Movable(Movable&& other) noexcept: a{other.a} { ++constructed; }
+    ~Movable() { ++destructed; }
+    Movable& operator=(Movable&&) = delete;
+
+    int a;
+};
+
+int Movable::constructed = 0;
+int Movable::destructed = 0;
+
+void MemoryTest::virtualNontrivial() {
+    Movable::constructed = Movable::destructed = 0;
+
+    {
+        const std::size_t perPage = Implementation::virtualPageSize()/sizeof(Movable);
+        Containers::Array<Movable> a = reserveVirtual<Movable>(perPage);
+        const std::size_t reserved = ArrayVirtualAllocator<Movable>::reservedCapacity(a.data());
+        for(std::size_t i = 0; i != reserved; ++i)
+            Containers::arrayAppend<ArrayVirtualAllocator>(a, InPlaceInit, int(i));
+
+        /* No moves while within the reservation */
+        CORRADE_COMPARE(Movable::constructed, reserved);
+        CORRADE_COMPARE(Movable::destructed, 0);
+
+        /* Outgrowing the reservation moves everything */
+        Containers::arrayAppend<ArrayVirtualAllocator>(a, InPlaceInit, 1337);
+        CORRADE_COMPARE(Movable::constructed, 2*reserved + 1);
+        CORRADE_COMPARE(Movable::destructed, reserved);
+        CORRADE_COMPARE(a[reserved - 1].a, int(reserved - 1));
+        CORRADE_COMPARE(a.back().a, 1337);
+    }
+
+    CORRADE_COMPARE(Movable::constructed, Movable::destructed);
+}
+
+void MemoryTest::ringBufferConstruct() {
+    MagicRingBuffer buffer{100};
+    CORRADE_COMPARE_AS(buffer.capacity(), 100,
+        TestSuite::Compare::GreaterOrEqual);
+    CORRADE_COMPARE_AS(buffer.capacity(), Implementation::virtualPageSize(),
+        TestSuite::Compare::Divisible);
+    CORRADE_COMPARE(buffer.size(), 0);
+    CORRADE_VERIFY(buffer.isEmpty());
+    CORRADE_VERIFY(!buffer.isFull());
+    CORRADE_VERIFY(buffer.readView().data());
+    CORRADE_COMPARE(buffer.readView().size(), 0);
+    CORRADE_COMPARE(buffer.writeView().data(), buffer.readView().data());
+    CORRADE_COMPARE(buffer.writeView().size(), buffer.capacity());
+}
+
+void MemoryTest::ringBufferConstructZeroCapacity() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    MagicRingBuffer{0};
+    CORRADE_COMPARE(out.str(), "Utility::MagicRingBuffer: expected non-zero capacity\n");
+}
+
+void MemoryTest::ringBufferConstructFailed() {
+    #if !defined(CORRADE_TARGET_UNIX) || defined(CORRADE_TARGET_EMSCRIPTEN)
+    CORRADE_SKIP("Can't limit the count of open files on this platform.");
+    #else
+    /* Make creation of any new file descriptor fail. The limit is restored
+       right after so a failed check below doesn't affect other tests. */
+    rlimit limit;
+    CORRADE_VERIFY(getrlimit(RLIMIT_NOFILE, &limit) == 0);
+    rlimit restricted = limit;
+    restricted.rlim_cur = 0;
+    CORRADE_VERIFY(setrlimit(RLIMIT_NOFILE, &restricted) == 0);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    MagicRingBuffer buffer{100};
+    CORRADE_VERIFY(setrlimit(RLIMIT_NOFILE, &limit) == 0);
+
+    /* The instance is in the NoCreate state, which means the destructor has
+       nothing to release */
+    CORRADE_COMPARE(buffer.capacity(), 0);
+    CORRADE_COMPARE(buffer.size(), 0);
+    CORRADE_VERIFY(!buffer.readView().data());
+    CORRADE_VERIFY(!buffer.writeView().data());
+    CORRADE_COMPARE(out.str(), std::string{"Utility::MagicRingBuffer: can't create the backing file: "} + std::strerror(EMFILE) + "\n");
+    #endif
+}
+
+void MemoryTest::ringBufferConstructNoCreate() {
+    MagicRingBuffer buffer{NoCreate};
+    CORRADE_COMPARE(buffer.capacity(), 0);
+    CORRADE_COMPARE(buffer.size(), 0);
+    CORRADE_VERIFY(!buffer.readView().data());
+    CORRADE_VERIFY(!buffer.writeView().data());
+
+    CORRADE_VERIFY(std::is_nothrow_constructible<MagicRingBuffer, NoCreateT>::value);
+
+    /* Implicit construction is not allowed */
+    CORRADE_VERIFY(!std::is_convertible<NoCreateT, MagicRingBuffer>::value);
+}
+
+void MemoryTest::ringBufferConstructMove() {
+    MagicRingBuffer a{100};
+    a.writeView()[0] = 'a';
+    a.produce(1);
+    const char* data = a.readView().data();
+    const std::size_t capacity = a.capacity();
+
+    MagicRingBuffer b = std::move(a);
+    CORRADE_COMPARE(a.capacity(), 0);
+    CORRADE_VERIFY(!a.readView().data());
+    CORRADE_COMPARE(b.capacity(), capacity);
+    CORRADE_COMPARE(b.size(), 1);
+    CORRADE_COMPARE(b.readView().data(), data);
+
+    MagicRingBuffer c{100};
+    c = std::move(b);
+    CORRADE_COMPARE(c.capacity(), capacity);
+    CORRADE_COMPARE(c.readView().data(), data);
+    CORRADE_COMPARE(c.readView()[0], 'a');
+
+    CORRADE_VERIFY(!std::is_copy_constructible<MagicRingBuffer>::value);
+    CORRADE_VERIFY(!std::is_copy_assignable<MagicRingBuffer>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<MagicRingBuffer>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<MagicRingBuffer>::value);
+}
+
+void MemoryTest::ringBufferMirrored() {
+    MagicRingBuffer buffer{100};
+    const std::size_t capacity = buffer.capacity();
+    Containers::ArrayView<char> view = buffer.writeView();
+
+    /* Writes to the first copy are visible in the second and vice versa */
+    view[0] = 'x';
+    view[capacity - 1] = 'y';
+    CORRADE_COMPARE(view.data()[capacity], 'x');
+    CORRADE_COMPARE(view.data()[2*capacity - 1], 'y');
+    view.data()[capacity + 5] = 'z';
+    CORRADE_COMPARE(view[5], 'z');
+}
+
+void MemoryTest::ringBufferProduceConsume() {
+    MagicRingBuffer buffer{100};
+    const std::size_t capacity = buffer.capacity();
+
+    std::memcpy(buffer.writeView().data(), "hello", 5);
+    buffer.produce(5);
+    CORRADE_COMPARE(buffer.size(), 5);
+    CORRADE_VERIFY(!buffer.isEmpty());
+    CORRADE_COMPARE(buffer.writeView().size(), capacity - 5);
+    CORRADE_COMPARE((Containers::StringView{buffer.readView().data(), buffer.readView().size()}), "hello");
+
+    buffer.consume(2);
+    CORRADE_COMPARE(buffer.size(), 3);
+    CORRADE_COMPARE((Containers::StringView{buffer.readView().data(), buffer.readView().size()}), "llo");
+    CORRADE_COMPARE(buffer.writeView().size(), capacity - 3);
+
+    buffer.produce(buffer.writeView().size());
+    CORRADE_VERIFY(buffer.isFull());
+    CORRADE_COMPARE(buffer.writeView().size(), 0);
+
+    buffer.consume(buffer.size());
+    CORRADE_VERIFY(buffer.isEmpty());
+}
+
+void MemoryTest::ringBufferWrapAround() {
+    MagicRingBuffer buffer{100};
+    const std::size_t capacity = buffer.capacity();
+
+    /* Move the read position close to the end */
+    buffer.produce(capacity - 3);
+    buffer.consume(capacity - 3);
+    CORRADE_VERIFY(buffer.isEmpty());
+
+    /* A write crossing the end is contiguous */
+    Containers::ArrayView<char> write = buffer.writeView();
+    CORRADE_COMPARE(write.size(), capacity);
+    std::memcpy(write.data(), "wrapped!", 8);
+    buffer.produce(8);
+
+    /* And so is the read */
+    const MagicRingBuffer& cbuffer = buffer;
+    Containers::ArrayView<const char> read = cbuffer.readView();
+    CORRADE_COMPARE((Containers::StringView{read.data(), read.size()}), "wrapped!");
+
+    /* The data past the end are at the buffer start */
+    buffer.consume(3);
+    CORRADE_COMPARE(buffer.readView().data(), write.data() + 3 - capacity);
+    CORRADE_COMPARE((Containers::StringView{buffer.readView().data(), buffer.readView().size()}), "pped!");
+}
+
+void MemoryTest::ringBufferClear() {
+    MagicRingBuffer buffer{100};
+    const char* data = buffer.readView().data();
+    buffer.produce(50);
+    buffer.consume(20);
+    CORRADE_COMPARE(buffer.size(), 30);
+
+    buffer.clear();
+    CORRADE_VERIFY(buffer.isEmpty());
+    CORRADE_COMPARE(buffer.readView().data(), data);
+    CORRADE_COMPARE(buffer.writeView().size(), buffer.capacity());
+}
+
+void MemoryTest::ringBufferProduceTooMuch() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    MagicRingBuffer buffer{100};
+    buffer.produce(buffer.capacity() - 3);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    buffer.produce(4);
+    CORRADE_COMPARE(buffer.size(), buffer.capacity() - 3);
+    CORRADE_COMPARE(out.str(), "Utility::MagicRingBuffer::produce(): can't produce 4 bytes with only 3 bytes free\n");
+}
+
+void MemoryTest::ringBufferConsumeTooMuch() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    MagicRingBuffer buffer{100};
+    buffer.produce(5);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    buffer.consume(6);
+    CORRADE_COMPARE(buffer.size(), 5);
+    CORRADE_COMPARE(out.str(), "Utility::MagicRingBuffer::consume(): can't consume 6 bytes with only 5 bytes available\n");
+}
+#endif
+
 }}}}
 
 CORRADE_TEST_MAIN(Corrade::Utility::Test::MemoryTest)
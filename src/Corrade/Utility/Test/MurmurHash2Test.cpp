@@ -24,8 +24,10 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
 #include <string>
 
+#include "Corrade/Containers/Array.h"
 #include "Corrade/TestSuite/Tester.h"
 #include "Corrade/Utility/AbstractHash.h"
 #include "Corrade/Utility/MurmurHash2.h"
@@ -38,12 +40,32 @@ struct MurmurHash2Test: TestSuite::Tester {
     void test32();
     void test64();
     void constructor();
+
+    void constexpr32();
+    void constexpr64();
+    void constexprLong();
+    void constexprDigest();
+
+    void incremental();
+    void incrementalPieces();
+    void incrementalSeed();
+    void incrementalReuse();
 };
 
 MurmurHash2Test::MurmurHash2Test() {
     addTests({&MurmurHash2Test::test32,
               &MurmurHash2Test::test64,
-              &MurmurHash2Test::constructor});
+              &MurmurHash2Test::constructor,
+
+              &MurmurHash2Test::constexpr32,
+              &MurmurHash2Test::constexpr64,
+              &MurmurHash2Test::constexprLong,
+              &MurmurHash2Test::constexprDigest,
+
+              &MurmurHash2Test::incremental,
+              &MurmurHash2Test::incrementalPieces,
+              &MurmurHash2Test::incrementalSeed,
+              &MurmurHash2Test::incrementalReuse});
 }
 
 void MurmurHash2Test::test32() {
@@ -60,6 +82,148 @@ void MurmurHash2Test::constructor() {
     /* All should give the same value */
     CORRADE_COMPARE(MurmurHash2()("hello"), MurmurHash2()("hello", 5));
     CORRADE_COMPARE(MurmurHash2()(std::string("hello")), MurmurHash2()("hello", 5));
+
+    /* The incremental state is in MurmurHash2A, this holds just the seed */
+    CORRADE_COMPARE(sizeof(MurmurHash2), sizeof(std::size_t));
+}
+
+void MurmurHash2Test::constexpr32() {
+    /* Same values as in test32() */
+    constexpr unsigned int a = Implementation::MurmurHash2Constexpr<4>::hash(23, "string", 6);
+    constexpr unsigned int b = Implementation::MurmurHash2Constexpr<4>::hash(23, "four", 4);
+    CORRADE_COMPARE(a, 3435905073u);
+    CORRADE_COMPARE(b, 2072697618u);
+}
+
+void MurmurHash2Test::constexpr64() {
+    /* Same values as in test64() */
+    constexpr unsigned long long a = Implementation::MurmurHash2Constexpr<8>::hash(23, "string", 6);
+    constexpr unsigned long long b = Implementation::MurmurHash2Constexpr<8>::hash(23, "eightbit", 8);
+    CORRADE_COMPARE(a, 7441339218310318127ull);
+    CORRADE_COMPARE(b, 14685337704530366946ull);
+}
+
+constexpr const char Data[] =
+    "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do "
+    "eiusmod tempor incididunt ut labore et dolore magna aliqua. Ut enim "
+    "ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut "
+    "aliquip ex ea commodo consequat. Duis aute irure dolor in "
+    "reprehenderit in voluptate velit esse cillum dolore eu fugiat nulla "
+    "pariatur. Excepteur sint occaecat cupidatat non proident, sunt in "
+    "culpa qui officia deserunt mollit anim id est laborum.";
+
+void MurmurHash2Test::constexprLong() {
+    /* All tail sizes, compared to the runtime implementation */
+    for(std::size_t size: {std::size_t{0}, std::size_t{1}, std::size_t{2},
+                           std::size_t{3}, std::size_t{4}, std::size_t{5},
+                           std::size_t{6}, std::size_t{7}, std::size_t{8},
+                           sizeof(Data) - 1}) {
+        CORRADE_ITERATION(size);
+        CORRADE_COMPARE(Implementation::MurmurHash2Constexpr<4>::hash(23, Data, size),
+                        Implementation::MurmurHash2<4>{}(23, Data, size));
+        CORRADE_COMPARE(Implementation::MurmurHash2Constexpr<8>::hash(23, Data, size),
+                        Implementation::MurmurHash2<8>{}(23, Data, size));
+    }
+
+    constexpr std::size_t hash = MurmurHash2{}.hash(Data);
+    CORRADE_COMPARE(MurmurHash2::Digest::fromByteArray(reinterpret_cast<const char*>(&hash)), MurmurHash2{}(Data));
+}
+
+int lookup(const std::string& key) {
+    switch(MurmurHash2{}.hash(key.data(), key.size())) {
+        case MurmurHash2{}.hash("hello"): return 1;
+        case MurmurHash2{}.hash("world"): return 2;
+    }
+
+    return 0;
+}
+
+void MurmurHash2Test::constexprDigest() {
+    /* The literal and the pointer overload should give the same value as
+       the runtime digest */
+    constexpr std::size_t a = MurmurHash2{23}.hash("hello");
+    constexpr std::size_t b = MurmurHash2{23}.hash("hello", 5);
+    CORRADE_COMPARE(a, b);
+    CORRADE_COMPARE(MurmurHash2::Digest::fromByteArray(reinterpret_cast<const char*>(&a)), MurmurHash2{23}("hello"));
+
+    /* Usable as a case label */
+    CORRADE_COMPARE(lookup("hello"), 1);
+    CORRADE_COMPARE(lookup("world"), 2);
+    CORRADE_COMPARE(lookup("dlrow"), 0);
+}
+
+MurmurHash2::Digest digestFromValue(const std::size_t value) {
+    return MurmurHash2::Digest::fromByteArray(reinterpret_cast<const char*>(&value));
+}
+
+/* Reference values calculated from the SMHasher CMurmurHash2A for 32 bits
+   and its equivalent built on MurmurHash64A for 64 bits */
+#ifndef CORRADE_TARGET_32BIT
+#define MURMURHASH2A(hash32, hash64) std::size_t(hash64)
+#else
+#define MURMURHASH2A(hash32, hash64) std::size_t(hash32)
+#endif
+
+void MurmurHash2Test::incremental() {
+    CORRADE_COMPARE(MurmurHash2A{}.digest(),
+        digestFromValue(MURMURHASH2A(0x0, 0x0)));
+    CORRADE_COMPARE((MurmurHash2A{} << std::string{"hello"}).digest(),
+        digestFromValue(MURMURHASH2A(0xf7e3bda, 0xb59a2db959611cb3ull)));
+    CORRADE_COMPARE((MurmurHash2A{} << Containers::arrayView("string", 6)).digest(),
+        digestFromValue(MURMURHASH2A(0x6c858aca, 0x81bbf24feb89c7e8ull)));
+    CORRADE_COMPARE((MurmurHash2A{} << Containers::arrayView("eightbit", 8)).digest(),
+        digestFromValue(MURMURHASH2A(0x9d20882e, 0xde8602d7d9e40290ull)));
+
+    /* The convenience static function should give the same */
+    CORRADE_COMPARE(MurmurHash2A::digest("hello"),
+        digestFromValue(MURMURHASH2A(0xf7e3bda, 0xb59a2db959611cb3ull)));
+
+    /* Not the same as the one-shot MurmurHash2 digest */
+    CORRADE_VERIFY(MurmurHash2A::digest("hello") != MurmurHash2::digest("hello"));
+}
+
+void MurmurHash2Test::incrementalPieces() {
+    Containers::Array<char> array{NoInit, 1000};
+    for(std::size_t i = 0; i != array.size(); ++i)
+        array[i] = char(i*37 + (i >> 8));
+    const Containers::ArrayView<const char> data = array;
+
+    /* Feeding all at once and in pieces of varying size, both aligned and
+       unaligned to the block size, should give the same result */
+    for(std::size_t pieceSize: {std::size_t{1}, std::size_t{3}, std::size_t{4}, std::size_t{7}, std::size_t{8}, std::size_t{13}, std::size_t{1000}}) {
+        CORRADE_ITERATION(pieceSize);
+
+        MurmurHash2A hasher;
+        for(std::size_t offset = 0; offset < data.size(); offset += pieceSize)
+            hasher << data.slice(offset, std::min(offset + pieceSize, data.size()));
+
+        CORRADE_COMPARE(hasher.digest(),
+            digestFromValue(MURMURHASH2A(0x7d6c4400, 0x9408c1cd56406f7ull)));
+    }
+}
+
+void MurmurHash2Test::incrementalSeed() {
+    MurmurHash2A hasher{23};
+    hasher << std::string{"The quick brown fox "}
+           << std::string{"jumps over the lazy dog"};
+    #ifndef CORRADE_TARGET_32BIT
+    CORRADE_COMPARE(hasher.digest(), digestFromValue(0x22c6e03f40a33474ull));
+    #else
+    CORRADE_SKIP("Only 64-bit reference value for a seeded hash available.");
+    #endif
+}
+
+void MurmurHash2Test::incrementalReuse() {
+    MurmurHash2A hasher;
+    hasher << std::string{"hel"};
+    hasher << std::string{"lo"};
+    CORRADE_COMPARE(hasher.digest(),
+        digestFromValue(MURMURHASH2A(0xf7e3bda, 0xb59a2db959611cb3ull)));
+
+    /* The state is reset after digest */
+    hasher << std::string{"string"};
+    CORRADE_COMPARE(hasher.digest(),
+        digestFromValue(MURMURHASH2A(0x6c858aca, 0x81bbf24feb89c7e8ull)));
 }
 
 }}}}
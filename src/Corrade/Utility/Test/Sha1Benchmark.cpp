@@ -0,0 +1,141 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <chrono>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/Sha1.h"
+
+namespace Corrade { namespace Utility { namespace Test { namespace {
+
+struct Sha1Benchmark: TestSuite::Tester {
+    explicit Sha1Benchmark();
+
+    void small();
+    void large();
+    void throughput();
+    void batch();
+    void batchOneByOne();
+
+    void throughputBegin();
+    std::uint64_t throughputEnd();
+
+    private:
+        Containers::Array<char> _data;
+        std::chrono::high_resolution_clock::time_point _throughputBegin;
+};
+
+constexpr std::size_t LargeSize = 1024*1024;
+
+Sha1Benchmark::Sha1Benchmark(): _data{NoInit, LargeSize} {
+    for(std::size_t i = 0; i != _data.size(); ++i)
+        _data[i] = char(i*37 + (i >> 8));
+
+    addBenchmarks({&Sha1Benchmark::small,
+                   &Sha1Benchmark::large,
+                   &Sha1Benchmark::batch,
+                   &Sha1Benchmark::batchOneByOne}, 10);
+
+    /* Reports bytes hashed per second instead of time, so the "B" in the
+       output is actually B/s */
+    addCustomBenchmarks({&Sha1Benchmark::throughput}, 10,
+        &Sha1Benchmark::throughputBegin,
+        &Sha1Benchmark::throughputEnd,
+        BenchmarkUnits::Bytes);
+}
+
+void Sha1Benchmark::small() {
+    /* Short inputs are dominated by the padding and finalization */
+    const Containers::ArrayView<const char> data = _data.prefix(55);
+
+    Sha1::Digest digest;
+    CORRADE_BENCHMARK(1000)
+        digest = (Sha1{} << data).digest();
+
+    CORRADE_COMPARE(digest, Sha1::Digest::fromHexString("c5c6c6489395b389610c07e696a74908840d5be1"));
+}
+
+void Sha1Benchmark::large() {
+    const Containers::ArrayView<const char> data = _data;
+
+    Sha1::Digest digest;
+    CORRADE_BENCHMARK(1)
+        digest = (Sha1{} << data).digest();
+
+    CORRADE_COMPARE(digest, Sha1::Digest::fromHexString("732ff1006e5905ef784ee784149417089fc91c9c"));
+}
+
+void Sha1Benchmark::throughput() {
+    const Containers::ArrayView<const char> data = _data;
+
+    Sha1::Digest digest;
+    CORRADE_BENCHMARK(1)
+        digest = (Sha1{} << data).digest();
+
+    CORRADE_COMPARE(digest, Sha1::Digest::fromHexString("732ff1006e5905ef784ee784149417089fc91c9c"));
+}
+
+/* 4096 inputs between 16 and 271 bytes */
+constexpr std::size_t BatchSize = 4096;
+
+void Sha1Benchmark::batch() {
+    Containers::ArrayView<const char> data[BatchSize];
+    for(std::size_t i = 0; i != BatchSize; ++i)
+        data[i] = _data.slice(i*240, i*240 + 16 + (i*97) % 256);
+    Sha1::Digest digests[BatchSize];
+
+    CORRADE_BENCHMARK(1)
+        Sha1::digestInto(data, digests);
+
+    CORRADE_COMPARE(digests[BatchSize - 1], Sha1::Digest::fromHexString("ff664d45878753a91950711b8395bdebd7b7d4cf"));
+}
+
+void Sha1Benchmark::batchOneByOne() {
+    Containers::ArrayView<const char> data[BatchSize];
+    for(std::size_t i = 0; i != BatchSize; ++i)
+        data[i] = _data.slice(i*240, i*240 + 16 + (i*97) % 256);
+    Sha1::Digest digests[BatchSize];
+
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            digests[i] = (Sha1{} << data[i]).digest();
+
+    CORRADE_COMPARE(digests[BatchSize - 1], Sha1::Digest::fromHexString("ff664d45878753a91950711b8395bdebd7b7d4cf"));
+}
+
+void Sha1Benchmark::throughputBegin() {
+    _throughputBegin = std::chrono::high_resolution_clock::now();
+}
+
+std::uint64_t Sha1Benchmark::throughputEnd() {
+    const std::uint64_t nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - _throughputBegin).count();
+    return nanoseconds ? LargeSize*1000000000ull/nanoseconds : 0;
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Utility::Test::Sha1Benchmark)
@@ -29,9 +29,12 @@
 #include <algorithm> /* std::min() */
 #endif
 
+#include <sstream>
+
 #include "Corrade/Containers/Array.h"
 #include "Corrade/TestSuite/Tester.h"
 #include "Corrade/Utility/AbstractHash.h"
+#include "Corrade/Utility/DebugStl.h"
 #include "Corrade/Utility/Sha1.h"
 
 namespace Corrade { namespace Utility { namespace Test { namespace {
@@ -44,10 +47,15 @@ struct Sha1Test: TestSuite::Tester {
     void exactOneBlockPadding();
     void twoBlockPadding();
     void zeroInLeftover();
+    void manyBlocks();
 
     void iterative();
     void iterativeSecondEmpty();
     void reuse();
+
+    void batch();
+    void batchEmpty();
+    void batchInvalidOutputSize();
 };
 
 Sha1Test::Sha1Test() {
@@ -55,12 +63,17 @@ Sha1Test::Sha1Test() {
               &Sha1Test::exact64bytes,
               &Sha1Test::exactOneBlockPadding,
               &Sha1Test::twoBlockPadding,
-              &Sha1Test::zeroInLeftover});
+              &Sha1Test::zeroInLeftover,
+              &Sha1Test::manyBlocks});
 
     addRepeatedTests({&Sha1Test::iterative}, 128);
 
     addTests({&Sha1Test::iterativeSecondEmpty,
-              &Sha1Test::reuse});
+              &Sha1Test::reuse,
+
+              &Sha1Test::batch,
+              &Sha1Test::batchEmpty,
+              &Sha1Test::batchInvalidOutputSize});
 }
 
 void Sha1Test::emptyString() {
@@ -92,6 +105,26 @@ void Sha1Test::zeroInLeftover() {
         Sha1::Digest::fromHexString("5fdc3d8c862c3c3f86735c536824aee668f89967"));
 }
 
+void Sha1Test::manyBlocks() {
+    /* Large enough to go through the whole-chunk loop in all
+       implementations, with a size that isn't a multiple of 64 */
+    Containers::Array<char> array{NoInit, 1000003};
+    for(std::size_t i = 0; i != array.size(); ++i)
+        array[i] = char(i*37 + (i >> 8));
+    const Containers::ArrayView<const char> data = array;
+
+    CORRADE_COMPARE((Sha1{} << data).digest(),
+        Sha1::Digest::fromHexString("7414be4539d7444c360b3dffc05300a36c3c19bc"));
+
+    /* Same when fed in pieces that aren't aligned to chunk boundaries */
+    Sha1 sha;
+    sha << data.prefix(1);
+    sha << data.slice(1, 100000);
+    sha << data.suffix(100000);
+    CORRADE_COMPARE(sha.digest(),
+        Sha1::Digest::fromHexString("7414be4539d7444c360b3dffc05300a36c3c19bc"));
+}
+
 constexpr const char Data[] =
     "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do "
     "eiusmod tempor incididunt ut labore et dolore magna aliqua. Ut enim "
@@ -133,6 +166,51 @@ void Sha1Test::reuse() {
     CORRADE_COMPARE(hasher.digest(), Sha1::Digest::fromHexString("cd36b370758a259b34845084a6cc38473cb95e27"));
 }
 
+void Sha1Test::batch() {
+    Containers::Array<char> array{NoInit, 200000};
+    for(std::size_t i = 0; i != array.size(); ++i)
+        array[i] = char(i*37 + (i >> 8));
+
+    /* Sizes around all padding boundaries, interleaved with a few large
+       inputs and an odd total count so there are partially filled lanes */
+    Containers::ArrayView<const char> data[301];
+    for(std::size_t i = 0; i != 300; ++i)
+        data[i] = array.slice(i, i + (i % 3 == 1 ? 5000*(i % 7) : i));
+    data[300] = array;
+
+    const Containers::Array<Sha1::Digest> digests = Sha1::digest(data);
+    CORRADE_COMPARE(digests.size(), 301);
+    for(std::size_t i = 0; i != 301; ++i) {
+        CORRADE_ITERATION(i << Debug::nospace << ":" << data[i].size());
+        CORRADE_COMPARE(digests[i], (Sha1{} << data[i]).digest());
+    }
+}
+
+void Sha1Test::batchEmpty() {
+    CORRADE_COMPARE(Sha1::digest(Containers::ArrayView<const Containers::ArrayView<const char>>{}).size(), 0);
+
+    /* Empty inputs, on the other hand, give a regular empty digest */
+    const Containers::ArrayView<const char> data[2]{};
+    Sha1::Digest digests[2];
+    Sha1::digestInto(data, digests);
+    CORRADE_COMPARE(digests[0], Sha1::Digest::fromHexString("da39a3ee5e6b4b0d3255bfef95601890afd80709"));
+    CORRADE_COMPARE(digests[1], Sha1::Digest::fromHexString("da39a3ee5e6b4b0d3255bfef95601890afd80709"));
+}
+
+void Sha1Test::batchInvalidOutputSize() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const Containers::ArrayView<const char> data[3]{};
+    Sha1::Digest digests[2];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Sha1::digestInto(data, digests);
+    CORRADE_COMPARE(out.str(), "Utility::Sha1::digestInto(): expected output view size to be 3 but got 2\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Corrade::Utility::Test::Sha1Test)
@@ -0,0 +1,130 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2019 Jonathan Hale <squareys@googlemail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <chrono>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/MurmurHash2.h"
+#include "Corrade/Utility/XxHash3.h"
+
+namespace Corrade { namespace Utility { namespace Test { namespace {
+
+struct XxHash3Benchmark: TestSuite::Tester {
+    explicit XxHash3Benchmark();
+
+    void shortKeys();
+    void shortKeysMurmurHash2();
+    void large();
+    void largeMurmurHash2();
+    void throughput();
+
+    void throughputBegin();
+    std::uint64_t throughputEnd();
+
+    private:
+        Containers::Array<char> _data;
+        std::chrono::high_resolution_clock::time_point _throughputBegin;
+};
+
+constexpr std::size_t LargeSize = 1024*1024;
+
+XxHash3Benchmark::XxHash3Benchmark(): _data{NoInit, LargeSize} {
+    for(std::size_t i = 0; i != _data.size(); ++i)
+        _data[i] = char(i*37 + (i >> 8));
+
+    addBenchmarks({&XxHash3Benchmark::shortKeys,
+                   &XxHash3Benchmark::shortKeysMurmurHash2,
+                   &XxHash3Benchmark::large,
+                   &XxHash3Benchmark::largeMurmurHash2}, 10);
+
+    /* Reports bytes hashed per second instead of time, so the "B" in the
+       output is actually B/s */
+    addCustomBenchmarks({&XxHash3Benchmark::throughput}, 10,
+        &XxHash3Benchmark::throughputBegin,
+        &XxHash3Benchmark::throughputEnd,
+        BenchmarkUnits::Bytes);
+}
+
+/* 4096 keys between 4 and 67 bytes, which is what a typical string key in a
+   hash map looks like */
+constexpr std::size_t KeyCount = 4096;
+
+void XxHash3Benchmark::shortKeys() {
+    std::uint64_t hash = 0;
+    CORRADE_BENCHMARK(10)
+        for(std::size_t i = 0; i != KeyCount; ++i)
+            hash += Implementation::xxHash3(_data + i*64, 4 + (i*97) % 64);
+
+    CORRADE_VERIFY(hash);
+}
+
+void XxHash3Benchmark::shortKeysMurmurHash2() {
+    std::uint64_t hash = 0;
+    CORRADE_BENCHMARK(10)
+        for(std::size_t i = 0; i != KeyCount; ++i)
+            hash += Implementation::MurmurHash2<sizeof(std::size_t)>{}(0, _data + i*64, 4 + (i*97) % 64);
+
+    CORRADE_VERIFY(hash);
+}
+
+void XxHash3Benchmark::large() {
+    XxHash3::Digest digest;
+    CORRADE_BENCHMARK(1)
+        digest = XxHash3::digest(_data);
+
+    CORRADE_COMPARE(digest, XxHash3::Digest::fromHexString("d805f322f886d581"));
+}
+
+void XxHash3Benchmark::largeMurmurHash2() {
+    MurmurHash2::Digest digest;
+    CORRADE_BENCHMARK(1)
+        digest = MurmurHash2{}(_data, _data.size());
+
+    CORRADE_VERIFY(digest != MurmurHash2::Digest{});
+}
+
+void XxHash3Benchmark::throughput() {
+    XxHash3::Digest digest;
+    CORRADE_BENCHMARK(1)
+        digest = XxHash3::digest(_data);
+
+    CORRADE_COMPARE(digest, XxHash3::Digest::fromHexString("d805f322f886d581"));
+}
+
+void XxHash3Benchmark::throughputBegin() {
+    _throughputBegin = std::chrono::high_resolution_clock::now();
+}
+
+std::uint64_t XxHash3Benchmark::throughputEnd() {
+    const std::uint64_t nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - _throughputBegin).count();
+    return nanoseconds ? LargeSize*1000000000ull/nanoseconds : 0;
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Utility::Test::XxHash3Benchmark)
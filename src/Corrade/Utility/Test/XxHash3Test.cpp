@@ -0,0 +1,201 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2019 Jonathan Hale <squareys@googlemail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <string>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/AbstractHash.h"
+#include "Corrade/Utility/XxHash3.h"
+
+namespace Corrade { namespace Utility { namespace Test { namespace {
+
+struct XxHash3Test: TestSuite::Tester {
+    explicit XxHash3Test();
+
+    void digest();
+    void digestSeed();
+    void iterative();
+    void iterativeEmpty();
+    void reuse();
+    void overloads();
+    void integer();
+
+    private:
+        Containers::Array<char> _data;
+};
+
+/* Reference values calculated with the xxhash Python module, with the data
+   generated the same way as below */
+constexpr struct {
+    std::size_t size;
+    const char* digest;
+    const char* digestSeed;
+} DigestData[]{
+    {0, "2d06800538d394c2", "b5991a1202758c1d"},
+    {1, "c44bdff4074eecdb", "446f0cb058c57375"},
+    {3, "2b15aa0b3d075427", "6649788775ae5d2a"},
+    {4, "e41090fa396e2123", "24d08ad979165367"},
+    {8, "44db4d702e7af307", "418b82e8fd06cf29"},
+    {9, "699d61966d226a40", "fc0e92e4aa47f032"},
+    {16, "79e8aab409bf708c", "2756919379813795"},
+    {17, "eab8a05663e5e451", "661bacdc79bc3fa6"},
+    {32, "714a8d2cefe994d1", "509650d09da02e7a"},
+    {33, "8c7dd4127bbd9fb2", "aecf3340585137dc"},
+    {64, "895f676d4bce2e93", "02b37f645a6ea162"},
+    {65, "689fd8c3930f8e4d", "6978ed21165ac067"},
+    {96, "f95fac39833aa3c8", "17ed1abdca9ffffc"},
+    {97, "571b928f918186ea", "f5086f1c8017ae05"},
+    {128, "d0c5f5cbbce75e08", "e9259ca500e53f8e"},
+    {129, "b983f428e1f4b8cd", "f921ba97c66e6442"},
+    {240, "97ca2e159ebf5174", "fd6d831602c900a5"},
+    {241, "8a70955e58ec2034", "63fe6546d76cf5f9"},
+    {1024, "4adcaceb384e2d8b", "638897bed1160269"},
+    {1025, "2d9efb2b7fcbbb3a", "4dde2da8033f5f15"},
+    {2048, "1593b55e2530d3c4", "c5c63828c8baa4dd"},
+    {100000, "5e07b21924d3737a", "305ae5e6de4f9fa3"}
+};
+
+constexpr std::uint64_t Seed = 0x1234567890abcdefull;
+
+/* Piece sizes used to feed the streaming interface, crossing the internal
+   256-byte buffer, stripe and 1024-byte block boundaries in various ways */
+constexpr std::size_t IterativeData[]{1, 7, 63, 64, 65, 255, 256, 257, 1023, 4096};
+
+XxHash3Test::XxHash3Test(): _data{NoInit, 100000} {
+    for(std::size_t i = 0; i != _data.size(); ++i)
+        _data[i] = char(i*37 + (i >> 8));
+
+    addInstancedTests({&XxHash3Test::digest,
+                       &XxHash3Test::digestSeed},
+        Containers::arraySize(DigestData));
+
+    addInstancedTests({&XxHash3Test::iterative},
+        Containers::arraySize(IterativeData));
+
+    addTests({&XxHash3Test::iterativeEmpty,
+              &XxHash3Test::reuse,
+              &XxHash3Test::overloads,
+              &XxHash3Test::integer});
+}
+
+void XxHash3Test::digest() {
+    auto&& data = DigestData[testCaseInstanceId()];
+    setTestCaseDescription(std::to_string(data.size));
+
+    const Containers::ArrayView<const char> view = _data.prefix(data.size);
+    CORRADE_COMPARE(XxHash3::digest(view),
+        XxHash3::Digest::fromHexString(data.digest));
+    CORRADE_COMPARE((XxHash3{} << view).digest(),
+        XxHash3::Digest::fromHexString(data.digest));
+}
+
+void XxHash3Test::digestSeed() {
+    auto&& data = DigestData[testCaseInstanceId()];
+    setTestCaseDescription(std::to_string(data.size));
+
+    const Containers::ArrayView<const char> view = _data.prefix(data.size);
+    CORRADE_COMPARE((XxHash3{Seed} << view).digest(),
+        XxHash3::Digest::fromHexString(data.digestSeed));
+}
+
+void XxHash3Test::iterative() {
+    const std::size_t pieceSize = IterativeData[testCaseInstanceId()];
+    setTestCaseDescription(std::to_string(pieceSize));
+
+    for(std::size_t size: {std::size_t{240}, std::size_t{241}, std::size_t{1025}, std::size_t{100000}}) {
+        CORRADE_ITERATION(size);
+
+        const char* expected{};
+        const char* expectedSeed{};
+        for(auto&& i: DigestData) if(i.size == size) {
+            expected = i.digest;
+            expectedSeed = i.digestSeed;
+        }
+
+        XxHash3 hasher, hasherSeed{Seed};
+        for(std::size_t offset = 0; offset < size; offset += pieceSize) {
+            const Containers::ArrayView<const char> piece = _data.slice(offset, std::min(offset + pieceSize, size));
+            hasher << piece;
+            hasherSeed << piece;
+        }
+
+        CORRADE_COMPARE(hasher.digest(),
+            XxHash3::Digest::fromHexString(expected));
+        CORRADE_COMPARE(hasherSeed.digest(),
+            XxHash3::Digest::fromHexString(expectedSeed));
+    }
+}
+
+void XxHash3Test::iterativeEmpty() {
+    const Containers::ArrayView<const char> data = _data;
+
+    XxHash3 hasher;
+    hasher << data.prefix(300);
+    hasher << Containers::ArrayView<const char>{};
+    hasher << data.slice(300, 1025);
+    CORRADE_COMPARE(hasher.digest(),
+        XxHash3::Digest::fromHexString("2d9efb2b7fcbbb3a"));
+}
+
+void XxHash3Test::reuse() {
+    const Containers::ArrayView<const char> data = _data;
+
+    XxHash3 hasher{Seed};
+    hasher << data.prefix(2048);
+    CORRADE_COMPARE(hasher.digest(),
+        XxHash3::Digest::fromHexString("c5c63828c8baa4dd"));
+
+    /* The state is reset after digest, but the seed stays */
+    CORRADE_COMPARE(hasher.seed(), Seed);
+    hasher << data.prefix(17);
+    CORRADE_COMPARE(hasher.digest(),
+        XxHash3::Digest::fromHexString("661bacdc79bc3fa6"));
+}
+
+void XxHash3Test::overloads() {
+    /* All should give the same value */
+    CORRADE_COMPARE(XxHash3::digest("hello"),
+        XxHash3::Digest::fromHexString("9555e8555c62dcfd"));
+    CORRADE_COMPARE(XxHash3::digest(std::string{"hello"}),
+        XxHash3::Digest::fromHexString("9555e8555c62dcfd"));
+    CORRADE_COMPARE(XxHash3::digest(Containers::ArrayView<const char>{"hello", 5}),
+        XxHash3::Digest::fromHexString("9555e8555c62dcfd"));
+    CORRADE_COMPARE((XxHash3{} << std::string{"hello"}).digest(),
+        XxHash3::Digest::fromHexString("9555e8555c62dcfd"));
+}
+
+void XxHash3Test::integer() {
+    /* The digest is the integer hash in big endian */
+    CORRADE_COMPARE(Implementation::xxHash3("hello", 5), 0x9555e8555c62dcfdull);
+    CORRADE_COMPARE(Implementation::xxHash3(_data, 1025, Seed), 0x4dde2da8033f5f15ull);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Utility::Test::XxHash3Test)
@@ -59,10 +59,12 @@ class Fatal;
 
 /* Endianness used only statically */
 class MurmurHash2;
+class MurmurHash2A;
 
 class Resource;
 class Sha1;
 class Translator;
+class XxHash3;
 
 #if defined(DOXYGEN_GENERATING_OUTPUT) || defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT)) || defined(CORRADE_TARGET_EMSCRIPTEN)
 /* Tweakable doesn't need forward declaration */
@@ -0,0 +1,555 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "XxHash3.h"
+
+#include <cstring>
+#include <string>
+
+#include "Corrade/Containers/ArrayView.h"
+#include "Corrade/Utility/Endianness.h"
+#include "Corrade/Utility/Implementation/cpu.h"
+
+#ifdef CORRADE_TARGET_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef CORRADE_ENABLE_AVX2
+#include <immintrin.h>
+#endif
+#if defined(CORRADE_TARGET_MSVC) && !defined(__SIZEOF_INT128__) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace Corrade { namespace Utility {
+
+namespace {
+
+constexpr std::uint64_t Prime32_1 = 0x9e3779b1u;
+constexpr std::uint64_t Prime32_2 = 0x85ebca77u;
+constexpr std::uint64_t Prime32_3 = 0xc2b2ae3du;
+constexpr std::uint64_t Prime64_1 = 0x9e3779b185ebca87ull;
+constexpr std::uint64_t Prime64_2 = 0xc2b2ae3d27d4eb4full;
+constexpr std::uint64_t Prime64_3 = 0x165667b19e3779f9ull;
+constexpr std::uint64_t Prime64_4 = 0x85ebca77c2b2ae63ull;
+constexpr std::uint64_t Prime64_5 = 0x27d4eb2f165667c5ull;
+
+/* Input is consumed in 64-byte stripes, each going through a different part
+   of the secret, offset by 8 bytes. After 16 stripes (a block) the whole
+   secret is used and the accumulators get scrambled. */
+constexpr std::size_t StripeSize = 64;
+constexpr std::size_t SecretSize = 192;
+constexpr std::size_t SecretLimit = SecretSize - StripeSize;
+constexpr std::size_t StripesPerBlock = SecretLimit/8;
+constexpr std::size_t BlockSize = StripesPerBlock*StripeSize;
+/* Inputs up to this size are hashed with dedicated code paths */
+constexpr std::size_t MidSizeMax = 240;
+
+alignas(64) constexpr const char DefaultSecret[SecretSize]{
+    '\xb8', '\xfe', '\x6c', '\x39', '\x23', '\xa4', '\x4b', '\xbe', '\x7c', '\x01', '\x81', '\x2c', '\xf7', '\x21', '\xad', '\x1c',
+    '\xde', '\xd4', '\x6d', '\xe9', '\x83', '\x90', '\x97', '\xdb', '\x72', '\x40', '\xa4', '\xa4', '\xb7', '\xb3', '\x67', '\x1f',
+    '\xcb', '\x79', '\xe6', '\x4e', '\xcc', '\xc0', '\xe5', '\x78', '\x82', '\x5a', '\xd0', '\x7d', '\xcc', '\xff', '\x72', '\x21',
+    '\xb8', '\x08', '\x46', '\x74', '\xf7', '\x43', '\x24', '\x8e', '\xe0', '\x35', '\x90', '\xe6', '\x81', '\x3a', '\x26', '\x4c',
+    '\x3c', '\x28', '\x52', '\xbb', '\x91', '\xc3', '\x00', '\xcb', '\x88', '\xd0', '\x65', '\x8b', '\x1b', '\x53', '\x2e', '\xa3',
+    '\x71', '\x64', '\x48', '\x97', '\xa2', '\x0d', '\xf9', '\x4e', '\x38', '\x19', '\xef', '\x46', '\xa9', '\xde', '\xac', '\xd8',
+    '\xa8', '\xfa', '\x76', '\x3f', '\xe3', '\x9c', '\x34', '\x3f', '\xf9', '\xdc', '\xbb', '\xc7', '\xc7', '\x0b', '\x4f', '\x1d',
+    '\x8a', '\x51', '\xe0', '\x4b', '\xcd', '\xb4', '\x59', '\x31', '\xc8', '\x9f', '\x7e', '\xc9', '\xd9', '\x78', '\x73', '\x64',
+    '\xea', '\xc5', '\xac', '\x83', '\x34', '\xd3', '\xeb', '\xc3', '\xc5', '\x81', '\xa0', '\xff', '\xfa', '\x13', '\x63', '\xeb',
+    '\x17', '\x0d', '\xdd', '\x51', '\xb7', '\xf0', '\xda', '\x49', '\xd3', '\x16', '\x55', '\x26', '\x29', '\xd4', '\x68', '\x9e',
+    '\x2b', '\x16', '\xbe', '\x58', '\x7d', '\x47', '\xa1', '\xfc', '\x8f', '\xf8', '\xb8', '\xd1', '\x7a', '\xd0', '\x31', '\xce',
+    '\x45', '\xcb', '\x3a', '\x8f', '\x95', '\x16', '\x04', '\x28', '\xaf', '\xd7', '\xfb', '\xca', '\xbb', '\x4b', '\x40', '\x7e'
+};
+
+/* The data have no alignment guarantees and are little endian */
+inline std::uint32_t read32(const char* const data) {
+    std::uint32_t value;
+    std::memcpy(&value, data, 4);
+    return Endianness::littleEndian(value);
+}
+
+inline std::uint64_t read64(const char* const data) {
+    std::uint64_t value;
+    std::memcpy(&value, data, 8);
+    return Endianness::littleEndian(value);
+}
+
+inline void write64(char* const data, const std::uint64_t value) {
+    const std::uint64_t littleEndian = Endianness::littleEndian(value);
+    std::memcpy(data, &littleEndian, 8);
+}
+
+inline std::uint32_t byteSwap(const std::uint32_t value) {
+    return Endianness::swap(value);
+}
+
+inline std::uint64_t byteSwap(const std::uint64_t value) {
+    return Endianness::swap(value);
+}
+
+inline std::uint64_t rotateLeft(const std::uint64_t value, const int shift) {
+    return value << shift | value >> (64 - shift);
+}
+
+/* Full 64x64 -> 128 multiplication with the two halves xored together */
+inline std::uint64_t multiplyFold(const std::uint64_t a, const std::uint64_t b) {
+    #ifdef __SIZEOF_INT128__
+    /* __extension__ silences -Wpedantic about the non-standard type */
+    __extension__ typedef unsigned __int128 UnsignedInt128;
+    const UnsignedInt128 product = UnsignedInt128(a)*b;
+    return std::uint64_t(product) ^ std::uint64_t(product >> 64);
+    #elif defined(CORRADE_TARGET_MSVC) && defined(_M_X64)
+    std::uint64_t high;
+    const std::uint64_t low = _umul128(a, b, &high);
+    return low ^ high;
+    #else
+    const std::uint64_t lowLow = (a & 0xffffffffull)*(b & 0xffffffffull);
+    const std::uint64_t highLow = (a >> 32)*(b & 0xffffffffull);
+    const std::uint64_t lowHigh = (a & 0xffffffffull)*(b >> 32);
+    const std::uint64_t highHigh = (a >> 32)*(b >> 32);
+    const std::uint64_t cross = (lowLow >> 32) + (highLow & 0xffffffffull) + lowHigh;
+    const std::uint64_t high = (highLow >> 32) + (cross >> 32) + highHigh;
+    const std::uint64_t low = (cross << 32) | (lowLow & 0xffffffffull);
+    return low ^ high;
+    #endif
+}
+
+std::uint64_t avalanche(std::uint64_t h) {
+    h ^= h >> 37;
+    h *= 0x165667919e3779f9ull;
+    h ^= h >> 32;
+    return h;
+}
+
+/* Finalizer from XXH64, used for inputs of 1 to 3 bytes */
+std::uint64_t avalancheXxh64(std::uint64_t h) {
+    h ^= h >> 33;
+    h *= Prime64_2;
+    h ^= h >> 29;
+    h *= Prime64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+/* Stronger finalizer used for inputs of 4 to 8 bytes */
+std::uint64_t rrmxmx(std::uint64_t h, const std::uint64_t size) {
+    h ^= rotateLeft(h, 49) ^ rotateLeft(h, 24);
+    h *= 0x9fb21c651e98df25ull;
+    h ^= (h >> 35) + size;
+    h *= 0x9fb21c651e98df25ull;
+    h ^= h >> 28;
+    return h;
+}
+
+std::uint64_t mix16(const char* const data, const char* const secret, const std::uint64_t seed) {
+    return multiplyFold(read64(data) ^ (read64(secret) + seed),
+                        read64(data + 8) ^ (read64(secret + 8) - seed));
+}
+
+std::uint64_t hash0To16(const char* const data, const std::size_t size, const char* const secret, std::uint64_t seed) {
+    if(size > 8) {
+        const std::uint64_t flipLow = (read64(secret + 24) ^ read64(secret + 32)) + seed;
+        const std::uint64_t flipHigh = (read64(secret + 40) ^ read64(secret + 48)) - seed;
+        const std::uint64_t low = read64(data) ^ flipLow;
+        const std::uint64_t high = read64(data + size - 8) ^ flipHigh;
+        return avalanche(size + byteSwap(low) + high + multiplyFold(low, high));
+    }
+
+    if(size >= 4) {
+        seed ^= std::uint64_t(byteSwap(std::uint32_t(seed))) << 32;
+        const std::uint64_t flip = (read64(secret + 8) ^ read64(secret + 16)) - seed;
+        const std::uint64_t value = read32(data + size - 4) + (std::uint64_t(read32(data)) << 32);
+        return rrmxmx(value ^ flip, size);
+    }
+
+    if(size) {
+        const std::uint32_t combined =
+            std::uint32_t(std::uint8_t(data[0])) << 16 |
+            std::uint32_t(std::uint8_t(data[size >> 1])) << 24 |
+            std::uint32_t(std::uint8_t(data[size - 1])) |
+            std::uint32_t(size) << 8;
+        const std::uint64_t flip = (read32(secret) ^ read32(secret + 4)) + seed;
+        return avalancheXxh64(combined ^ flip);
+    }
+
+    return avalancheXxh64(seed ^ read64(secret + 56) ^ read64(secret + 64));
+}
+
+std::uint64_t hash17To128(const char* const data, const std::size_t size, const char* const secret, const std::uint64_t seed) {
+    std::uint64_t acc = size*Prime64_1;
+    if(size > 32) {
+        if(size > 64) {
+            if(size > 96) {
+                acc += mix16(data + 48, secret + 96, seed);
+                acc += mix16(data + size - 64, secret + 112, seed);
+            }
+            acc += mix16(data + 32, secret + 64, seed);
+            acc += mix16(data + size - 48, secret + 80, seed);
+        }
+        acc += mix16(data + 16, secret + 32, seed);
+        acc += mix16(data + size - 32, secret + 48, seed);
+    }
+    acc += mix16(data, secret, seed);
+    acc += mix16(data + size - 16, secret + 16, seed);
+    return avalanche(acc);
+}
+
+std::uint64_t hash129To240(const char* const data, const std::size_t size, const char* const secret, const std::uint64_t seed) {
+    std::uint64_t acc = size*Prime64_1;
+    for(std::size_t i = 0; i != 8; ++i)
+        acc += mix16(data + 16*i, secret + 16*i, seed);
+    acc = avalanche(acc);
+
+    /* The remaining 16-byte pieces use the secret again, shifted by a few
+       bytes, the last piece ends at the end of the minimal secret size */
+    const std::size_t rounds = size/16;
+    for(std::size_t i = 8; i < rounds; ++i)
+        acc += mix16(data + 16*i, secret + 16*(i - 8) + 3, seed);
+    acc += mix16(data + size - 16, secret + 136 - 17, seed);
+    return avalanche(acc);
+}
+
+/* Accumulates given count of 64-byte stripes, each with the secret advanced
+   by 8 bytes. SSE2 is always available on x86-64, so the scalar variant is
+   needed only elsewhere. */
+#ifndef CORRADE_TARGET_SSE2
+void accumulateScalar(std::uint64_t* const accumulators, const char* data, const char* secret, std::size_t count) {
+    for(; count; --count, data += StripeSize, secret += 8) {
+        for(std::size_t i = 0; i != 8; ++i) {
+            const std::uint64_t value = read64(data + 8*i);
+            const std::uint64_t key = value ^ read64(secret + 8*i);
+            accumulators[i ^ 1] += value;
+            accumulators[i] += (key & 0xffffffffull)*(key >> 32);
+        }
+    }
+}
+
+void scrambleScalar(std::uint64_t* const accumulators, const char* const secret) {
+    for(std::size_t i = 0; i != 8; ++i) {
+        std::uint64_t acc = accumulators[i];
+        acc ^= acc >> 47;
+        acc ^= read64(secret + 8*i);
+        acc *= Prime32_1;
+        accumulators[i] = acc;
+    }
+}
+#endif
+
+/* The SIMD variants do the same as above, with the 32x32 -> 64 multiply done
+   by PMULUDQ on the low halves and the swap of neighboring values with a
+   shuffle */
+#ifdef CORRADE_TARGET_SSE2
+void accumulateSse2(std::uint64_t* const accumulators, const char* data, const char* secret, std::size_t count) {
+    __m128i acc[4];
+    for(std::size_t i = 0; i != 4; ++i)
+        acc[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(accumulators) + i);
+
+    for(; count; --count, data += StripeSize, secret += 8) {
+        for(std::size_t i = 0; i != 4; ++i) {
+            const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data) + i);
+            const __m128i key = _mm_xor_si128(value, _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret) + i));
+            const __m128i product = _mm_mul_epu32(key, _mm_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1)));
+            const __m128i swapped = _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+            acc[i] = _mm_add_epi64(acc[i], _mm_add_epi64(product, swapped));
+        }
+    }
+
+    for(std::size_t i = 0; i != 4; ++i)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(accumulators) + i, acc[i]);
+}
+
+void scrambleSse2(std::uint64_t* const accumulators, const char* const secret) {
+    const __m128i prime = _mm_set1_epi32(int(Prime32_1));
+    for(std::size_t i = 0; i != 4; ++i) {
+        __m128i acc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(accumulators) + i);
+        acc = _mm_xor_si128(acc, _mm_srli_epi64(acc, 47));
+        acc = _mm_xor_si128(acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret) + i));
+        /* 64x32 multiplication split into two 32x32 ones */
+        const __m128i low = _mm_mul_epu32(acc, prime);
+        const __m128i high = _mm_mul_epu32(_mm_shuffle_epi32(acc, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(accumulators) + i, _mm_add_epi64(low, _mm_slli_epi64(high, 32)));
+    }
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX2
+CORRADE_ENABLE_AVX2 void accumulateAvx2(std::uint64_t* const accumulators, const char* data, const char* secret, std::size_t count) {
+    __m256i acc[2];
+    for(std::size_t i = 0; i != 2; ++i)
+        acc[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(accumulators) + i);
+
+    for(; count; --count, data += StripeSize, secret += 8) {
+        for(std::size_t i = 0; i != 2; ++i) {
+            const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data) + i);
+            const __m256i key = _mm256_xor_si256(value, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(secret) + i));
+            const __m256i product = _mm256_mul_epu32(key, _mm256_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1)));
+            const __m256i swapped = _mm256_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+            acc[i] = _mm256_add_epi64(acc[i], _mm256_add_epi64(product, swapped));
+        }
+    }
+
+    for(std::size_t i = 0; i != 2; ++i)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(accumulators) + i, acc[i]);
+}
+
+CORRADE_ENABLE_AVX2 void scrambleAvx2(std::uint64_t* const accumulators, const char* const secret) {
+    const __m256i prime = _mm256_set1_epi32(int(Prime32_1));
+    for(std::size_t i = 0; i != 2; ++i) {
+        __m256i acc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(accumulators) + i);
+        acc = _mm256_xor_si256(acc, _mm256_srli_epi64(acc, 47));
+        acc = _mm256_xor_si256(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(secret) + i));
+        /* 64x32 multiplication split into two 32x32 ones */
+        const __m256i low = _mm256_mul_epu32(acc, prime);
+        const __m256i high = _mm256_mul_epu32(_mm256_shuffle_epi32(acc, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(accumulators) + i, _mm256_add_epi64(low, _mm256_slli_epi64(high, 32)));
+    }
+}
+#endif
+
+typedef void(*AccumulateImplementation)(std::uint64_t*, const char*, const char*, std::size_t);
+typedef void(*ScrambleImplementation)(std::uint64_t*, const char*);
+
+struct Implementations {
+    AccumulateImplementation accumulate;
+    ScrambleImplementation scramble;
+};
+
+Implementations implementationsForCpu() {
+    #ifdef CORRADE_ENABLE_AVX2
+    if(Implementation::cpuFeatures() & Implementation::CpuAvx2)
+        return {accumulateAvx2, scrambleAvx2};
+    #endif
+    #ifdef CORRADE_TARGET_SSE2
+    return {accumulateSse2, scrambleSse2};
+    #else
+    return {accumulateScalar, scrambleScalar};
+    #endif
+}
+
+/* Picks the best implementation for the current CPU on the first call */
+const Implementations& implementations() {
+    static const Implementations implementations = implementationsForCpu();
+    return implementations;
+}
+
+/* Accumulates given count of stripes, continuing from stripeCount stripes
+   already processed in the current block and scrambling at the end of each
+   block. Returns pointer after the last stripe. */
+const char* consumeStripes(const Implementations& implementation, std::uint64_t* const accumulators, std::size_t& stripeCount, const char* data, std::size_t count, const char* const secret) {
+    while(count) {
+        const std::size_t stripes = StripesPerBlock - stripeCount < count ? StripesPerBlock - stripeCount : count;
+        implementation.accumulate(accumulators, data, secret + stripeCount*8, stripes);
+        data += stripes*StripeSize;
+        count -= stripes;
+        stripeCount += stripes;
+        if(stripeCount == StripesPerBlock) {
+            implementation.scramble(accumulators, secret + SecretLimit);
+            stripeCount = 0;
+        }
+    }
+
+    return data;
+}
+
+void initializeAccumulators(std::uint64_t* const accumulators) {
+    accumulators[0] = Prime32_3;
+    accumulators[1] = Prime64_1;
+    accumulators[2] = Prime64_2;
+    accumulators[3] = Prime64_3;
+    accumulators[4] = Prime64_4;
+    accumulators[5] = Prime32_2;
+    accumulators[6] = Prime64_5;
+    accumulators[7] = Prime32_1;
+}
+
+std::uint64_t mergeAccumulators(const std::uint64_t* const accumulators, const char* const secret, const std::uint64_t start) {
+    std::uint64_t result = start;
+    for(std::size_t i = 0; i != 4; ++i)
+        result += multiplyFold(accumulators[2*i] ^ read64(secret + 16*i),
+                               accumulators[2*i + 1] ^ read64(secret + 16*i + 8));
+    return avalanche(result);
+}
+
+/* For a non-zero seed, long inputs use a secret derived from it */
+void initializeSecret(char* const secret, const std::uint64_t seed) {
+    for(std::size_t i = 0; i != SecretSize/16; ++i) {
+        write64(secret + 16*i, read64(DefaultSecret + 16*i) + seed);
+        write64(secret + 16*i + 8, read64(DefaultSecret + 16*i + 8) - seed);
+    }
+}
+
+std::uint64_t hashLong(const char* const data, const std::size_t size, const char* const secret) {
+    const Implementations& implementation = implementations();
+
+    std::uint64_t accumulators[8];
+    initializeAccumulators(accumulators);
+
+    /* All whole stripes except the last one, which is processed separately
+       below, overlapping with the previous one if the size isn't a multiple
+       of the stripe size */
+    std::size_t stripeCount = 0;
+    consumeStripes(implementation, accumulators, stripeCount, data, (size - 1)/StripeSize, secret);
+    implementation.accumulate(accumulators, data + size - StripeSize, secret + SecretLimit - 7, 1);
+
+    return mergeAccumulators(accumulators, secret + 11, size*Prime64_1);
+}
+
+std::uint64_t hashShort(const char* const data, const std::size_t size, const std::uint64_t seed) {
+    if(size <= 16) return hash0To16(data, size, DefaultSecret, seed);
+    if(size <= 128) return hash17To128(data, size, DefaultSecret, seed);
+    return hash129To240(data, size, DefaultSecret, seed);
+}
+
+XxHash3::Digest digestFromHash(const std::uint64_t hash) {
+    /* The canonical representation is big endian, same as the reference
+       implementation prints it */
+    const std::uint64_t bigEndian = Endianness::bigEndian(hash);
+    return XxHash3::Digest::fromByteArray(reinterpret_cast<const char*>(&bigEndian));
+}
+
+}
+
+namespace Implementation {
+
+std::uint64_t xxHash3(const char* const data, const std::size_t size, const std::uint64_t seed) {
+    if(size <= MidSizeMax)
+        return hashShort(data, size, seed);
+
+    if(!seed)
+        return hashLong(data, size, DefaultSecret);
+
+    char secret[SecretSize];
+    initializeSecret(secret, seed);
+    return hashLong(data, size, secret);
+}
+
+}
+
+XxHash3::Digest XxHash3::digestInternal(const char* const data, const std::size_t size) {
+    return digestFromHash(Implementation::xxHash3(data, size));
+}
+
+XxHash3::Digest XxHash3::digest(const std::string& data) {
+    return digestInternal(data.data(), data.size());
+}
+
+XxHash3::Digest XxHash3::digest(const Containers::ArrayView<const char> data) {
+    return digestInternal(data.data(), data.size());
+}
+
+XxHash3::XxHash3(const std::uint64_t seed): _seed{seed} {
+    if(seed) initializeSecret(_secret, seed);
+    reset();
+}
+
+void XxHash3::reset() {
+    _dataSize = 0;
+    _bufferSize = 0;
+    _stripeCount = 0;
+    initializeAccumulators(_accumulators);
+}
+
+XxHash3& XxHash3::operator<<(const Containers::ArrayView<const char> data) {
+    /* Apparently memcpy() can't be called with null pointers, even if size is
+       zero */
+    if(data.empty()) return *this;
+
+    const char* const secret = _seed ? _secret : DefaultSecret;
+    const char* i = data.data();
+    const char* const end = data.end();
+    _dataSize += data.size();
+
+    /* Not enough to fill the buffer, try it next time */
+    if(data.size() <= sizeof(_buffer) - _bufferSize) {
+        std::memcpy(_buffer + _bufferSize, i, data.size());
+        _bufferSize += data.size();
+        return *this;
+    }
+
+    const Implementations& implementation = implementations();
+
+    /* Fill the buffer and consume it whole. There's always more data after,
+       so it's not needed for the last stripe. */
+    if(_bufferSize) {
+        const std::size_t size = sizeof(_buffer) - _bufferSize;
+        std::memcpy(_buffer + _bufferSize, i, size);
+        i += size;
+        consumeStripes(implementation, _accumulators, _stripeCount, _buffer, sizeof(_buffer)/StripeSize, secret);
+        _bufferSize = 0;
+    }
+
+    /* Consume stripes directly from the input, keeping at least one byte
+       for the buffer. Save the last consumed stripe at the end of the buffer
+       as digest() may need to read from it if there's less than a stripe
+       left. */
+    if(std::size_t(end - i) > sizeof(_buffer)) {
+        i = consumeStripes(implementation, _accumulators, _stripeCount, i, std::size_t(end - 1 - i)/StripeSize, secret);
+        std::memcpy(_buffer + sizeof(_buffer) - StripeSize, i - StripeSize, StripeSize);
+    }
+
+    /* Buffer the rest */
+    std::memcpy(_buffer, i, end - i);
+    _bufferSize = end - i;
+    return *this;
+}
+
+XxHash3& XxHash3::operator<<(const std::string& data) {
+    return *this << Containers::arrayView(data.data(), data.size());
+}
+
+XxHash3::Digest XxHash3::digest() {
+    std::uint64_t hash;
+
+    /* Short inputs are all in the buffer */
+    if(_dataSize <= MidSizeMax) {
+        hash = hashShort(_buffer, _dataSize, _seed);
+
+    /* Consume whole stripes that are left in the buffer except the last,
+       which is processed separately. If there's less than a stripe, it's
+       taken partially from the previously consumed data. */
+    } else {
+        const Implementations& implementation = implementations();
+        const char* const secret = _seed ? _secret : DefaultSecret;
+
+        const char* lastStripe;
+        char lastStripeStorage[StripeSize];
+        if(_bufferSize >= StripeSize) {
+            consumeStripes(implementation, _accumulators, _stripeCount, _buffer, (_bufferSize - 1)/StripeSize, secret);
+            lastStripe = _buffer + _bufferSize - StripeSize;
+        } else {
+            const std::size_t previousSize = StripeSize - _bufferSize;
+            std::memcpy(lastStripeStorage, _buffer + sizeof(_buffer) - previousSize, previousSize);
+            std::memcpy(lastStripeStorage + previousSize, _buffer, _bufferSize);
+            lastStripe = lastStripeStorage;
+        }
+
+        implementation.accumulate(_accumulators, lastStripe, secret + SecretLimit - 7, 1);
+        hash = mergeAccumulators(_accumulators, secret + 11, _dataSize*Prime64_1);
+    }
+
+    reset();
+    return digestFromHash(hash);
+}
+
+}}
@@ -0,0 +1,138 @@
+#ifndef Corrade_Utility_XxHash3_h
+#define Corrade_Utility_XxHash3_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Utility::XxHash3
+ * @m_since_latest
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Corrade/Containers/Containers.h"
+#include "Corrade/Utility/AbstractHash.h"
+#include "Corrade/Utility/StlForwardString.h"
+#include "Corrade/Utility/visibility.h"
+
+namespace Corrade { namespace Utility {
+
+namespace Implementation {
+    /* Used directly by the hash containers, which need just an integer */
+    CORRADE_UTILITY_EXPORT std::uint64_t xxHash3(const char* data, std::size_t size, std::uint64_t seed = 0);
+}
+
+/**
+@brief XXH3 hash
+@m_since_latest
+
+Implementation of the 64-bit variant of
+[XXH3](https://github.com/Cyan4973/xxHash), based on the algorithm by Yann
+Collet. Unlike @ref MurmurHash2, which consumes 4 or 8 bytes at a time, it
+processes the input in 64-byte stripes with eight independent accumulators,
+using SSE2 or AVX2 if available, with the AVX2 variant picked at runtime if
+supported by the CPU. Short inputs go through dedicated code paths without
+any loops. The output is the same as of the reference implementation, with
+the digest bytes in big endian. It's a non-cryptographic hash, meant for
+fast checksums and hash tables. Example usage:
+
+@snippet Utility.cpp XxHash3-usage
+
+@ref Containers::HashMap uses this hash for string keys.
+*/
+class CORRADE_UTILITY_EXPORT XxHash3: public AbstractHash<8> {
+    public:
+        /**
+         * @brief Digest of given data
+         *
+         * Computes digest using default zero seed. Faster than going
+         * through the incremental interface.
+         */
+        static Digest digest(const std::string& data);
+
+        /** @overload */
+        static Digest digest(Containers::ArrayView<const char> data);
+
+        /**
+         * @overload
+         *
+         * Treats the literal as a string, i.e. without the null terminator.
+         */
+        template<std::size_t size> static Digest digest(const char(&data)[size]) {
+            return digestInternal(data, size - 1);
+        }
+
+        /**
+         * @brief Constructor
+         * @param seed      Seed to initialize the hash
+         */
+        explicit XxHash3(std::uint64_t seed = 0);
+
+        /** @brief Seed the hash was initialized with */
+        std::uint64_t seed() const { return _seed; }
+
+        /** @brief Add data for digesting */
+        XxHash3& operator<<(Containers::ArrayView<const char> data);
+
+        /** @overload */
+        XxHash3& operator<<(const std::string& data);
+
+        /**
+         * @brief @cpp operator<< @ce with C strings is not allowed
+         *
+         * To clarify your intent with handling the @cpp '\0' @ce delimiter,
+         * cast to @ref Containers::ArrayView or @ref std::string instead.
+         */
+        XxHash3& operator<<(const char*) = delete;
+
+        /**
+         * @brief Digest of all added data
+         *
+         * Resets the internal state afterwards, keeping the seed, so the
+         * instance can be reused for another input.
+         */
+        Digest digest();
+
+    private:
+        static Digest digestInternal(const char* data, std::size_t size);
+        CORRADE_UTILITY_LOCAL void reset();
+
+        std::uint64_t _seed;
+        std::uint64_t _dataSize;
+        std::size_t _bufferSize;
+        /* Count of stripes processed in current block */
+        std::size_t _stripeCount;
+        std::uint64_t _accumulators[8];
+        /* Derived from the default secret if the seed is non-zero, unused
+           otherwise */
+        char _secret[192];
+        char _buffer[256];
+};
+
+}}
+
+#endif
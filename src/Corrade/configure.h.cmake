@@ -47,6 +47,7 @@
 #cmakedefine CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
 #cmakedefine CORRADE_TESTSUITE_TARGET_XCTEST
 #cmakedefine CORRADE_UTILITY_USE_ANSI_COLORS
+#cmakedefine CORRADE_UTILITY_USE_THREADS
 
 /* Cherry-picked from https://sourceforge.net/p/predef/wiki/Architectures/.
    Can't detect this stuff directly from CMake because of (for example) macOS